@@ -45,6 +45,14 @@ extern struct freeblock*  _heaplast;    /* Last free block in list */
 
 
 
+/* The heap functions behind malloc and free. An alternative malloc may handle
+** some blocks itself and pass the others to these functions.
+*/
+void* __fastcall__ _heapalloc (unsigned size);
+void __fastcall__ _heapfree (void* block);
+
+
+
 /* End of _heap.h */
 
 #endif
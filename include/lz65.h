@@ -0,0 +1,50 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  lz65.h                                   */
+/*                                                                           */
+/*              Decompression routines for the 'lz65' format                 */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef _LZ65_H
+#define _LZ65_H
+
+/* The lz65 format compresses better than lz4 and is still fast to decode.
+** Data is compressed with the lz65 program from util/lz65. The end of the
+** data is marked in the stream, so the size doesn't need to be known in
+** advance.
+*/
+
+unsigned __fastcall__ decompress_lz65 (const unsigned char* src,
+                                       unsigned char* dst);
+/* Decompresses the source buffer into the destination buffer and returns
+** the size of the decompressed data. This version is small.
+*/
+
+unsigned __fastcall__ decompress_lz65_fast (const unsigned char* src,
+                                            unsigned char* dst);
+/* Same as decompress_lz65, but about 1.7 times as fast and larger. */
+
+/* end of lz65.h */
+#endif
@@ -0,0 +1,80 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  sim65.h                                  */
+/*                                                                           */
+/*                  Benchmark support for the sim65 simulator                */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef _SIM65_H
+#define _SIM65_H
+
+
+
+/* Check for errors */
+#if !defined(__SIM6502__) && !defined(__SIM65C02__)
+#  error This module may only be used when compiling for sim65!
+#endif
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Number of cycles executed by the simulator, a 64 bit number */
+struct sim65_cycles {
+    unsigned long       lo;
+    unsigned long       hi;
+};
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void __fastcall__ sim65_get_cycles (struct sim65_cycles* cycles);
+/* Store the number of cycles executed since the start of the program. */
+
+void __fastcall__ sim65_region_start (const char* name);
+/* Start measuring the cycles spent in the timing region with the given name.
+** A region may be started and stopped any number of times, regions with
+** different names may overlap.
+*/
+
+void __fastcall__ sim65_region_stop (const char* name);
+/* Stop measuring the cycles spent in the timing region with the given name.
+** When the program exits, sim65 prints how often each region ran, and the
+** total and average number of cycles spent in it.
+*/
+
+
+
+/* End of sim65.h */
+#endif
@@ -137,6 +137,11 @@ char* __fastcall__ utoa (unsigned val, char* buf, int radix);
 char* __fastcall__ ltoa (long val, char* buf, int radix);
 char* __fastcall__ ultoa (unsigned long val, char* buf, int radix);
 int __fastcall__ putenv (char* s);
+void __fastcall__ qsort_u8 (void* base, size_t count, size_t size);
+void __fastcall__ qsort_u16 (void* base, size_t count, size_t size);
+/* Sort count elements of the given size by the unsigned char or unsigned int
+** at the start of each element. Faster than qsort with a compare function.
+*/
 #endif
 
 
@@ -0,0 +1,71 @@
+;
+; The cc65 authors, 2026-10-18
+;
+; Number output primitives for printf calls with a constant format. See
+; _pfout.s for the other primitives.
+;
+; int __fastcall__ _pfint (int val);            /* Spec in Y */
+; int __fastcall__ _pfuint (unsigned val);      /* Spec in Y */
+; int __fastcall__ _pfhex (unsigned val);       /* Spec in Y */
+;
+
+        .export         __pfint, __pfuint, __pfhex
+        .import         pfstr, pfspec
+        .import         _itoa, _utoa, _strlower, pushax
+
+; Bits of the conversion spec
+PF_UPPER        = $20           ; Upper case hex digits
+
+.bss
+
+buf:    .res    7               ; Room for "-32768"
+
+.code
+
+; ----------------------------------------------------------------------------
+; Signed decimal
+
+__pfint:
+        sty     pfspec
+        jsr     pushargs
+        jsr     _itoa
+        jmp     pfstr
+
+; ----------------------------------------------------------------------------
+; Unsigned decimal
+
+__pfuint:
+        sty     pfspec
+        jsr     pushargs
+        jsr     _utoa
+        jmp     pfstr
+
+; ----------------------------------------------------------------------------
+; Hex. utoa uses upper case digits.
+
+__pfhex:
+        sty     pfspec
+        jsr     pushargs
+        lda     #16
+        jsr     _utoa
+        lda     pfspec
+        and     #PF_UPPER
+        bne     @L1
+        lda     #<buf
+        ldx     #>buf
+        jsr     _strlower
+@L1:    lda     #<buf
+        ldx     #>buf
+        jmp     pfstr
+
+; ----------------------------------------------------------------------------
+; Push the value in a/x and the buffer, and load the radix for decimal output
+
+pushargs:
+        jsr     pushax
+        lda     #<buf
+        ldx     #>buf
+        jsr     pushax
+        lda     #10
+        ldx     #0
+        rts
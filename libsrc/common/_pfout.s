@@ -0,0 +1,272 @@
+;
+; The cc65 authors, 2026-10-18
+;
+; Output primitives for printf calls with a constant format. The compiler
+; replaces such calls by calls to these routines, so the format is neither
+; parsed at runtime nor is the complete formatter linked.
+;
+; int _pfstdout (void);
+; int __fastcall__ _pftofile (FILE* f);
+; int __fastcall__ _pftobuf (char* buf);
+; int __fastcall__ _pfputs (const char* s);
+; int __fastcall__ _pfputc (char c);
+; int __fastcall__ _pfstr (const char* s);      /* Spec in Y */
+; int __fastcall__ _pfchar (char c);            /* Spec in Y */
+;
+; The field width and flags of a conversion are passed in Y. All routines
+; return the number of characters written so far, or -1 after an error.
+;
+
+        .export         __pfstdout, __pftofile, __pftobuf
+        .export         __pfputs, __pfputc, __pfstr, __pfchar
+        .export         pfstr, pfspec
+        .import         _stdout, _fwrite, _memcpy, _strlen
+        .import         pushax, push1
+        .importzp       ptr1
+
+        .macpack        generic
+
+; Bits of the conversion spec
+PF_WIDTH        = $1F           ; Field width
+PF_ZERO         = $40           ; Pad with zeroes
+PF_LEFT         = $80           ; Left justify
+
+.bss
+
+ccount: .res    2               ; Characters written, or -1
+dest:   .res    2               ; Output file or buffer
+tobuf:  .res    1               ; Output goes to a buffer
+pfspec: .res    1               ; Spec of the current conversion
+sptr:   .res    2               ; String to output
+slen:   .res    2               ; Length of the string
+optr:   .res    2               ; Output buffer for out
+olen:   .res    2               ; Output length for out
+pad:    .res    1               ; Number of pad characters
+cbuf:   .res    1               ; Buffer for %c
+pbuf:   .res    1               ; Buffer for pad and sign characters
+
+.code
+
+; ----------------------------------------------------------------------------
+; Setup the destination
+
+__pfstdout:
+        lda     _stdout
+        ldx     _stdout+1
+__pftofile:
+        ldy     #$00
+        beq     init            ; Branch always
+
+__pftobuf:
+        ldy     #$01
+init:   sta     dest
+        stx     dest+1
+        sty     tobuf
+        sta     ptr1
+        stx     ptr1+1
+        lda     #$00
+        sta     ccount
+        sta     ccount+1
+        tax                     ; Return zero
+        dey
+        bne     @L9             ; Jump if output goes to a file
+        sta     (ptr1),y        ; Terminate the (still empty) string
+@L9:    rts
+
+; ----------------------------------------------------------------------------
+; Characters
+
+__pfputc:
+        ldy     #$00
+__pfchar:
+        sty     pfspec
+        sta     cbuf
+        lda     #$01
+        sta     slen
+        lda     #$00
+        sta     slen+1
+        lda     #<cbuf
+        ldx     #>cbuf
+        jmp     pfconv
+
+; ----------------------------------------------------------------------------
+; Strings. pfstr is also used for numbers; it expects the spec in pfspec.
+
+__pfputs:
+        ldy     #$00
+__pfstr:
+        sty     pfspec
+pfstr:  sta     sptr
+        stx     sptr+1
+        jsr     _strlen
+        sta     slen
+        stx     slen+1
+        lda     sptr
+        ldx     sptr+1
+
+; Output the string in a/x with the length in slen, padded as requested by
+; pfspec.
+
+pfconv: sta     sptr
+        stx     sptr+1
+
+; Calculate the number of pad characters
+
+        lda     pfspec
+        and     #PF_WIDTH
+        ldx     slen+1
+        bne     @NoPad
+        sub     slen
+        bcs     @L1
+@NoPad: lda     #$00
+@L1:    sta     pad
+
+        bit     pfspec
+        bmi     @Left
+        bvc     @Right
+
+; Pad with zeroes. A sign goes in front of them.
+
+        lda     sptr
+        sta     ptr1
+        lda     sptr+1
+        sta     ptr1+1
+        ldy     #$00
+        lda     (ptr1),y
+        cmp     #'-'
+        bne     @Zero
+        jsr     outc
+        inc     sptr
+        bne     @L2
+        inc     sptr+1
+@L2:    lda     slen
+        bne     @L3
+        dec     slen+1
+@L3:    dec     slen
+@Zero:  lda     #'0'
+        jsr     padout
+        jmp     outstr
+
+; Right justify
+
+@Right: lda     #' '
+        jsr     padout
+        jmp     outstr
+
+; Left justify
+
+@Left:  jsr     outstr
+        lda     #' '
+        jsr     padout
+        jmp     retcnt
+
+; Output the character in a pad times
+
+padout: sta     pbuf
+@L1:    lda     pad
+        beq     @L9
+        dec     pad
+        lda     pbuf
+        jsr     outc
+        jmp     @L1
+@L9:    rts
+
+; ----------------------------------------------------------------------------
+; Output the character in a
+
+outc:   sta     pbuf
+        lda     #$01
+        sta     olen
+        lda     #$00
+        sta     olen+1
+        lda     #<pbuf
+        ldx     #>pbuf
+        jmp     out
+
+; Output the string in sptr/slen
+
+outstr: lda     slen
+        sta     olen
+        lda     slen+1
+        sta     olen+1
+        lda     sptr
+        ldx     sptr+1
+
+; Output olen characters from the buffer in a/x
+
+out:    sta     optr
+        stx     optr+1
+        lda     olen
+        ora     olen+1
+        bne     @L1
+        jmp     retcnt          ; Nothing to output
+@L1:    lda     tobuf
+        bne     @Buf
+
+; Write to the file: fwrite (optr, 1, olen, dest)
+
+        lda     optr
+        ldx     optr+1
+        jsr     pushax
+        jsr     push1
+        lda     olen
+        ldx     olen+1
+        jsr     pushax
+        lda     dest
+        ldx     dest+1
+        jsr     _fwrite
+        cpx     #$00
+        bne     addcnt
+        cmp     #$00
+        bne     addcnt
+
+; We had an error. Store -1 into ccount
+
+        lda     #<-1
+        sta     ccount
+        sta     ccount+1
+        bne     retcnt          ; Branch always
+
+; Copy to the buffer: memcpy (dest, optr, olen)
+
+@Buf:   lda     dest
+        ldx     dest+1
+        jsr     pushax
+        lda     optr
+        ldx     optr+1
+        jsr     pushax
+        lda     olen
+        ldx     olen+1
+        jsr     _memcpy
+
+; Advance the buffer pointer and terminate the string
+
+        lda     dest
+        add     olen
+        sta     dest
+        sta     ptr1
+        lda     dest+1
+        adc     olen+1
+        sta     dest+1
+        sta     ptr1+1
+        ldy     #$00
+        tya
+        sta     (ptr1),y
+        lda     olen
+        ldx     olen+1
+
+; Add the number of characters in a/x to ccount, unless there was an error
+
+addcnt: bit     ccount+1
+        bmi     retcnt
+        add     ccount
+        sta     ccount
+        txa
+        adc     ccount+1
+        sta     ccount+1
+
+; Return the character count
+
+retcnt: lda     ccount
+        ldx     ccount+1
+        rts
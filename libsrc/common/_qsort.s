@@ -0,0 +1,524 @@
+;
+; The cc65 authors, 2026-10-18
+;
+; Together with qsort.s, this replaces qsort.c (1998.12.09, Ullrich von
+; Bassewitz; 2015-06-21, Greg King).
+;
+; Sorting core shared by qsort, qsort_u8 and qsort_u16.
+;
+; Quicksort with a median of three pivot, and insertion sort for partitions
+; of less than SMALL elements. The larger part of a partition is pushed onto
+; the C stack, the smaller one is sorted next, so the stack needs at most 6
+; bytes per halving of the element count. Elements of 1, 2 and 4 bytes are
+; swapped by specialized routines.
+;
+; The state is kept in the DATA segment, since the compare function may
+; destroy the zero page registers. It is saved on the C stack during a sort,
+; so the compare function may call qsort itself.
+;
+        .export         qsortstart, qsortcallcmp, qsortargs
+        .import         popax, pushax, subysp, addysp
+        .import         umul16x16r16, __swap
+        .importzp       sp, sreg, ptr1, ptr2, ptr3, ptr4
+
+        .macpack        generic
+
+; Partitions with less elements are sorted by insertion sort
+SMALL           = 8
+
+;-----------------------------------------------------------------------------
+; Load the pointers p1 and p2 into ptr1 and ptr2
+
+.macro  ldptrs  p1, p2
+        lda     p1
+        sta     ptr1
+        lda     p1+1
+        sta     ptr1+1
+        lda     p2
+        sta     ptr2
+        lda     p2+1
+        sta     ptr2+1
+.endmacro
+
+; Add the element size to the pointer p
+
+.macro  incelem p
+        lda     p
+        add     size
+        sta     p
+        lda     p+1
+        adc     size+1
+        sta     p+1
+.endmacro
+
+; Subtract the element size from the pointer p
+
+.macro  decelem p
+        lda     p
+        sub     size
+        sta     p
+        lda     p+1
+        sbc     size+1
+        sta     p+1
+.endmacro
+
+; Decrement the 16 bit value v
+
+.macro  decw    v
+        lda     v
+        bne     :+
+        dec     v+1
+:       dec     v
+.endmacro
+
+;-----------------------------------------------------------------------------
+; Data
+
+.data
+
+; Everything between state and stateend is saved during a sort.
+state:
+
+; Compare the elements in ptr1 and ptr2. Return carry clear if the first is
+; less, carry set and the zero flag set if both are equal, carry set and the
+; zero flag clear if the first is greater. ptr1 and ptr2 are preserved.
+Compare:
+        jmp     $0000
+
+; Swap the elements in ptr1 and ptr2
+Swap:
+        jmp     $0000
+
+; Call the compare function of the user
+qsortcallcmp:
+        jmp     $0000
+
+size:   .word   0                       ; Element size
+lo:     .word   0                       ; First element of the partition
+hi:     .word   0                       ; Last element of the partition
+count:  .word   0                       ; Elements in the partition
+i:      .word   0
+j:      .word   0
+jidx:   .word   0                       ; Index of j in the partition
+depth:  .byte   0                       ; Partitions on the C stack
+qsortargs:
+        .res    4                       ; ptr1 and ptr2 during a call
+
+stateend:
+STATESIZE       = stateend - state
+
+.code
+
+;-----------------------------------------------------------------------------
+; Sort the array. The size is passed in a/x, base and count on the C stack.
+; ptr4 contains the routine that compares two elements as described for
+; Compare above, sreg the compare function of the user if there is one.
+
+qsortstart:
+        sta     ptr1
+        stx     ptr1+1                  ; Save size
+        jsr     popax
+        sta     ptr2
+        stx     ptr2+1                  ; Save count
+        jsr     popax
+        sta     ptr3
+        stx     ptr3+1                  ; Save base
+
+; Nothing to do for less than two elements
+
+        lda     ptr2+1
+        bne     @L1
+        lda     ptr2
+        cmp     #2
+        bcs     @L1
+        rts
+
+; Save the state of an outer sort on the C stack
+
+@L1:    ldy     #STATESIZE
+        jsr     subysp
+        ldy     #STATESIZE-1
+@L2:    lda     state,y
+        sta     (sp),y
+        dey
+        bpl     @L2
+
+; Setup the compare and swap routines
+
+        lda     ptr4
+        sta     Compare+1
+        lda     ptr4+1
+        sta     Compare+2
+        lda     sreg
+        sta     qsortcallcmp+1
+        lda     sreg+1
+        sta     qsortcallcmp+2
+
+        lda     ptr1
+        sta     size
+        ldy     ptr1+1
+        sty     size+1
+        bne     @L4                     ; Jump if size >= 256
+        ldx     #<Swap1
+        ldy     #>Swap1
+        cmp     #1
+        beq     @L5
+        ldx     #<Swap2
+        ldy     #>Swap2
+        cmp     #2
+        beq     @L5
+        ldx     #<Swap4
+        ldy     #>Swap4
+        cmp     #4
+        beq     @L5
+        ldx     #<SwapN
+        ldy     #>SwapN
+        bne     @L5                     ; Branch always
+@L4:    ldx     #<SwapBig
+        ldy     #>SwapBig
+@L5:    stx     Swap+1
+        sty     Swap+2
+
+; The whole array is the first partition: lo = base, count = count,
+; hi = base + (count - 1) * size. ptr1 still contains the size.
+
+        lda     ptr3
+        sta     lo
+        lda     ptr3+1
+        sta     lo+1
+        lda     ptr2
+        sta     count
+        sub     #1
+        pha
+        lda     ptr2+1
+        sta     count+1
+        sbc     #0
+        tax
+        pla
+        jsr     umul16x16r16
+        add     lo
+        sta     hi
+        txa
+        adc     lo+1
+        sta     hi+1
+        lda     #0
+        sta     depth
+
+;-----------------------------------------------------------------------------
+; Sort the partition lo..hi with count elements
+
+Loop:   lda     count+1
+        bne     Partition
+        lda     count
+        cmp     #SMALL
+        bcs     Partition
+        jsr     InsertionSort
+
+; Continue with the last partition from the stack
+
+        lda     depth
+        beq     Done
+        dec     depth
+        jsr     popax
+        sta     count
+        stx     count+1
+        jsr     popax
+        sta     hi
+        stx     hi+1
+        jsr     popax
+        sta     lo
+        stx     lo+1
+        jmp     Loop
+
+; Restore the state of an outer sort and return
+
+Done:   ldy     #STATESIZE-1
+@L1:    lda     (sp),y
+        sta     state,y
+        dey
+        bpl     @L1
+        ldy     #STATESIZE
+        jmp     addysp
+
+;-----------------------------------------------------------------------------
+; Partition lo..hi. Use the median of the first, middle and last element as
+; pivot and move it to lo. The first and last element are then on the right
+; side already.
+
+Partition:
+        lda     count+1
+        lsr     a
+        tax
+        lda     count
+        ror     a
+        ldy     size
+        sty     ptr1
+        ldy     size+1
+        sty     ptr1+1
+        jsr     umul16x16r16            ; (count / 2) * size
+        add     lo
+        sta     i
+        txa
+        adc     lo+1
+        sta     i+1                     ; i = middle element
+
+        ldptrs  i, lo
+        jsr     Compare
+        bcs     @L1
+        jsr     Swap                    ; Middle is less than first
+@L1:    ldptrs  hi, i
+        jsr     Compare
+        bcs     @L2
+        jsr     Swap                    ; Last is less than middle
+        ldptrs  i, lo
+        jsr     Compare
+        bcs     @L2
+        jsr     Swap                    ; Middle is less than first
+@L2:    ldptrs  lo, i
+        jsr     Swap                    ; Pivot to lo
+
+; i = lo + size, j = hi, jidx = count - 1
+
+        lda     lo
+        add     size
+        sta     i
+        lda     lo+1
+        adc     size+1
+        sta     i+1
+        lda     hi
+        sta     j
+        lda     hi+1
+        sta     j+1
+        lda     count
+        sub     #1
+        sta     jidx
+        lda     count+1
+        sbc     #0
+        sta     jidx+1
+
+; while (i <= j)
+
+PLoop:  jsr     CmpIJ
+        bcs     @L1
+        jmp     PDone
+
+; while (i <= j && compare (lo, i) >= 0) i += size;
+
+@L1:    ldptrs  lo, i
+        jsr     Compare
+        bcc     @L2
+        incelem i
+        jsr     CmpIJ
+        bcs     @L1
+        jmp     PDone
+
+; while (i <= j && compare (lo, j) < 0) j -= size;
+
+@L2:    ldptrs  lo, j
+        jsr     Compare
+        bcs     @L3
+        decelem j
+        decw    jidx
+        jsr     CmpIJ
+        bcs     @L2
+        jmp     PDone
+
+; i <= j here: swap (i, j), then step both
+
+@L3:    ldptrs  i, j
+        jsr     Swap
+        incelem i
+        decelem j
+        decw    jidx
+        jmp     PLoop
+
+; Move the pivot between both parts
+
+PDone:  lda     j
+        cmp     lo
+        bne     @L1
+        lda     j+1
+        cmp     lo+1
+        beq     @L2
+@L1:    ldptrs  j, lo
+        jsr     Swap
+
+; The left part is lo..j-size with jidx elements, the right one is
+; j+size..hi with count-1-jidx elements. Calculate the size of the right
+; one in count.
+
+@L2:    lda     count
+        sub     #1
+        sta     count
+        lda     count+1
+        sbc     #0
+        sta     count+1                 ; count - 1
+        lda     count
+        sub     jidx
+        sta     count
+        lda     count+1
+        sbc     jidx+1
+        sta     count+1
+
+; Push the larger part and continue with the smaller one
+
+        inc     depth
+        lda     count
+        cmp     jidx
+        lda     count+1
+        sbc     jidx+1
+        bcs     @L3                     ; Jump if the right part is larger
+
+; Push the left part, continue with the right one
+
+        lda     lo
+        ldx     lo+1
+        jsr     pushax
+        decelem j
+        lda     j
+        ldx     j+1
+        jsr     pushax
+        lda     jidx
+        ldx     jidx+1
+        jsr     pushax
+        incelem j
+        incelem j
+        lda     j
+        sta     lo
+        lda     j+1
+        sta     lo+1
+        jmp     Loop
+
+; Push the right part, continue with the left one
+
+@L3:    incelem j
+        lda     j
+        ldx     j+1
+        jsr     pushax
+        lda     hi
+        ldx     hi+1
+        jsr     pushax
+        lda     count
+        ldx     count+1
+        jsr     pushax
+        lda     jidx
+        sta     count
+        lda     jidx+1
+        sta     count+1
+        decelem j
+        decelem j
+        lda     j
+        sta     hi
+        lda     j+1
+        sta     hi+1
+        jmp     Loop
+
+; Return carry set if i <= j
+
+CmpIJ:  lda     j
+        cmp     i
+        lda     j+1
+        sbc     i+1
+        rts
+
+;-----------------------------------------------------------------------------
+; Sort the count elements starting at lo by insertion. Uses i, j and jidx.
+
+InsertionSort:
+        lda     count+1
+        bne     @L0
+        lda     count
+        cmp     #2
+        bcs     @L0
+        rts                             ; Nothing to do for less than two
+@L0:    lda     lo
+        sta     i
+        lda     lo+1
+        sta     i+1
+        lda     count
+        sta     jidx
+        lda     count+1
+        sta     jidx+1
+
+; Next element. Sink it down as long as the one before is greater.
+
+@L1:    decw    jidx
+        lda     jidx
+        ora     jidx+1
+        beq     @L9                     ; Jump if no elements left
+        incelem i
+        lda     i
+        sta     j
+        lda     i+1
+        sta     j+1
+
+@L2:    lda     j
+        cmp     lo
+        bne     @L3
+        lda     j+1
+        cmp     lo+1
+        beq     @L1                     ; Jump if at the first element
+@L3:    lda     j
+        sub     size
+        sta     ptr1
+        lda     j+1
+        sbc     size+1
+        sta     ptr1+1
+        lda     j
+        sta     ptr2
+        lda     j+1
+        sta     ptr2+1
+        jsr     Compare
+        bcc     @L1                     ; Jump if less
+        beq     @L1                     ; Jump if equal
+        jsr     Swap
+        decelem j
+        jmp     @L2
+
+@L9:    rts
+
+;-----------------------------------------------------------------------------
+; Swap functions
+
+.macro  swapbyte        offs
+        ldy     #offs
+        lda     (ptr1),y
+        tax
+        lda     (ptr2),y
+        sta     (ptr1),y
+        txa
+        sta     (ptr2),y
+.endmacro
+
+Swap4:  swapbyte        3
+        swapbyte        2
+Swap2:  swapbyte        1
+Swap1:  swapbyte        0
+        rts
+
+; Elements of less than 256 bytes
+
+SwapN:  ldy     size
+@L1:    dey
+        lda     (ptr1),y
+        tax
+        lda     (ptr2),y
+        sta     (ptr1),y
+        txa
+        sta     (ptr2),y
+        cpy     #0
+        bne     @L1
+        rts
+
+; Larger elements
+
+SwapBig:
+        lda     ptr1
+        ldx     ptr1+1
+        jsr     pushax
+        lda     ptr2
+        ldx     ptr2+1
+        jsr     pushax
+        lda     size
+        ldx     size+1
+        jmp     __swap
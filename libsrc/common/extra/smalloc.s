@@ -0,0 +1,269 @@
+;
+; The cc65 authors, 2026-10-18
+;
+; Size class allocator. Link the object file <target>-smalloc.o together with
+; the program to use it instead of malloc and free from the library.
+;
+; void* __fastcall__ malloc (size_t size);
+; void __fastcall__ free (void* block);
+; size_t __fastcall__ _heapblocksize (const void* block);
+;
+; Blocks of up to 64 bytes are taken from four size classes of 8, 16, 32 and
+; 64 bytes. Each class has a list of free blocks and carves new blocks from
+; pages it gets from the heap, so allocating and freeing such a block takes
+; constant time and doesn't fragment the heap. Pages are never returned to the
+; heap, freed blocks are kept for the next request of the same class. Larger
+; blocks are passed to the normal heap functions.
+;
+; A small block is preceeded by a word that points to the size of its class
+; below. This is the start field of struct usedblock, so realloc handles small
+; blocks without knowing about them: The "raw block" has the size of the class
+; and is never located at the heap top.
+;
+
+        .export         _malloc, _free, __heapblocksize
+        .import         __heapalloc, __heapfree
+        .importzp       ptr1, ptr2
+
+        .include        "_heap.inc"
+
+        .macpack        generic
+
+; Smallest size class, and the number of classes. Every class has twice the
+; size of the one before.
+MINSIZE         = 8
+CLASSES         = 4
+
+; Maximum size of a page taken from the heap
+PAGESIZE        = 255
+
+; All tables are indexed by twice the class number
+
+.rodata
+
+; Size of a block in the class including the administration space as it is
+; stored for heap blocks. The word before a small block points here.
+blksize:
+.repeat CLASSES, I
+        .word   (MINSIZE << I) + HEAP_ADMIN_SPACE
+.endrepeat
+
+; Size of a slot in a page: The block and the word in front of it
+slotsize:
+.repeat CLASSES, I
+        .word   (MINSIZE << I) + 2
+.endrepeat
+
+; Number of slots in a page
+slots:
+.repeat CLASSES, I
+        .word   PAGESIZE / ((MINSIZE << I) + 2)
+.endrepeat
+
+; Size of a page
+pagesize:
+.repeat CLASSES, I
+        .word   PAGESIZE / ((MINSIZE << I) + 2) * ((MINSIZE << I) + 2)
+.endrepeat
+
+.bss
+
+freelist:       .res    CLASSES * 2     ; Free blocks
+nextslot:       .res    CLASSES * 2     ; Next unused slot in the current page
+slotsleft:      .res    CLASSES * 2     ; Unused slots in the current page
+
+.code
+
+;-----------------------------------------------------------------------------
+; Allocate a block
+
+_malloc:
+        cpx     #$00
+        bne     Heap                    ; Jump if 256 bytes or more
+        tay
+        beq     Done                    ; Return NULL for a size of zero
+
+; Determine the size class
+
+        ldx     #0*2
+        cmp     #MINSIZE*1+1
+        bcc     FromList
+        ldx     #1*2
+        cmp     #MINSIZE*2+1
+        bcc     FromList
+        ldx     #2*2
+        cmp     #MINSIZE*4+1
+        bcc     FromList
+        ldx     #3*2
+        cmp     #MINSIZE*8+1
+        bcc     FromList
+        ldx     #$00                    ; Restore the high byte of the size
+Heap:   jmp     __heapalloc
+
+; Take the first block from the free list if there is one
+
+FromList:
+        lda     freelist,x
+        sta     ptr1
+        ora     freelist+1,x
+        beq     NewSlot
+        lda     freelist+1,x
+        sta     ptr1+1
+        ldy     #$00
+        lda     (ptr1),y
+        sta     freelist,x
+        iny
+        lda     (ptr1),y
+        sta     freelist+1,x
+        lda     ptr1
+        ldx     ptr1+1
+Done:   rts
+
+; No free block. Take a new slot from the current page if there's one left.
+
+NewSlot:
+        lda     slotsleft,x
+        beq     NewPage
+Carve:  dec     slotsleft,x
+        lda     nextslot,x
+        sta     ptr1
+        add     slotsize,x
+        sta     nextslot,x
+        lda     nextslot+1,x
+        sta     ptr1+1
+        adc     #$00
+        sta     nextslot+1,x
+
+; Let the word in front of the block point to the size of the class
+
+        txa
+        add     #<blksize
+        ldy     #$00
+        sta     (ptr1),y
+        lda     #>blksize
+        adc     #$00
+        iny
+        sta     (ptr1),y
+
+; Return the pointer behind this word
+
+        lda     ptr1
+        ldx     ptr1+1
+        add     #$02
+        bcc     @L1
+        inx
+@L1:    rts
+
+; The current page is used up, get a new one from the heap
+
+NewPage:
+        txa
+        pha                             ; Save the class
+        lda     pagesize,x
+        ldx     #$00
+        jsr     __heapalloc
+        sta     ptr1
+        pla
+        tay                             ; Class now in Y
+        lda     ptr1
+        sta     nextslot,y
+        txa
+        sta     nextslot+1,y
+        ora     ptr1
+        beq     Done                    ; Out of memory, a/x are zero
+        lda     slots,y
+        sta     slotsleft,y
+        tya
+        tax
+        jmp     Carve
+
+;-----------------------------------------------------------------------------
+; Free a block
+
+_free:  sta     ptr1
+        stx     ptr1+1
+        ora     ptr1+1
+        beq     Done                    ; Accept NULL and do nothing
+        jsr     GetClass
+        bcs     @L1                     ; Jump if no small block
+
+; Put the block in front of the free list of its class
+
+        ldy     #$00
+        lda     freelist,x
+        sta     (ptr1),y
+        iny
+        lda     freelist+1,x
+        sta     (ptr1),y
+        lda     ptr1
+        sta     freelist,x
+        lda     ptr1+1
+        sta     freelist+1,x
+        rts
+
+@L1:    lda     ptr1
+        ldx     ptr1+1
+        jmp     __heapfree
+
+;-----------------------------------------------------------------------------
+; Return the usable size of a block
+
+__heapblocksize:
+        sta     ptr1
+        stx     ptr1+1
+        jsr     GetClass
+        bcs     @L1                     ; Jump if no small block
+        lda     blksize,x
+        sub     #HEAP_ADMIN_SPACE
+        ldx     #$00
+        rts
+
+; A heap block. The raw block starts with the size of the whole block, so the
+; usable size is size - (ptr1 - ptr2).
+
+@L1:    ldy     #usedblock::size
+        lda     (ptr2),y
+        add     ptr2
+        pha
+        iny
+        lda     (ptr2),y
+        adc     ptr2+1
+        tax
+        pla
+        sub     ptr1
+        pha
+        txa
+        sbc     ptr1+1
+        tax
+        pla
+        rts
+
+;-----------------------------------------------------------------------------
+; Check the block in ptr1. Load the pointer to the raw block from the word in
+; front of it into ptr2. Return carry clear and the table index of the class
+; in X for a small block, carry set otherwise.
+
+GetClass:
+        lda     ptr1
+        sub     #$02
+        sta     ptr2
+        lda     ptr1+1
+        sbc     #$00
+        sta     ptr2+1
+        ldy     #$01
+        lda     (ptr2),y
+        tax
+        dey
+        lda     (ptr2),y
+        sta     ptr2
+        stx     ptr2+1
+        sub     #<blksize
+        tax
+        lda     ptr2+1
+        sbc     #>blksize
+        bne     @L1
+        cpx     #CLASSES*2
+        rts
+
+@L1:    sec
+        rts
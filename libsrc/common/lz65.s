@@ -0,0 +1,162 @@
+;
+; The cc65 authors, 2026-10-18
+;
+; unsigned __fastcall__ decompress_lz65 (const unsigned char* src,
+;                                        unsigned char* dst);
+;
+; Decompress data in the lz65 format as written by util/lz65/lz65.c and
+; return the size of the decompressed data. This version is optimized for
+; size, see lz65fast.s for a faster one. The format is described in lz65.c.
+;
+
+        .export         _decompress_lz65
+        .import         popptr1
+        .importzp       sreg, ptr1, ptr2, ptr3, ptr4, tmp1, tmp2, tmp3
+
+src     = ptr1                  ; Compressed data
+dst     = ptr2                  ; Decompressed data
+copysrc = ptr3                  ; Source of the bytes to copy
+len     = ptr4                  ; Gamma coded number, number of bytes
+bits    = tmp1                  ; Bit buffer
+offset  = tmp2                  ; Last offset as a negative number, 2 bytes
+start   = sreg                  ; Start of the decompressed data
+
+_decompress_lz65:
+        sta     dst
+        stx     dst+1
+        sta     start
+        stx     start+1
+        jsr     popptr1         ; Get src, Y = 0
+        lda     #$80
+        sta     bits            ; Bit buffer is empty
+        lda     #$FF
+        sta     offset          ; Last offset is 1
+        sta     offset+1
+
+; After a match: A zero bit selects literals, a one bit a new offset
+
+Match:  jsr     GetBit
+        bcs     NewOffset
+
+; Copy literals
+
+        jsr     GetGamma
+        lda     src
+        sta     copysrc
+        lda     src+1
+        sta     copysrc+1
+        jsr     Copy
+        lda     copysrc
+        sta     src
+        lda     copysrc+1
+        sta     src+1
+
+; After literals: A zero bit selects a match with the last offset, a one bit
+; a new offset
+
+        jsr     GetBit
+        bcs     NewOffset
+        jsr     GetGamma
+        jmp     CopyMatch
+
+; Get a new offset. A high part of 256 ends the stream.
+
+NewOffset:
+        jsr     GetGamma
+        ldx     len+1
+        bne     Done
+        ldx     len
+        dex
+        txa
+        eor     #$FF
+        sta     offset+1
+        jsr     GetByte
+        eor     #$FF
+        sta     offset
+        jsr     GetGamma        ; Length - 1
+        inc     len
+        bne     CopyMatch
+        inc     len+1
+
+; Copy a match
+
+CopyMatch:
+        lda     dst
+        clc
+        adc     offset
+        sta     copysrc
+        lda     dst+1
+        adc     offset+1
+        sta     copysrc+1
+        jsr     Copy
+        jmp     Match
+
+; Return the size of the decompressed data
+
+Done:   lda     dst
+        sec
+        sbc     start
+        tay
+        lda     dst+1
+        sbc     start+1
+        tax
+        tya
+        rts
+
+;-----------------------------------------------------------------------------
+; Copy len bytes from copysrc to dst. len is not zero. Y must be zero.
+
+Copy:   lda     (copysrc),y
+        sta     (dst),y
+        inc     copysrc
+        bne     @L1
+        inc     copysrc+1
+@L1:    inc     dst
+        bne     @L2
+        inc     dst+1
+@L2:    lda     len
+        bne     @L3
+        dec     len+1
+@L3:    dec     len
+        lda     len
+        ora     len+1
+        bne     Copy
+        rts
+
+;-----------------------------------------------------------------------------
+; Read a gamma coded number into len
+
+GetGamma:
+        lda     #$01
+        sta     len
+        sty     len+1
+@L1:    jsr     GetBit
+        bcs     @L2
+        jsr     GetBit
+        rol     len
+        rol     len+1
+        bcc     @L1             ; Branch always
+@L2:    rts
+
+;-----------------------------------------------------------------------------
+; Read a bit into the carry. The bit buffer holds the bits left from the last
+; bit byte followed by a one bit, so it is zero after shifting out the last
+; one, and the carry is set.
+
+GetBit: asl     bits
+        bne     @L1
+        jsr     GetByte
+        rol     a
+        sta     bits
+@L1:    rts
+
+;-----------------------------------------------------------------------------
+; Read a byte from the compressed data. Y must be zero, the carry is
+; preserved.
+
+GetByte:
+        lda     (src),y
+        inc     src
+        bne     @L1
+        inc     src+1
+@L1:    rts
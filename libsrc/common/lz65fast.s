@@ -0,0 +1,199 @@
+;
+; The cc65 authors, 2026-10-18
+;
+; unsigned __fastcall__ decompress_lz65_fast (const unsigned char* src,
+;                                             unsigned char* dst);
+;
+; Decompress data in the lz65 format as written by util/lz65/lz65.c and
+; return the size of the decompressed data. This version is optimized for
+; speed: Bits are read inline, the frequent gamma code for 1 is handled
+; without a call, and bytes are copied by indexed loops. See lz65.s for a
+; smaller version.
+;
+
+        .export         _decompress_lz65_fast
+        .import         popptr1
+        .importzp       sreg, ptr1, ptr2, ptr3, ptr4, tmp1, tmp2
+
+src     = ptr1                  ; Compressed data
+dst     = ptr2                  ; Decompressed data
+copysrc = ptr3                  ; Source of a match
+len     = ptr4                  ; Gamma coded number, number of bytes
+bits    = tmp1                  ; Bit buffer
+offset  = sreg                  ; Last offset as a negative number, 2 bytes
+
+; Read a bit into the carry. Y must be zero.
+
+.macro  getbit
+        asl     bits
+        bne     :+
+        jsr     Refill
+:
+.endmacro
+
+; Read a gamma coded number. The low byte is returned in X, the high byte in
+; len+1. Y must be zero.
+
+.macro  getgamma
+        ldx     #$01
+        sty     len+1
+        getbit
+        bcs     :+
+        jsr     GammaRest
+:
+.endmacro
+
+; Copy X + 256 * len+1 bytes from ptr to dst, X is the low byte of a non zero
+; count. On return, ptr and dst point behind the copied bytes, and Y is zero.
+
+.macro  copy    ptr
+        .local  Short, Long, Loop, Next, Done
+        lda     len+1
+        bne     Long
+
+; Less than 256 bytes, Y doesn't wrap around
+
+Short:  lda     (ptr),y
+        sta     (dst),y
+        iny
+        dex
+        bne     Short
+        beq     Done            ; Branch always
+
+; Longer counts
+
+Long:   txa
+        bne     Loop
+        dec     len+1           ; The first loop copies 256 bytes
+Loop:   lda     (ptr),y
+        sta     (dst),y
+        iny
+        bne     Next
+        inc     ptr+1
+        inc     dst+1
+Next:   dex
+        bne     Loop
+        lda     len+1
+        beq     Done
+        dec     len+1
+        jmp     Loop
+Done:   tya
+        clc
+        adc     ptr
+        sta     ptr
+        bcc     :+
+        inc     ptr+1
+:       tya
+        clc
+        adc     dst
+        sta     dst
+        bcc     :+
+        inc     dst+1
+:       ldy     #$00
+.endmacro
+
+_decompress_lz65_fast:
+        sta     dst
+        stx     dst+1
+        pha
+        txa
+        pha                     ; Save the start of the decompressed data
+        jsr     popptr1         ; Get src, Y = 0
+        lda     #$80
+        sta     bits            ; Bit buffer is empty
+        lda     #$FF
+        sta     offset          ; Last offset is 1
+        sta     offset+1
+
+; After a match: A zero bit selects literals, a one bit a new offset
+
+Match:  getbit
+        bcs     NewOffset
+
+; Copy literals
+
+        getgamma
+        copy    src
+
+; After literals: A zero bit selects a match with the last offset, a one bit
+; a new offset
+
+        getbit
+        bcs     NewOffset
+        getgamma
+        jmp     CopyMatch
+
+; Get a new offset. A high part of 256 ends the stream.
+
+NewOffset:
+        getgamma
+        lda     len+1
+        bne     Done
+        dex
+        txa
+        eor     #$FF
+        sta     offset+1
+        lda     (src),y
+        eor     #$FF
+        sta     offset
+        inc     src
+        bne     :+
+        inc     src+1
+:       getgamma                ; Length - 1
+        inx
+        bne     CopyMatch
+        inc     len+1
+
+; Copy a match
+
+CopyMatch:
+        lda     dst
+        clc
+        adc     offset
+        sta     copysrc
+        lda     dst+1
+        adc     offset+1
+        sta     copysrc+1
+        copy    copysrc
+        jmp     Match
+
+; Return the size of the decompressed data
+
+Done:   pla
+        sta     tmp2
+        pla
+        eor     #$FF
+        sec
+        adc     dst
+        tay
+        lda     dst+1
+        sbc     tmp2
+        tax
+        tya
+        rts
+
+;-----------------------------------------------------------------------------
+; Read the rest of a gamma coded number after a zero bit. The number is
+; returned as for the getgamma macro.
+
+GammaRest:
+        stx     len
+@L1:    getbit
+        rol     len
+        rol     len+1
+        getbit
+        bcc     @L1
+        ldx     len
+        rts
+
+;-----------------------------------------------------------------------------
+; Load the next bit byte and return its first bit in the carry. The carry
+; must be set.
+
+Refill: lda     (src),y
+        inc     src
+        bne     @L1
+        inc     src+1
+@L1:    rol     a
+        sta     bits
+        rts
@@ -82,11 +82,13 @@ int __fastcall__ posix_memalign (void** memptr, size_t alignment, size_t size)
 
     /* Augment the block size up to the alignment, and allocate memory.
     ** We don't need to account for the additional admin. data that's needed to
-    ** manage the used block, because the block returned by malloc() has that
+    ** manage the used block, because the block returned by _heapalloc() has that
     ** overhead added one time; and, the worst thing that might happen is that
-    ** we cannot free the upper and lower blocks.
+    ** we cannot free the upper and lower blocks. The block is taken from the
+    ** heap directly, since the pieces are handled as heap blocks below, even
+    ** if an alternative malloc is linked.
     */
-    b = malloc (size + alignment);
+    b = _heapalloc (size + alignment);
 
     /* Handle out-of-memory */
     if (b == NULL) {
@@ -124,7 +126,7 @@ int __fastcall__ posix_memalign (void** memptr, size_t alignment, size_t size)
         p->start = p;
 
         /* Generate a pointer to the (upper) user space, and free that block */
-        free (p + 1);
+        _heapfree (p + 1);
 
         /* Decrease the raw-block size by the amount of space just freed */
         rawsize = lowersize;
@@ -149,7 +151,7 @@ int __fastcall__ posix_memalign (void** memptr, size_t alignment, size_t size)
         b->start = b;
 
         /* Generate a pointer to the (lower) user space, and free that block */
-        free (b + 1);
+        _heapfree (b + 1);
 
         /* Decrease the raw-block size by the amount of space just freed */
         rawsize -= lowersize;
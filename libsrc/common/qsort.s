@@ -0,0 +1,59 @@
+;
+; The cc65 authors, 2026-10-18
+;
+; Replaces qsort.c (1998.12.09, Ullrich von Bassewitz; 2015-06-21, Greg King).
+;
+; void __fastcall__ qsort (void* base, size_t count, size_t size,
+;                          int __fastcall__ (* compare) (const void*, const void*));
+;
+; The sorting is done in _qsort.s, which is shared with qsort_u8 and
+; qsort_u16.
+;
+
+        .export         _qsort
+        .import         popax, pushax
+        .import         qsortstart, qsortcallcmp, qsortargs
+        .importzp       sreg, ptr1, ptr2, ptr4, tmp1
+
+_qsort: sta     sreg
+        stx     sreg+1                  ; Save the compare function
+        jsr     popax                   ; Get size
+        ldy     #<CmpFunc
+        sty     ptr4
+        ldy     #>CmpFunc
+        sty     ptr4+1
+        jmp     qsortstart
+
+; Call the compare function of the user and convert the result. The function
+; may destroy the zero page registers, so ptr1 and ptr2 are restored.
+
+CmpFunc:
+        lda     ptr2
+        sta     qsortargs+2
+        lda     ptr2+1
+        sta     qsortargs+3
+        lda     ptr1
+        sta     qsortargs
+        ldx     ptr1+1
+        stx     qsortargs+1
+        jsr     pushax
+        lda     ptr2
+        ldx     ptr2+1
+        jsr     qsortcallcmp
+        sta     tmp1
+        lda     qsortargs
+        sta     ptr1
+        lda     qsortargs+1
+        sta     ptr1+1
+        lda     qsortargs+2
+        sta     ptr2
+        lda     qsortargs+3
+        sta     ptr2+1
+        cpx     #$80
+        bcs     @L1                     ; Jump if negative
+        txa
+        ora     tmp1                    ; Set the zero flag
+        sec
+        rts
+@L1:    clc
+        rts
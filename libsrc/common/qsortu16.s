@@ -0,0 +1,30 @@
+;
+; The cc65 authors, 2026-10-18
+;
+; void __fastcall__ qsort_u16 (void* base, size_t count, size_t size);
+;
+; Sort by the unsigned int at the start of each element. The keys are
+; compared inline, the sorting is done in _qsort.s.
+;
+
+        .export         _qsort_u16
+        .import         qsortstart
+        .importzp       ptr1, ptr2, ptr4
+
+_qsort_u16:
+        ldy     #<CmpU16
+        sty     ptr4
+        ldy     #>CmpU16
+        sty     ptr4+1
+        jmp     qsortstart
+
+; Compare the unsigned ints at the start of the elements
+
+CmpU16: ldy     #1
+        lda     (ptr1),y
+        cmp     (ptr2),y
+        bne     @L1
+        dey
+        lda     (ptr1),y
+        cmp     (ptr2),y
+@L1:    rts
@@ -0,0 +1,26 @@
+;
+; The cc65 authors, 2026-10-18
+;
+; void __fastcall__ qsort_u8 (void* base, size_t count, size_t size);
+;
+; Sort by the unsigned char at the start of each element. The keys are
+; compared inline, the sorting is done in _qsort.s.
+;
+
+        .export         _qsort_u8
+        .import         qsortstart
+        .importzp       ptr1, ptr2, ptr4
+
+_qsort_u8:
+        ldy     #<CmpU8
+        sty     ptr4
+        ldy     #>CmpU8
+        sty     ptr4+1
+        jmp     qsortstart
+
+; Compare the unsigned chars at the start of the elements
+
+CmpU8:  ldy     #0
+        lda     (ptr1),y
+        cmp     (ptr2),y
+        rts
@@ -0,0 +1,211 @@
+;
+; The cc65 authors, 2026-10-18
+;
+; CC65 runtime: Table driven replacements for the integer multiplication
+; routines. Link the object file <target>-fastmul.o together with the program
+; to use them instead of the shift-and-add versions from the library.
+;
+; The routines use the quarter square method:
+;
+;   a * b = sqr(a + b) - sqr(a - b)         with sqr(x) = floor(x * x / 4)
+;
+; so an 8x8 multiplication is reduced to two table lookups and a subtraction.
+; The tables need 1K of RODATA. The module replaces mul.o, mul8.o,
+; umul8x8r16.o and umul16x16r32.o; imul16x16r32 from the library uses the
+; faster unsigned routine automatically.
+;
+
+        .export         tosumulax, tosmulax
+        .export         tosumula0, tosmula0
+        .export         umul8x8r16, umul8x8r16m
+        .export         umul16x16r32, umul16x16r32m
+        .export         umul16x16r16, umul16x16r16m
+        .import         popptr1
+
+        .include        "zeropage.inc"
+
+
+;---------------------------------------------------------------------------
+; Multiply the byte at lhs with the byte at rhs. The low byte of the product
+; is stored at lo (or pushed onto the hardware stack if lo is blank), the high
+; byte is returned in A. The carry is set on exit, X and Y are destroyed.
+; lhs and rhs are read before lo is written, so lo may be one of them.
+
+.macro  qsmul   lhs, rhs, lo
+        .local  L1, L2, L3
+
+        lda     lhs
+        sec
+        sbc     rhs
+        bcs     L1
+        eor     #$FF
+        adc     #$01            ; Carry is clear
+L1:     tay                     ; Y = abs (lhs - rhs)
+        lda     lhs
+        clc
+        adc     rhs
+        tax                     ; X = (lhs + rhs) & $FF
+        bcs     L2              ; Jump if sum is >= 256
+
+        sec
+        lda     sqrlo,x
+        sbc     sqrlo,y
+.ifblank lo
+        pha
+.else
+        sta     lo
+.endif
+        lda     sqrhi,x
+        sbc     sqrhi,y
+        bcs     L3              ; Branch always
+
+L2:     lda     sqrlo+256,x     ; Carry is set
+        sbc     sqrlo,y
+.ifblank lo
+        pha
+.else
+        sta     lo
+.endif
+        lda     sqrhi+256,x
+        sbc     sqrhi,y
+L3:
+.endmacro
+
+
+;---------------------------------------------------------------------------
+; 16x16 multiplication routine
+
+tosmulax:
+tosumulax:
+        sta     ptr4
+        stx     ptr4+1          ; Save right operand
+        jsr     popptr1         ; Get left operand
+
+; The result is lo(lhs) * rhs + ((hi(lhs) * lo(rhs)) << 8). Only the low
+; bytes of the cross products are needed.
+
+        lda     ptr1+1          ; If hi(lhs) is zero, so is the product
+        beq     :+
+        qsmul   ptr1+1, ptr4, ptr1+1
+:       lda     ptr4+1          ; If hi(rhs) is zero, so is the product
+        beq     :+
+        qsmul   ptr1, ptr4+1, ptr4+1
+:       qsmul   ptr1, ptr4, ptr1
+        clc
+        adc     ptr1+1
+        clc
+        adc     ptr4+1
+        tax
+        lda     ptr1            ; Load the result
+        rts
+
+
+;---------------------------------------------------------------------------
+; 16x8 multiplication routine
+
+tosmula0:
+tosumula0:
+        sta     ptr4
+        jsr     popptr1         ; Get left operand
+
+        lda     ptr1+1          ; If hi(lhs) is zero, so is the product
+        beq     :+
+        qsmul   ptr1+1, ptr4, ptr1+1
+:       qsmul   ptr1, ptr4, ptr1
+        clc
+        adc     ptr1+1
+        tax
+        lda     ptr1            ; Load the result
+        rts
+
+
+;---------------------------------------------------------------------------
+; 8x8 => 16 unsigned multiplication routine.
+;
+;   LHS            RHS          result      result in also
+; -------------------------------------------------------------
+;   .A (ptr3-low)  ptr1-low     .XA             ptr1
+;
+
+umul8x8r16:
+        sta     ptr3
+umul8x8r16m:
+        qsmul   ptr3, ptr1, ptr1
+        sta     ptr1+1
+        tax
+        lda     ptr1
+        rts
+
+
+;---------------------------------------------------------------------------
+; 16x16 => 32 unsigned multiplication routine.
+;
+;  routine         LHS         RHS        result          result also in
+; -----------------------------------------------------------------------
+;  umul16x16r32    ax          ptr1       ax:sreg          ptr1:sreg
+;  umul16x16r32m   ptr3        ptr1       ax:sreg          ptr1:sreg
+;  umul16x16r16    ax          ptr1       ax               ptr1
+;  umul16x16r16m   ptr3        ptr1       ax               ptr1
+;
+; ptr3 is left intact by the routine. The partial products are ordered so
+; that each byte of ptr1 is read for the last time before it is overwritten
+; by the result.
+;
+
+umul16x16r32:
+umul16x16r16:
+        sta     ptr3
+        stx     ptr3+1
+
+umul16x16r32m:
+umul16x16r16m:
+        qsmul   ptr3+1, ptr1+1, sreg
+        sta     sreg+1          ; sreg = hi(lhs) * hi(rhs)
+
+        qsmul   ptr3, ptr1+1, ptr1+1
+        clc                     ; Add lo(lhs) * hi(rhs)
+        adc     sreg
+        sta     sreg
+        bcc     :+
+        inc     sreg+1
+
+:       qsmul   ptr3+1, ptr1
+        tax                     ; Add hi(lhs) * lo(rhs)
+        pla
+        clc
+        adc     ptr1+1
+        sta     ptr1+1
+        txa
+        adc     sreg
+        sta     sreg
+        bcc     :+
+        inc     sreg+1
+
+:       qsmul   ptr3, ptr1, ptr1
+        clc                     ; Add lo(lhs) * lo(rhs)
+        adc     ptr1+1
+        sta     ptr1+1
+        tax
+        bcc     :+
+        inc     sreg
+        bne     :+
+        inc     sreg+1
+
+:       lda     ptr1            ; Load the result
+        rts
+
+
+;---------------------------------------------------------------------------
+; Quarter square tables: sqr(i) = floor(i * i / 4) for i = 0..511
+
+.rodata
+
+sqrlo:
+        .repeat 512, i
+        .byte   <((i * i) / 4)
+        .endrepeat
+
+sqrhi:
+        .repeat 512, i
+        .byte   >((i * i) / 4)
+        .endrepeat
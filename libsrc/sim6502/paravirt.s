@@ -5,13 +5,21 @@
 ; int __fastcall__ close (int fd);
 ; int __fastcall__ read (int fd, void* buf, unsigned count);
 ; int __fastcall__ write (int fd, const void* buf, unsigned count);
+; void __fastcall__ sim65_get_cycles (struct sim65_cycles* cycles);
+; void __fastcall__ sim65_region_start (const char* name);
+; void __fastcall__ sim65_region_stop (const char* name);
 ;
 
         .export         exit, args, _open, _close, _read, _write
+        .export         _sim65_get_cycles
+        .export         _sim65_region_start, _sim65_region_stop
 
-_open           := $FFF4
-_close          := $FFF5
-_read           := $FFF6
-_write          := $FFF7
-args            := $FFF8
-exit            := $FFF9
+_sim65_get_cycles       := $FFF1
+_sim65_region_start     := $FFF2
+_sim65_region_stop      := $FFF3
+_open                   := $FFF4
+_close                  := $FFF5
+_read                   := $FFF6
+_write                  := $FFF7
+args                    := $FFF8
+exit                    := $FFF9
@@ -0,0 +1,69 @@
+;
+; 2001-11-14, Piotr Fusik
+; 2018-05-20, Christian Kruger
+;
+; Lookup table for crc32, built in RAM on the first call of crc32_init.
+; extra/crc32rom.s has a precomputed table for ROM targets.
+;
+
+        .export         crc32_init, crc32_table
+        .importzp       sreg, tmp1, tmp2
+
+POLYNOMIAL      =       $EDB88320
+
+crc32_init:
+        lda     table_initialised
+        bne     RET
+make_table:
+        ldx     #0
+@L1:    lda     #0
+        sta     tmp2
+        sta     sreg
+        sta     sreg+1
+        ldy     #8
+        txa
+@L2:    sta     tmp1
+        lsr     a
+        bcc     @L3
+        lda     sreg+1
+        lsr     a
+        eor     #(POLYNOMIAL>>24)&$FF
+        sta     sreg+1
+        lda     sreg
+        ror     a
+        eor     #(POLYNOMIAL>>16)&$FF
+        sta     sreg
+        lda     tmp2
+        ror     a
+        eor     #(POLYNOMIAL>>8)&$FF
+        sta     tmp2
+        lda     tmp1
+        ror     a
+        eor     #POLYNOMIAL&$FF
+        bcs     @L4     ; branch always
+@L3:    rol     a
+        lsr     sreg+1
+        ror     sreg
+        ror     tmp2
+        ror     a
+@L4:    dey
+        bne     @L2
+        sta     crc32_table,x
+        lda     tmp2
+        sta     crc32_table+256,x
+        lda     sreg
+        sta     crc32_table+512,x
+        lda     sreg+1
+        sta     crc32_table+768,x
+        inx
+        bne     @L1
+        inc     table_initialised
+RET:
+        rts
+
+                .data
+table_initialised:
+                .byte   0
+
+                .bss
+crc32_table:    .res    1024
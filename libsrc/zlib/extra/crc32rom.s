@@ -0,0 +1,43 @@
+;
+; The cc65 authors, 2026-10-18
+;
+; Precomputed lookup table for crc32. Link the object file <target>-crc32rom.o
+; together with the program to use it instead of the table that crc32tab.s
+; builds in RAM. The table needs 1K of RODATA, but no RAM and no time to
+; build it, so it is the choice for ROM targets.
+;
+
+        .export         crc32_init, crc32_table
+
+POLYNOMIAL      =       $EDB88320
+
+; Output byte n of the table entry for the byte i. The value is masked after
+; each shift, so the calculation doesn't depend on the width of the integers
+; of the assembler.
+
+.macro  crcbyte i, n
+        .local  crc
+        crc     .set    i
+        .repeat 8
+        .if     crc & 1
+        crc     .set    ((crc >> 1) & $7FFFFFFF) ^ POLYNOMIAL
+        .else
+        crc     .set    (crc >> 1) & $7FFFFFFF
+        .endif
+        .endrepeat
+        .byte   (crc >> (n * 8)) & $FF
+.endmacro
+
+.rodata
+
+crc32_table:
+.repeat 4, N
+.repeat 256, I
+        crcbyte I, N
+.endrepeat
+.endrepeat
+
+.code
+
+crc32_init:
+        rts
@@ -0,0 +1,65 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_stderr
+	.import		_fprintf
+	.export		__poserror
+	.import		__stroserror
+	.import		__oserror
+
+.segment	"RODATA"
+
+L000C:
+	.byte	$3A,$20,$00
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ _poserror (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	__poserror: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     __oserror
+	jsr     __stroserror
+	jsr     pushax
+	ldy     #$03
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0006
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     __pftofile
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     __pfstr
+	lda     #<(L000C)
+	ldx     #>(L000C)
+	jsr     __pfputs
+	jmp     L0016
+L0006:	lda     _stderr
+	ldx     _stderr+1
+	jsr     __pftofile
+L0016:	jsr     ldax0sp
+	ldy     #$00
+	jsr     __pfstr
+	lda     #$0A
+	jsr     __pfputc
+	jmp     incsp4
+
+.endproc
+
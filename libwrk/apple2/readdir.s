@@ -0,0 +1,138 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_read
+	.export		_readdir
+
+; ---------------------------------------------------------------
+; __near__ struct dirent * __near__ __fastcall__ readdir (register __near__ struct DIR *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_readdir: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$00
+	ldx     #$04
+	jsr     regswap2
+	lda     regbank+2
+	ldx     regbank+3
+	jsr     pushax
+L000B:	ldy     #$04
+	ldx     #$00
+	lda     (regbank+4),y
+	sta     ptr1
+	stx     ptr1+1
+	dey
+	lda     (regbank+4),y
+	cpx     ptr1+1
+	bne     L000E
+	cmp     ptr1
+	bne     L000E
+	ldy     #$01
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     incax5
+	jsr     pushax
+	ldx     #$02
+	lda     #$00
+	jsr     _read
+	cpx     #$02
+	bne     L0034
+	cmp     #$00
+	beq     L0010
+L0034:	ldx     #$00
+	txa
+	jmp     L000A
+L0010:	ldy     #$04
+	sta     (regbank+4),y
+L000E:	lda     regbank+4
+	ldx     regbank+4+1
+	ldy     #$09
+	jsr     incaxy
+	jsr     pushax
+	ldy     #$04
+	lda     (regbank+4),y
+	jsr     pusha0
+	ldy     #$02
+	lda     (regbank+4),y
+	jsr     tosumula0
+	jsr     tosaddax
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4+1
+	sta     ptr1+1
+	lda     regbank+4
+	sta     ptr1
+	ldy     #$04
+	lda     #$01
+	clc
+	adc     (ptr1),y
+	sta     (ptr1),y
+	ldy     #$00
+	lda     (regbank+2),y
+	beq     L000B
+	lda     regbank+2
+	ldx     regbank+2+1
+	ldy     #$1A
+	jsr     incaxy
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	ldy     #$18
+	jsr     incaxy
+	jsr     ldeaxi
+	ldy     #$00
+	jsr     steaxspidx
+	lda     #$00
+	ldy     #$18
+	sta     (regbank+2),y
+	ldy     #$10
+	lda     (regbank+2),y
+	ldy     #$19
+	sta     (regbank+2),y
+	ldy     #$00
+	lda     (regbank+2),y
+	ldx     #$00
+	and     #$0F
+	jsr     incax1
+	clc
+	adc     regbank+2
+	sta     ptr1
+	txa
+	adc     regbank+2+1
+	sta     ptr1+1
+	tya
+	sta     (ptr1),y
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     incax1
+L000A:	pha
+	ldy     #$00
+L0032:	lda     (sp),y
+	sta     regbank+2,y
+	iny
+	cpy     #$04
+	bne     L0032
+	pla
+	jmp     incsp4
+
+.endproc
+
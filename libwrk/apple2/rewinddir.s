@@ -0,0 +1,80 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_read
+	.import		_lseek
+	.import		_memset
+	.export		_rewinddir
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ rewinddir (register __near__ struct DIR *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_rewinddir: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$00
+	ldx     #$04
+	jsr     regswap2
+	ldy     #$01
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	jsr     pushax
+	jsr     pushl0
+	lda     #$02
+	jsr     _lseek
+	jsr     tsteax
+	beq     L0010
+	ldy     #$01
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     incax5
+	jsr     pushax
+	ldx     #$02
+	lda     #$00
+	jsr     _read
+	cpx     #$02
+	bne     L0010
+	cmp     #$00
+	bne     L0010
+	lda     #$01
+	ldy     #$04
+	sta     (regbank+4),y
+	jmp     L000A
+L0010:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     incax5
+	jsr     pushax
+	ldx     #$02
+	lda     #$00
+	jsr     __bzero
+L000A:	ldy     #$00
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	jmp     incsp2
+
+.endproc
+
@@ -0,0 +1,65 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_raise
+	.import		_stderr
+	.import		_fprintf
+	.import		_exit
+	.export		__afailed
+
+.segment	"RODATA"
+
+L0009:
+	.byte	$41,$53,$53,$45,$52,$54,$49,$4F,$4E,$20,$46,$41,$49,$4C,$45,$44
+	.byte	$20,$49,$4E,$20,$00
+L000A:
+	.byte	$29,$9B,$00
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ _afailed (__near__ unsigned char *, unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	__afailed: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldx     #$00
+	txa
+	jsr     _raise
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     __pftofile
+	lda     #<(L0009)
+	ldx     #>(L0009)
+	jsr     __pfputs
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     __pfstr
+	lda     #$28
+	jsr     __pfputc
+	jsr     ldax0sp
+	ldy     #$00
+	jsr     __pfuint
+	lda     #<(L000A)
+	ldx     #>(L000A)
+	jsr     __pfputs
+	ldx     #$00
+	lda     #$02
+	jsr     _exit
+	jmp     incsp4
+
+.endproc
+
@@ -0,0 +1,34 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.export		__hextab
+
+.segment	"RODATA"
+
+__hextab:
+	.byte	$30
+	.byte	$31
+	.byte	$32
+	.byte	$33
+	.byte	$34
+	.byte	$35
+	.byte	$36
+	.byte	$37
+	.byte	$38
+	.byte	$39
+	.byte	$41
+	.byte	$42
+	.byte	$43
+	.byte	$44
+	.byte	$45
+	.byte	$46
+
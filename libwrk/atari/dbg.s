@@ -0,0 +1,2849 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_exit
+	.import		_strlen
+	.import		_clrscr
+	.import		_kbhit
+	.import		_gotoxy
+	.import		_wherex
+	.import		_cputc
+	.import		_cputcxy
+	.import		_cputsxy
+	.import		_cgetc
+	.import		_cursor
+	.import		_revers
+	.import		_bgcolor
+	.import		_bordercolor
+	.import		_chline
+	.import		_chlinexy
+	.import		_cvlinexy
+	.import		_cclearxy
+	.import		_cputhex8
+	.import		_cputhex16
+	.import		_isalnum
+	.import		_isdigit
+	.import		_isxdigit
+	.import		_toupper
+	.import		_brk_a
+	.import		_brk_x
+	.import		_brk_y
+	.import		_brk_sr
+	.import		_brk_pc
+	.import		_DbgDisAsm
+	.import		_DbgDisAsmLen
+	.import		_DbgIsRAM
+	.import		_DbgMemDump
+	.import		_DbgSP
+	.import		_DbgCS
+	.import		_DbgHI
+	.export		_DbgBreakCount
+	.export		_DbgBreaks
+	.import		_DbgGetBreakSlot
+	.import		_DbgIsBreak
+	.export		_DbgEntry
+
+.segment	"DATA"
+
+_ActiveFrame:
+	.word	$FFFF
+_ActivePrompt:
+	.word	$0000
+_DbgBreakCount:
+	.byte	$00
+
+.segment	"RODATA"
+
+_RegText:
+	.byte	$01
+	.byte	$00
+	.addr	L0022
+	.byte	$01
+	.byte	$01
+	.addr	L0026
+	.byte	$01
+	.byte	$02
+	.addr	L002A
+	.byte	$01
+	.byte	$03
+	.addr	L002E
+	.byte	$01
+	.byte	$04
+	.addr	L0032
+	.byte	$01
+	.byte	$05
+	.addr	L0036
+	.byte	$01
+	.byte	$06
+	.addr	L003A
+	.byte	$01
+	.byte	$07
+	.addr	L003E
+_HelpText:
+	.byte	$01
+	.byte	$00
+	.addr	L0042
+	.byte	$01
+	.byte	$01
+	.addr	L0046
+	.byte	$01
+	.byte	$02
+	.addr	L004A
+	.byte	$01
+	.byte	$03
+	.addr	L004E
+	.byte	$01
+	.byte	$04
+	.addr	L0052
+	.byte	$01
+	.byte	$05
+	.addr	L0056
+	.byte	$01
+	.byte	$06
+	.addr	L005A
+	.byte	$01
+	.byte	$07
+	.addr	L005E
+	.byte	$01
+	.byte	$08
+	.addr	L0062
+	.byte	$01
+	.byte	$09
+	.addr	L0066
+	.byte	$01
+	.byte	$0A
+	.addr	L006A
+	.byte	$01
+	.byte	$0B
+	.addr	L006E
+	.byte	$01
+	.byte	$0C
+	.addr	L0072
+	.byte	$01
+	.byte	$0D
+	.addr	L0076
+	.byte	$01
+	.byte	$0E
+	.addr	L007A
+	.byte	$01
+	.byte	$0F
+	.addr	L007E
+	.byte	$01
+	.byte	$10
+	.addr	L0082
+	.byte	$01
+	.byte	$11
+	.addr	L0086
+_AsmFrame:
+	.byte	$11
+	.byte	$17
+	.byte	$01
+	.byte	$13
+	.byte	$00
+	.byte	$00
+	.byte	$1E
+	.byte	$0F
+	.byte	$1D
+	.byte	$0E
+	.byte	$01
+	.addr	_AsmHandler
+	.byte	$00
+	.word	$0000
+_RegFrame:
+	.byte	$17
+	.byte	$05
+	.byte	$01
+	.byte	$04
+	.byte	$1E
+	.byte	$00
+	.byte	$27
+	.byte	$09
+	.byte	$08
+	.byte	$08
+	.byte	$01
+	.addr	_RegHandler
+	.byte	$08
+	.addr	_RegText
+_StackFrame:
+	.byte	$01
+	.byte	$04
+	.byte	$13
+	.byte	$04
+	.byte	$1E
+	.byte	$09
+	.byte	$27
+	.byte	$0F
+	.byte	$08
+	.byte	$05
+	.byte	$01
+	.addr	_StackHandler
+	.byte	$00
+	.word	$0000
+_CStackFrame:
+	.byte	$13
+	.byte	$04
+	.byte	$18
+	.byte	$03
+	.byte	$1E
+	.byte	$0F
+	.byte	$27
+	.byte	$17
+	.byte	$08
+	.byte	$07
+	.byte	$01
+	.addr	_CStackHandler
+	.byte	$00
+	.word	$0000
+_DumpFrame:
+	.byte	$01
+	.byte	$13
+	.byte	$1A
+	.byte	$18
+	.byte	$00
+	.byte	$0F
+	.byte	$1E
+	.byte	$17
+	.byte	$1D
+	.byte	$07
+	.byte	$01
+	.addr	_DumpHandler
+	.byte	$00
+	.word	$0000
+_HelpFrame:
+	.byte	$11
+	.byte	$05
+	.byte	$1A
+	.byte	$03
+	.byte	$00
+	.byte	$00
+	.byte	$27
+	.byte	$17
+	.byte	$26
+	.byte	$16
+	.byte	$00
+	.addr	_HelpHandler
+	.byte	$12
+	.addr	_HelpText
+_Frames:
+	.addr	_AsmFrame
+	.addr	_RegFrame
+	.addr	_StackFrame
+	.addr	_CStackFrame
+	.addr	_DumpFrame
+	.addr	_HelpFrame
+L004A:
+	.byte	$46,$33,$2C,$20,$75,$20,$20,$20,$20,$20,$52,$75,$6E,$20,$75,$6E
+	.byte	$74,$69,$6C,$20,$73,$75,$62,$72,$6F,$75,$74,$69,$6E,$65,$20,$72
+	.byte	$65,$74,$75,$72,$6E,$73,$00
+L0253:
+	.byte	$43,$61,$6E,$6E,$6F,$74,$20,$73,$65,$74,$20,$62,$72,$65,$61,$6B
+	.byte	$70,$6F,$69,$6E,$74,$20,$2D,$20,$70,$72,$65,$73,$73,$20,$61,$20
+	.byte	$6B,$65,$79,$00
+L025D:
+	.byte	$54,$6F,$6F,$20,$6D,$61,$6E,$79,$20,$62,$72,$65,$61,$6B,$70,$6F
+	.byte	$69,$6E,$74,$73,$20,$2D,$20,$70,$72,$65,$73,$73,$20,$61,$20,$6B
+	.byte	$65,$79,$00
+L0086:
+	.byte	$73,$20,$20,$20,$20,$20,$20,$20,$20,$20,$53,$6B,$69,$70,$20,$6E
+	.byte	$65,$78,$74,$20,$69,$6E,$73,$74,$72,$75,$63,$74,$69,$6F,$6E,$00
+L005A:
+	.byte	$31,$2D,$35,$20,$20,$20,$20,$20,$20,$20,$53,$65,$6C,$65,$63,$74
+	.byte	$20,$61,$63,$74,$69,$76,$65,$20,$77,$69,$6E,$64,$6F,$77,$00
+L007A:
+	.byte	$70,$20,$20,$20,$20,$20,$20,$20,$20,$20,$55,$73,$65,$20,$61,$73
+	.byte	$20,$6E,$65,$77,$20,$50,$43,$20,$76,$61,$6C,$75,$65,$00
+L0072:
+	.byte	$66,$20,$20,$20,$20,$20,$20,$20,$20,$20,$46,$6F,$6C,$6C,$6F,$77
+	.byte	$20,$69,$6E,$73,$74,$72,$75,$63,$74,$69,$6F,$6E,$00
+L0046:
+	.byte	$46,$32,$2C,$20,$74,$20,$20,$20,$20,$20,$54,$6F,$67,$67,$6C,$65
+	.byte	$20,$62,$72,$65,$61,$6B,$70,$6F,$69,$6E,$74,$00
+L0248:
+	.byte	$49,$6E,$76,$61,$6C,$69,$64,$20,$69,$6E,$70,$75,$74,$20,$2D,$20
+	.byte	$70,$72,$65,$73,$73,$20,$61,$20,$6B,$65,$79,$00
+L01AC:
+	.byte	$50,$72,$65,$73,$73,$20,$61,$6E,$79,$20,$6B,$65,$79,$20,$74,$6F
+	.byte	$20,$63,$6F,$6E,$74,$69,$6E,$75,$65,$00
+L004E:
+	.byte	$46,$34,$2C,$20,$68,$20,$20,$20,$20,$20,$52,$75,$6E,$20,$74,$6F
+	.byte	$20,$63,$75,$72,$73,$6F,$72,$00
+L0082:
+	.byte	$72,$20,$20,$20,$20,$20,$20,$20,$20,$20,$52,$65,$64,$72,$61,$77
+	.byte	$20,$73,$63,$72,$65,$65,$6E,$00
+L006A:
+	.byte	$61,$2F,$7A,$20,$20,$20,$20,$20,$20,$20,$4D,$6F,$76,$65,$20,$75
+	.byte	$70,$2F,$64,$6F,$77,$6E,$00
+L0066:
+	.byte	$43,$75,$72,$73,$6F,$72,$20,$20,$20,$20,$4D,$6F,$76,$65,$20,$75
+	.byte	$70,$2F,$64,$6F,$77,$6E,$00
+L0076:
+	.byte	$6F,$20,$20,$20,$20,$20,$20,$20,$20,$20,$47,$6F,$74,$6F,$20,$6F
+	.byte	$72,$69,$67,$69,$6E,$00
+L0052:
+	.byte	$46,$37,$2C,$20,$73,$70,$61,$63,$65,$20,$53,$74,$65,$70,$20,$69
+	.byte	$6E,$74,$6F,$00
+L0056:
+	.byte	$46,$38,$2C,$20,$65,$6E,$74,$65,$72,$20,$53,$74,$65,$70,$20,$6F
+	.byte	$76,$65,$72,$00
+L005E:
+	.byte	$2B,$20,$20,$20,$20,$20,$20,$20,$20,$20,$50,$61,$67,$65,$20,$64
+	.byte	$6F,$77,$6E,$00
+L006E:
+	.byte	$63,$20,$20,$20,$20,$20,$20,$20,$20,$20,$43,$6F,$6E,$74,$69,$6E
+	.byte	$75,$65,$00
+L0062:
+	.byte	$2D,$20,$20,$20,$20,$20,$20,$20,$20,$20,$50,$61,$67,$65,$20,$75
+	.byte	$70,$00
+L01A8:
+	.byte	$50,$72,$65,$73,$73,$20,$46,$31,$20,$66,$6F,$72,$20,$68,$65,$6C
+	.byte	$70,$00
+L007E:
+	.byte	$71,$20,$20,$20,$20,$20,$20,$20,$20,$20,$51,$75,$69,$74,$00
+L0042:
+	.byte	$46,$31,$2C,$20,$3F,$20,$20,$20,$20,$20,$48,$65,$6C,$70,$00
+L0247:
+	.byte	$47,$6F,$74,$6F,$3A,$20,$00
+L0026:
+	.byte	$53,$52,$00
+L003A:
+	.byte	$43,$53,$00
+L003E:
+	.byte	$48,$49,$00
+L0036:
+	.byte	$53,$50,$00
+L03D6:
+	.byte	$2D,$3E,$00
+L0022:
+	.byte	$50,$43,$00
+L002E:
+	.byte	$58,$00
+L002A:
+	.byte	$41,$00
+L0032:
+	.byte	$59,$00
+
+.segment	"BSS"
+
+_AsmAddr:
+	.res	2,$00
+_DumpAddr:
+	.res	2,$00
+_CStackAddr:
+	.res	2,$00
+_StackAddr:
+	.res	1,$00
+_PromptColor:
+	.res	1,$00
+_PromptLength:
+	.res	1,$00
+_DbgBreaks:
+	.res	48,$00
+
+; ---------------------------------------------------------------
+; unsigned char __near__ AsmHandler (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AsmHandler: near
+
+.segment	"CODE"
+
+	jsr     decsp3
+L032A:	jsr     _UpdateAsm
+	jsr     stax0sp
+	jsr     _GetKeyUpdate
+	ldy     #$02
+	sta     (sp),y
+	cmp     #$1C
+	jeq     L0353
+	cmp     #$1D
+	jeq     L035B
+	cmp     #$2B
+	beq     L0335
+	cmp     #$2D
+	beq     L0339
+	cmp     #$61
+	beq     L0353
+	cmp     #$66
+	beq     L0345
+	cmp     #$67
+	beq     L0348
+	cmp     #$6F
+	beq     L034C
+	cmp     #$70
+	beq     L034F
+	cmp     #$74
+	beq     L033F
+	cmp     #$7A
+	beq     L035B
+	cmp     #$B2
+	beq     L033F
+	jmp     L0551
+L0335:	jsr     ldax0sp
+	sta     _AsmAddr
+	stx     _AsmAddr+1
+	jmp     L032A
+L0339:	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     pushax
+	lda     _AsmFrame+9
+	jsr     _AsmBack
+	sta     _AsmAddr
+	stx     _AsmAddr+1
+	jmp     L032A
+L033F:	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     _DbgToggleUserBreak
+	jmp     L032A
+L0345:	jsr     _AsmFollow
+	jmp     L032A
+L0348:	lda     #<(_AsmAddr)
+	ldx     #>(_AsmAddr)
+	jsr     _InputGoto
+	jmp     L032A
+L034C:	jsr     _AsmHome
+	jmp     L032A
+L034F:	lda     _AsmAddr+1
+	sta     _brk_pc+1
+	lda     _AsmAddr
+	sta     _brk_pc
+	jmp     L032A
+L0353:	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     pushax
+	lda     #$01
+	jsr     _AsmBack
+	sta     _AsmAddr
+	stx     _AsmAddr+1
+	jmp     L032A
+L035B:	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     _DbgDisAsmLen
+	clc
+	adc     _AsmAddr
+	sta     _AsmAddr
+	txa
+	adc     _AsmAddr+1
+	sta     _AsmAddr+1
+	jmp     L032A
+L0551:	ldx     #$00
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ RegHandler (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_RegHandler: near
+
+.segment	"CODE"
+
+	jmp     _GetKeyUpdate
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ StackHandler (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_StackHandler: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     _StackFrame+9
+	jsr     pusha
+L03B5:	jsr     _GetKeyUpdate
+	ldy     #$01
+	sta     (sp),y
+	cmp     #$1C
+	beq     L03C9
+	cmp     #$1D
+	beq     L03CE
+	cmp     #$2B
+	beq     L03BE
+	cmp     #$2D
+	beq     L03C2
+	cmp     #$61
+	beq     L03C9
+	cmp     #$6F
+	beq     L03C6
+	cmp     #$7A
+	beq     L03CE
+	jmp     L0552
+L03BE:	dey
+	lda     (sp),y
+	clc
+	adc     _StackAddr
+	sta     _StackAddr
+	jmp     L03BC
+L03C2:	dey
+	lda     (sp),y
+	eor     #$FF
+	sec
+	adc     _StackAddr
+	sta     _StackAddr
+	jmp     L03BC
+L03C6:	jsr     _StackHome
+	jmp     L03BC
+L03C9:	dec     _StackAddr
+	jmp     L03BC
+L03CE:	inc     _StackAddr
+	jmp     L03BC
+L0552:	ldx     #$00
+	jmp     incsp2
+L03BC:	jsr     _UpdateStack
+	jmp     L03B5
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ CStackHandler (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_CStackHandler: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     _CStackFrame+9
+	asl     a
+	jsr     pusha
+L03F5:	jsr     _GetKeyUpdate
+	ldy     #$01
+	sta     (sp),y
+	cmp     #$1C
+	beq     L0409
+	cmp     #$1D
+	beq     L0410
+	cmp     #$2B
+	beq     L03FE
+	cmp     #$2D
+	beq     L0402
+	cmp     #$61
+	beq     L0409
+	cmp     #$6F
+	beq     L0406
+	cmp     #$7A
+	beq     L0410
+	jmp     L0553
+L03FE:	dey
+	lda     (sp),y
+	clc
+	adc     _CStackAddr
+	sta     _CStackAddr
+	tya
+	adc     _CStackAddr+1
+	sta     _CStackAddr+1
+	jmp     L03FC
+L0402:	dey
+	lda     (sp),y
+	eor     #$FF
+	sec
+	adc     _CStackAddr
+	sta     _CStackAddr
+	lda     #$FF
+	adc     _CStackAddr+1
+	sta     _CStackAddr+1
+	jmp     L03FC
+L0406:	jsr     _CStackHome
+	jmp     L03FC
+L0409:	lda     _CStackAddr
+	sec
+	sbc     #$02
+	sta     _CStackAddr
+	bcs     L03FC
+	dec     _CStackAddr+1
+	jmp     L03FC
+L0410:	lda     #$02
+	clc
+	adc     _CStackAddr
+	sta     _CStackAddr
+	bcc     L03FC
+	inc     _CStackAddr+1
+	jmp     L03FC
+L0553:	ldx     #$00
+	jmp     incsp2
+L03FC:	jsr     _UpdateCStack
+	jmp     L03F5
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ DumpHandler (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DumpHandler: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	ldx     #$00
+	lda     _DumpFrame+9
+	jsr     shlax3
+	jsr     pushax
+L0435:	jsr     _GetKeyUpdate
+	ldy     #$02
+	sta     (sp),y
+	cmp     #$1C
+	beq     L044D
+	cmp     #$1D
+	beq     L0454
+	cmp     #$2B
+	beq     L043E
+	cmp     #$2D
+	beq     L0442
+	cmp     #$61
+	beq     L044D
+	cmp     #$67
+	beq     L0446
+	cmp     #$6F
+	beq     L044A
+	cmp     #$7A
+	beq     L0454
+	jmp     L0554
+L043E:	jsr     ldax0sp
+	clc
+	adc     _DumpAddr
+	sta     _DumpAddr
+	txa
+	adc     _DumpAddr+1
+	sta     _DumpAddr+1
+	jmp     L043C
+L0442:	jsr     ldax0sp
+	eor     #$FF
+	sec
+	adc     _DumpAddr
+	sta     _DumpAddr
+	txa
+	eor     #$FF
+	adc     _DumpAddr+1
+	sta     _DumpAddr+1
+	jmp     L043C
+L0446:	lda     #<(_DumpAddr)
+	ldx     #>(_DumpAddr)
+	jsr     _InputGoto
+	jmp     L043C
+L044A:	jsr     _DumpHome
+	jmp     L043C
+L044D:	lda     _DumpAddr
+	sec
+	sbc     #$08
+	sta     _DumpAddr
+	bcs     L043C
+	dec     _DumpAddr+1
+	jmp     L043C
+L0454:	lda     #$08
+	clc
+	adc     _DumpAddr
+	sta     _DumpAddr
+	bcc     L043C
+	inc     _DumpAddr+1
+	jmp     L043C
+L0554:	ldx     #$00
+	jmp     incsp3
+L043C:	jsr     _UpdateDump
+	jmp     L0435
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ HelpHandler (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_HelpHandler: near
+
+.segment	"CODE"
+
+	lda     _ActiveFrame
+	ldx     _ActiveFrame+1
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #$01
+	jsr     _ActivateFrame
+	jsr     _AnyKeyPrompt
+	jsr     _cgetc
+	ldy     #$00
+	lda     (sp),y
+	jsr     _Redraw
+	ldx     #$00
+	txa
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DisplayPrompt (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DisplayPrompt: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp1
+	lda     #$0E
+	ldy     #$00
+	sta     (sp),y
+	lda     _ActivePrompt
+	ora     _ActivePrompt+1
+	beq     L0182
+	lda     #$28
+	sec
+	sbc     _PromptLength
+	lsr     a
+	jsr     pusha
+	lda     #$17
+	jsr     pusha
+	lda     _PromptLength
+	jsr     _chlinexy
+L0182:	ldy     #$02
+	jsr     ldaxysp
+	sta     _ActivePrompt
+	stx     _ActivePrompt+1
+	ldy     #$00
+	lda     (sp),y
+	sta     _PromptColor
+	lda     _ActivePrompt
+	ldx     _ActivePrompt+1
+	jsr     _strlen
+	sta     _PromptLength
+	lda     #$28
+	sec
+	sbc     _PromptLength
+	lsr     a
+	jsr     pusha
+	lda     #$17
+	jsr     pusha
+	lda     _ActivePrompt
+	ldx     _ActivePrompt+1
+	jsr     _cputsxy
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ SingleStep (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_SingleStep: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jsr     decsp1
+	lda     _brk_pc+1
+	sta     ptr1+1
+	lda     _brk_pc
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	cmp     #$10
+	beq     L048C
+	cmp     #$20
+	beq     L049F
+	cmp     #$30
+	beq     L048C
+	cmp     #$40
+	beq     L049A
+	cmp     #$4C
+	beq     L0476
+	cmp     #$50
+	beq     L048C
+	cmp     #$60
+	beq     L0497
+	cmp     #$6C
+	beq     L047A
+	cmp     #$70
+	beq     L048C
+	cmp     #$90
+	beq     L048C
+	cmp     #$B0
+	beq     L048C
+	cmp     #$D0
+	beq     L048C
+	cmp     #$F0
+	beq     L048C
+	jmp     L0474
+L0476:	jsr     _GetArg16
+	jmp     L0555
+L047A:	jsr     _GetArg16
+	jsr     ldaxi
+	jmp     L0555
+L048C:	lda     _brk_pc
+	ldx     _brk_pc+1
+	iny
+	jsr     ldaidx
+	dey
+	sta     (sp),y
+	lda     (sp),y
+	beq     L0474
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0495
+	dex
+L0495:	clc
+	adc     _brk_pc
+	pha
+	txa
+	adc     _brk_pc+1
+	tax
+	pla
+	jsr     incax2
+	jsr     _DbgSetTmpBreak
+	jmp     L0474
+L0497:	jsr     _SetRTSBreak
+	jmp     incsp2
+L049A:	lda     #$01
+	jsr     _GetStack16
+	jmp     L0555
+L049F:	iny
+	lda     (sp),y
+	beq     L0474
+	jsr     _GetArg16
+	jmp     L0555
+L0474:	lda     _brk_pc
+	ldx     _brk_pc+1
+	jsr     pushax
+	lda     _brk_pc
+	ldx     _brk_pc+1
+	jsr     _DbgDisAsmLen
+	jsr     tosaddax
+L0555:	jsr     _DbgSetTmpBreak
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ RedrawStatic (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_RedrawStatic: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	lda     #$FF
+	sta     _ActiveFrame
+	sta     _ActiveFrame+1
+	lda     #$00
+	jsr     _bordercolor
+	lda     #$00
+	jsr     _bgcolor
+	jsr     _clrscr
+	lda     #$00
+	jsr     _cursor
+	jsr     _DrawFrames
+	jsr     _HelpPrompt
+	ldy     #$00
+	lda     (sp),y
+	jsr     pusha0
+	lda     #$00
+	jsr     _ActivateFrame
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ Redraw (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Redraw: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldy     #$00
+	lda     (sp),y
+	jsr     _RedrawStatic
+	jsr     _UpdateAsm
+	jsr     _UpdateReg
+	jsr     _UpdateStack
+	jsr     _UpdateCStack
+	jsr     _UpdateDump
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ GetKeyUpdate (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_GetKeyUpdate: near
+
+.segment	"BSS"
+
+L04CF:
+	.res	1,$00
+
+.segment	"CODE"
+
+	jmp     L04D2
+L0556:	lda     L04CF
+	beq     L04D8
+	cmp     #$01
+	beq     L04DB
+	cmp     #$02
+	beq     L04DE
+	cmp     #$03
+	beq     L04E1
+	jmp     L0557
+L04D8:	jsr     _UpdateAsm
+	jmp     L0557
+L04DB:	jsr     _UpdateStack
+	jmp     L0557
+L04DE:	jsr     _UpdateCStack
+	jmp     L0557
+L04E1:	jsr     _UpdateDump
+L0557:	lda     L04CF
+	clc
+	adc     #$01
+	and     #$03
+	sta     L04CF
+L04D2:	jsr     _kbhit
+	tax
+	beq     L0556
+	jmp     _cgetc
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DrawFrame (register __near__ const struct $anon-struct-0018 *, unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DrawFrame: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldy     #$01
+	ldx     #$04
+	jsr     regswap2
+	ldy     #$0B
+	jsr     subysp
+	ldy     #$0B
+	lda     (sp),y
+	beq     L00ED
+	lda     #$0E
+	ldy     #$00
+	sta     (sp),y
+	lda     #$11
+	ldy     #$07
+	sta     (sp),y
+	lda     #$05
+	dey
+	sta     (sp),y
+	lda     #$1A
+	dey
+	sta     (sp),y
+	lda     #$03
+	jmp     L0559
+L00ED:	lda     #$0E
+	ldy     #$00
+	sta     (sp),y
+	lda     (regbank+4),y
+	ldy     #$07
+	sta     (sp),y
+	ldy     #$01
+	lda     (regbank+4),y
+	ldy     #$06
+	sta     (sp),y
+	ldy     #$02
+	lda     (regbank+4),y
+	ldy     #$05
+	sta     (sp),y
+	ldy     #$03
+	lda     (regbank+4),y
+L0559:	ldy     #$04
+	sta     (sp),y
+	lda     (regbank+4),y
+	dey
+	sta     (sp),y
+	ldy     #$05
+	lda     (regbank+4),y
+	ldy     #$02
+	sta     (sp),y
+	ldy     #$08
+	lda     (regbank+4),y
+	ldy     #$01
+	sta     (sp),y
+	ldy     #$03
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$03
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$09
+	lda     (sp),y
+	jsr     _cputcxy
+	ldy     #$01
+	lda     (sp),y
+	jsr     _chline
+	ldy     #$06
+	lda     (sp),y
+	jsr     _cputc
+	ldy     #$03
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$03
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	jsr     pusha
+	ldy     #$09
+	lda     (regbank+4),y
+	jsr     _cvlinexy
+	ldy     #$05
+	lda     (sp),y
+	jsr     _cputc
+	ldy     #$01
+	lda     (sp),y
+	jsr     _chline
+	ldy     #$04
+	lda     (sp),y
+	jsr     _cputc
+	ldy     #$06
+	lda     (regbank+4),y
+	jsr     pusha
+	ldy     #$03
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$09
+	lda     (regbank+4),y
+	jsr     _cvlinexy
+	ldy     #$0D
+	lda     (regbank+4),y
+	ldy     #$08
+	sta     (sp),y
+	ldy     #$0F
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	ldy     #$09
+	jsr     staxysp
+	jmp     L0136
+L0134:	ldy     #$03
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$0C
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     tosadda0
+	jsr     pusha
+	ldy     #$03
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$0D
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	jsr     tosadda0
+	jsr     pusha
+	ldy     #$0C
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     _cputsxy
+	ldy     #$09
+	ldx     #$00
+	lda     #$04
+	jsr     addeqysp
+L0136:	ldy     #$08
+	lda     (sp),y
+	pha
+	sec
+	sbc     #$01
+	sta     (sp),y
+	pla
+	tax
+	bne     L0134
+	ldy     #$0C
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	iny
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DrawFrames (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DrawFrames: near
+
+.segment	"CODE"
+
+	jsr     decsp3
+	lda     #$00
+	ldy     #$02
+L055B:	sta     (sp),y
+	cmp     #$06
+	bcs     L0145
+	ldx     #$00
+	asl     a
+	bcc     L055C
+	inx
+	clc
+L055C:	adc     #<(_Frames)
+	tay
+	txa
+	adc     #>(_Frames)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     stax0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$0A
+	lda     (ptr1),y
+	beq     L0146
+	jsr     pushw0sp
+	lda     #$00
+	jsr     _DrawFrame
+L0146:	ldy     #$02
+	clc
+	lda     #$01
+	adc     (sp),y
+	jmp     L055B
+L0145:	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ ActivateFrame (int, unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ActivateFrame: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jsr     decsp1
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	cpx     _ActiveFrame+1
+	bne     L055F
+	cmp     _ActiveFrame
+	jeq     L0158
+L055F:	ldx     _ActiveFrame+1
+	bmi     L015A
+	lda     _ActiveFrame
+	jsr     aslax1
+	clc
+	adc     #<(_Frames)
+	tay
+	txa
+	adc     #>(_Frames)
+	tax
+	tya
+	jsr     pushw
+	lda     #$00
+	jsr     _DrawFrame
+L015A:	ldy     #$05
+	jsr     ldaxysp
+	sta     _ActiveFrame
+	stx     _ActiveFrame+1
+	txa
+	bmi     L0160
+	lda     _ActiveFrame
+	jsr     aslax1
+	clc
+	adc     #<(_Frames)
+	tay
+	txa
+	adc     #>(_Frames)
+	tax
+	tya
+	jsr     ldaxi
+	sta     regbank+4
+	stx     regbank+4+1
+	ldy     #$03
+	lda     (sp),y
+	beq     L016A
+	ldy     #$05
+	lda     (regbank+4),y
+	clc
+	adc     #$01
+	ldy     #$02
+L055E:	sta     (sp),y
+	jsr     pusha0
+	ldy     #$07
+	lda     (regbank+4),y
+	jsr     tosicmp0
+	bcs     L016A
+	ldy     #$04
+	lda     (regbank+4),y
+	clc
+	adc     #$01
+	jsr     pusha
+	ldy     #$03
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$08
+	lda     (regbank+4),y
+	jsr     _cclearxy
+	ldy     #$02
+	clc
+	lda     #$01
+	adc     (sp),y
+	jmp     L055E
+L016A:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	lda     #$01
+	jsr     _DrawFrame
+L0160:	lda     _ActivePrompt
+	ldx     _ActivePrompt+1
+	jsr     _DisplayPrompt
+L0158:	ldy     #$00
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ HelpPrompt (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_HelpPrompt: near
+
+.segment	"CODE"
+
+	lda     #<(L01A8)
+	ldx     #>(L01A8)
+	jmp     _DisplayPrompt
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ AnyKeyPrompt (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AnyKeyPrompt: near
+
+.segment	"CODE"
+
+	lda     #<(L01AC)
+	ldx     #>(L01AC)
+	jmp     _DisplayPrompt
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ IsAbortKey (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_IsAbortKey: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldx     #$00
+	lda     (sp,x)
+	cmp     #$1B
+	bne     L0560
+	lda     #$01
+	jmp     incsp1
+L0560:	txa
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ Input (__near__ unsigned char *, __near__ unsigned char *, unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Input: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jsr     decsp8
+	lda     #$00
+	jsr     pusha
+	lda     #$17
+	jsr     pusha
+	lda     #$28
+	jsr     _cclearxy
+	lda     #$0E
+	ldy     #$05
+	sta     (sp),y
+	lda     #$00
+	jsr     pusha
+	lda     #$17
+	jsr     pusha
+	ldy     #$0E
+	jsr     ldaxysp
+	jsr     _cputsxy
+	jsr     _wherex
+	ldy     #$03
+	sta     (sp),y
+	lda     #$01
+	jsr     _cursor
+	ldy     #$04
+	sta     (sp),y
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+L01D2:	jsr     _cgetc
+	ldy     #$00
+	sta     (sp),y
+	ldx     #$00
+	jsr     _isalnum
+	stx     tmp1
+	ora     tmp1
+	beq     L01D7
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$08
+	cmp     (sp),y
+	bcs     L01D7
+	clc
+	iny
+	adc     (sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	ldy     #$00
+	lda     (sp),y
+	sta     (ptr1),y
+	ldy     #$02
+	lda     (sp),y
+	clc
+	iny
+	adc     (sp),y
+	jsr     pusha
+	lda     #$17
+	jsr     pusha
+	ldy     #$02
+	lda     (sp),y
+	jsr     _cputcxy
+	ldy     #$02
+	clc
+	lda     #$01
+	adc     (sp),y
+	jmp     L0564
+L01D7:	ldy     #$02
+	lda     (sp),y
+	beq     L01E5
+	ldy     #$00
+	lda     (sp),y
+	cmp     #$7E
+	bne     L056B
+	ldy     #$02
+	lda     (sp),y
+	sec
+	sbc     #$01
+	sta     (sp),y
+	clc
+	iny
+	adc     (sp),y
+	jsr     pusha
+	lda     #$17
+	jsr     pusha
+	lda     #$20
+	jsr     _cputcxy
+	ldy     #$02
+	lda     (sp),y
+	clc
+	iny
+	adc     (sp),y
+	jsr     pusha
+	lda     #$17
+	jsr     _gotoxy
+	jmp     L01FA
+L01E5:	tay
+L056B:	lda     (sp),y
+	cmp     #$9B
+	bne     L0569
+	ldy     #$02
+	lda     (sp),y
+	clc
+	ldy     #$09
+	adc     (sp),y
+	sta     ptr1
+	lda     #$00
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	lda     #$01
+	jmp     L056A
+L0569:	jsr     _IsAbortKey
+	tax
+	beq     L01FA
+	lda     #$02
+L056A:	ldy     #$01
+L0564:	sta     (sp),y
+L01FA:	ldy     #$01
+	lda     (sp),y
+	jeq     L01D2
+	ldy     #$04
+	lda     (sp),y
+	jsr     _cursor
+	jsr     _DrawFrames
+	lda     _ActiveFrame
+	ldx     _ActiveFrame+1
+	ldy     #$06
+	jsr     staxysp
+	lda     #$FF
+	sta     _ActiveFrame
+	sta     _ActiveFrame+1
+	ldy     #$09
+	jsr     pushwysp
+	lda     #$00
+	jsr     _ActivateFrame
+	ldy     #$01
+	lda     (sp),y
+	cmp     #$01
+	jsr     booleq
+	ldy     #$0D
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ InputHex (__near__ unsigned char *, __near__ unsigned int *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_InputHex: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$0A
+	jsr     subysp
+	ldy     #$0F
+	jsr     pushwysp
+	lda     #$07
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$04
+	jsr     _Input
+	tax
+	jeq     L023D
+	ldy     #$05
+	lda     (sp),y
+	ldx     #$00
+	jsr     _isxdigit
+	stx     tmp1
+	ora     tmp1
+	bne     L0215
+	tax
+	jmp     L023D
+L0215:	lda     #$05
+	jsr     leaa0sp
+	ldy     #$03
+	jsr     staxysp
+	ldx     #$00
+	txa
+	jsr     stax0sp
+	jmp     L0224
+L0222:	jsr     ldax0sp
+	jsr     shlax4
+	jsr     stax0sp
+	ldy     #$02
+	lda     (sp),y
+	ldx     #$00
+	jsr     _isdigit
+	stx     tmp1
+	ora     tmp1
+	beq     L022D
+	ldy     #$02
+	lda     (sp),y
+	sec
+	sbc     #$30
+	jmp     L056D
+L022D:	ldy     #$02
+	lda     (sp),y
+	ldx     #$00
+	jsr     _toupper
+	ldy     #$37
+	jsr     decaxy
+	ldy     #$02
+L056D:	sta     (sp),y
+	ldx     #$00
+	jsr     addeq0sp
+	ldy     #$03
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0224:	ldy     #$04
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	ldy     #$02
+	sta     (sp),y
+	tax
+	beq     L056C
+	ldx     #$00
+	jsr     _isxdigit
+	stx     tmp1
+	ora     tmp1
+	bne     L0222
+L056C:	ldy     #$0B
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	jsr     ldax0sp
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	ldx     #$00
+	tya
+L023D:	ldy     #$0E
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ ErrorPrompt (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ErrorPrompt: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     _ActivePrompt
+	ldx     _ActivePrompt+1
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _DisplayPrompt
+	jsr     _cgetc
+	jsr     ldax0sp
+	jsr     _DisplayPrompt
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ InputGoto (__near__ unsigned int *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_InputGoto: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp1
+	lda     #<(L0247)
+	ldx     #>(L0247)
+	jsr     pushax
+	ldy     #$04
+	jsr     ldaxysp
+	jsr     _InputHex
+	ldy     #$00
+	sta     (sp),y
+	lda     (sp),y
+	bne     L0573
+	lda     #<(L0248)
+	ldx     #>(L0248)
+	jsr     _ErrorPrompt
+L0573:	ldx     #$00
+	lda     (sp,x)
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ BreakInRomError (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_BreakInRomError: near
+
+.segment	"CODE"
+
+	lda     #<(L0253)
+	ldx     #>(L0253)
+	jmp     _ErrorPrompt
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DbgSetTmpBreak (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DbgSetTmpBreak: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     _DbgGetBreakSlot
+	jsr     pushax
+	jsr     ldax0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	jsr     ldax0sp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$80
+	ldy     #$03
+	sta     (ptr1),y
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DbgToggleUserBreak (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DbgToggleUserBreak: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _DbgIsBreak
+	sta     regbank+4
+	stx     regbank+4+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0260
+	lda     #$00
+	ldy     #$03
+	sta     (regbank+4),y
+	dec     _DbgBreakCount
+	jmp     L026F
+L0260:	lda     _DbgBreakCount
+	cmp     #$0A
+	bcc     L0266
+	lda     #<(L025D)
+	ldx     #>(L025D)
+	jsr     _ErrorPrompt
+	jmp     L026F
+L0266:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _DbgIsRAM
+	stx     tmp1
+	ora     tmp1
+	bne     L026B
+	jsr     _BreakInRomError
+	jmp     L026F
+L026B:	jsr     _DbgGetBreakSlot
+	sta     regbank+4
+	stx     regbank+4+1
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	tya
+	ldy     #$03
+	sta     (regbank+4),y
+	inc     _DbgBreakCount
+L026F:	ldy     #$00
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DbgResetTmpBreaks (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DbgResetTmpBreaks: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     #<(_DbgBreaks)
+	ldx     #>(_DbgBreaks)
+	jsr     pushax
+	lda     #$00
+	ldy     #$02
+L0575:	sta     (sp),y
+	cmp     #$0A
+	bcs     L027A
+	jsr     ldax0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$03
+	lda     (ptr1),y
+	cmp     #$80
+	bne     L0281
+	jsr     ldax0sp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$00
+	ldy     #$03
+	sta     (ptr1),y
+L0281:	ldx     #$00
+	lda     #$04
+	jsr     addeq0sp
+	ldy     #$02
+	clc
+	lda     #$01
+	adc     (sp),y
+	jmp     L0575
+L027A:	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ DbgTmpBreaksOk (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DbgTmpBreaksOk: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     #<(_DbgBreaks)
+	ldx     #>(_DbgBreaks)
+	jsr     pushax
+	lda     #$00
+	ldy     #$02
+L0576:	sta     (sp),y
+	ldx     #$00
+	cmp     #$0A
+	bcs     L0578
+	jsr     ldax0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$03
+	lda     (ptr1),y
+	cmp     #$80
+	bne     L0290
+	jsr     ldax0sp
+	jsr     ldaxi
+	jsr     _DbgIsRAM
+	stx     tmp1
+	ora     tmp1
+	bne     L0290
+	jsr     _BreakInRomError
+	jsr     _DbgResetTmpBreaks
+	ldx     #$00
+	txa
+	jmp     incsp3
+L0290:	ldx     #$00
+	lda     #$04
+	jsr     addeq0sp
+	ldy     #$02
+	clc
+	lda     #$01
+	adc     (sp),y
+	jmp     L0576
+L0578:	lda     #$01
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ AsmBack (unsigned int, unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AsmBack: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldy     #$43
+	jsr     subysp
+	lda     #$06
+	jsr     pusha0
+L029D:	lda     #$00
+	ldy     #$02
+	sta     (sp),y
+	ldy     #$49
+	jsr     pushwysp
+	ldy     #$47
+	ldx     #$00
+	lda     (sp),y
+	jsr     mulax3
+	jsr     tossubax
+	sec
+	ldy     #$00
+	sbc     (sp),y
+	pha
+	txa
+	iny
+	sbc     (sp),y
+	tax
+	pla
+	ldy     #$43
+	jsr     staxysp
+L02A6:	ldy     #$44
+	jsr     ldaxysp
+	jsr     _DbgDisAsmLen
+	ldy     #$43
+	jsr     addeqysp
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L057C
+	inx
+	clc
+L057C:	adc     #$03
+	bcc     L02AF
+	inx
+	clc
+L02AF:	adc     sp
+	sta     ptr1
+	txa
+	adc     sp+1
+	sta     ptr1+1
+	ldy     #$44
+	jsr     ldaxysp
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	iny
+	lda     (sp),y
+	clc
+	adc     #$01
+	and     #$1F
+	sta     (sp),y
+	ldy     #$44
+	jsr     ldaxysp
+	ldy     #$46
+	cmp     (sp),y
+	txa
+	iny
+	sbc     (sp),y
+	bcc     L02A6
+	ldy     #$44
+	jsr     ldaxysp
+	ldy     #$46
+	cmp     (sp),y
+	bne     L057E
+	txa
+	iny
+	cmp     (sp),y
+	beq     L02B7
+L057E:	ldy     #$01
+	lda     (sp),y
+	bne     L0580
+	dey
+	lda     (sp),y
+	cmp     #$0C
+	bne     L0580
+L02B7:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	sec
+	ldy     #$45
+	sbc     (sp),y
+	sec
+	sbc     #$01
+	and     #$1F
+	asl     a
+	bcc     L057D
+	inx
+	clc
+L057D:	adc     #$03
+	bcc     L02BD
+	inx
+	clc
+L02BD:	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     ldaxi
+	jmp     L029E
+L0580:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	jmp     L029D
+L029E:	ldy     #$48
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ UpdateAsm (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_UpdateAsm: near
+
+.segment	"CODE"
+
+	ldy     #$2A
+	jsr     subysp
+	lda     _AsmFrame+8
+	jsr     pusha
+	lda     _AsmFrame+4
+	clc
+	adc     #$01
+	jsr     pusha
+	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     pushax
+	lda     #$02
+	jsr     _AsmBack
+	jsr     pushax
+	lda     _AsmFrame+5
+	clc
+	adc     #$01
+	ldy     #$04
+L0583:	sta     (sp),y
+	cmp     _AsmFrame+7
+	jcs     L02C8
+	jsr     pushw0sp
+	lda     #$08
+	jsr     leaa0sp
+	jsr     pushax
+	ldy     #$07
+	lda     (sp),y
+	jsr     _DbgDisAsm
+	ldy     #$05
+	sta     (sp),y
+	jsr     ldax0sp
+	cpx     _brk_pc+1
+	bne     L02D4
+	cmp     _brk_pc
+	bne     L02D4
+	lda     #$2D
+	ldy     #$0A
+	sta     (sp),y
+	lda     #$3E
+	iny
+	sta     (sp),y
+L02D4:	jsr     ldax0sp
+	jsr     _DbgIsBreak
+	stx     tmp1
+	ora     tmp1
+	beq     L02DC
+	lda     #$2A
+	ldy     #$0B
+	sta     (sp),y
+L02DC:	jsr     ldax0sp
+	cpx     _AsmAddr+1
+	bne     L02E2
+	cmp     _AsmAddr
+	bne     L02E2
+	lda     #$01
+	jsr     _revers
+	lda     #$01
+	jsr     pusha
+	ldy     #$05
+	lda     (sp),y
+	jsr     pusha
+	lda     #$08
+	jsr     leaa0sp
+	jsr     _cputsxy
+	lda     #$00
+	jsr     _revers
+	jmp     L02EC
+L02E2:	lda     #$01
+	jsr     pusha
+	ldy     #$05
+	lda     (sp),y
+	jsr     pusha
+	lda     #$08
+	jsr     leaa0sp
+	jsr     _cputsxy
+L02EC:	ldy     #$05
+	lda     (sp),y
+	ldx     #$00
+	jsr     addeq0sp
+	ldy     #$04
+	clc
+	lda     #$01
+	adc     (sp),y
+	jmp     L0583
+L02C8:	jsr     ldax0sp
+	ldy     #$2E
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ AsmArg16 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AsmArg16: near
+
+.segment	"CODE"
+
+	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     incax1
+	ldy     #$01
+	jmp     ldaxidx
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ AsmFollow (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AsmFollow: near
+
+.segment	"CODE"
+
+	lda     _AsmAddr+1
+	sta     ptr1+1
+	lda     _AsmAddr
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	cmp     #$10
+	beq     L0306
+	cmp     #$20
+	beq     L02FC
+	cmp     #$30
+	beq     L0306
+	cmp     #$40
+	beq     L0588
+	cmp     #$4C
+	beq     L02FC
+	cmp     #$50
+	beq     L0306
+	cmp     #$60
+	beq     L0587
+	cmp     #$6C
+	beq     L0302
+	cmp     #$70
+	beq     L0306
+	cmp     #$90
+	beq     L0306
+	cmp     #$B0
+	beq     L0306
+	cmp     #$D0
+	beq     L0306
+	cmp     #$F0
+	beq     L0306
+	rts
+L02FC:	jsr     _AsmArg16
+	jmp     L0589
+L0302:	jsr     _AsmArg16
+	jmp     L0585
+L0306:	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     incax2
+	jsr     pushax
+	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     incax1
+	ldy     #$00
+	jsr     ldaidx
+	jsr     tosaddax
+	jmp     L0589
+L0587:	ldx     #$01
+	txa
+	clc
+	adc     _DbgSP
+	bcc     L0584
+	inx
+L0584:	jsr     ldaxi
+	jsr     incax1
+	jmp     L0589
+L0588:	ldx     #$01
+	lda     #$02
+	clc
+	adc     _DbgSP
+	bcc     L0585
+	inx
+L0585:	jsr     ldaxi
+L0589:	sta     _AsmAddr
+	stx     _AsmAddr+1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ AsmHome (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AsmHome: near
+
+.segment	"CODE"
+
+	lda     _brk_pc+1
+	sta     _AsmAddr+1
+	lda     _brk_pc
+	sta     _AsmAddr
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ InitAsm (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_InitAsm: near
+
+.segment	"CODE"
+
+	jsr     _AsmHome
+	jmp     _UpdateAsm
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ UpdateReg (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_UpdateReg: near
+
+.segment	"CODE"
+
+	lda     _RegFrame+4
+	clc
+	adc     #$05
+	jsr     pusha
+	ldy     #$00
+	lda     (sp),y
+	clc
+	adc     #$02
+	jsr     pusha
+	lda     _RegFrame+5
+	jsr     pusha
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	jsr     _gotoxy
+	lda     _brk_pc
+	ldx     _brk_pc+1
+	jsr     _cputhex16
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	jsr     _gotoxy
+	lda     _brk_sr
+	jsr     _cputhex8
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	jsr     _gotoxy
+	lda     _brk_a
+	jsr     _cputhex8
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	jsr     _gotoxy
+	lda     _brk_x
+	jsr     _cputhex8
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	jsr     _gotoxy
+	lda     _brk_y
+	jsr     _cputhex8
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	jsr     _gotoxy
+	lda     _DbgSP
+	jsr     _cputhex8
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	jsr     _gotoxy
+	lda     _DbgCS
+	ldx     _DbgCS+1
+	jsr     _cputhex16
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	jsr     _gotoxy
+	lda     _DbgHI
+	ldx     _DbgHI+1
+	jsr     _cputhex16
+	ldx     #$00
+	txa
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ InitReg (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_InitReg: near
+
+.segment	"CODE"
+
+	jmp     _UpdateReg
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ UpdateStack (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_UpdateStack: near
+
+.segment	"CODE"
+
+	lda     _StackAddr
+	jsr     pusha
+	lda     _StackFrame+4
+	clc
+	adc     #$01
+	jsr     pusha
+	ldy     #$00
+	lda     (sp),y
+	clc
+	adc     #$06
+	jsr     pusha
+	jsr     decsp1
+	lda     _StackFrame+7
+	sec
+	sbc     #$01
+	ldy     #$00
+L058D:	sta     (sp),y
+	ldx     #$00
+	sec
+	sbc     _StackFrame+5
+	sta     tmp1
+	lda     tmp1
+	beq     L0399
+	bcc     L0399
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	lda     (sp),y
+	jsr     _gotoxy
+	ldy     #$03
+	lda     (sp),y
+	jsr     _cputhex8
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	lda     (sp),y
+	jsr     _gotoxy
+	ldx     #$01
+	lda     #$00
+	clc
+	ldy     #$03
+	adc     (sp),y
+	bcc     L058B
+	inx
+L058B:	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	jsr     _cputhex8
+	ldy     #$03
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$00
+	lda     (sp),y
+	sec
+	sbc     #$01
+	jmp     L058D
+L0399:	ldy     #$03
+	lda     (sp),y
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ StackHome (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_StackHome: near
+
+.segment	"CODE"
+
+	lda     _DbgSP
+	clc
+	adc     #$01
+	sta     _StackAddr
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ InitStack (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_InitStack: near
+
+.segment	"CODE"
+
+	jsr     _StackHome
+	jmp     _UpdateStack
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ UpdateCStack (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_UpdateCStack: near
+
+.segment	"CODE"
+
+	lda     _CStackAddr
+	ldx     _CStackAddr+1
+	jsr     pushax
+	lda     _CStackFrame+4
+	clc
+	adc     #$05
+	jsr     pusha
+	jsr     decsp1
+	lda     _CStackFrame+7
+	sec
+	sbc     #$01
+	ldy     #$00
+L058F:	sta     (sp),y
+	sec
+	sbc     _CStackFrame+5
+	sta     tmp1
+	lda     tmp1
+	beq     L0590
+	bcc     L0590
+	iny
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	lda     (sp),y
+	jsr     _gotoxy
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     ldaxi
+	jsr     _cputhex16
+	ldy     #$02
+	ldx     #$00
+	tya
+	jsr     addeqysp
+	ldy     #$00
+	lda     (sp),y
+	sec
+	sbc     #$01
+	jmp     L058F
+L0590:	lda     _CStackFrame+4
+	clc
+	adc     #$01
+	jsr     pusha
+	lda     _CStackFrame+7
+	sec
+	sbc     #$01
+	jsr     pusha
+	lda     #<(L03D6)
+	ldx     #>(L03D6)
+	jsr     _cputsxy
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ CStackHome (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_CStackHome: near
+
+.segment	"CODE"
+
+	lda     _DbgCS+1
+	sta     _CStackAddr+1
+	lda     _DbgCS
+	sta     _CStackAddr
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ InitCStack (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_InitCStack: near
+
+.segment	"CODE"
+
+	jsr     _CStackHome
+	jmp     _UpdateCStack
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ UpdateDump (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_UpdateDump: near
+
+.segment	"CODE"
+
+	ldy     #$29
+	jsr     subysp
+	lda     _DumpAddr
+	ldx     _DumpAddr+1
+	jsr     pushax
+	lda     _DumpFrame+4
+	clc
+	adc     #$01
+	jsr     pusha
+	ldy     #$04
+	jsr     pushwysp
+	lda     _DumpFrame+5
+	clc
+	adc     #$01
+	ldy     #$05
+L0591:	sta     (sp),y
+	cmp     _DumpFrame+7
+	bcs     L041F
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$06
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$08
+	jsr     pushwysp
+	lda     #$0A
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$08
+	jsr     pusha
+	jsr     _DbgMemDump
+	jsr     _cputsxy
+	ldy     #$03
+	ldx     #$00
+	lda     #$08
+	jsr     addeqysp
+	ldy     #$05
+	clc
+	lda     #$01
+	adc     (sp),y
+	jmp     L0591
+L041F:	dey
+	jsr     ldaxysp
+	ldy     #$2E
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DumpHome (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DumpHome: near
+
+.segment	"CODE"
+
+	lda     #$00
+	sta     _DumpAddr
+	sta     _DumpAddr+1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ GetArg16 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_GetArg16: near
+
+.segment	"CODE"
+
+	lda     _brk_pc
+	ldx     _brk_pc+1
+	jsr     incax1
+	ldy     #$01
+	jmp     ldaxidx
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ GetStack16 (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_GetStack16: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldx     #$00
+	lda     (sp,x)
+	clc
+	adc     _DbgSP
+	bcc     L0592
+	inx
+L0592:	sta     ptr1
+	stx     ptr1+1
+	ldx     #$01
+	txa
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	jsr     ldaxi
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ SetRTSBreak (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_SetRTSBreak: near
+
+.segment	"CODE"
+
+	lda     #$00
+	jsr     _GetStack16
+	jsr     incax1
+	jmp     _DbgSetTmpBreak
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DbgEntry (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DbgEntry: near
+
+.segment	"DATA"
+
+L04E8:
+	.byte	$01
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     L04E8
+	beq     L04EA
+	lda     #$00
+	sta     L04E8
+	jsr     _RedrawStatic
+	jsr     _InitAsm
+	jsr     _InitReg
+	jsr     _InitStack
+	jsr     _InitCStack
+	jsr     _UpdateDump
+L04EA:	jsr     _AsmHome
+	jsr     _UpdateReg
+	jsr     _StackHome
+	jsr     _CStackHome
+	lda     #$00
+	tay
+	sta     (sp),y
+	jmp     L0597
+L04FB:	lda     _ActiveFrame
+	ldx     _ActiveFrame+1
+	jsr     aslax1
+	clc
+	adc     #<(_Frames)
+	tay
+	txa
+	adc     #>(_Frames)
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$0C
+	jsr     ldaxidx
+	jsr     callax
+	ldy     #$01
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	jeq     L0596
+	cmp     #$20
+	jeq     L0529
+	cmp     #$31
+	beq     L0595
+	cmp     #$32
+	beq     L0595
+	cmp     #$33
+	beq     L0595
+	cmp     #$34
+	beq     L0595
+	cmp     #$35
+	beq     L0595
+	cmp     #$3F
+	beq     L0513
+	cmp     #$63
+	jeq     L0596
+	cmp     #$68
+	beq     L051F
+	cmp     #$71
+	jeq     L054D
+	cmp     #$72
+	jeq     L0549
+	cmp     #$73
+	jeq     L0543
+	cmp     #$75
+	beq     L0518
+	cmp     #$9B
+	beq     L0533
+	cmp     #$B1
+	beq     L0513
+	cmp     #$B3
+	beq     L0518
+	cmp     #$B4
+	beq     L051F
+	cmp     #$B7
+	beq     L0529
+	cmp     #$B8
+	beq     L0533
+	jmp     L0504
+L0595:	ldy     #$31
+	jsr     decaxy
+	jsr     pushax
+	lda     #$00
+	jsr     _ActivateFrame
+	jmp     L0504
+L0513:	jsr     _HelpHandler
+	jmp     L0504
+L0518:	jsr     _SetRTSBreak
+	lda     #$01
+	ldy     #$00
+	sta     (sp),y
+	jmp     L0597
+L051F:	lda     _brk_pc
+	ldx     _brk_pc+1
+	cpx     _AsmAddr+1
+	bne     L0598
+	cmp     _AsmAddr
+	beq     L0504
+L0598:	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     _DbgSetTmpBreak
+	lda     #$01
+	ldy     #$00
+	sta     (sp),y
+	jmp     L0597
+L0529:	tya
+	jsr     _SingleStep
+	jsr     _DbgTmpBreaksOk
+	tax
+	beq     L0504
+	lda     #$01
+	ldy     #$00
+	sta     (sp),y
+	jmp     L0597
+L0533:	txa
+	jsr     _SingleStep
+	jsr     _DbgTmpBreaksOk
+	tax
+	beq     L0504
+	lda     #$01
+	ldy     #$00
+	sta     (sp),y
+	jmp     L0597
+L0596:	tya
+	dey
+	sta     (sp),y
+	jmp     L0597
+L0543:	lda     _brk_pc
+	ldx     _brk_pc+1
+	jsr     _DbgDisAsmLen
+	clc
+	adc     _brk_pc
+	sta     _brk_pc
+	txa
+	adc     _brk_pc+1
+	sta     _brk_pc+1
+	jsr     _InitAsm
+	jmp     L0504
+L0549:	lda     _ActiveFrame
+	jsr     _Redraw
+	jmp     L0504
+L054D:	jsr     _clrscr
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0504:	ldy     #$00
+L0597:	lda     (sp),y
+	jeq     L04FB
+	jmp     incsp2
+
+.endproc
+
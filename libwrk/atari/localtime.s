@@ -0,0 +1,53 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		__tz
+	.import		_gmtime
+	.export		_localtime
+
+; ---------------------------------------------------------------
+; __near__ struct tm * __near__ __fastcall__ localtime (__near__ const unsigned long *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_localtime: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp4
+	ldy     #$04
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L000C
+	tax
+	jmp     incsp6
+L000C:	jsr     ldaxysp
+	jsr     ldeaxi
+	jsr     pusheax
+	lda     __tz+1+3
+	sta     sreg+1
+	lda     __tz+1+2
+	sta     sreg
+	ldx     __tz+1+1
+	lda     __tz+1
+	jsr     tosaddeax
+	jsr     steax0sp
+	lda     sp
+	ldx     sp+1
+	jsr     _gmtime
+	jmp     incsp6
+
+.endproc
+
@@ -0,0 +1,160 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_strchr
+	.export		_strqtok
+
+.segment	"RODATA"
+
+L0003:
+	.byte	$00
+L0002	:=	L0003+0
+
+; ---------------------------------------------------------------
+; __near__ unsigned char * __near__ __fastcall__ strqtok (register __near__ unsigned char *, __near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_strqtok: near
+
+.segment	"DATA"
+
+L0006:
+	.addr	L0002
+
+.segment	"RODATA"
+
+L0020:
+	.word	$0000
+L0010:
+	.word	$0000
+L0034:
+	.word	$0000
+L0032:
+	.word	$0000
+
+.segment	"BSS"
+
+L0004:
+	.res	1,$00
+L0005:
+	.res	2,$00
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	ldx     #$04
+	jsr     regswap2
+	lda     regbank+4
+	ora     regbank+4+1
+	bne     L0013
+	lda     L0006+1
+	sta     regbank+4+1
+	lda     L0006
+	sta     regbank+4
+	lda     L0004
+	cmp     #$22
+	bne     L0013
+	jmp     L0054
+L0011:	lda     L0004
+	bne     L0018
+	tax
+	jmp     L0001
+L0018:	inc     regbank+4
+	bne     L0013
+	inc     regbank+4+1
+L0013:	jsr     pushw0sp
+	ldy     #$00
+	lda     (regbank+4),y
+	sta     L0004
+	ldx     #$00
+	jsr     _strchr
+	stx     tmp1
+	ora     tmp1
+	bne     L0011
+	lda     L0004
+	cmp     #$22
+	beq     L001F
+	lda     regbank+4+1
+	sta     L0005+1
+	lda     regbank+4
+	sta     L0005
+	jmp     L0025
+L0023:	inc     regbank+4
+	bne     L0025
+	inc     regbank+4+1
+L0025:	ldy     #$00
+	lda     (regbank+4),y
+	sta     L0004
+	cmp     #$22
+	beq     L0053
+	jsr     pushw0sp
+	lda     L0004
+	ldx     #$00
+	jsr     _strchr
+	stx     tmp1
+	ora     tmp1
+	beq     L0023
+L0053:	lda     L0004
+	bne     L003D
+	jmp     L0031
+L001F:	inc     regbank+4
+	bne     L0054
+	inc     regbank+4+1
+L0054:	lda     #$00
+	sta     L0004
+	lda     regbank+4+1
+	sta     L0005+1
+	lda     regbank+4
+	sta     L0005
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	ldx     #$00
+	lda     #$22
+	jsr     _strchr
+	sta     regbank+4
+	stx     regbank+4+1
+	cpx     #$00
+	bne     L003D
+	cmp     #$00
+	bne     L003D
+	lda     #>(L0003)
+	sta     L0006+1
+	lda     #<(L0003)
+	jmp     L0056
+L003D:	lda     #$00
+	tay
+	sta     (regbank+4),y
+	inc     regbank+4
+	bne     L0031
+	inc     regbank+4+1
+L0031:	lda     regbank+4+1
+	sta     L0006+1
+	lda     regbank+4
+L0056:	sta     L0006
+	lda     L0005
+	ldx     L0005+1
+L0001:	pha
+	ldy     #$02
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp4
+
+.endproc
+
@@ -0,0 +1,315 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_isdigit
+	.import		_islower
+	.import		_isspace
+	.import		_isupper
+	.import		__seterrno
+	.export		_strtol
+
+; ---------------------------------------------------------------
+; long __near__ __fastcall__ strtol (__near__ const unsigned char *, __near__ __near__ unsigned char * *, int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_strtol: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	sta     regbank+4
+	stx     regbank+4+1
+	jsr     pushl0
+	jsr     pusha
+	jsr     pusha
+	jsr     push0
+	jsr     decsp6
+	jmp     L0009
+L0007:	inc     regbank+4
+	bne     L0009
+	inc     regbank+4+1
+L0009:	ldy     #$00
+	lda     (regbank+4),y
+	ldx     #$00
+	jsr     _isspace
+	stx     tmp1
+	ora     tmp1
+	bne     L0007
+	tay
+	lda     (regbank+4),y
+	cmp     #$2B
+	beq     L0016
+	cmp     #$2D
+	bne     L0010
+	lda     #$01
+	ldy     #$09
+	sta     (sp),y
+L0016:	inc     regbank+4
+	bne     L0010
+	inc     regbank+4+1
+L0010:	ldy     #$10
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0090
+	tax
+	lda     (regbank+4,x)
+	cmp     #$30
+	bne     L008F
+	inc     regbank+4
+	bne     L001F
+	inc     regbank+4+1
+L001F:	lda     (regbank+4,x)
+	cmp     #$78
+	beq     L008D
+	cmp     #$58
+	bne     L008E
+L008D:	inc     regbank+4
+	bne     L0024
+	inc     regbank+4+1
+L0024:	lda     #$10
+	jmp     L00A1
+L008E:	lda     #$08
+	dey
+	jsr     staxysp
+	jmp     L002E
+L008F:	lda     #$0A
+L00A1:	dey
+	jsr     staxysp
+	jmp     L002E
+L0090:	lda     (sp),y
+	bne     L002E
+	dey
+	lda     (sp),y
+	cmp     #$10
+	bne     L002E
+	ldy     #$00
+	lda     (regbank+4),y
+	cmp     #$30
+	bne     L002E
+	iny
+	lda     (regbank+4),y
+	cmp     #$78
+	beq     L0095
+	cmp     #$58
+	bne     L002E
+L0095:	lda     #$02
+	clc
+	adc     regbank+4
+	sta     regbank+4
+	bcc     L002E
+	inc     regbank+4+1
+L002E:	ldy     #$09
+	lda     (sp),y
+	beq     L003A
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	jmp     L00A9
+L003A:	ldx     #$FF
+	stx     sreg
+	lda     #$7F
+L00A9:	sta     sreg+1
+	txa
+	ldy     #$01
+	jsr     steaxysp
+	ldy     #$04
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$15
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosumodeax
+	ldy     #$00
+	sta     (sp),y
+	ldy     #$04
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$15
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosudiveax
+	ldy     #$01
+	jsr     steaxysp
+L0046:	ldy     #$00
+	lda     (regbank+4),y
+	ldx     #$00
+	jsr     _isdigit
+	stx     tmp1
+	ora     tmp1
+	beq     L004A
+	ldx     #$00
+	lda     (regbank+4,x)
+	ldy     #$30
+	jmp     L00A7
+L004A:	tay
+	lda     (regbank+4),y
+	ldx     #$00
+	jsr     _isupper
+	stx     tmp1
+	ora     tmp1
+	beq     L0050
+	ldx     #$00
+	lda     (regbank+4,x)
+	ldy     #$37
+	jmp     L00A7
+L0050:	tay
+	lda     (regbank+4),y
+	ldx     #$00
+	jsr     _islower
+	stx     tmp1
+	ora     tmp1
+	jeq     L0047
+	ldx     #$00
+	lda     (regbank+4,x)
+	ldy     #$57
+L00A7:	jsr     decaxy
+	ldy     #$05
+	sta     (sp),y
+	ldy     #$10
+	cmp     (sp),y
+	lda     #$00
+	iny
+	sbc     (sp),y
+	bcs     L0047
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$08
+	jsr     ldeaxysp
+	jsr     tosugteax
+	bne     L0061
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$08
+	jsr     ldeaxysp
+	jsr     toseqeax
+	beq     L0060
+	ldy     #$05
+	lda     (sp),y
+	sec
+	ldy     #$00
+	sbc     (sp),y
+	sta     tmp1
+	lda     tmp1
+	beq     L0060
+	bcc     L0060
+L0061:	lda     #$01
+	ldy     #$08
+	sta     (sp),y
+L0060:	ldy     #$08
+	lda     (sp),y
+	bne     L0068
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$15
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosumuleax
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	jsr     axulong
+	jsr     tosaddeax
+	ldy     #$0A
+	jsr     steaxysp
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0068:	inc     regbank+4
+	jne     L0046
+	inc     regbank+4+1
+	jmp     L0046
+L0047:	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0077
+	ldy     #$06
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L0072
+	ldy     #$13
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	lda     regbank+4
+	ldy     #$00
+	sta     (sreg),y
+	iny
+	lda     regbank+4+1
+	jmp     L00A4
+L0072:	ldy     #$13
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$00
+	sta     (sreg),y
+	iny
+	txa
+L00A4:	sta     (sreg),y
+L0077:	ldy     #$08
+	lda     (sp),y
+	beq     L0082
+	lda     #$0F
+	jsr     __seterrno
+	ldy     #$09
+	lda     (sp),y
+	beq     L007E
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	txa
+	jmp     L0087
+L007E:	ldx     #$FF
+	stx     sreg
+	lda     #$7F
+	sta     sreg+1
+	txa
+	jmp     L0087
+L0082:	iny
+	lda     (sp),y
+	beq     L0084
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     negeax
+	jmp     L0087
+L0084:	ldy     #$0D
+	jsr     ldeaxysp
+L0087:	pha
+	ldy     #$0E
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	ldy     #$16
+	jmp     addysp
+
+.endproc
+
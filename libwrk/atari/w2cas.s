@@ -0,0 +1,716 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_stdin
+	.import		_stderr
+	.import		_fclose
+	.import		_fgets
+	.import		_fopen
+	.import		_fprintf
+	.import		_fread
+	.import		_printf
+	.import		_malloc
+	.import		_free
+	.import		__heapmaxavail
+	.import		_atexit
+	.import		_strerror
+	.import		_strlen
+	.import		__errno
+	.import		__sys
+	.import		_doesclrscrafterexit
+	.import		_cgetc
+	.export		_main
+
+.segment	"DATA"
+
+_verbose:
+	.word	$0001
+_C_dev:
+	.byte	$43,$3A,$00
+
+.segment	"RODATA"
+
+L003B:
+	.byte	$63,$61,$6E,$6E,$6F,$74,$20,$61,$6C,$6C,$6F,$63,$20,$25,$6C,$64
+	.byte	$20,$62,$79,$74,$65,$73,$20,$2D,$2D,$20,$61,$62,$6F,$72,$74,$69
+	.byte	$6E,$67,$2E,$2E,$2E,$9B,$00
+L00C9:
+	.byte	$66,$69,$6C,$65,$20,$69,$73,$20,$74,$6F,$6F,$20,$6C,$61,$72,$67
+	.byte	$65,$20,$28,$6D,$75,$73,$74,$20,$62,$65,$20,$3C,$20,$33,$32,$37
+	.byte	$36,$38,$29,$9B,$00
+L0123:
+	.byte	$43,$49,$4F,$20,$63,$61,$6C,$6C,$20,$74,$6F,$20,$63,$6C,$6F,$73
+	.byte	$65,$20,$63,$61,$73,$73,$65,$74,$74,$65,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$00
+L00EF:
+	.byte	$43,$49,$4F,$20,$63,$61,$6C,$6C,$20,$74,$6F,$20,$6F,$70,$65,$6E
+	.byte	$20,$63,$61,$73,$73,$65,$74,$74,$65,$20,$72,$65,$74,$75,$72,$6E
+	.byte	$65,$64,$20,$00
+L0108:
+	.byte	$43,$49,$4F,$20,$63,$61,$6C,$6C,$20,$74,$6F,$20,$77,$72,$69,$74
+	.byte	$65,$20,$66,$69,$6C,$65,$20,$72,$65,$74,$75,$72,$6E,$65,$64,$20
+	.byte	$00
+L0071:
+	.byte	$65,$6D,$70,$74,$79,$20,$66,$69,$6C,$65,$6E,$61,$6D,$65,$2C,$20
+	.byte	$65,$78,$69,$74,$69,$6E,$67,$2E,$2E,$2E,$9B,$00
+L0081	:=	L0071+0
+L0055:
+	.byte	$63,$6F,$75,$6C,$64,$6E,$27,$74,$20,$66,$69,$6E,$64,$20,$61,$20
+	.byte	$66,$72,$65,$65,$20,$69,$6F,$63,$62,$9B,$00
+L00F6:
+	.byte	$77,$72,$69,$74,$69,$6E,$67,$20,$74,$6F,$20,$63,$61,$73,$73,$65
+	.byte	$74,$74,$65,$2E,$2E,$2E,$9B,$00
+L003C:
+	.byte	$62,$75,$66,$66,$65,$72,$20,$73,$69,$7A,$65,$3A,$20,$25,$6C,$64
+	.byte	$20,$62,$79,$74,$65,$73,$9B,$00
+L00B2:
+	.byte	$72,$65,$61,$64,$69,$6E,$67,$20,$69,$6E,$70,$75,$74,$20,$66,$69
+	.byte	$6C,$65,$2E,$2E,$2E,$9B,$00
+L0043:
+	.byte	$66,$69,$6C,$65,$20,$73,$69,$7A,$65,$3A,$20,$25,$6C,$64,$20,$62
+	.byte	$79,$74,$65,$73,$9B,$00
+L00DB:
+	.byte	$6F,$70,$65,$6E,$69,$6E,$67,$20,$63,$61,$73,$73,$65,$74,$74,$65
+	.byte	$2E,$2E,$2E,$9B,$00
+L00CF:
+	.byte	$6E,$6F,$74,$20,$65,$6E,$6F,$75,$67,$68,$20,$6D,$65,$6D,$6F,$72
+	.byte	$79,$9B,$00
+L0060:
+	.byte	$75,$73,$69,$6E,$67,$20,$69,$6F,$63,$62,$20,$69,$6E,$64,$65,$78
+	.byte	$20,$24,$00
+L00AC:
+	.byte	$63,$61,$6E,$6E,$6F,$74,$20,$6F,$70,$65,$6E,$20,$27,$00
+L0067:
+	.byte	$9B,$66,$69,$6C,$65,$6E,$61,$6D,$65,$3A,$20,$00
+L00BD:
+	.byte	$72,$65,$61,$64,$20,$65,$72,$72,$6F,$72,$9B,$00
+L0126:
+	.byte	$73,$75,$63,$63,$65,$73,$73,$9B,$00
+L0061:
+	.byte	$20,$28,$24,$00
+L00AD:
+	.byte	$27,$3A,$20,$00
+L003D:
+	.byte	$72,$62,$00
+L0062	:=	L00C9+34
+
+; ---------------------------------------------------------------
+; __near__ struct __iocb * __near__ findfreeiocb (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_findfreeiocb: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	txa
+L012A:	jsr     stax0sp
+	cmp     #$08
+	txa
+	sbc     #$00
+	bvc     L002A
+	eor     #$80
+L002A:	asl     a
+	lda     #$00
+	tax
+	bcc     L0022
+	jsr     ldax0sp
+	jsr     aslax4
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$40
+	clc
+	adc     ptr1
+	sta     ptr1
+	lda     #$03
+	adc     ptr1+1
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	cmp     #$FF
+	bne     L0025
+	jsr     ldax0sp
+	jsr     aslax4
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$40
+	clc
+	adc     ptr1
+	pha
+	lda     #$03
+	adc     ptr1+1
+	tax
+	pla
+	jmp     incsp2
+L0025:	jsr     ldax0sp
+	jsr     incax1
+	jmp     L012A
+L0022:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int, __near__ __near__ unsigned char * *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldy     #$1E
+	jsr     subysp
+	ldx     #$80
+	lda     #$01
+	jsr     pushax
+	jsr     decsp6
+	jsr     _findfreeiocb
+	jsr     pushax
+	jsr     decsp2
+	jsr     _doesclrscrafterexit
+	tax
+	beq     L004D
+	lda     #<(_cgetc)
+	ldx     #>(_cgetc)
+	jsr     _atexit
+L004D:	ldy     #$03
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	bne     L0051
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     __pftofile
+	lda     #<(L0055)
+	ldx     #>(L0055)
+	jsr     __pfputs
+	ldx     #$00
+	lda     #$01
+	jmp     L0034
+L0051:	iny
+	jsr     ldaxysp
+	sec
+	sbc     #$40
+	pha
+	txa
+	sbc     #$03
+	tax
+	pla
+	jsr     asrax4
+	jsr     aslax4
+	jsr     stax0sp
+	lda     _verbose
+	ora     _verbose+1
+	beq     L005B
+	jsr     __pfstdout
+	lda     #<(L0060)
+	ldx     #>(L0060)
+	jsr     __pfputs
+	jsr     ldax0sp
+	ldy     #$62
+	jsr     __pfhex
+	lda     #<(L0061)
+	ldx     #>(L0061)
+	jsr     __pfputs
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$64
+	jsr     __pfhex
+	lda     #<(L0062)
+	ldx     #>(L0062)
+	jsr     __pfputs
+L005B:	ldy     #$2D
+	jsr     ldaxysp
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L0065
+	eor     #$80
+L0065:	asl     a
+	lda     #$00
+	tax
+	rol     a
+	jeq     L0063
+	jsr     __pfstdout
+	lda     #<(L0067)
+	ldx     #>(L0067)
+	jsr     __pfputs
+	lda     #$12
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$13
+	jsr     pusha0
+	lda     _stdin
+	ldx     _stdin+1
+	jsr     _fgets
+	ldy     #$26
+	jsr     staxysp
+	jsr     __pfstdout
+	lda     #$9B
+	jsr     __pfputc
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	bne     L006E
+	jsr     __pfstdout
+	lda     #<(L0071)
+	ldx     #>(L0071)
+	jsr     __pfputs
+	ldx     #$00
+	lda     #$01
+	jmp     L0034
+L006E:	iny
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	beq     L0073
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$29
+	jsr     ldaxysp
+	jsr     _strlen
+	jsr     tosaddax
+	jsr     decax1
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	cmp     #$9B
+	bne     L0073
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$29
+	jsr     ldaxysp
+	jsr     _strlen
+	jsr     tosaddax
+	jsr     decax1
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+L0073:	ldy     #$27
+	jsr     ldaxysp
+	jsr     _strlen
+	stx     tmp1
+	ora     tmp1
+	bne     L007D
+	jsr     __pfstdout
+	lda     #<(L0081)
+	ldx     #>(L0081)
+	jsr     __pfputs
+	ldx     #$00
+	lda     #$01
+	jmp     L0034
+L007D:	ldy     #$27
+	jsr     ldaxysp
+	jmp     L0130
+L0063:	ldy     #$2B
+	jsr     ldaxysp
+	jsr     incax2
+	jsr     ldaxi
+L0130:	ldy     #$28
+	jsr     staxysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     _malloc
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$0F
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	bne     L0093
+	jsr     __heapmaxavail
+	ldy     #$0A
+	jsr     staxysp
+	jsr     _malloc
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$0F
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	bne     L0093
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(L003B)
+	ldx     #>(L003B)
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$08
+	jsr     _fprintf
+	ldx     #$00
+	lda     #$01
+	jmp     L0034
+L0093:	lda     _verbose
+	ora     _verbose+1
+	beq     L009A
+	lda     #<(L003C)
+	ldx     #>(L003C)
+	jsr     pushax
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+L009A:	ldy     #$2B
+	jsr     pushwysp
+	lda     #<(L003D)
+	ldx     #>(L003D)
+	jsr     _fopen
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$11
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	bne     L00A3
+	dey
+	jsr     ldaxysp
+	jsr     _free
+	lda     __errno
+	ldx     __errno+1
+	jsr     _strerror
+	jsr     pushax
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     __pftofile
+	lda     #<(L00AC)
+	ldx     #>(L00AC)
+	jsr     __pfputs
+	ldy     #$2B
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     __pfstr
+	lda     #<(L00AD)
+	ldx     #>(L00AD)
+	jsr     __pfputs
+	jsr     ldax0sp
+	ldy     #$00
+	jsr     __pfstr
+	lda     #$9B
+	jsr     __pfputc
+	jsr     incsp2
+	ldx     #$00
+	lda     #$01
+	jmp     L0034
+L00A3:	lda     _verbose
+	ora     _verbose+1
+	beq     L00AF
+	jsr     __pfstdout
+	lda     #<(L00B2)
+	ldx     #>(L00B2)
+	jsr     __pfputs
+L00AF:	ldy     #$11
+	jsr     pushwysp
+	lda     #$01
+	jsr     pusha0
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$17
+	jsr     ldaxysp
+	jsr     _fread
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0D
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	bne     L00B9
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     __pftofile
+	lda     #<(L00BD)
+	ldx     #>(L00BD)
+L012C:	jsr     __pfputs
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     _fclose
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     _free
+	ldx     #$00
+	lda     #$01
+	jmp     L0034
+L00B9:	iny
+	jsr     ldaxysp
+	jsr     axulong
+	cmp     #$00
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$00
+	lda     sreg+1
+	sbc     #$00
+	bcc     L00C5
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     __pftofile
+	lda     #<(L00C9)
+	ldx     #>(L00C9)
+	jmp     L012C
+L00C5:	ldy     #$0F
+	jsr     pushwysp
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     tosicmp
+	bne     L00CB
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     __pftofile
+	lda     #<(L00CF)
+	ldx     #>(L00CF)
+	jmp     L012C
+L00CB:	lda     _verbose
+	ora     _verbose+1
+	beq     L00D1
+	lda     #<(L0043)
+	ldx     #>(L0043)
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+L00D1:	ldy     #$11
+	jsr     ldaxysp
+	jsr     _fclose
+	lda     _verbose
+	ora     _verbose+1
+	beq     L00D8
+	jsr     __pfstdout
+	lda     #<(L00DB)
+	ldx     #>(L00DB)
+	jsr     __pfputs
+L00D8:	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_C_dev)
+	ldy     #$04
+	sta     (ptr1),y
+	iny
+	lda     #>(_C_dev)
+	sta     (ptr1),y
+	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$08
+	ldy     #$0A
+	sta     (ptr1),y
+	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$80
+	ldy     #$0B
+	sta     (ptr1),y
+	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$03
+	ldy     #$02
+	sta     (ptr1),y
+	ldy     #$00
+	lda     (sp),y
+	ldy     #$05
+	sta     (sp),y
+	ldx     #$E4
+	lda     #$56
+	ldy     #$08
+	jsr     staxysp
+	lda     #$04
+	jsr     leaa0sp
+	jsr     __sys
+	ldy     #$06
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$01
+	beq     L00EA
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     __pftofile
+	lda     #<(L00EF)
+	ldx     #>(L00EF)
+	jsr     __pfputs
+	ldy     #$06
+	lda     (sp),y
+	ldx     #$00
+	ldy     #$00
+	jsr     __pfint
+	lda     #$9B
+	jsr     __pfputc
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     _free
+	ldx     #$00
+	lda     #$01
+	jmp     L0034
+L00EA:	lda     _verbose
+	ora     _verbose+1
+	beq     L00F3
+	jsr     __pfstdout
+	lda     #<(L00F6)
+	ldx     #>(L00F6)
+	jsr     __pfputs
+L00F3:	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$0F
+	jsr     ldaxysp
+	ldy     #$04
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$08
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$0B
+	ldy     #$02
+	sta     (ptr1),y
+	ldy     #$00
+	lda     (sp),y
+	ldy     #$05
+	sta     (sp),y
+	ldx     #$E4
+	lda     #$56
+	ldy     #$08
+	jsr     staxysp
+	lda     #$04
+	jsr     leaa0sp
+	jsr     __sys
+	ldy     #$06
+	lda     (sp),y
+	cmp     #$01
+	beq     L0103
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     __pftofile
+	lda     #<(L0108)
+	ldx     #>(L0108)
+	jsr     __pfputs
+	ldy     #$06
+	lda     (sp),y
+	ldx     #$00
+	ldy     #$00
+	jsr     __pfint
+	lda     #$9B
+	jsr     __pfputc
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     _free
+	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$0C
+	ldy     #$02
+	sta     (ptr1),y
+	ldy     #$00
+	lda     (sp),y
+	ldy     #$05
+	sta     (sp),y
+	ldx     #$E4
+	lda     #$56
+	ldy     #$08
+	jsr     staxysp
+	lda     #$04
+	jsr     leaa0sp
+	jsr     __sys
+	ldx     #$00
+	lda     #$01
+	jmp     L0034
+L0103:	ldy     #$0F
+	jsr     ldaxysp
+	jsr     _free
+	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$0C
+	ldy     #$02
+	sta     (ptr1),y
+	ldy     #$00
+	lda     (sp),y
+	ldy     #$05
+	sta     (sp),y
+	ldx     #$E4
+	lda     #$56
+	ldy     #$08
+	jsr     staxysp
+	lda     #$04
+	jsr     leaa0sp
+	jsr     __sys
+	ldy     #$06
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$01
+	beq     L011E
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     __pftofile
+	lda     #<(L0123)
+	ldx     #>(L0123)
+	jsr     __pfputs
+	ldy     #$06
+	lda     (sp),y
+	ldx     #$00
+	ldy     #$00
+	jsr     __pfint
+	lda     #$9B
+	jsr     __pfputc
+	ldx     #$00
+	lda     #$01
+	jmp     L0034
+L011E:	jsr     __pfstdout
+	lda     #<(L0126)
+	ldx     #>(L0126)
+	jsr     __pfputs
+	ldx     #$00
+	txa
+L0034:	ldy     #$2E
+	jmp     addysp
+
+.endproc
+
@@ -0,0 +1,1088 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_memset
+	.import		__setjmp
+	.import		_longjmp
+	.import		__seterrno
+	.import		_isdigit
+	.import		_isspace
+	.import		_isxdigit
+	.import		_tolower
+	.export		__scanf
+
+.segment	"RODATA"
+
+_Bits:
+	.byte	$01
+	.byte	$02
+	.byte	$04
+	.byte	$08
+	.byte	$10
+	.byte	$20
+	.byte	$40
+	.byte	$80
+
+.segment	"BSS"
+
+_format:
+	.res	2,$00
+_D_:
+	.res	2,$00
+_ap:
+	.res	2,$00
+_JumpBuf:
+	.res	5,$00
+_F:
+	.res	1,$00
+_CharCount:
+	.res	2,$00
+_C:
+	.res	2,$00
+_Width:
+	.res	2,$00
+_IntVal:
+	.res	4,$00
+_Assignments:
+	.res	2,$00
+_IntBytes:
+	.res	1,$00
+_Converted:
+	.res	1,$00
+_Positive:
+	.res	1,$00
+_NoAssign:
+	.res	1,$00
+_Invert:
+	.res	1,$00
+_CharSet:
+	.res	32,$00
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ _scanf (__near__ const struct scanfdata *, __near__ const unsigned char *, __near__ unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	__scanf: near
+
+.segment	"RODATA"
+
+L01B4:
+	.word	$0000
+L02B8:
+	.word	$0000
+L02C7:
+	.word	$0000
+L02D6:
+	.word	$0000
+
+.segment	"BSS"
+
+L0190:
+	.res	1,$00
+L0191:
+	.res	1,$00
+L0192:
+	.res	1,$00
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	sta     _D_
+	stx     _D_+1
+	ldy     #$05
+	jsr     ldaxysp
+	sta     _format
+	stx     _format+1
+	ldy     #$03
+	jsr     ldaxysp
+	sta     _ap
+	stx     _ap+1
+	lda     #$00
+	sta     _Converted
+	sta     _Assignments
+	sta     _Assignments+1
+	sta     _CharCount
+	sta     _CharCount+1
+	lda     #<(_JumpBuf)
+	ldx     #>(_JumpBuf)
+	jsr     __setjmp
+	cmp     #$00
+	jne     L019F
+L01A2:	jsr     _ReadChar
+	jmp     L01FD
+L01A5:	lda     _F
+	cmp     #$25
+	beq     L01A9
+	ldx     #$00
+	jsr     _isspace
+	tax
+	beq     L01AB
+	jsr     _SkipWhite
+	jmp     L01FD
+L01AB:	lda     _C
+	ldx     _C+1
+	jsr     pushax
+	lda     _F
+	jsr     tosicmp0
+	beq     L01A2
+	jmp     L019F
+L01A9:	jsr     _GetFormat
+	cmp     #$25
+	beq     L01AB
+	lda     _F
+	cmp     #$2A
+	jsr     booleq
+	sta     _NoAssign
+	lda     _NoAssign
+	beq     L01BD
+	jsr     _GetFormat
+L01BD:	lda     #$FF
+	sta     _Width
+	sta     _Width+1
+	lda     _F
+	ldx     #$00
+	jsr     _isdigit
+	sta     L0190
+	lda     L0190
+	beq     L01CA
+	lda     #$00
+	sta     _Width
+	sta     _Width+1
+L01C9:	lda     _Width
+	ldx     _Width+1
+	jsr     mulax10
+	sta     ptr1
+	lda     _F
+	and     #$0F
+	clc
+	adc     ptr1
+	bcc     L0331
+	inx
+L0331:	sta     _Width
+	stx     _Width+1
+	jsr     _GetFormat
+	ldx     #$00
+	jsr     _isdigit
+	tax
+	bne     L01C9
+L01CA:	lda     _Width
+	ora     _Width+1
+	bne     L01D1
+	lda     #$07
+	jsr     __seterrno
+	jmp     L0338
+L01D1:	lda     _Width
+	ldx     _Width+1
+	jsr     complax
+	sta     _Width
+	stx     _Width+1
+	lda     #$01
+	sta     _IntBytes
+	lda     _F
+	cmp     #$48
+	beq     L01E2
+	cmp     #$4A
+	beq     L031E
+	cmp     #$4C
+	beq     L01EB
+	cmp     #$54
+	beq     L01F5
+	cmp     #$5A
+	beq     L01F5
+	cmp     #$CC
+	beq     L01F5
+	jmp     L031F
+L01E2:	lda     _format+1
+	sta     ptr1+1
+	lda     _format
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	cmp     #$48
+	bne     L01F5
+	sty     _IntBytes
+	inc     _format
+	bne     L01F5
+	inc     _format+1
+	jmp     L01F5
+L01EB:	lda     _format+1
+	sta     ptr1+1
+	lda     _format
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	cmp     #$4C
+	bne     L031E
+	inc     _format
+	bne     L031E
+	inc     _format+1
+L031E:	lda     #$03
+	sta     _IntBytes
+L01F5:	jsr     _GetFormat
+L031F:	lda     _F
+	cmp     #$41
+	jeq     L02EC
+	cmp     #$43
+	jeq     L0324
+	cmp     #$44
+	beq     L01FF
+	cmp     #$45
+	jeq     L02EC
+	cmp     #$46
+	jeq     L02EC
+	cmp     #$47
+	jeq     L02EC
+	cmp     #$49
+	beq     L0205
+	cmp     #$4E
+	jeq     L02DC
+	cmp     #$4F
+	beq     L0209
+	cmp     #$50
+	jeq     L02C0
+	cmp     #$53
+	beq     L0213
+	cmp     #$55
+	beq     L01FF
+	cmp     #$58
+	beq     L020D
+	cmp     #$5B
+	jeq     L025D
+	cmp     #$C1
+	jeq     L02EC
+	cmp     #$C3
+	jeq     L02EC
+	cmp     #$C5
+	jeq     L02EC
+	cmp     #$C6
+	jeq     L02EC
+	cmp     #$C7
+	jeq     L02EC
+	cmp     #$D3
+	jeq     L02EC
+	cmp     #$D8
+	beq     L020D
+	jmp     L0305
+L01FF:	lda     #$0A
+	jsr     _ScanInt
+	jmp     L01FD
+L0205:	lda     #$00
+	jsr     _ScanInt
+	jmp     L01FD
+L0209:	lda     #$08
+	jsr     _ScanInt
+	jmp     L01FD
+L020D:	lda     #$10
+	jsr     _ScanInt
+	jmp     L01FD
+L0213:	jsr     _SkipWhite
+	jsr     _CheckEnd
+	lda     #$01
+	sta     _Converted
+	lda     _NoAssign
+	bne     L0224
+	lda     _ap
+	sec
+	sbc     #$02
+	sta     _ap
+	bcs     L0221
+	dec     _ap+1
+L0221:	ldx     _ap+1
+	jsr     ldaxi
+	sta     regbank+4
+	stx     regbank+4+1
+	jmp     L0224
+L0320:	lda     _NoAssign
+	bne     L022B
+	lda     regbank+4
+	ldx     regbank+4+1
+	sta     regsave
+	stx     regsave+1
+	jsr     incax1
+	sta     regbank+4
+	stx     regbank+4+1
+	lda     _C
+	ldy     #$00
+	sta     (regsave),y
+L022B:	jsr     _ReadChar
+L0224:	lda     _C+1
+	cmp     #$FF
+	bne     L0332
+	lda     _C
+	cmp     #$FF
+	beq     L0323
+L0332:	lda     _C
+	ldx     _C+1
+	jsr     _isspace
+	cmp     #$00
+	bne     L0323
+	inc     _Width
+	bne     L0229
+	inc     _Width+1
+L0229:	lda     _Width
+	ora     _Width+1
+	bne     L0320
+L0323:	lda     _NoAssign
+	jne     L01FD
+	tay
+	sta     (regbank+4),y
+	inc     _Assignments
+	jne     L01FD
+	inc     _Assignments+1
+	jmp     L01FD
+L0324:	lda     L0190
+	bne     L0238
+	ldx     #$FF
+	lda     #$FE
+	sta     _Width
+	stx     _Width+1
+L0238:	jsr     _CheckEnd
+	lda     #$01
+	sta     _Converted
+	lda     _NoAssign
+	bne     L0257
+	lda     _ap
+	sec
+	sbc     #$02
+	sta     _ap
+	bcs     L0248
+	dec     _ap+1
+L0248:	ldx     _ap+1
+	jsr     ldaxi
+	sta     regbank+4
+	stx     regbank+4+1
+	jmp     L024B
+L0249:	jsr     _CheckEnd
+	lda     regbank+4
+	ldx     regbank+4+1
+	sta     regsave
+	stx     regsave+1
+	jsr     incax1
+	sta     regbank+4
+	stx     regbank+4+1
+	lda     _C
+	ldy     #$00
+	sta     (regsave),y
+	jsr     _ReadChar
+L024B:	inc     _Width
+	bne     L024D
+	inc     _Width+1
+L024D:	lda     _Width
+	ora     _Width+1
+	bne     L0249
+	inc     _Assignments
+	jne     L01FD
+	inc     _Assignments+1
+	jmp     L01FD
+L0255:	jsr     _CheckEnd
+	jsr     _ReadChar
+L0257:	inc     _Width
+	bne     L0259
+	inc     _Width+1
+L0259:	lda     _Width
+	ora     _Width+1
+	bne     L0255
+	jmp     L01FD
+L025D:	lda     #>(_CharSet)
+	sta     ptr1+1
+	lda     #<(_CharSet)
+	sta     ptr1
+	lda     #$00
+	ldy     #$1F
+L0317:	sta     (ptr1),y
+	dey
+	bpl     L0317
+	jsr     _GetFormat
+	cmp     #$5E
+	jsr     booleq
+	sta     _Invert
+	lda     _Invert
+	beq     L0325
+	jsr     _GetFormat
+L0325:	lda     _F
+	cmp     #$5D
+	bne     L0326
+	jmp     L0334
+L026E:	lda     _format+1
+	sta     ptr1+1
+	lda     _format
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	cmp     #$2D
+	bne     L0274
+	lda     _F
+	sta     L0192
+	inc     _format
+	bne     L0279
+	inc     _format+1
+L0279:	jsr     _GetFormat
+	cmp     #$00
+	beq     L027E
+	cmp     #$5D
+	bne     L0286
+L027E:	lda     L0192
+	jsr     _AddCharToSet
+	lda     #$2D
+	jsr     _AddCharToSet
+	jmp     L0326
+L0286:	lda     L0192
+	jsr     _AddCharToSet
+	lda     _F
+	cmp     L0192
+	beq     L031D
+	inc     L0192
+	jmp     L0286
+L0274:	lda     _F
+L0334:	jsr     _AddCharToSet
+L031D:	jsr     _GetFormat
+L0326:	lda     _F
+	beq     L032A
+	cmp     #$5D
+	bne     L026E
+L032A:	lda     _F
+	bne     L0294
+	lda     _format
+	sec
+	sbc     #$01
+	sta     _format
+	bcs     L0294
+	dec     _format+1
+L0294:	lda     _Invert
+	beq     L0335
+	jsr     _InvertCharSet
+	lda     #$00
+L0335:	sta     L0191
+	lda     _NoAssign
+	bne     L02A9
+	lda     _ap
+	sec
+	sbc     #$02
+	sta     _ap
+	bcs     L02A6
+	dec     _ap+1
+L02A6:	ldx     _ap+1
+	jsr     ldaxi
+	sta     regbank+4
+	stx     regbank+4+1
+	jmp     L02A9
+L032B:	lda     _NoAssign
+	bne     L032C
+	lda     regbank+4
+	ldx     regbank+4+1
+	sta     regsave
+	stx     regsave+1
+	jsr     incax1
+	sta     regbank+4
+	stx     regbank+4+1
+	lda     _C
+	ldy     #$00
+	sta     (regsave),y
+L032C:	lda     #$01
+	sta     _Converted
+	sta     L0191
+	jsr     _ReadChar
+L02A9:	jsr     _IsCharInSet
+	tax
+	beq     L032F
+	inc     _Width
+	bne     L02AC
+	inc     _Width+1
+L02AC:	lda     _Width
+	ora     _Width+1
+	bne     L032B
+L032F:	lda     L0191
+	jeq     L019F
+	lda     _NoAssign
+	jne     L01FD
+	tay
+	sta     (regbank+4),y
+	inc     _Assignments
+	jne     L01FD
+	inc     _Assignments+1
+	jmp     L01FD
+L02C0:	jsr     _SkipWhite
+	lda     _C
+	cmp     #$30
+	jne     L019F
+	lda     #$01
+	sta     _Converted
+	jsr     _ReadChar
+	lda     _C
+	cmp     #$58
+	beq     L02D0
+	cmp     #$D8
+	bne     L019F
+L02D0:	jsr     _ReadChar
+	lda     #$10
+	jsr     _ReadInt
+	jsr     _AssignInt
+	jmp     L01FD
+L02DC:	lda     _CharCount
+	ldx     _CharCount+1
+	jsr     pushax
+	lda     _C+1
+	cmp     #$FF
+	bne     L02E2
+	lda     _C
+	cmp     #$FF
+	bne     L02E2
+	lda     #$00
+	jmp     L02E4
+L02E2:	lda     #$01
+L02E4:	jsr     tossuba0
+	jsr     axulong
+	sta     _IntVal
+	stx     _IntVal+1
+	ldy     sreg
+	sty     _IntVal+2
+	ldy     sreg+1
+	sty     _IntVal+3
+	jsr     _AssignInt
+	lda     _NoAssign
+	bne     L01FD
+	lda     _Assignments
+	sec
+	sbc     #$01
+	sta     _Assignments
+	bcs     L01FD
+	dec     _Assignments+1
+	jmp     L01FD
+L02EC:	lda     #$0D
+	jsr     __seterrno
+	jmp     L0338
+L0305:	lda     #$07
+	jsr     __seterrno
+	jmp     L0338
+L01FD:	jsr     _GetFormat
+	tax
+	jne     L01A5
+	jmp     L030E
+L019F:	lda     _C+1
+	cmp     #$FF
+	bne     L030E
+	lda     _C
+	cmp     #$FF
+	bne     L030E
+	lda     _Converted
+	bne     L030E
+L0338:	lda     #$FF
+	sta     _Assignments
+	sta     _Assignments+1
+L030E:	jsr     _PushBack
+	lda     _Assignments
+	ldx     _Assignments+1
+	pha
+	ldy     #$00
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ FindBit (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_FindBit: near
+
+.segment	"CODE"
+
+	pha
+	lsr     a
+	lsr     a
+	lsr     a
+	tax
+	pla
+	and     #$07
+	tay
+	lda     _Bits,y
+	jmp     L000F
+L000F:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ AddCharToSet (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AddCharToSet: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jsr     _FindBit
+	ora     _CharSet,x
+	sta     _CharSet,x
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ IsCharInSet (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_IsCharInSet: near
+
+.segment	"CODE"
+
+	lda     #$00
+	ldx     _C+1
+	bne     L1
+	lda     _C
+	jsr     _FindBit
+	and     _CharSet,x
+L1:	ldx     #$00
+	jmp     L002C
+L002C:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ InvertCharSet (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_InvertCharSet: near
+
+.segment	"CODE"
+
+	ldy     #$1F
+L1:	lda     _CharSet,y
+	eor     #$FF
+	sta     _CharSet,y
+	dey
+	bpl     L1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ PushBack (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_PushBack: near
+
+.segment	"CODE"
+
+	ldx     _C+1
+	bne     L0068
+	lda     _C
+	jsr     pusha0
+	lda     _D_+1
+	sta     ptr1+1
+	lda     _D_
+	sta     ptr1
+	ldy     #$02
+	lda     (ptr1),y
+	sta     jmpvec+1
+	iny
+	lda     (ptr1),y
+	sta     jmpvec+2
+	ldy     #$05
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     jmpvec
+	lda     _CharCount
+	bne     L0084
+	dec     _CharCount+1
+L0084:	dec     _CharCount
+L0068:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ ReadChar (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ReadChar: near
+
+.segment	"CODE"
+
+	lda     _D_+1
+	sta     ptr1+1
+	lda     _D_
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	sta     jmpvec+1
+	iny
+	lda     (ptr1),y
+	sta     jmpvec+2
+	ldy     #$05
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     jmpvec
+	sta     _C
+	stx     _C+1
+	inx
+	beq     L00BC
+	inc     _CharCount
+	bne     L00BC
+	inc     _CharCount+1
+L00BC:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ Error (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Error: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	pha
+	lda     #<(_JumpBuf)
+	ldx     #>(_JumpBuf)
+	jsr     pushax
+	pla
+	ldx     #>$0000
+	jmp     _longjmp
+	jsr     incsp1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ CheckEnd (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_CheckEnd: near
+
+.segment	"CODE"
+
+	ldx     _C+1
+	beq     L00D7
+	lda     #$02
+	jmp     _Error
+L00D7:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ SkipWhite (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_SkipWhite: near
+
+.segment	"CODE"
+
+	jmp     L00DF
+L00DD:	jsr     _ReadChar
+L00DF:	lda     _C
+	ldx     _C+1
+	jsr     _isspace
+	tax
+	bne     L00DD
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ ReadSign (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ReadSign: near
+
+.segment	"CODE"
+
+	lda     _C
+	cmp     #'-'
+	bne     L00F5
+	sta     _Converted
+	jsr     _ReadChar
+	lda     #$00
+	beq     L00FB
+L00F5:	cmp     #'+'
+	bne     L0100
+	sta     _Converted
+	jsr     _ReadChar
+L0100:	lda     #$01
+L00FB:	sta     _Positive
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ __fastcall__ HexVal (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_HexVal: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldy     #$00
+	lda     (sp),y
+	ldx     #$00
+	jsr     _isdigit
+	beq     L010C
+	ldx     #$00
+	lda     (sp,x)
+	ldy     #$30
+	jmp     L0339
+L010C:	ldy     #$00
+	lda     (sp),y
+	ldx     #$00
+	jsr     _tolower
+	ldx     #$00
+	ldy     #$37
+L0339:	jsr     decaxy
+	ldx     #$00
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ ReadInt (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ReadInt: near
+
+.segment	"BSS"
+
+L0113:
+	.res	1,$00
+L0114:
+	.res	1,$00
+
+.segment	"CODE"
+
+	jsr     pusha
+	lda     #$00
+	sta     L0114
+	sta     _IntVal
+	sta     _IntVal+1
+	sta     _IntVal+2
+	sta     _IntVal+3
+	jmp     L011A
+L033B:	inc     L0114
+	lda     _IntVal+3
+	sta     sreg+1
+	lda     _IntVal+2
+	sta     sreg
+	ldx     _IntVal+1
+	lda     _IntVal
+	jsr     pusheax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	jsr     aulong
+	jsr     axulong
+	jsr     tosmuleax
+	jsr     pusheax
+	ldx     #$00
+	lda     L0113
+	jsr     aulong
+	jsr     axulong
+	jsr     tosaddeax
+	sta     _IntVal
+	stx     _IntVal+1
+	ldy     sreg
+	sty     _IntVal+2
+	ldy     sreg+1
+	sty     _IntVal+3
+	jsr     _ReadChar
+L011A:	lda     _C
+	ldx     _C+1
+	jsr     _isxdigit
+	tax
+	beq     L033E
+	inc     _Width
+	bne     L011E
+	inc     _Width+1
+L011E:	lda     _Width
+	ora     _Width+1
+	beq     L033E
+	lda     _C
+	jsr     _HexVal
+	sta     L0113
+	ldy     #$00
+	cmp     (sp),y
+	txa
+	sbc     #$00
+	bcc     L033B
+L033E:	lda     L0114
+	bne     L033F
+	lda     #$01
+	jsr     _Error
+L033F:	lda     #$01
+	sta     _Converted
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ AssignInt (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AssignInt: near
+
+.segment	"CODE"
+
+	lda     _NoAssign
+	bne     L014F
+	lda     _ap
+	sec
+	sbc     #$02
+	sta     _ap
+	bcs     L0142
+	dec     _ap+1
+L0142:	ldx     _ap+1
+	jsr     ldaxi
+	sta     ptr1
+	stx     ptr1+1
+	ldy     _IntBytes
+L0146:	lda     _IntVal,y
+	sta     (ptr1),y
+	dey
+	bpl     L0146
+	inc     _Assignments
+	bne     L014F
+	inc     _Assignments+1
+L014F:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ ScanInt (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ScanInt: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jsr     _SkipWhite
+	jsr     _ReadSign
+	ldy     #$00
+	lda     (sp),y
+	bne     L0343
+	lda     _C
+	cmp     #$30
+	bne     L0342
+	jsr     _ReadChar
+	lda     _C
+	cmp     #$58
+	beq     L0340
+	cmp     #$D8
+	bne     L0341
+L0340:	lda     #$10
+	ldy     #$00
+	sta     (sp),y
+	lda     #$01
+	sta     _Converted
+	jsr     _ReadChar
+	jmp     L0173
+L0341:	lda     #$08
+	ldy     #$00
+	sta     (sp),y
+	jsr     _PushBack
+	ldx     #$00
+	lda     #$30
+	sta     _C
+	stx     _C+1
+	jmp     L0173
+L0342:	lda     #$0A
+	sta     (sp),y
+L0173:	ldy     #$00
+L0343:	lda     (sp),y
+	jsr     _ReadInt
+	lda     _Positive
+	bne     L0178
+	lda     _IntVal+3
+	sta     sreg+1
+	lda     _IntVal+2
+	sta     sreg
+	ldx     _IntVal+1
+	lda     _IntVal
+	jsr     negeax
+	sta     _IntVal
+	stx     _IntVal+1
+	ldy     sreg
+	sty     _IntVal+2
+	ldy     sreg+1
+	sty     _IntVal+3
+L0178:	jsr     _AssignInt
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ GetFormat (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_GetFormat: near
+
+.segment	"CODE"
+
+	lda     _format+1
+	sta     regsave+1
+	lda     _format
+	sta     regsave
+	inc     _format
+	bne     L0188
+	inc     _format+1
+L0188:	ldy     #0
+	lda     (regsave),y
+	ldx     #>$0000
+	sta     _F
+	rts
+
+.endproc
+
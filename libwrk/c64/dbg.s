@@ -0,0 +1,2875 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_exit
+	.import		_strlen
+	.import		_clrscr
+	.import		_kbhit
+	.import		_gotoxy
+	.import		_wherex
+	.import		_cputc
+	.import		_cputcxy
+	.import		_cputsxy
+	.import		_cgetc
+	.import		_cursor
+	.import		_revers
+	.import		_textcolor
+	.import		_bgcolor
+	.import		_bordercolor
+	.import		_chline
+	.import		_chlinexy
+	.import		_cvlinexy
+	.import		_cclearxy
+	.import		_cputhex8
+	.import		_cputhex16
+	.import		_isalnum
+	.import		_isdigit
+	.import		_isxdigit
+	.import		_toupper
+	.import		_brk_a
+	.import		_brk_x
+	.import		_brk_y
+	.import		_brk_sr
+	.import		_brk_pc
+	.import		_DbgDisAsm
+	.import		_DbgDisAsmLen
+	.import		_DbgIsRAM
+	.import		_DbgMemDump
+	.import		_DbgSP
+	.import		_DbgCS
+	.import		_DbgHI
+	.export		_DbgBreakCount
+	.export		_DbgBreaks
+	.import		_DbgGetBreakSlot
+	.import		_DbgIsBreak
+	.export		_DbgEntry
+
+.segment	"DATA"
+
+_ActiveFrame:
+	.word	$FFFF
+_ActivePrompt:
+	.word	$0000
+_DbgBreakCount:
+	.byte	$00
+
+.segment	"RODATA"
+
+_RegText:
+	.byte	$01
+	.byte	$00
+	.addr	L0008
+	.byte	$01
+	.byte	$01
+	.addr	L000C
+	.byte	$01
+	.byte	$02
+	.addr	L0010
+	.byte	$01
+	.byte	$03
+	.addr	L0014
+	.byte	$01
+	.byte	$04
+	.addr	L0018
+	.byte	$01
+	.byte	$05
+	.addr	L001C
+	.byte	$01
+	.byte	$06
+	.addr	L0020
+	.byte	$01
+	.byte	$07
+	.addr	L0024
+_HelpText:
+	.byte	$01
+	.byte	$00
+	.addr	L0028
+	.byte	$01
+	.byte	$01
+	.addr	L002C
+	.byte	$01
+	.byte	$02
+	.addr	L0030
+	.byte	$01
+	.byte	$03
+	.addr	L0034
+	.byte	$01
+	.byte	$04
+	.addr	L0038
+	.byte	$01
+	.byte	$05
+	.addr	L003C
+	.byte	$01
+	.byte	$06
+	.addr	L0040
+	.byte	$01
+	.byte	$07
+	.addr	L0044
+	.byte	$01
+	.byte	$08
+	.addr	L0048
+	.byte	$01
+	.byte	$09
+	.addr	L004C
+	.byte	$01
+	.byte	$0A
+	.addr	L0050
+	.byte	$01
+	.byte	$0B
+	.addr	L0054
+	.byte	$01
+	.byte	$0C
+	.addr	L0058
+	.byte	$01
+	.byte	$0D
+	.addr	L005C
+	.byte	$01
+	.byte	$0E
+	.addr	L0060
+	.byte	$01
+	.byte	$0F
+	.addr	L0064
+	.byte	$01
+	.byte	$10
+	.addr	L0068
+	.byte	$01
+	.byte	$11
+	.addr	L006C
+_AsmFrame:
+	.byte	$B0
+	.byte	$B2
+	.byte	$AB
+	.byte	$DB
+	.byte	$00
+	.byte	$00
+	.byte	$1E
+	.byte	$0F
+	.byte	$1D
+	.byte	$0E
+	.byte	$01
+	.addr	_AsmHandler
+	.byte	$00
+	.word	$0000
+_RegFrame:
+	.byte	$B2
+	.byte	$AE
+	.byte	$AB
+	.byte	$B3
+	.byte	$1E
+	.byte	$00
+	.byte	$27
+	.byte	$09
+	.byte	$08
+	.byte	$08
+	.byte	$01
+	.addr	_RegHandler
+	.byte	$08
+	.addr	_RegText
+_StackFrame:
+	.byte	$AB
+	.byte	$B3
+	.byte	$DB
+	.byte	$B3
+	.byte	$1E
+	.byte	$09
+	.byte	$27
+	.byte	$0F
+	.byte	$08
+	.byte	$05
+	.byte	$01
+	.addr	_StackHandler
+	.byte	$00
+	.word	$0000
+_CStackFrame:
+	.byte	$DB
+	.byte	$B3
+	.byte	$B1
+	.byte	$BD
+	.byte	$1E
+	.byte	$0F
+	.byte	$27
+	.byte	$18
+	.byte	$08
+	.byte	$08
+	.byte	$01
+	.addr	_CStackHandler
+	.byte	$00
+	.word	$0000
+_DumpFrame:
+	.byte	$AB
+	.byte	$DB
+	.byte	$AD
+	.byte	$B1
+	.byte	$00
+	.byte	$0F
+	.byte	$1E
+	.byte	$18
+	.byte	$1D
+	.byte	$08
+	.byte	$01
+	.addr	_DumpHandler
+	.byte	$00
+	.word	$0000
+_HelpFrame:
+	.byte	$B0
+	.byte	$AE
+	.byte	$AD
+	.byte	$BD
+	.byte	$00
+	.byte	$00
+	.byte	$27
+	.byte	$18
+	.byte	$26
+	.byte	$17
+	.byte	$00
+	.addr	_HelpHandler
+	.byte	$12
+	.addr	_HelpText
+_Frames:
+	.addr	_AsmFrame
+	.addr	_RegFrame
+	.addr	_StackFrame
+	.addr	_CStackFrame
+	.addr	_DumpFrame
+	.addr	_HelpFrame
+L0030:
+	.byte	$C6,$33,$2C,$20,$55,$20,$20,$20,$20,$20,$D2,$55,$4E,$20,$55,$4E
+	.byte	$54,$49,$4C,$20,$53,$55,$42,$52,$4F,$55,$54,$49,$4E,$45,$20,$52
+	.byte	$45,$54,$55,$52,$4E,$53,$00
+L0210:
+	.byte	$C3,$41,$4E,$4E,$4F,$54,$20,$53,$45,$54,$20,$42,$52,$45,$41,$4B
+	.byte	$50,$4F,$49,$4E,$54,$20,$2D,$20,$50,$52,$45,$53,$53,$20,$41,$20
+	.byte	$4B,$45,$59,$00
+L021A:
+	.byte	$D4,$4F,$4F,$20,$4D,$41,$4E,$59,$20,$42,$52,$45,$41,$4B,$50,$4F
+	.byte	$49,$4E,$54,$53,$20,$2D,$20,$50,$52,$45,$53,$53,$20,$41,$20,$4B
+	.byte	$45,$59,$00
+L006C:
+	.byte	$53,$20,$20,$20,$20,$20,$20,$20,$20,$20,$D3,$4B,$49,$50,$20,$4E
+	.byte	$45,$58,$54,$20,$49,$4E,$53,$54,$52,$55,$43,$54,$49,$4F,$4E,$00
+L0040:
+	.byte	$31,$2D,$35,$20,$20,$20,$20,$20,$20,$20,$D3,$45,$4C,$45,$43,$54
+	.byte	$20,$41,$43,$54,$49,$56,$45,$20,$57,$49,$4E,$44,$4F,$57,$00
+L0060:
+	.byte	$50,$20,$20,$20,$20,$20,$20,$20,$20,$20,$D5,$53,$45,$20,$41,$53
+	.byte	$20,$4E,$45,$57,$20,$D0,$C3,$20,$56,$41,$4C,$55,$45,$00
+L0058:
+	.byte	$46,$20,$20,$20,$20,$20,$20,$20,$20,$20,$C6,$4F,$4C,$4C,$4F,$57
+	.byte	$20,$49,$4E,$53,$54,$52,$55,$43,$54,$49,$4F,$4E,$00
+L002C:
+	.byte	$C6,$32,$2C,$20,$54,$20,$20,$20,$20,$20,$D4,$4F,$47,$47,$4C,$45
+	.byte	$20,$42,$52,$45,$41,$4B,$50,$4F,$49,$4E,$54,$00
+L0205:
+	.byte	$C9,$4E,$56,$41,$4C,$49,$44,$20,$49,$4E,$50,$55,$54,$20,$2D,$20
+	.byte	$50,$52,$45,$53,$53,$20,$41,$20,$4B,$45,$59,$00
+L0172:
+	.byte	$D0,$52,$45,$53,$53,$20,$41,$4E,$59,$20,$4B,$45,$59,$20,$54,$4F
+	.byte	$20,$43,$4F,$4E,$54,$49,$4E,$55,$45,$00
+L0034:
+	.byte	$C6,$34,$2C,$20,$48,$20,$20,$20,$20,$20,$D2,$55,$4E,$20,$54,$4F
+	.byte	$20,$43,$55,$52,$53,$4F,$52,$00
+L0068:
+	.byte	$52,$20,$20,$20,$20,$20,$20,$20,$20,$20,$D2,$45,$44,$52,$41,$57
+	.byte	$20,$53,$43,$52,$45,$45,$4E,$00
+L0050:
+	.byte	$41,$2F,$5A,$20,$20,$20,$20,$20,$20,$20,$CD,$4F,$56,$45,$20,$55
+	.byte	$50,$2F,$44,$4F,$57,$4E,$00
+L004C:
+	.byte	$C3,$55,$52,$53,$4F,$52,$20,$20,$20,$20,$CD,$4F,$56,$45,$20,$55
+	.byte	$50,$2F,$44,$4F,$57,$4E,$00
+L005C:
+	.byte	$4F,$20,$20,$20,$20,$20,$20,$20,$20,$20,$C7,$4F,$54,$4F,$20,$4F
+	.byte	$52,$49,$47,$49,$4E,$00
+L0038:
+	.byte	$C6,$37,$2C,$20,$53,$50,$41,$43,$45,$20,$D3,$54,$45,$50,$20,$49
+	.byte	$4E,$54,$4F,$00
+L003C:
+	.byte	$C6,$38,$2C,$20,$45,$4E,$54,$45,$52,$20,$D3,$54,$45,$50,$20,$4F
+	.byte	$56,$45,$52,$00
+L0044:
+	.byte	$2B,$20,$20,$20,$20,$20,$20,$20,$20,$20,$D0,$41,$47,$45,$20,$44
+	.byte	$4F,$57,$4E,$00
+L0054:
+	.byte	$43,$20,$20,$20,$20,$20,$20,$20,$20,$20,$C3,$4F,$4E,$54,$49,$4E
+	.byte	$55,$45,$00
+L0048:
+	.byte	$2D,$20,$20,$20,$20,$20,$20,$20,$20,$20,$D0,$41,$47,$45,$20,$55
+	.byte	$50,$00
+L016E:
+	.byte	$D0,$52,$45,$53,$53,$20,$C6,$31,$20,$46,$4F,$52,$20,$48,$45,$4C
+	.byte	$50,$00
+L0064:
+	.byte	$51,$20,$20,$20,$20,$20,$20,$20,$20,$20,$D1,$55,$49,$54,$00
+L0028:
+	.byte	$C6,$31,$2C,$20,$3F,$20,$20,$20,$20,$20,$C8,$45,$4C,$50,$00
+L0204:
+	.byte	$C7,$4F,$54,$4F,$3A,$20,$00
+L000C:
+	.byte	$D3,$D2,$00
+L0020:
+	.byte	$C3,$D3,$00
+L0024:
+	.byte	$C8,$C9,$00
+L001C:
+	.byte	$D3,$D0,$00
+L0393:
+	.byte	$2D,$3E,$00
+L0008:
+	.byte	$D0,$C3,$00
+L0014:
+	.byte	$D8,$00
+L0010:
+	.byte	$C1,$00
+L0018:
+	.byte	$D9,$00
+
+.segment	"BSS"
+
+_AsmAddr:
+	.res	2,$00
+_DumpAddr:
+	.res	2,$00
+_CStackAddr:
+	.res	2,$00
+_StackAddr:
+	.res	1,$00
+_PromptColor:
+	.res	1,$00
+_PromptLength:
+	.res	1,$00
+_DbgBreaks:
+	.res	48,$00
+
+; ---------------------------------------------------------------
+; unsigned char __near__ AsmHandler (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AsmHandler: near
+
+.segment	"CODE"
+
+	jsr     decsp3
+L02E7:	jsr     _UpdateAsm
+	jsr     stax0sp
+	jsr     _GetKeyUpdate
+	ldy     #$02
+	sta     (sp),y
+	cmp     #$11
+	jeq     L0318
+	cmp     #$2B
+	beq     L02F2
+	cmp     #$2D
+	beq     L02F6
+	cmp     #$41
+	beq     L0310
+	cmp     #$46
+	beq     L0302
+	cmp     #$47
+	beq     L0305
+	cmp     #$4F
+	beq     L0309
+	cmp     #$50
+	beq     L030C
+	cmp     #$54
+	beq     L02FC
+	cmp     #$5A
+	beq     L0318
+	cmp     #$89
+	beq     L02FC
+	cmp     #$91
+	beq     L0310
+	jmp     L0500
+L02F2:	jsr     ldax0sp
+	sta     _AsmAddr
+	stx     _AsmAddr+1
+	jmp     L02E7
+L02F6:	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     pushax
+	lda     _AsmFrame+9
+	jsr     _AsmBack
+	sta     _AsmAddr
+	stx     _AsmAddr+1
+	jmp     L02E7
+L02FC:	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     _DbgToggleUserBreak
+	jmp     L02E7
+L0302:	jsr     _AsmFollow
+	jmp     L02E7
+L0305:	lda     #<(_AsmAddr)
+	ldx     #>(_AsmAddr)
+	jsr     _InputGoto
+	jmp     L02E7
+L0309:	jsr     _AsmHome
+	jmp     L02E7
+L030C:	lda     _AsmAddr+1
+	sta     _brk_pc+1
+	lda     _AsmAddr
+	sta     _brk_pc
+	jmp     L02E7
+L0310:	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     pushax
+	lda     #$01
+	jsr     _AsmBack
+	sta     _AsmAddr
+	stx     _AsmAddr+1
+	jmp     L02E7
+L0318:	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     _DbgDisAsmLen
+	clc
+	adc     _AsmAddr
+	sta     _AsmAddr
+	txa
+	adc     _AsmAddr+1
+	sta     _AsmAddr+1
+	jmp     L02E7
+L0500:	ldx     #$00
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ RegHandler (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_RegHandler: near
+
+.segment	"CODE"
+
+	jmp     _GetKeyUpdate
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ StackHandler (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_StackHandler: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     _StackFrame+9
+	jsr     pusha
+L0372:	jsr     _GetKeyUpdate
+	ldy     #$01
+	sta     (sp),y
+	cmp     #$11
+	beq     L038B
+	cmp     #$2B
+	beq     L037B
+	cmp     #$2D
+	beq     L037F
+	cmp     #$41
+	beq     L0386
+	cmp     #$4F
+	beq     L0383
+	cmp     #$5A
+	beq     L038B
+	cmp     #$91
+	beq     L0386
+	jmp     L0501
+L037B:	dey
+	lda     (sp),y
+	clc
+	adc     _StackAddr
+	sta     _StackAddr
+	jmp     L0379
+L037F:	dey
+	lda     (sp),y
+	eor     #$FF
+	sec
+	adc     _StackAddr
+	sta     _StackAddr
+	jmp     L0379
+L0383:	jsr     _StackHome
+	jmp     L0379
+L0386:	dec     _StackAddr
+	jmp     L0379
+L038B:	inc     _StackAddr
+	jmp     L0379
+L0501:	ldx     #$00
+	jmp     incsp2
+L0379:	jsr     _UpdateStack
+	jmp     L0372
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ CStackHandler (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_CStackHandler: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     _CStackFrame+9
+	asl     a
+	jsr     pusha
+L03B2:	jsr     _GetKeyUpdate
+	ldy     #$01
+	sta     (sp),y
+	cmp     #$11
+	beq     L03CD
+	cmp     #$2B
+	beq     L03BB
+	cmp     #$2D
+	beq     L03BF
+	cmp     #$41
+	beq     L03C6
+	cmp     #$4F
+	beq     L03C3
+	cmp     #$5A
+	beq     L03CD
+	cmp     #$91
+	beq     L03C6
+	jmp     L0502
+L03BB:	dey
+	lda     (sp),y
+	clc
+	adc     _CStackAddr
+	sta     _CStackAddr
+	tya
+	adc     _CStackAddr+1
+	sta     _CStackAddr+1
+	jmp     L03B9
+L03BF:	dey
+	lda     (sp),y
+	eor     #$FF
+	sec
+	adc     _CStackAddr
+	sta     _CStackAddr
+	lda     #$FF
+	adc     _CStackAddr+1
+	sta     _CStackAddr+1
+	jmp     L03B9
+L03C3:	jsr     _CStackHome
+	jmp     L03B9
+L03C6:	lda     _CStackAddr
+	sec
+	sbc     #$02
+	sta     _CStackAddr
+	bcs     L03B9
+	dec     _CStackAddr+1
+	jmp     L03B9
+L03CD:	lda     #$02
+	clc
+	adc     _CStackAddr
+	sta     _CStackAddr
+	bcc     L03B9
+	inc     _CStackAddr+1
+	jmp     L03B9
+L0502:	ldx     #$00
+	jmp     incsp2
+L03B9:	jsr     _UpdateCStack
+	jmp     L03B2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ DumpHandler (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DumpHandler: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	ldx     #$00
+	lda     _DumpFrame+9
+	jsr     shlax3
+	jsr     pushax
+L03F2:	jsr     _GetKeyUpdate
+	ldy     #$02
+	sta     (sp),y
+	cmp     #$11
+	beq     L0411
+	cmp     #$2B
+	beq     L03FB
+	cmp     #$2D
+	beq     L03FF
+	cmp     #$41
+	beq     L040A
+	cmp     #$47
+	beq     L0403
+	cmp     #$4F
+	beq     L0407
+	cmp     #$5A
+	beq     L0411
+	cmp     #$91
+	beq     L040A
+	jmp     L0503
+L03FB:	jsr     ldax0sp
+	clc
+	adc     _DumpAddr
+	sta     _DumpAddr
+	txa
+	adc     _DumpAddr+1
+	sta     _DumpAddr+1
+	jmp     L03F9
+L03FF:	jsr     ldax0sp
+	eor     #$FF
+	sec
+	adc     _DumpAddr
+	sta     _DumpAddr
+	txa
+	eor     #$FF
+	adc     _DumpAddr+1
+	sta     _DumpAddr+1
+	jmp     L03F9
+L0403:	lda     #<(_DumpAddr)
+	ldx     #>(_DumpAddr)
+	jsr     _InputGoto
+	jmp     L03F9
+L0407:	jsr     _DumpHome
+	jmp     L03F9
+L040A:	lda     _DumpAddr
+	sec
+	sbc     #$08
+	sta     _DumpAddr
+	bcs     L03F9
+	dec     _DumpAddr+1
+	jmp     L03F9
+L0411:	lda     #$08
+	clc
+	adc     _DumpAddr
+	sta     _DumpAddr
+	bcc     L03F9
+	inc     _DumpAddr+1
+	jmp     L03F9
+L0503:	ldx     #$00
+	jmp     incsp3
+L03F9:	jsr     _UpdateDump
+	jmp     L03F2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ HelpHandler (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_HelpHandler: near
+
+.segment	"CODE"
+
+	lda     _ActiveFrame
+	ldx     _ActiveFrame+1
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #$01
+	jsr     _ActivateFrame
+	jsr     _AnyKeyPrompt
+	jsr     _cgetc
+	ldy     #$00
+	lda     (sp),y
+	jsr     _Redraw
+	ldx     #$00
+	txa
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DisplayPrompt (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DisplayPrompt: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp1
+	lda     #$01
+	jsr     _textcolor
+	ldy     #$00
+	sta     (sp),y
+	lda     _ActivePrompt
+	ora     _ActivePrompt+1
+	beq     L0154
+	lda     _PromptColor
+	jsr     _textcolor
+	lda     #$28
+	sec
+	sbc     _PromptLength
+	lsr     a
+	jsr     pusha
+	lda     #$18
+	jsr     pusha
+	lda     _PromptLength
+	jsr     _chlinexy
+L0154:	ldy     #$02
+	jsr     ldaxysp
+	sta     _ActivePrompt
+	stx     _ActivePrompt+1
+	ldy     #$00
+	lda     (sp),y
+	sta     _PromptColor
+	lda     _ActivePrompt
+	ldx     _ActivePrompt+1
+	jsr     _strlen
+	sta     _PromptLength
+	lda     #$01
+	jsr     _textcolor
+	lda     #$28
+	sec
+	sbc     _PromptLength
+	lsr     a
+	jsr     pusha
+	lda     #$18
+	jsr     pusha
+	lda     _ActivePrompt
+	ldx     _ActivePrompt+1
+	jsr     _cputsxy
+	lda     _PromptColor
+	jsr     _textcolor
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ SingleStep (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_SingleStep: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jsr     decsp1
+	lda     _brk_pc+1
+	sta     ptr1+1
+	lda     _brk_pc
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	cmp     #$10
+	beq     L0449
+	cmp     #$20
+	beq     L045C
+	cmp     #$30
+	beq     L0449
+	cmp     #$40
+	beq     L0457
+	cmp     #$4C
+	beq     L0433
+	cmp     #$50
+	beq     L0449
+	cmp     #$60
+	beq     L0454
+	cmp     #$6C
+	beq     L0437
+	cmp     #$70
+	beq     L0449
+	cmp     #$90
+	beq     L0449
+	cmp     #$B0
+	beq     L0449
+	cmp     #$D0
+	beq     L0449
+	cmp     #$F0
+	beq     L0449
+	jmp     L0431
+L0433:	jsr     _GetArg16
+	jmp     L0504
+L0437:	jsr     _GetArg16
+	jsr     ldaxi
+	jmp     L0504
+L0449:	lda     _brk_pc
+	ldx     _brk_pc+1
+	iny
+	jsr     ldaidx
+	dey
+	sta     (sp),y
+	lda     (sp),y
+	beq     L0431
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0452
+	dex
+L0452:	clc
+	adc     _brk_pc
+	pha
+	txa
+	adc     _brk_pc+1
+	tax
+	pla
+	jsr     incax2
+	jsr     _DbgSetTmpBreak
+	jmp     L0431
+L0454:	jsr     _SetRTSBreak
+	jmp     incsp2
+L0457:	lda     #$01
+	jsr     _GetStack16
+	jmp     L0504
+L045C:	iny
+	lda     (sp),y
+	beq     L0431
+	jsr     _GetArg16
+	jmp     L0504
+L0431:	lda     _brk_pc
+	ldx     _brk_pc+1
+	jsr     pushax
+	lda     _brk_pc
+	ldx     _brk_pc+1
+	jsr     _DbgDisAsmLen
+	jsr     tosaddax
+L0504:	jsr     _DbgSetTmpBreak
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ RedrawStatic (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_RedrawStatic: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	lda     #$FF
+	sta     _ActiveFrame
+	sta     _ActiveFrame+1
+	lda     #$00
+	jsr     _bordercolor
+	lda     #$00
+	jsr     _bgcolor
+	jsr     _clrscr
+	lda     #$00
+	jsr     _cursor
+	lda     #$0F
+	jsr     _textcolor
+	jsr     _DrawFrames
+	jsr     _HelpPrompt
+	ldy     #$00
+	lda     (sp),y
+	jsr     pusha0
+	lda     #$00
+	jsr     _ActivateFrame
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ Redraw (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Redraw: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldy     #$00
+	lda     (sp),y
+	jsr     _RedrawStatic
+	jsr     _UpdateAsm
+	jsr     _UpdateReg
+	jsr     _UpdateStack
+	jsr     _UpdateCStack
+	jsr     _UpdateDump
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ GetKeyUpdate (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_GetKeyUpdate: near
+
+.segment	"BSS"
+
+L047E:
+	.res	1,$00
+
+.segment	"CODE"
+
+	jmp     L0481
+L0505:	lda     L047E
+	beq     L0487
+	cmp     #$01
+	beq     L048A
+	cmp     #$02
+	beq     L048D
+	cmp     #$03
+	beq     L0490
+	jmp     L0506
+L0487:	jsr     _UpdateAsm
+	jmp     L0506
+L048A:	jsr     _UpdateStack
+	jmp     L0506
+L048D:	jsr     _UpdateCStack
+	jmp     L0506
+L0490:	jsr     _UpdateDump
+L0506:	lda     L047E
+	clc
+	adc     #$01
+	and     #$03
+	sta     L047E
+L0481:	jsr     _kbhit
+	tax
+	beq     L0505
+	jmp     _cgetc
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DrawFrame (register __near__ const struct $anon-struct-0014 *, unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DrawFrame: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldy     #$01
+	ldx     #$04
+	jsr     regswap2
+	ldy     #$0B
+	jsr     subysp
+	ldy     #$0B
+	lda     (sp),y
+	beq     L00D3
+	lda     #$01
+	jsr     _textcolor
+	ldy     #$00
+	sta     (sp),y
+	lda     #$B0
+	ldy     #$07
+	sta     (sp),y
+	lda     #$AE
+	dey
+	sta     (sp),y
+	lda     #$AD
+	dey
+	sta     (sp),y
+	lda     #$BD
+	jmp     L0508
+L00D3:	lda     #$0F
+	jsr     _textcolor
+	ldy     #$00
+	sta     (sp),y
+	lda     (regbank+4),y
+	ldy     #$07
+	sta     (sp),y
+	ldy     #$01
+	lda     (regbank+4),y
+	ldy     #$06
+	sta     (sp),y
+	ldy     #$02
+	lda     (regbank+4),y
+	ldy     #$05
+	sta     (sp),y
+	ldy     #$03
+	lda     (regbank+4),y
+L0508:	ldy     #$04
+	sta     (sp),y
+	lda     (regbank+4),y
+	dey
+	sta     (sp),y
+	ldy     #$05
+	lda     (regbank+4),y
+	ldy     #$02
+	sta     (sp),y
+	ldy     #$08
+	lda     (regbank+4),y
+	ldy     #$01
+	sta     (sp),y
+	ldy     #$03
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$03
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$09
+	lda     (sp),y
+	jsr     _cputcxy
+	ldy     #$01
+	lda     (sp),y
+	jsr     _chline
+	ldy     #$06
+	lda     (sp),y
+	jsr     _cputc
+	ldy     #$03
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$03
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	jsr     pusha
+	ldy     #$09
+	lda     (regbank+4),y
+	jsr     _cvlinexy
+	ldy     #$05
+	lda     (sp),y
+	jsr     _cputc
+	ldy     #$01
+	lda     (sp),y
+	jsr     _chline
+	ldy     #$04
+	lda     (sp),y
+	jsr     _cputc
+	ldy     #$06
+	lda     (regbank+4),y
+	jsr     pusha
+	ldy     #$03
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$09
+	lda     (regbank+4),y
+	jsr     _cvlinexy
+	lda     #$0F
+	jsr     _textcolor
+	ldy     #$0D
+	lda     (regbank+4),y
+	ldy     #$08
+	sta     (sp),y
+	ldy     #$0F
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	ldy     #$09
+	jsr     staxysp
+	jmp     L0110
+L010E:	ldy     #$03
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$0C
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     tosadda0
+	jsr     pusha
+	ldy     #$03
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$0D
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	jsr     tosadda0
+	jsr     pusha
+	ldy     #$0C
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     _cputsxy
+	ldy     #$09
+	ldx     #$00
+	lda     #$04
+	jsr     addeqysp
+L0110:	ldy     #$08
+	lda     (sp),y
+	pha
+	sec
+	sbc     #$01
+	sta     (sp),y
+	pla
+	tax
+	bne     L010E
+	lda     (sp,x)
+	jsr     _textcolor
+	ldy     #$0C
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	iny
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DrawFrames (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DrawFrames: near
+
+.segment	"CODE"
+
+	jsr     decsp3
+	lda     #$00
+	ldy     #$02
+L050A:	sta     (sp),y
+	cmp     #$06
+	bcs     L011B
+	ldx     #$00
+	asl     a
+	bcc     L050B
+	inx
+	clc
+L050B:	adc     #<(_Frames)
+	tay
+	txa
+	adc     #>(_Frames)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     stax0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$0A
+	lda     (ptr1),y
+	beq     L011C
+	jsr     pushw0sp
+	lda     #$00
+	jsr     _DrawFrame
+L011C:	ldy     #$02
+	clc
+	lda     #$01
+	adc     (sp),y
+	jmp     L050A
+L011B:	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ ActivateFrame (int, unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ActivateFrame: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jsr     decsp1
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	cpx     _ActiveFrame+1
+	bne     L050E
+	cmp     _ActiveFrame
+	jeq     L012E
+L050E:	ldx     _ActiveFrame+1
+	bmi     L0130
+	lda     _ActiveFrame
+	jsr     aslax1
+	clc
+	adc     #<(_Frames)
+	tay
+	txa
+	adc     #>(_Frames)
+	tax
+	tya
+	jsr     pushw
+	lda     #$00
+	jsr     _DrawFrame
+L0130:	ldy     #$05
+	jsr     ldaxysp
+	sta     _ActiveFrame
+	stx     _ActiveFrame+1
+	txa
+	bmi     L0136
+	lda     _ActiveFrame
+	jsr     aslax1
+	clc
+	adc     #<(_Frames)
+	tay
+	txa
+	adc     #>(_Frames)
+	tax
+	tya
+	jsr     ldaxi
+	sta     regbank+4
+	stx     regbank+4+1
+	ldy     #$03
+	lda     (sp),y
+	beq     L0140
+	ldy     #$05
+	lda     (regbank+4),y
+	clc
+	adc     #$01
+	ldy     #$02
+L050D:	sta     (sp),y
+	jsr     pusha0
+	ldy     #$07
+	lda     (regbank+4),y
+	jsr     tosicmp0
+	bcs     L0140
+	ldy     #$04
+	lda     (regbank+4),y
+	clc
+	adc     #$01
+	jsr     pusha
+	ldy     #$03
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$08
+	lda     (regbank+4),y
+	jsr     _cclearxy
+	ldy     #$02
+	clc
+	lda     #$01
+	adc     (sp),y
+	jmp     L050D
+L0140:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	lda     #$01
+	jsr     _DrawFrame
+L0136:	lda     _ActivePrompt
+	ldx     _ActivePrompt+1
+	jsr     _DisplayPrompt
+L012E:	ldy     #$00
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ HelpPrompt (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_HelpPrompt: near
+
+.segment	"CODE"
+
+	lda     #<(L016E)
+	ldx     #>(L016E)
+	jmp     _DisplayPrompt
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ AnyKeyPrompt (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AnyKeyPrompt: near
+
+.segment	"CODE"
+
+	lda     #<(L0172)
+	ldx     #>(L0172)
+	jmp     _DisplayPrompt
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ IsAbortKey (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_IsAbortKey: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldx     #$00
+	lda     (sp,x)
+	cmp     #$1B
+	bne     L0510
+	lda     #$01
+	jmp     incsp1
+L0510:	cmp     #$03
+	bne     L0511
+	lda     #$01
+	jmp     incsp1
+L0511:	txa
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ Input (__near__ unsigned char *, __near__ unsigned char *, unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Input: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jsr     decsp8
+	lda     #$00
+	jsr     pusha
+	lda     #$18
+	jsr     pusha
+	lda     #$28
+	jsr     _cclearxy
+	lda     #$01
+	jsr     _textcolor
+	ldy     #$05
+	sta     (sp),y
+	lda     #$00
+	jsr     pusha
+	lda     #$18
+	jsr     pusha
+	ldy     #$0E
+	jsr     ldaxysp
+	jsr     _cputsxy
+	lda     #$0F
+	jsr     _textcolor
+	jsr     _wherex
+	ldy     #$03
+	sta     (sp),y
+	lda     #$01
+	jsr     _cursor
+	ldy     #$04
+	sta     (sp),y
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+L0193:	jsr     _cgetc
+	ldy     #$00
+	sta     (sp),y
+	ldx     #$00
+	jsr     _isalnum
+	stx     tmp1
+	ora     tmp1
+	beq     L0198
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$08
+	cmp     (sp),y
+	bcs     L0198
+	clc
+	iny
+	adc     (sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	ldy     #$00
+	lda     (sp),y
+	sta     (ptr1),y
+	ldy     #$02
+	lda     (sp),y
+	clc
+	iny
+	adc     (sp),y
+	jsr     pusha
+	lda     #$18
+	jsr     pusha
+	ldy     #$02
+	lda     (sp),y
+	jsr     _cputcxy
+	ldy     #$02
+	clc
+	lda     #$01
+	adc     (sp),y
+	jmp     L0515
+L0198:	ldy     #$02
+	lda     (sp),y
+	beq     L01A6
+	ldy     #$00
+	lda     (sp),y
+	cmp     #$14
+	bne     L051C
+	ldy     #$02
+	lda     (sp),y
+	sec
+	sbc     #$01
+	sta     (sp),y
+	clc
+	iny
+	adc     (sp),y
+	jsr     pusha
+	lda     #$18
+	jsr     pusha
+	lda     #$20
+	jsr     _cputcxy
+	ldy     #$02
+	lda     (sp),y
+	clc
+	iny
+	adc     (sp),y
+	jsr     pusha
+	lda     #$18
+	jsr     _gotoxy
+	jmp     L01BB
+L01A6:	tay
+L051C:	lda     (sp),y
+	cmp     #$0D
+	bne     L051A
+	ldy     #$02
+	lda     (sp),y
+	clc
+	ldy     #$09
+	adc     (sp),y
+	sta     ptr1
+	lda     #$00
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	lda     #$01
+	jmp     L051B
+L051A:	jsr     _IsAbortKey
+	tax
+	beq     L01BB
+	lda     #$02
+L051B:	ldy     #$01
+L0515:	sta     (sp),y
+L01BB:	ldy     #$01
+	lda     (sp),y
+	jeq     L0193
+	ldy     #$04
+	lda     (sp),y
+	jsr     _cursor
+	ldy     #$05
+	lda     (sp),y
+	jsr     _textcolor
+	jsr     _DrawFrames
+	lda     _ActiveFrame
+	ldx     _ActiveFrame+1
+	ldy     #$06
+	jsr     staxysp
+	lda     #$FF
+	sta     _ActiveFrame
+	sta     _ActiveFrame+1
+	ldy     #$09
+	jsr     pushwysp
+	lda     #$00
+	jsr     _ActivateFrame
+	ldy     #$01
+	lda     (sp),y
+	cmp     #$01
+	jsr     booleq
+	ldy     #$0D
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ InputHex (__near__ unsigned char *, __near__ unsigned int *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_InputHex: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$0A
+	jsr     subysp
+	ldy     #$0F
+	jsr     pushwysp
+	lda     #$07
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$04
+	jsr     _Input
+	tax
+	jeq     L01FA
+	ldy     #$05
+	lda     (sp),y
+	ldx     #$00
+	jsr     _isxdigit
+	stx     tmp1
+	ora     tmp1
+	bne     L01D2
+	tax
+	jmp     L01FA
+L01D2:	lda     #$05
+	jsr     leaa0sp
+	ldy     #$03
+	jsr     staxysp
+	ldx     #$00
+	txa
+	jsr     stax0sp
+	jmp     L01E1
+L01DF:	jsr     ldax0sp
+	jsr     shlax4
+	jsr     stax0sp
+	ldy     #$02
+	lda     (sp),y
+	ldx     #$00
+	jsr     _isdigit
+	stx     tmp1
+	ora     tmp1
+	beq     L01EA
+	ldy     #$02
+	lda     (sp),y
+	sec
+	sbc     #$30
+	jmp     L051E
+L01EA:	ldy     #$02
+	lda     (sp),y
+	ldx     #$00
+	jsr     _toupper
+	ldy     #$B7
+	jsr     decaxy
+	ldy     #$02
+L051E:	sta     (sp),y
+	ldx     #$00
+	jsr     addeq0sp
+	ldy     #$03
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L01E1:	ldy     #$04
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	ldy     #$02
+	sta     (sp),y
+	tax
+	beq     L051D
+	ldx     #$00
+	jsr     _isxdigit
+	stx     tmp1
+	ora     tmp1
+	bne     L01DF
+L051D:	ldy     #$0B
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	jsr     ldax0sp
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	ldx     #$00
+	tya
+L01FA:	ldy     #$0E
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ ErrorPrompt (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ErrorPrompt: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     _ActivePrompt
+	ldx     _ActivePrompt+1
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _DisplayPrompt
+	jsr     _cgetc
+	jsr     ldax0sp
+	jsr     _DisplayPrompt
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ InputGoto (__near__ unsigned int *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_InputGoto: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp1
+	lda     #<(L0204)
+	ldx     #>(L0204)
+	jsr     pushax
+	ldy     #$04
+	jsr     ldaxysp
+	jsr     _InputHex
+	ldy     #$00
+	sta     (sp),y
+	lda     (sp),y
+	bne     L0524
+	lda     #<(L0205)
+	ldx     #>(L0205)
+	jsr     _ErrorPrompt
+L0524:	ldx     #$00
+	lda     (sp,x)
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ BreakInRomError (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_BreakInRomError: near
+
+.segment	"CODE"
+
+	lda     #<(L0210)
+	ldx     #>(L0210)
+	jmp     _ErrorPrompt
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DbgSetTmpBreak (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DbgSetTmpBreak: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     _DbgGetBreakSlot
+	jsr     pushax
+	jsr     ldax0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	jsr     ldax0sp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$80
+	ldy     #$03
+	sta     (ptr1),y
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DbgToggleUserBreak (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DbgToggleUserBreak: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _DbgIsBreak
+	sta     regbank+4
+	stx     regbank+4+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L021D
+	lda     #$00
+	ldy     #$03
+	sta     (regbank+4),y
+	dec     _DbgBreakCount
+	jmp     L022C
+L021D:	lda     _DbgBreakCount
+	cmp     #$0A
+	bcc     L0223
+	lda     #<(L021A)
+	ldx     #>(L021A)
+	jsr     _ErrorPrompt
+	jmp     L022C
+L0223:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _DbgIsRAM
+	stx     tmp1
+	ora     tmp1
+	bne     L0228
+	jsr     _BreakInRomError
+	jmp     L022C
+L0228:	jsr     _DbgGetBreakSlot
+	sta     regbank+4
+	stx     regbank+4+1
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	tya
+	ldy     #$03
+	sta     (regbank+4),y
+	inc     _DbgBreakCount
+L022C:	ldy     #$00
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DbgResetTmpBreaks (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DbgResetTmpBreaks: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     #<(_DbgBreaks)
+	ldx     #>(_DbgBreaks)
+	jsr     pushax
+	lda     #$00
+	ldy     #$02
+L0526:	sta     (sp),y
+	cmp     #$0A
+	bcs     L0237
+	jsr     ldax0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$03
+	lda     (ptr1),y
+	cmp     #$80
+	bne     L023E
+	jsr     ldax0sp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$00
+	ldy     #$03
+	sta     (ptr1),y
+L023E:	ldx     #$00
+	lda     #$04
+	jsr     addeq0sp
+	ldy     #$02
+	clc
+	lda     #$01
+	adc     (sp),y
+	jmp     L0526
+L0237:	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ DbgTmpBreaksOk (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DbgTmpBreaksOk: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     #<(_DbgBreaks)
+	ldx     #>(_DbgBreaks)
+	jsr     pushax
+	lda     #$00
+	ldy     #$02
+L0527:	sta     (sp),y
+	ldx     #$00
+	cmp     #$0A
+	bcs     L0529
+	jsr     ldax0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$03
+	lda     (ptr1),y
+	cmp     #$80
+	bne     L024D
+	jsr     ldax0sp
+	jsr     ldaxi
+	jsr     _DbgIsRAM
+	stx     tmp1
+	ora     tmp1
+	bne     L024D
+	jsr     _BreakInRomError
+	jsr     _DbgResetTmpBreaks
+	ldx     #$00
+	txa
+	jmp     incsp3
+L024D:	ldx     #$00
+	lda     #$04
+	jsr     addeq0sp
+	ldy     #$02
+	clc
+	lda     #$01
+	adc     (sp),y
+	jmp     L0527
+L0529:	lda     #$01
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ AsmBack (unsigned int, unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AsmBack: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldy     #$43
+	jsr     subysp
+	lda     #$06
+	jsr     pusha0
+L025A:	lda     #$00
+	ldy     #$02
+	sta     (sp),y
+	ldy     #$49
+	jsr     pushwysp
+	ldy     #$47
+	ldx     #$00
+	lda     (sp),y
+	jsr     mulax3
+	jsr     tossubax
+	sec
+	ldy     #$00
+	sbc     (sp),y
+	pha
+	txa
+	iny
+	sbc     (sp),y
+	tax
+	pla
+	ldy     #$43
+	jsr     staxysp
+L0263:	ldy     #$44
+	jsr     ldaxysp
+	jsr     _DbgDisAsmLen
+	ldy     #$43
+	jsr     addeqysp
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L052D
+	inx
+	clc
+L052D:	adc     #$03
+	bcc     L026C
+	inx
+	clc
+L026C:	adc     sp
+	sta     ptr1
+	txa
+	adc     sp+1
+	sta     ptr1+1
+	ldy     #$44
+	jsr     ldaxysp
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	iny
+	lda     (sp),y
+	clc
+	adc     #$01
+	and     #$1F
+	sta     (sp),y
+	ldy     #$44
+	jsr     ldaxysp
+	ldy     #$46
+	cmp     (sp),y
+	txa
+	iny
+	sbc     (sp),y
+	bcc     L0263
+	ldy     #$44
+	jsr     ldaxysp
+	ldy     #$46
+	cmp     (sp),y
+	bne     L052F
+	txa
+	iny
+	cmp     (sp),y
+	beq     L0274
+L052F:	ldy     #$01
+	lda     (sp),y
+	bne     L0531
+	dey
+	lda     (sp),y
+	cmp     #$0C
+	bne     L0531
+L0274:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	sec
+	ldy     #$45
+	sbc     (sp),y
+	sec
+	sbc     #$01
+	and     #$1F
+	asl     a
+	bcc     L052E
+	inx
+	clc
+L052E:	adc     #$03
+	bcc     L027A
+	inx
+	clc
+L027A:	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     ldaxi
+	jmp     L025B
+L0531:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	jmp     L025A
+L025B:	ldy     #$48
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ UpdateAsm (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_UpdateAsm: near
+
+.segment	"CODE"
+
+	ldy     #$2A
+	jsr     subysp
+	lda     _AsmFrame+8
+	jsr     pusha
+	lda     _AsmFrame+4
+	clc
+	adc     #$01
+	jsr     pusha
+	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     pushax
+	lda     #$02
+	jsr     _AsmBack
+	jsr     pushax
+	lda     _AsmFrame+5
+	clc
+	adc     #$01
+	ldy     #$04
+L0534:	sta     (sp),y
+	cmp     _AsmFrame+7
+	jcs     L0285
+	jsr     pushw0sp
+	lda     #$08
+	jsr     leaa0sp
+	jsr     pushax
+	ldy     #$07
+	lda     (sp),y
+	jsr     _DbgDisAsm
+	ldy     #$05
+	sta     (sp),y
+	jsr     ldax0sp
+	cpx     _brk_pc+1
+	bne     L0291
+	cmp     _brk_pc
+	bne     L0291
+	lda     #$2D
+	ldy     #$0A
+	sta     (sp),y
+	lda     #$3E
+	iny
+	sta     (sp),y
+L0291:	jsr     ldax0sp
+	jsr     _DbgIsBreak
+	stx     tmp1
+	ora     tmp1
+	beq     L0299
+	lda     #$2A
+	ldy     #$0B
+	sta     (sp),y
+L0299:	jsr     ldax0sp
+	cpx     _AsmAddr+1
+	bne     L029F
+	cmp     _AsmAddr
+	bne     L029F
+	lda     #$01
+	jsr     _revers
+	lda     #$01
+	jsr     pusha
+	ldy     #$05
+	lda     (sp),y
+	jsr     pusha
+	lda     #$08
+	jsr     leaa0sp
+	jsr     _cputsxy
+	lda     #$00
+	jsr     _revers
+	jmp     L02A9
+L029F:	lda     #$01
+	jsr     pusha
+	ldy     #$05
+	lda     (sp),y
+	jsr     pusha
+	lda     #$08
+	jsr     leaa0sp
+	jsr     _cputsxy
+L02A9:	ldy     #$05
+	lda     (sp),y
+	ldx     #$00
+	jsr     addeq0sp
+	ldy     #$04
+	clc
+	lda     #$01
+	adc     (sp),y
+	jmp     L0534
+L0285:	jsr     ldax0sp
+	ldy     #$2E
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ AsmArg16 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AsmArg16: near
+
+.segment	"CODE"
+
+	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     incax1
+	ldy     #$01
+	jmp     ldaxidx
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ AsmFollow (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AsmFollow: near
+
+.segment	"CODE"
+
+	lda     _AsmAddr+1
+	sta     ptr1+1
+	lda     _AsmAddr
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	cmp     #$10
+	beq     L02C3
+	cmp     #$20
+	beq     L02B9
+	cmp     #$30
+	beq     L02C3
+	cmp     #$40
+	beq     L0539
+	cmp     #$4C
+	beq     L02B9
+	cmp     #$50
+	beq     L02C3
+	cmp     #$60
+	beq     L0538
+	cmp     #$6C
+	beq     L02BF
+	cmp     #$70
+	beq     L02C3
+	cmp     #$90
+	beq     L02C3
+	cmp     #$B0
+	beq     L02C3
+	cmp     #$D0
+	beq     L02C3
+	cmp     #$F0
+	beq     L02C3
+	rts
+L02B9:	jsr     _AsmArg16
+	jmp     L053A
+L02BF:	jsr     _AsmArg16
+	jmp     L0536
+L02C3:	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     incax2
+	jsr     pushax
+	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     incax1
+	ldy     #$00
+	jsr     ldaidx
+	jsr     tosaddax
+	jmp     L053A
+L0538:	ldx     #$01
+	txa
+	clc
+	adc     _DbgSP
+	bcc     L0535
+	inx
+L0535:	jsr     ldaxi
+	jsr     incax1
+	jmp     L053A
+L0539:	ldx     #$01
+	lda     #$02
+	clc
+	adc     _DbgSP
+	bcc     L0536
+	inx
+L0536:	jsr     ldaxi
+L053A:	sta     _AsmAddr
+	stx     _AsmAddr+1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ AsmHome (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AsmHome: near
+
+.segment	"CODE"
+
+	lda     _brk_pc+1
+	sta     _AsmAddr+1
+	lda     _brk_pc
+	sta     _AsmAddr
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ InitAsm (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_InitAsm: near
+
+.segment	"CODE"
+
+	jsr     _AsmHome
+	jmp     _UpdateAsm
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ UpdateReg (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_UpdateReg: near
+
+.segment	"CODE"
+
+	lda     _RegFrame+4
+	clc
+	adc     #$05
+	jsr     pusha
+	ldy     #$00
+	lda     (sp),y
+	clc
+	adc     #$02
+	jsr     pusha
+	lda     _RegFrame+5
+	jsr     pusha
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	jsr     _gotoxy
+	lda     _brk_pc
+	ldx     _brk_pc+1
+	jsr     _cputhex16
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	jsr     _gotoxy
+	lda     _brk_sr
+	jsr     _cputhex8
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	jsr     _gotoxy
+	lda     _brk_a
+	jsr     _cputhex8
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	jsr     _gotoxy
+	lda     _brk_x
+	jsr     _cputhex8
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	jsr     _gotoxy
+	lda     _brk_y
+	jsr     _cputhex8
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	jsr     _gotoxy
+	lda     _DbgSP
+	jsr     _cputhex8
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	jsr     _gotoxy
+	lda     _DbgCS
+	ldx     _DbgCS+1
+	jsr     _cputhex16
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	jsr     _gotoxy
+	lda     _DbgHI
+	ldx     _DbgHI+1
+	jsr     _cputhex16
+	ldx     #$00
+	txa
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ InitReg (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_InitReg: near
+
+.segment	"CODE"
+
+	jmp     _UpdateReg
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ UpdateStack (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_UpdateStack: near
+
+.segment	"CODE"
+
+	lda     _StackAddr
+	jsr     pusha
+	lda     _StackFrame+4
+	clc
+	adc     #$01
+	jsr     pusha
+	ldy     #$00
+	lda     (sp),y
+	clc
+	adc     #$06
+	jsr     pusha
+	jsr     decsp1
+	lda     _StackFrame+7
+	sec
+	sbc     #$01
+	ldy     #$00
+L053E:	sta     (sp),y
+	ldx     #$00
+	sec
+	sbc     _StackFrame+5
+	sta     tmp1
+	lda     tmp1
+	beq     L0356
+	bcc     L0356
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	lda     (sp),y
+	jsr     _gotoxy
+	ldy     #$03
+	lda     (sp),y
+	jsr     _cputhex8
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	lda     (sp),y
+	jsr     _gotoxy
+	ldx     #$01
+	lda     #$00
+	clc
+	ldy     #$03
+	adc     (sp),y
+	bcc     L053C
+	inx
+L053C:	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	jsr     _cputhex8
+	ldy     #$03
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$00
+	lda     (sp),y
+	sec
+	sbc     #$01
+	jmp     L053E
+L0356:	ldy     #$03
+	lda     (sp),y
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ StackHome (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_StackHome: near
+
+.segment	"CODE"
+
+	lda     _DbgSP
+	clc
+	adc     #$01
+	sta     _StackAddr
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ InitStack (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_InitStack: near
+
+.segment	"CODE"
+
+	jsr     _StackHome
+	jmp     _UpdateStack
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ UpdateCStack (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_UpdateCStack: near
+
+.segment	"CODE"
+
+	lda     _CStackAddr
+	ldx     _CStackAddr+1
+	jsr     pushax
+	lda     _CStackFrame+4
+	clc
+	adc     #$05
+	jsr     pusha
+	jsr     decsp1
+	lda     _CStackFrame+7
+	sec
+	sbc     #$01
+	ldy     #$00
+L0540:	sta     (sp),y
+	sec
+	sbc     _CStackFrame+5
+	sta     tmp1
+	lda     tmp1
+	beq     L0541
+	bcc     L0541
+	iny
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	lda     (sp),y
+	jsr     _gotoxy
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     ldaxi
+	jsr     _cputhex16
+	ldy     #$02
+	ldx     #$00
+	tya
+	jsr     addeqysp
+	ldy     #$00
+	lda     (sp),y
+	sec
+	sbc     #$01
+	jmp     L0540
+L0541:	lda     _CStackFrame+4
+	clc
+	adc     #$01
+	jsr     pusha
+	lda     _CStackFrame+7
+	sec
+	sbc     #$01
+	jsr     pusha
+	lda     #<(L0393)
+	ldx     #>(L0393)
+	jsr     _cputsxy
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ CStackHome (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_CStackHome: near
+
+.segment	"CODE"
+
+	lda     _DbgCS+1
+	sta     _CStackAddr+1
+	lda     _DbgCS
+	sta     _CStackAddr
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ InitCStack (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_InitCStack: near
+
+.segment	"CODE"
+
+	jsr     _CStackHome
+	jmp     _UpdateCStack
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ UpdateDump (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_UpdateDump: near
+
+.segment	"CODE"
+
+	ldy     #$29
+	jsr     subysp
+	lda     _DumpAddr
+	ldx     _DumpAddr+1
+	jsr     pushax
+	lda     _DumpFrame+4
+	clc
+	adc     #$01
+	jsr     pusha
+	ldy     #$04
+	jsr     pushwysp
+	lda     _DumpFrame+5
+	clc
+	adc     #$01
+	ldy     #$05
+L0542:	sta     (sp),y
+	cmp     _DumpFrame+7
+	bcs     L03DC
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$06
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$08
+	jsr     pushwysp
+	lda     #$0A
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$08
+	jsr     pusha
+	jsr     _DbgMemDump
+	jsr     _cputsxy
+	ldy     #$03
+	ldx     #$00
+	lda     #$08
+	jsr     addeqysp
+	ldy     #$05
+	clc
+	lda     #$01
+	adc     (sp),y
+	jmp     L0542
+L03DC:	dey
+	jsr     ldaxysp
+	ldy     #$2E
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DumpHome (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DumpHome: near
+
+.segment	"CODE"
+
+	lda     #$00
+	sta     _DumpAddr
+	sta     _DumpAddr+1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ GetArg16 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_GetArg16: near
+
+.segment	"CODE"
+
+	lda     _brk_pc
+	ldx     _brk_pc+1
+	jsr     incax1
+	ldy     #$01
+	jmp     ldaxidx
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ GetStack16 (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_GetStack16: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldx     #$00
+	lda     (sp,x)
+	clc
+	adc     _DbgSP
+	bcc     L0543
+	inx
+L0543:	sta     ptr1
+	stx     ptr1+1
+	ldx     #$01
+	txa
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	jsr     ldaxi
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ SetRTSBreak (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_SetRTSBreak: near
+
+.segment	"CODE"
+
+	lda     #$00
+	jsr     _GetStack16
+	jsr     incax1
+	jmp     _DbgSetTmpBreak
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DbgEntry (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DbgEntry: near
+
+.segment	"DATA"
+
+L0497:
+	.byte	$01
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     L0497
+	beq     L0499
+	lda     #$00
+	sta     L0497
+	jsr     _RedrawStatic
+	jsr     _InitAsm
+	jsr     _InitReg
+	jsr     _InitStack
+	jsr     _InitCStack
+	jsr     _UpdateDump
+L0499:	jsr     _AsmHome
+	jsr     _UpdateReg
+	jsr     _StackHome
+	jsr     _CStackHome
+	lda     #$00
+	tay
+	sta     (sp),y
+	jmp     L0548
+L04AA:	lda     _ActiveFrame
+	ldx     _ActiveFrame+1
+	jsr     aslax1
+	clc
+	adc     #<(_Frames)
+	tay
+	txa
+	adc     #>(_Frames)
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$0C
+	jsr     ldaxidx
+	jsr     callax
+	ldy     #$01
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	jeq     L0547
+	cmp     #$0D
+	jeq     L04E2
+	cmp     #$20
+	jeq     L04D8
+	cmp     #$31
+	beq     L0546
+	cmp     #$32
+	beq     L0546
+	cmp     #$33
+	beq     L0546
+	cmp     #$34
+	beq     L0546
+	cmp     #$35
+	beq     L0546
+	cmp     #$3F
+	beq     L04C2
+	cmp     #$43
+	jeq     L0547
+	cmp     #$48
+	beq     L04CE
+	cmp     #$51
+	jeq     L04FC
+	cmp     #$52
+	jeq     L04F8
+	cmp     #$53
+	jeq     L04F2
+	cmp     #$55
+	beq     L04C7
+	cmp     #$85
+	beq     L04C2
+	cmp     #$86
+	beq     L04C7
+	cmp     #$88
+	beq     L04D8
+	cmp     #$8A
+	beq     L04CE
+	cmp     #$8C
+	beq     L04E2
+	jmp     L04B3
+L0546:	ldy     #$31
+	jsr     decaxy
+	jsr     pushax
+	lda     #$00
+	jsr     _ActivateFrame
+	jmp     L04B3
+L04C2:	jsr     _HelpHandler
+	jmp     L04B3
+L04C7:	jsr     _SetRTSBreak
+	lda     #$01
+	ldy     #$00
+	sta     (sp),y
+	jmp     L0548
+L04CE:	lda     _brk_pc
+	ldx     _brk_pc+1
+	cpx     _AsmAddr+1
+	bne     L0549
+	cmp     _AsmAddr
+	beq     L04B3
+L0549:	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     _DbgSetTmpBreak
+	lda     #$01
+	ldy     #$00
+	sta     (sp),y
+	jmp     L0548
+L04D8:	tya
+	jsr     _SingleStep
+	jsr     _DbgTmpBreaksOk
+	tax
+	beq     L04B3
+	lda     #$01
+	ldy     #$00
+	sta     (sp),y
+	jmp     L0548
+L04E2:	txa
+	jsr     _SingleStep
+	jsr     _DbgTmpBreaksOk
+	tax
+	beq     L04B3
+	lda     #$01
+	ldy     #$00
+	sta     (sp),y
+	jmp     L0548
+L0547:	tya
+	dey
+	sta     (sp),y
+	jmp     L0548
+L04F2:	lda     _brk_pc
+	ldx     _brk_pc+1
+	jsr     _DbgDisAsmLen
+	clc
+	adc     _brk_pc
+	sta     _brk_pc
+	txa
+	adc     _brk_pc+1
+	sta     _brk_pc+1
+	jsr     _InitAsm
+	jmp     L04B3
+L04F8:	lda     _ActiveFrame
+	jsr     _Redraw
+	jmp     L04B3
+L04FC:	jsr     _clrscr
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L04B3:	ldy     #$00
+L0548:	lda     (sp),y
+	jeq     L04AA
+	jmp     incsp2
+
+.endproc
+
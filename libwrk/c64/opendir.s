@@ -0,0 +1,140 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_malloc
+	.import		_memcpy
+	.import		_open
+	.import		__errno
+	.export		_opendir
+	.import		__dirread
+
+; ---------------------------------------------------------------
+; __near__ struct DIR * __near__ __fastcall__ opendir (register __near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_opendir: near
+
+.segment	"RODATA"
+
+L002C:
+	.word	$0000
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$00
+	ldx     #$04
+	jsr     regswap2
+	jsr     decsp2
+	jsr     push0
+	ldy     #$15
+	jsr     subysp
+	lda     #$24
+	ldy     #$04
+	sta     (sp),y
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L005C
+	lda     (regbank+4,x)
+	beq     L005C
+	cmp     #$2E
+	bne     L005D
+	ldy     #$01
+	lda     (regbank+4),y
+	bne     L005D
+L005C:	ldy     #$05
+	sta     (sp),y
+	jmp     L005A
+L005D:	lda     (regbank+4,x)
+	cmp     #$30
+	beq     L0055
+	cmp     #$31
+	bne     L0059
+L0055:	ldy     #$01
+	lda     (regbank+4),y
+	cmp     #$3A
+	bne     L0059
+	iny
+	lda     (regbank+4),y
+	bne     L0059
+	lda     (regbank+4,x)
+	ldy     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	jmp     L005A
+L0059:	lda     #$07
+	jmp     L005B
+L005A:	lda     #$02
+	tay
+	jsr     staxysp
+	lda     #$04
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _open
+	jsr     stax0sp
+	txa
+	bmi     L0047
+	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     #$19
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$02
+	jsr     __dirread
+	tax
+	beq     L0047
+	ldx     #$00
+	lda     #$15
+	jsr     _malloc
+	ldy     #$15
+	jsr     staxysp
+	ldy     #$16
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0040
+	ldy     #$18
+	jsr     pushwysp
+	lda     #$02
+	jsr     leaa0sp
+	jsr     pushax
+	ldx     #$00
+	lda     #$15
+	jsr     _memcpy
+	jmp     L0047
+L0040:	tax
+	lda     #$02
+L005B:	sta     __errno
+	stx     __errno+1
+L0047:	ldy     #$16
+	jsr     ldaxysp
+	pha
+	ldy     #$19
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	iny
+	jmp     addysp
+
+.endproc
+
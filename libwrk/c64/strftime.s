@@ -0,0 +1,811 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_strlen
+	.import		_memcpy
+	.import		_sprintf
+	.import		__tz
+	.export		_strftime
+
+.segment	"RODATA"
+
+L0026:
+	.byte	$25,$2E,$33,$53,$20,$25,$2E,$33,$53,$25,$33,$44,$20,$25,$30,$32
+	.byte	$44,$3A,$25,$30,$32,$44,$3A,$25,$30,$32,$44,$20,$25,$44,$00
+L0008:
+	.byte	$D7,$45,$44,$4E,$45,$53,$44,$41,$59,$00
+L0014:
+	.byte	$D3,$45,$50,$54,$45,$4D,$42,$45,$52,$00
+L0009:
+	.byte	$D4,$48,$55,$52,$53,$44,$41,$59,$00
+L0016:
+	.byte	$CE,$4F,$56,$45,$4D,$42,$45,$52,$00
+L000B:
+	.byte	$D3,$41,$54,$55,$52,$44,$41,$59,$00
+L000D:
+	.byte	$C6,$45,$42,$52,$55,$41,$52,$59,$00
+L0017:
+	.byte	$C4,$45,$43,$45,$4D,$42,$45,$52,$00
+L0015:
+	.byte	$CF,$43,$54,$4F,$42,$45,$52,$00
+L000C:
+	.byte	$CA,$41,$4E,$55,$41,$52,$59,$00
+L0007:
+	.byte	$D4,$55,$45,$53,$44,$41,$59,$00
+L000A:
+	.byte	$C6,$52,$49,$44,$41,$59,$00
+L0005:
+	.byte	$D3,$55,$4E,$44,$41,$59,$00
+L0013:
+	.byte	$C1,$55,$47,$55,$53,$54,$00
+L0006:
+	.byte	$CD,$4F,$4E,$44,$41,$59,$00
+L000E:
+	.byte	$CD,$41,$52,$43,$48,$00
+L000F:
+	.byte	$C1,$50,$52,$49,$4C,$00
+L0011:
+	.byte	$CA,$55,$4E,$45,$00
+L0025:
+	.byte	$25,$2E,$33,$53,$00
+L0024	:=	L0025+0
+L0012:
+	.byte	$CA,$55,$4C,$59,$00
+L0010:
+	.byte	$CD,$41,$59,$00
+L001D:
+	.byte	$50,$4D,$00
+L002A:
+	.byte	$D0,$CD,$00
+L002B:
+	.byte	$C1,$CD,$00
+L001E:
+	.byte	$41,$4D,$00
+
+; ---------------------------------------------------------------
+; unsigned int __near__ __fastcall__ strftime (__near__ unsigned char *, unsigned int, __near__ const unsigned char *, __near__ const struct tm *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_strftime: near
+
+.segment	"RODATA"
+
+L0030:
+	.addr	L0005
+	.addr	L0006
+	.addr	L0007
+	.addr	L0008
+	.addr	L0009
+	.addr	L000A
+	.addr	L000B
+L0039:
+	.addr	L000C
+	.addr	L000D
+	.addr	L000E
+	.addr	L000F
+	.addr	L0010
+	.addr	L0011
+	.addr	L0012
+	.addr	L0013
+	.addr	L0014
+	.addr	L0015
+	.addr	L0016
+	.addr	L0017
+
+.segment	"BSS"
+
+L0046:
+	.res	2,$00
+L0047:
+	.res	2,$00
+L0048:
+	.res	1,$00
+L004A:
+	.res	40,$00
+L004B:
+	.res	2,$00
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #$00
+	sta     L0046
+	sta     L0046+1
+L004E:	lda     L0046
+	ldy     #$04
+	cmp     (sp),y
+	lda     L0046+1
+	iny
+	sbc     (sp),y
+	bcc     L0052
+	ldx     #$00
+	txa
+	jmp     incsp8
+L0052:	ldy     #$03
+	jsr     ldaxysp
+	sta     regsave
+	stx     regsave+1
+	jsr     incax1
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$00
+	lda     (regsave),y
+	sta     L0048
+	cmp     #$00
+	bne     L0123
+	ldy     #$07
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	lda     L0046
+	ldx     L0046+1
+	jmp     incsp8
+L0123:	cmp     #$25
+	jne     L005C
+	lda     #>(L004A)
+	sta     L004B+1
+	lda     #<(L004A)
+	sta     L004B
+	ldy     #$03
+	jsr     ldaxysp
+	sta     regsave
+	stx     regsave+1
+	jsr     incax1
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$00
+	lda     (regsave),y
+	cmp     #$25
+	jeq     L0125
+	cmp     #$41
+	jeq     L00C8
+	cmp     #$42
+	jeq     L00CF
+	cmp     #$43
+	jeq     L00D6
+	cmp     #$44
+	jeq     L00E4
+	cmp     #$4A
+	jeq     L00E9
+	cmp     #$4D
+	jeq     L00EE
+	cmp     #$50
+	jeq     L00F3
+	cmp     #$57
+	jeq     L00FD
+	cmp     #$58
+	jeq     L0102
+	cmp     #$59
+	jeq     L0109
+	cmp     #$C1
+	beq     L006C
+	cmp     #$C2
+	jeq     L0071
+	cmp     #$C4
+	jeq     L0076
+	cmp     #$C6
+	jeq     L007D
+	cmp     #$C8
+	jeq     L0084
+	cmp     #$C9
+	jeq     L0089
+	cmp     #$CD
+	jeq     L008F
+	cmp     #$D0
+	jeq     L0094
+	cmp     #$D3
+	jeq     L009E
+	cmp     #$D5
+	jeq     L00A3
+	cmp     #$D7
+	jeq     L00A9
+	cmp     #$D8
+	jeq     L00B4
+	cmp     #$D9
+	jeq     L00BB
+	cmp     #$DA
+	jeq     L00C0
+	jmp     L0126
+L0125:	sta     L004A
+	sty     L004A+1
+	jmp     L0062
+L006C:	jsr     ldax0sp
+	ldy     #$0D
+	jsr     ldaxidx
+	jsr     aslax1
+	clc
+	adc     #<(L0030)
+	tay
+	txa
+	adc     #>(L0030)
+	tax
+	tya
+	jsr     ldaxi
+	sta     L004B
+	stx     L004B+1
+	jmp     L0062
+L0071:	jsr     ldax0sp
+	ldy     #$09
+	jsr     ldaxidx
+	jsr     aslax1
+	clc
+	adc     #<(L0039)
+	tay
+	txa
+	adc     #>(L0039)
+	tax
+	tya
+	jsr     ldaxi
+	sta     L004B
+	stx     L004B+1
+	jmp     L0062
+L0076:	jsr     ldax0sp
+	ldy     #$09
+	jsr     ldaxidx
+	jsr     incax1
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     pushwidx
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$0B
+	jsr     pushwidx
+	ldx     #$00
+	lda     #$64
+	jsr     tosmoda0
+	jsr     pushax
+	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     __pftobuf
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$42
+	jsr     __pfint
+	lda     #$2F
+	jsr     __pfputc
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$42
+	jsr     __pfint
+	lda     #$2F
+	jsr     __pfputc
+	jsr     ldax0sp
+	ldy     #$42
+	jsr     __pfint
+	jsr     incsp6
+	jmp     L0062
+L007D:	jsr     ldax0sp
+	ldy     #$0B
+	jsr     ldaxidx
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$6C
+	clc
+	adc     ptr1
+	pha
+	lda     #$07
+	adc     ptr1+1
+	tax
+	pla
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$09
+	jsr     ldaxidx
+	jsr     incax1
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     pushwidx
+	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     __pftobuf
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$44
+	jsr     __pfint
+	lda     #$2D
+	jsr     __pfputc
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$42
+	jsr     __pfint
+	lda     #$2D
+	jsr     __pfputc
+	jsr     ldax0sp
+	ldy     #$42
+	jsr     __pfint
+	jsr     incsp6
+	jmp     L0062
+L0084:	jsr     ldax0sp
+	ldy     #$05
+	jsr     pushwidx
+	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     __pftobuf
+	jsr     ldax0sp
+	ldy     #$42
+	jsr     __pfint
+	jsr     incsp2
+	jmp     L0062
+L0089:	jsr     ldax0sp
+	ldy     #$05
+	jsr     ldaxidx
+	ldy     #$0B
+	jsr     incaxy
+	jsr     pushax
+	ldx     #$00
+	lda     #$0C
+	jsr     tosmoda0
+	jsr     incax1
+	jsr     pushax
+	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     __pftobuf
+	jsr     ldax0sp
+	ldy     #$42
+	jsr     __pfint
+	jsr     incsp2
+	jmp     L0062
+L008F:	jsr     ldax0sp
+	ldy     #$03
+	jsr     pushwidx
+	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     __pftobuf
+	jsr     ldax0sp
+	ldy     #$42
+	jsr     __pfint
+	jsr     incsp2
+	jmp     L0062
+L0094:	jsr     ldax0sp
+	ldy     #$05
+	jsr     ldaxidx
+	cmp     #$0C
+	txa
+	sbc     #$00
+	bvs     L0098
+	eor     #$80
+L0098:	bpl     L0099
+	lda     #<(L001D)
+	ldx     #>(L001D)
+	jmp     L009B
+L0099:	lda     #<(L001E)
+	ldx     #>(L001E)
+L009B:	sta     L004B
+	stx     L004B+1
+	jmp     L0062
+L009E:	jsr     ldax0sp
+	jsr     pushw
+	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     __pftobuf
+	jsr     ldax0sp
+	ldy     #$42
+	jsr     __pfint
+	jsr     incsp2
+	jmp     L0062
+L00A3:	jsr     ldax0sp
+	ldy     #$0F
+	jsr     ldaxidx
+	jsr     incax7
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$0D
+	jsr     ldaxidx
+	jsr     tossubax
+	jsr     pushax
+	lda     #$07
+	jsr     tosdiva0
+	jsr     pushax
+	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     __pftobuf
+	jsr     ldax0sp
+	ldy     #$42
+	jsr     __pfint
+	jsr     incsp2
+	jmp     L0062
+L00A9:	jsr     ldax0sp
+	ldy     #$0F
+	jsr     ldaxidx
+	jsr     incax7
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$0C
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	beq     L00AF
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$0D
+	jsr     ldaxidx
+	jsr     decax1
+	jmp     L00B1
+L00AF:	tax
+	lda     #$06
+L00B1:	jsr     tossubax
+	jsr     pushax
+	lda     #$07
+	jsr     tosdiva0
+	jsr     pushax
+	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     __pftobuf
+	jsr     ldax0sp
+	ldy     #$42
+	jsr     __pfint
+	jsr     incsp2
+	jmp     L0062
+L00B4:	jsr     ldax0sp
+	ldy     #$05
+	jsr     pushwidx
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     pushwidx
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushw
+	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     __pftobuf
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$42
+	jsr     __pfint
+	lda     #$3A
+	jsr     __pfputc
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$42
+	jsr     __pfint
+	lda     #$3A
+	jsr     __pfputc
+	jsr     ldax0sp
+	ldy     #$42
+	jsr     __pfint
+	jsr     incsp6
+	jmp     L0062
+L00BB:	jsr     ldax0sp
+	ldy     #$0B
+	jsr     ldaxidx
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$6C
+	clc
+	adc     ptr1
+	pha
+	lda     #$07
+	adc     ptr1+1
+	tax
+	pla
+	jsr     pushax
+	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     __pftobuf
+	jsr     ldax0sp
+	ldy     #$04
+	jsr     __pfint
+	jsr     incsp2
+	jmp     L0062
+L00C0:	jsr     ldax0sp
+	ldy     #$10
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	beq     L00C3
+	lda     #<(__tz+10)
+	ldx     #>(__tz+10)
+	jmp     L00C5
+L00C3:	lda     #<(__tz+5)
+	ldx     #>(__tz+5)
+L00C5:	sta     L004B
+	stx     L004B+1
+	jmp     L0062
+L00C8:	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     pushax
+	lda     #<(L0024)
+	ldx     #>(L0024)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$0D
+	jsr     ldaxidx
+	jsr     aslax1
+	clc
+	adc     #<(L0030)
+	tay
+	txa
+	adc     #>(L0030)
+	tax
+	tya
+	jsr     pushw
+	ldy     #$06
+	jsr     _sprintf
+	jmp     L0062
+L00CF:	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     pushax
+	lda     #<(L0025)
+	ldx     #>(L0025)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$09
+	jsr     ldaxidx
+	jsr     aslax1
+	clc
+	adc     #<(L0039)
+	tay
+	txa
+	adc     #>(L0039)
+	tax
+	tya
+	jsr     pushw
+	ldy     #$06
+	jsr     _sprintf
+	jmp     L0062
+L00D6:	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     pushax
+	lda     #<(L0026)
+	ldx     #>(L0026)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$0D
+	jsr     ldaxidx
+	jsr     aslax1
+	clc
+	adc     #<(L0030)
+	tay
+	txa
+	adc     #>(L0030)
+	tax
+	tya
+	jsr     pushw
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$09
+	jsr     ldaxidx
+	jsr     aslax1
+	clc
+	adc     #<(L0039)
+	tay
+	txa
+	adc     #>(L0039)
+	tax
+	tya
+	jsr     pushw
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     pushwidx
+	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     pushwidx
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     pushwidx
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushw
+	ldy     #$11
+	jsr     ldaxysp
+	ldy     #$0B
+	jsr     ldaxidx
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$6C
+	clc
+	adc     ptr1
+	pha
+	lda     #$07
+	adc     ptr1+1
+	tax
+	pla
+	jsr     pushax
+	ldy     #$12
+	jsr     _sprintf
+	jmp     L0062
+L00E4:	jsr     ldax0sp
+	ldy     #$07
+	jsr     pushwidx
+	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     __pftobuf
+	jsr     ldax0sp
+	ldy     #$42
+	jsr     __pfint
+	jsr     incsp2
+	jmp     L0062
+L00E9:	jsr     ldax0sp
+	ldy     #$0F
+	jsr     ldaxidx
+	jsr     incax1
+	jsr     pushax
+	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     __pftobuf
+	jsr     ldax0sp
+	ldy     #$43
+	jsr     __pfint
+	jsr     incsp2
+	jmp     L0062
+L00EE:	jsr     ldax0sp
+	ldy     #$09
+	jsr     ldaxidx
+	jsr     incax1
+	jsr     pushax
+	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     __pftobuf
+	jsr     ldax0sp
+	ldy     #$42
+	jsr     __pfint
+	jsr     incsp2
+	jmp     L0062
+L00F3:	jsr     ldax0sp
+	ldy     #$05
+	jsr     ldaxidx
+	cmp     #$0C
+	txa
+	sbc     #$00
+	bvs     L00F7
+	eor     #$80
+L00F7:	bpl     L00F8
+	lda     #<(L002A)
+	ldx     #>(L002A)
+	jmp     L00FA
+L00F8:	lda     #<(L002B)
+	ldx     #>(L002B)
+L00FA:	sta     L004B
+	stx     L004B+1
+	jmp     L0062
+L00FD:	jsr     ldax0sp
+	ldy     #$0D
+	jsr     pushwidx
+	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     __pftobuf
+	jsr     ldax0sp
+	ldy     #$00
+	jsr     __pfint
+	jsr     incsp2
+	jmp     L0062
+L0102:	jsr     ldax0sp
+	ldy     #$0B
+	jsr     ldaxidx
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$6C
+	clc
+	adc     ptr1
+	pha
+	lda     #$07
+	adc     ptr1+1
+	tax
+	pla
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$09
+	jsr     ldaxidx
+	jsr     incax1
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     pushwidx
+	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     __pftobuf
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$44
+	jsr     __pfint
+	lda     #$2D
+	jsr     __pfputc
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$42
+	jsr     __pfint
+	lda     #$2D
+	jsr     __pfputc
+	jsr     ldax0sp
+	ldy     #$42
+	jsr     __pfint
+	jsr     incsp6
+	jmp     L0062
+L0109:	jsr     ldax0sp
+	ldy     #$0B
+	jsr     pushwidx
+	ldx     #$00
+	lda     #$64
+	jsr     tosmoda0
+	jsr     pushax
+	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     __pftobuf
+	jsr     ldax0sp
+	ldy     #$42
+	jsr     __pfint
+	jsr     incsp2
+	jmp     L0062
+L0126:	sty     L004A
+L0062:	lda     L004B
+	ldx     L004B+1
+	jsr     _strlen
+	sta     L0047
+	stx     L0047+1
+	clc
+	adc     L0046
+	sta     L0046
+	txa
+	adc     L0046+1
+	sta     L0046+1
+	lda     L0046
+	ldy     #$04
+	cmp     (sp),y
+	lda     L0046+1
+	iny
+	sbc     (sp),y
+	jcs     L004E
+	ldy     #$09
+	jsr     pushwysp
+	lda     L004B
+	ldx     L004B+1
+	jsr     pushax
+	lda     L0047
+	ldx     L0047+1
+	jsr     _memcpy
+	lda     L0047
+	ldx     L0047+1
+	ldy     #$06
+	jsr     addeqysp
+	jmp     L004E
+L005C:	ldy     #$07
+	jsr     ldaxysp
+	sta     regsave
+	stx     regsave+1
+	jsr     incax1
+	ldy     #$06
+	jsr     staxysp
+	lda     L0048
+	ldy     #$00
+	sta     (regsave),y
+	inc     L0046
+	jne     L004E
+	inc     L0046+1
+	jmp     L004E
+
+.endproc
+
@@ -0,0 +1,24 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.export		__tz
+
+.segment	"DATA"
+
+__tz:
+	.byte	$00
+	.dword	$00000000
+	.byte	$D5,$D4,$C3,$00
+	.res	1,$00
+	.byte	$D5,$D4,$C3,$00
+	.res	1,$00
+
@@ -0,0 +1,48 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.export		_abort
+	.import		_exit
+	.import		_ExitTurbo
+	.import		_DlgBoxOk
+
+.segment	"RODATA"
+
+L0009:
+	.byte	$18,$41,$42,$4E,$4F,$52,$4D,$41,$4C,$20,$50,$52,$4F,$47,$52,$41
+	.byte	$4D,$00
+L000A:
+	.byte	$54,$45,$52,$4D,$49,$4E,$41,$54,$49,$4F,$4E,$2E,$1B,$00
+
+; ---------------------------------------------------------------
+; void __near__ abort (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_abort: near
+
+.segment	"CODE"
+
+	jsr     _ExitTurbo
+	lda     #<(L0009)
+	ldx     #>(L0009)
+	jsr     pushax
+	lda     #<(L000A)
+	ldx     #>(L000A)
+	jsr     _DlgBoxOk
+	ldx     #$00
+	lda     #$03
+	jmp     _exit
+
+.endproc
+
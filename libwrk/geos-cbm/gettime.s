@@ -0,0 +1,92 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.export		_clock
+	.import		_mktime
+	.export		_clock_gettime
+
+; ---------------------------------------------------------------
+; unsigned long __near__ clock (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_clock: near
+
+.segment	"CODE"
+
+	ldy     #$12
+	jsr     subysp
+	lda     $851B
+	ldx     #$00
+	jsr     stax0sp
+	lda     $851A
+	ldy     #$02
+	jsr     staxysp
+	lda     $8519
+	ldy     #$04
+	jsr     staxysp
+	lda     $8518
+	ldy     #$06
+	jsr     staxysp
+	lda     $8517
+	ldy     #$08
+	jsr     staxysp
+	lda     $8516
+	ldy     #$0A
+	jsr     staxysp
+	lda     $8516
+	cmp     #$57
+	bcs     L001D
+	ldy     #$0A
+	lda     #$64
+	jsr     addeqysp
+L001D:	ldx     #$FF
+	txa
+	ldy     #$10
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	jsr     _mktime
+	ldy     #$12
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ clock_gettime (unsigned char, __near__ struct timespec *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_clock_gettime: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     pushw0sp
+	jsr     _clock
+	ldy     #$00
+	jsr     steaxspidx
+	jsr     pushw0sp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	txa
+	ldy     #$04
+	jsr     steaxspidx
+	ldx     #$00
+	txa
+	jmp     incsp3
+
+.endproc
+
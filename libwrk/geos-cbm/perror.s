@@ -0,0 +1,64 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.export		_perror
+	.import		_strerror
+	.import		__errno
+	.import		_ExitTurbo
+	.import		_DlgBoxOk
+
+.segment	"RODATA"
+
+L0009:
+	.byte	$00
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ perror (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_perror: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     __errno
+	ldx     __errno+1
+	jsr     _strerror
+	jsr     pushax
+	jsr     _ExitTurbo
+	ldy     #$03
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L000D
+	iny
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	beq     L000D
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     L001C
+L000D:	lda     #<(L0009)
+	ldx     #>(L0009)
+L001C:	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _DlgBoxOk
+	jmp     incsp4
+
+.endproc
+
@@ -0,0 +1,58 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.export		_asctime
+	.import		_strftime
+
+.segment	"RODATA"
+
+L000A:
+	.byte	$25,$63,$0A,$00
+
+; ---------------------------------------------------------------
+; __near__ unsigned char * __near__ __fastcall__ asctime (__near__ const struct tm *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_asctime: near
+
+.segment	"BSS"
+
+L0005:
+	.res	26,$00
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(L0005)
+	ldx     #>(L0005)
+	jsr     pushax
+	lda     #$1A
+	jsr     pusha0
+	lda     #<(L000A)
+	ldx     #>(L000A)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _strftime
+	stx     tmp1
+	ora     tmp1
+	beq     L000D
+	lda     #<(L0005)
+	ldx     #>(L0005)
+	jmp     incsp2
+L000D:	tax
+	jmp     incsp2
+
+.endproc
+
@@ -0,0 +1,2850 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_exit
+	.import		_strlen
+	.import		_clrscr
+	.import		_kbhit
+	.import		_gotoxy
+	.import		_wherex
+	.import		_cputc
+	.import		_cputcxy
+	.import		_cputsxy
+	.import		_cgetc
+	.import		_cursor
+	.import		_revers
+	.import		_textcolor
+	.import		_bgcolor
+	.import		_bordercolor
+	.import		_chline
+	.import		_chlinexy
+	.import		_cvlinexy
+	.import		_cclearxy
+	.import		_cputhex8
+	.import		_cputhex16
+	.import		_isalnum
+	.import		_isdigit
+	.import		_isxdigit
+	.import		_toupper
+	.import		_brk_a
+	.import		_brk_x
+	.import		_brk_y
+	.import		_brk_sr
+	.import		_brk_pc
+	.import		_DbgDisAsm
+	.import		_DbgDisAsmLen
+	.import		_DbgIsRAM
+	.import		_DbgMemDump
+	.import		_DbgSP
+	.import		_DbgCS
+	.import		_DbgHI
+	.export		_DbgBreakCount
+	.export		_DbgBreaks
+	.import		_DbgGetBreakSlot
+	.import		_DbgIsBreak
+	.export		_DbgEntry
+
+.segment	"DATA"
+
+_ActiveFrame:
+	.word	$FFFF
+_ActivePrompt:
+	.word	$0000
+_DbgBreakCount:
+	.byte	$00
+
+.segment	"RODATA"
+
+_RegText:
+	.byte	$01
+	.byte	$00
+	.addr	L0003
+	.byte	$01
+	.byte	$01
+	.addr	L0007
+	.byte	$01
+	.byte	$02
+	.addr	L000B
+	.byte	$01
+	.byte	$03
+	.addr	L000F
+	.byte	$01
+	.byte	$04
+	.addr	L0013
+	.byte	$01
+	.byte	$05
+	.addr	L0017
+	.byte	$01
+	.byte	$06
+	.addr	L001B
+	.byte	$01
+	.byte	$07
+	.addr	L001F
+_HelpText:
+	.byte	$01
+	.byte	$00
+	.addr	L0023
+	.byte	$01
+	.byte	$01
+	.addr	L0027
+	.byte	$01
+	.byte	$02
+	.addr	L002B
+	.byte	$01
+	.byte	$03
+	.addr	L002F
+	.byte	$01
+	.byte	$04
+	.addr	L0033
+	.byte	$01
+	.byte	$05
+	.addr	L0037
+	.byte	$01
+	.byte	$06
+	.addr	L003B
+	.byte	$01
+	.byte	$07
+	.addr	L003F
+	.byte	$01
+	.byte	$08
+	.addr	L0043
+	.byte	$01
+	.byte	$09
+	.addr	L0047
+	.byte	$01
+	.byte	$0A
+	.addr	L004B
+	.byte	$01
+	.byte	$0B
+	.addr	L004F
+	.byte	$01
+	.byte	$0C
+	.addr	L0053
+	.byte	$01
+	.byte	$0D
+	.addr	L0057
+	.byte	$01
+	.byte	$0E
+	.addr	L005B
+	.byte	$01
+	.byte	$0F
+	.addr	L005F
+	.byte	$01
+	.byte	$10
+	.addr	L0063
+	.byte	$01
+	.byte	$11
+	.addr	L0067
+_AsmFrame:
+	.byte	$2B
+	.byte	$2B
+	.byte	$2B
+	.byte	$2B
+	.byte	$00
+	.byte	$00
+	.byte	$1E
+	.byte	$0F
+	.byte	$1D
+	.byte	$0E
+	.byte	$01
+	.addr	_AsmHandler
+	.byte	$00
+	.word	$0000
+_RegFrame:
+	.byte	$2B
+	.byte	$2B
+	.byte	$2B
+	.byte	$2B
+	.byte	$1E
+	.byte	$00
+	.byte	$27
+	.byte	$09
+	.byte	$08
+	.byte	$08
+	.byte	$01
+	.addr	_RegHandler
+	.byte	$08
+	.addr	_RegText
+_StackFrame:
+	.byte	$2B
+	.byte	$2B
+	.byte	$2B
+	.byte	$2B
+	.byte	$1E
+	.byte	$09
+	.byte	$27
+	.byte	$0F
+	.byte	$08
+	.byte	$05
+	.byte	$01
+	.addr	_StackHandler
+	.byte	$00
+	.word	$0000
+_CStackFrame:
+	.byte	$2B
+	.byte	$2B
+	.byte	$2B
+	.byte	$2B
+	.byte	$1E
+	.byte	$0F
+	.byte	$27
+	.byte	$18
+	.byte	$08
+	.byte	$08
+	.byte	$01
+	.addr	_CStackHandler
+	.byte	$00
+	.word	$0000
+_DumpFrame:
+	.byte	$2B
+	.byte	$2B
+	.byte	$2B
+	.byte	$2B
+	.byte	$00
+	.byte	$0F
+	.byte	$1E
+	.byte	$18
+	.byte	$1D
+	.byte	$08
+	.byte	$01
+	.addr	_DumpHandler
+	.byte	$00
+	.word	$0000
+_HelpFrame:
+	.byte	$2B
+	.byte	$2B
+	.byte	$2B
+	.byte	$2B
+	.byte	$00
+	.byte	$00
+	.byte	$27
+	.byte	$18
+	.byte	$26
+	.byte	$17
+	.byte	$00
+	.addr	_HelpHandler
+	.byte	$12
+	.addr	_HelpText
+_Frames:
+	.addr	_AsmFrame
+	.addr	_RegFrame
+	.addr	_StackFrame
+	.addr	_CStackFrame
+	.addr	_DumpFrame
+	.addr	_HelpFrame
+L002B:
+	.byte	$46,$33,$2C,$20,$75,$20,$20,$20,$20,$20,$52,$75,$6E,$20,$75,$6E
+	.byte	$74,$69,$6C,$20,$73,$75,$62,$72,$6F,$75,$74,$69,$6E,$65,$20,$72
+	.byte	$65,$74,$75,$72,$6E,$73,$00
+L0208:
+	.byte	$43,$61,$6E,$6E,$6F,$74,$20,$73,$65,$74,$20,$62,$72,$65,$61,$6B
+	.byte	$70,$6F,$69,$6E,$74,$20,$2D,$20,$70,$72,$65,$73,$73,$20,$61,$20
+	.byte	$6B,$65,$79,$00
+L021C:
+	.byte	$54,$6F,$6F,$20,$6D,$61,$6E,$79,$20,$62,$72,$65,$61,$6B,$70,$6F
+	.byte	$69,$6E,$74,$73,$20,$2D,$20,$70,$72,$65,$73,$73,$20,$61,$20,$6B
+	.byte	$65,$79,$00
+L0067:
+	.byte	$73,$20,$20,$20,$20,$20,$20,$20,$20,$20,$53,$6B,$69,$70,$20,$6E
+	.byte	$65,$78,$74,$20,$69,$6E,$73,$74,$72,$75,$63,$74,$69,$6F,$6E,$00
+L003B:
+	.byte	$31,$2D,$35,$20,$20,$20,$20,$20,$20,$20,$53,$65,$6C,$65,$63,$74
+	.byte	$20,$61,$63,$74,$69,$76,$65,$20,$77,$69,$6E,$64,$6F,$77,$00
+L005B:
+	.byte	$70,$20,$20,$20,$20,$20,$20,$20,$20,$20,$55,$73,$65,$20,$61,$73
+	.byte	$20,$6E,$65,$77,$20,$50,$43,$20,$76,$61,$6C,$75,$65,$00
+L0053:
+	.byte	$66,$20,$20,$20,$20,$20,$20,$20,$20,$20,$46,$6F,$6C,$6C,$6F,$77
+	.byte	$20,$69,$6E,$73,$74,$72,$75,$63,$74,$69,$6F,$6E,$00
+L0027:
+	.byte	$46,$32,$2C,$20,$74,$20,$20,$20,$20,$20,$54,$6F,$67,$67,$6C,$65
+	.byte	$20,$62,$72,$65,$61,$6B,$70,$6F,$69,$6E,$74,$00
+L0203:
+	.byte	$49,$6E,$76,$61,$6C,$69,$64,$20,$69,$6E,$70,$75,$74,$20,$2D,$20
+	.byte	$70,$72,$65,$73,$73,$20,$61,$20,$6B,$65,$79,$00
+L016E:
+	.byte	$50,$72,$65,$73,$73,$20,$61,$6E,$79,$20,$6B,$65,$79,$20,$74,$6F
+	.byte	$20,$63,$6F,$6E,$74,$69,$6E,$75,$65,$00
+L002F:
+	.byte	$46,$34,$2C,$20,$68,$20,$20,$20,$20,$20,$52,$75,$6E,$20,$74,$6F
+	.byte	$20,$63,$75,$72,$73,$6F,$72,$00
+L0063:
+	.byte	$72,$20,$20,$20,$20,$20,$20,$20,$20,$20,$52,$65,$64,$72,$61,$77
+	.byte	$20,$73,$63,$72,$65,$65,$6E,$00
+L004B:
+	.byte	$61,$2F,$7A,$20,$20,$20,$20,$20,$20,$20,$4D,$6F,$76,$65,$20,$75
+	.byte	$70,$2F,$64,$6F,$77,$6E,$00
+L0047:
+	.byte	$43,$75,$72,$73,$6F,$72,$20,$20,$20,$20,$4D,$6F,$76,$65,$20,$75
+	.byte	$70,$2F,$64,$6F,$77,$6E,$00
+L0057:
+	.byte	$6F,$20,$20,$20,$20,$20,$20,$20,$20,$20,$47,$6F,$74,$6F,$20,$6F
+	.byte	$72,$69,$67,$69,$6E,$00
+L0033:
+	.byte	$46,$37,$2C,$20,$73,$70,$61,$63,$65,$20,$53,$74,$65,$70,$20,$69
+	.byte	$6E,$74,$6F,$00
+L0037:
+	.byte	$46,$38,$2C,$20,$65,$6E,$74,$65,$72,$20,$53,$74,$65,$70,$20,$6F
+	.byte	$76,$65,$72,$00
+L003F:
+	.byte	$2B,$20,$20,$20,$20,$20,$20,$20,$20,$20,$50,$61,$67,$65,$20,$64
+	.byte	$6F,$77,$6E,$00
+L004F:
+	.byte	$63,$20,$20,$20,$20,$20,$20,$20,$20,$20,$43,$6F,$6E,$74,$69,$6E
+	.byte	$75,$65,$00
+L0043:
+	.byte	$2D,$20,$20,$20,$20,$20,$20,$20,$20,$20,$50,$61,$67,$65,$20,$75
+	.byte	$70,$00
+L016A:
+	.byte	$50,$72,$65,$73,$73,$20,$46,$31,$20,$66,$6F,$72,$20,$68,$65,$6C
+	.byte	$70,$00
+L005F:
+	.byte	$71,$20,$20,$20,$20,$20,$20,$20,$20,$20,$51,$75,$69,$74,$00
+L0023:
+	.byte	$46,$31,$2C,$20,$3F,$20,$20,$20,$20,$20,$48,$65,$6C,$70,$00
+L01FD:
+	.byte	$47,$6F,$74,$6F,$3A,$20,$00
+L0007:
+	.byte	$53,$52,$00
+L001B:
+	.byte	$43,$53,$00
+L001F:
+	.byte	$48,$49,$00
+L0017:
+	.byte	$53,$50,$00
+L0394:
+	.byte	$2D,$3E,$00
+L0003:
+	.byte	$50,$43,$00
+L000F:
+	.byte	$58,$00
+L000B:
+	.byte	$41,$00
+L0013:
+	.byte	$59,$00
+
+.segment	"BSS"
+
+_AsmAddr:
+	.res	2,$00
+_DumpAddr:
+	.res	2,$00
+_CStackAddr:
+	.res	2,$00
+_StackAddr:
+	.res	1,$00
+_PromptColor:
+	.res	1,$00
+_PromptLength:
+	.res	1,$00
+_DbgBreaks:
+	.res	48,$00
+
+; ---------------------------------------------------------------
+; unsigned char __near__ AsmHandler (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AsmHandler: near
+
+.segment	"CODE"
+
+	jsr     decsp3
+L02DE:	jsr     _UpdateAsm
+	jsr     stax0sp
+	jsr     _GetKeyUpdate
+	ldy     #$02
+	sta     (sp),y
+	cmp     #$2B
+	beq     L02E9
+	cmp     #$2D
+	beq     L02ED
+	cmp     #$61
+	beq     L0305
+	cmp     #$66
+	beq     L02F7
+	cmp     #$67
+	beq     L02FA
+	cmp     #$6F
+	beq     L02FE
+	cmp     #$70
+	beq     L0301
+	cmp     #$74
+	beq     L02F3
+	cmp     #$7A
+	beq     L030B
+	jmp     L04DB
+L02E9:	jsr     ldax0sp
+	sta     _AsmAddr
+	stx     _AsmAddr+1
+	jmp     L02DE
+L02ED:	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     pushax
+	lda     _AsmFrame+9
+	jsr     _AsmBack
+	sta     _AsmAddr
+	stx     _AsmAddr+1
+	jmp     L02DE
+L02F3:	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     _DbgToggleUserBreak
+	jmp     L02DE
+L02F7:	jsr     _AsmFollow
+	jmp     L02DE
+L02FA:	lda     #<(_AsmAddr)
+	ldx     #>(_AsmAddr)
+	jsr     _InputGoto
+	jmp     L02DE
+L02FE:	jsr     _AsmHome
+	jmp     L02DE
+L0301:	lda     _AsmAddr+1
+	sta     _brk_pc+1
+	lda     _AsmAddr
+	sta     _brk_pc
+	jmp     L02DE
+L0305:	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     pushax
+	lda     #$01
+	jsr     _AsmBack
+	sta     _AsmAddr
+	stx     _AsmAddr+1
+	jmp     L02DE
+L030B:	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     _DbgDisAsmLen
+	clc
+	adc     _AsmAddr
+	sta     _AsmAddr
+	txa
+	adc     _AsmAddr+1
+	sta     _AsmAddr+1
+	jmp     L02DE
+L04DB:	ldx     #$00
+	lda     (sp),y
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ RegHandler (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_RegHandler: near
+
+.segment	"CODE"
+
+	jmp     _GetKeyUpdate
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ StackHandler (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_StackHandler: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     _StackFrame+9
+	jsr     pusha
+L0363:	jsr     _GetKeyUpdate
+	ldy     #$01
+	sta     (sp),y
+	cmp     #$2B
+	beq     L036C
+	cmp     #$2D
+	beq     L0370
+	cmp     #$61
+	beq     L0377
+	cmp     #$6F
+	beq     L0374
+	cmp     #$7A
+	beq     L037A
+	jmp     L04DC
+L036C:	dey
+	lda     (sp),y
+	clc
+	adc     _StackAddr
+	sta     _StackAddr
+	jmp     L036A
+L0370:	dey
+	lda     (sp),y
+	eor     #$FF
+	sec
+	adc     _StackAddr
+	sta     _StackAddr
+	jmp     L036A
+L0374:	jsr     _StackHome
+	jmp     L036A
+L0377:	dec     _StackAddr
+	jmp     L036A
+L037A:	inc     _StackAddr
+	jmp     L036A
+L04DC:	ldx     #$00
+	lda     (sp),y
+	jmp     incsp2
+L036A:	jsr     _UpdateStack
+	jmp     L0363
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ CStackHandler (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_CStackHandler: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     _CStackFrame+9
+	asl     a
+	jsr     pusha
+L039F:	jsr     _GetKeyUpdate
+	ldy     #$01
+	sta     (sp),y
+	cmp     #$2B
+	beq     L03A8
+	cmp     #$2D
+	beq     L03AC
+	cmp     #$61
+	beq     L03B3
+	cmp     #$6F
+	beq     L03B0
+	cmp     #$7A
+	beq     L03B8
+	jmp     L04DD
+L03A8:	dey
+	lda     (sp),y
+	clc
+	adc     _CStackAddr
+	sta     _CStackAddr
+	tya
+	adc     _CStackAddr+1
+	sta     _CStackAddr+1
+	jmp     L03A6
+L03AC:	dey
+	lda     (sp),y
+	eor     #$FF
+	sec
+	adc     _CStackAddr
+	sta     _CStackAddr
+	lda     #$FF
+	adc     _CStackAddr+1
+	sta     _CStackAddr+1
+	jmp     L03A6
+L03B0:	jsr     _CStackHome
+	jmp     L03A6
+L03B3:	lda     _CStackAddr
+	sec
+	sbc     #$02
+	sta     _CStackAddr
+	bcs     L03A6
+	dec     _CStackAddr+1
+	jmp     L03A6
+L03B8:	lda     #$02
+	clc
+	adc     _CStackAddr
+	sta     _CStackAddr
+	bcc     L03A6
+	inc     _CStackAddr+1
+	jmp     L03A6
+L04DD:	ldx     #$00
+	lda     (sp),y
+	jmp     incsp2
+L03A6:	jsr     _UpdateCStack
+	jmp     L039F
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ DumpHandler (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DumpHandler: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	ldx     #$00
+	lda     _DumpFrame+9
+	jsr     shlax3
+	jsr     pushax
+L03DB:	jsr     _GetKeyUpdate
+	ldy     #$02
+	sta     (sp),y
+	cmp     #$2B
+	beq     L03E4
+	cmp     #$2D
+	beq     L03E8
+	cmp     #$61
+	beq     L03F3
+	cmp     #$67
+	beq     L03EC
+	cmp     #$6F
+	beq     L03F0
+	cmp     #$7A
+	beq     L03F8
+	jmp     L04DE
+L03E4:	jsr     ldax0sp
+	clc
+	adc     _DumpAddr
+	sta     _DumpAddr
+	txa
+	adc     _DumpAddr+1
+	sta     _DumpAddr+1
+	jmp     L03E2
+L03E8:	jsr     ldax0sp
+	eor     #$FF
+	sec
+	adc     _DumpAddr
+	sta     _DumpAddr
+	txa
+	eor     #$FF
+	adc     _DumpAddr+1
+	sta     _DumpAddr+1
+	jmp     L03E2
+L03EC:	lda     #<(_DumpAddr)
+	ldx     #>(_DumpAddr)
+	jsr     _InputGoto
+	jmp     L03E2
+L03F0:	jsr     _DumpHome
+	jmp     L03E2
+L03F3:	lda     _DumpAddr
+	sec
+	sbc     #$08
+	sta     _DumpAddr
+	bcs     L03E2
+	dec     _DumpAddr+1
+	jmp     L03E2
+L03F8:	lda     #$08
+	clc
+	adc     _DumpAddr
+	sta     _DumpAddr
+	bcc     L03E2
+	inc     _DumpAddr+1
+	jmp     L03E2
+L04DE:	ldx     #$00
+	lda     (sp),y
+	jmp     incsp3
+L03E2:	jsr     _UpdateDump
+	jmp     L03DB
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ HelpHandler (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_HelpHandler: near
+
+.segment	"CODE"
+
+	lda     _ActiveFrame
+	ldx     _ActiveFrame+1
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #$01
+	jsr     _ActivateFrame
+	jsr     _AnyKeyPrompt
+	jsr     _cgetc
+	ldy     #$00
+	lda     (sp),y
+	jsr     _Redraw
+	ldx     #$00
+	txa
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DisplayPrompt (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DisplayPrompt: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp1
+	lda     #$01
+	jsr     _textcolor
+	ldy     #$00
+	sta     (sp),y
+	lda     _ActivePrompt
+	ora     _ActivePrompt+1
+	beq     L014F
+	lda     _PromptColor
+	jsr     _textcolor
+	lda     #$28
+	sec
+	sbc     _PromptLength
+	lsr     a
+	jsr     pusha
+	lda     #$18
+	jsr     pusha
+	lda     _PromptLength
+	jsr     _chlinexy
+L014F:	ldy     #$02
+	jsr     ldaxysp
+	sta     _ActivePrompt
+	stx     _ActivePrompt+1
+	ldy     #$00
+	lda     (sp),y
+	sta     _PromptColor
+	lda     _ActivePrompt
+	ldx     _ActivePrompt+1
+	jsr     _strlen
+	sta     _PromptLength
+	lda     #$01
+	jsr     _textcolor
+	lda     #$28
+	sec
+	sbc     _PromptLength
+	lsr     a
+	jsr     pusha
+	lda     #$18
+	jsr     pusha
+	lda     _ActivePrompt
+	ldx     _ActivePrompt+1
+	jsr     _cputsxy
+	lda     _PromptColor
+	jsr     _textcolor
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ SingleStep (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_SingleStep: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jsr     decsp1
+	lda     _brk_pc+1
+	sta     ptr1+1
+	lda     _brk_pc
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	cmp     #$10
+	beq     L042E
+	cmp     #$20
+	beq     L0441
+	cmp     #$30
+	beq     L042E
+	cmp     #$40
+	beq     L043C
+	cmp     #$4C
+	beq     L0418
+	cmp     #$50
+	beq     L042E
+	cmp     #$60
+	beq     L0439
+	cmp     #$6C
+	beq     L041C
+	cmp     #$70
+	beq     L042E
+	cmp     #$90
+	beq     L042E
+	cmp     #$B0
+	beq     L042E
+	cmp     #$D0
+	beq     L042E
+	cmp     #$F0
+	beq     L042E
+	jmp     L0416
+L0418:	jsr     _GetArg16
+	jmp     L04DF
+L041C:	jsr     _GetArg16
+	jsr     ldaxi
+	jmp     L04DF
+L042E:	lda     _brk_pc
+	ldx     _brk_pc+1
+	iny
+	jsr     ldaidx
+	dey
+	sta     (sp),y
+	lda     (sp),y
+	beq     L0416
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0437
+	dex
+L0437:	clc
+	adc     _brk_pc
+	pha
+	txa
+	adc     _brk_pc+1
+	tax
+	pla
+	jsr     incax2
+	jsr     _DbgSetTmpBreak
+	jmp     L0416
+L0439:	jsr     _SetRTSBreak
+	jmp     incsp2
+L043C:	lda     #$01
+	jsr     _GetStack16
+	jmp     L04DF
+L0441:	iny
+	lda     (sp),y
+	beq     L0416
+	jsr     _GetArg16
+	jmp     L04DF
+L0416:	lda     _brk_pc
+	ldx     _brk_pc+1
+	jsr     pushax
+	lda     _brk_pc
+	ldx     _brk_pc+1
+	jsr     _DbgDisAsmLen
+	jsr     tosaddax
+L04DF:	jsr     _DbgSetTmpBreak
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ RedrawStatic (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_RedrawStatic: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	lda     #$FF
+	sta     _ActiveFrame
+	sta     _ActiveFrame+1
+	lda     #$00
+	jsr     _bordercolor
+	lda     #$00
+	jsr     _bgcolor
+	jsr     _clrscr
+	lda     #$00
+	jsr     _cursor
+	lda     #$01
+	jsr     _textcolor
+	jsr     _DrawFrames
+	jsr     _HelpPrompt
+	ldy     #$00
+	lda     (sp),y
+	jsr     pusha0
+	lda     #$00
+	jsr     _ActivateFrame
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ Redraw (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Redraw: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldy     #$00
+	lda     (sp),y
+	jsr     _RedrawStatic
+	jsr     _UpdateAsm
+	jsr     _UpdateReg
+	jsr     _UpdateStack
+	jsr     _UpdateCStack
+	jsr     _UpdateDump
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ GetKeyUpdate (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_GetKeyUpdate: near
+
+.segment	"BSS"
+
+L0463:
+	.res	1,$00
+
+.segment	"CODE"
+
+	jmp     L0466
+L04E0:	lda     L0463
+	beq     L046C
+	cmp     #$01
+	beq     L046F
+	cmp     #$02
+	beq     L0472
+	cmp     #$03
+	beq     L0475
+	jmp     L04E1
+L046C:	jsr     _UpdateAsm
+	jmp     L04E1
+L046F:	jsr     _UpdateStack
+	jmp     L04E1
+L0472:	jsr     _UpdateCStack
+	jmp     L04E1
+L0475:	jsr     _UpdateDump
+L04E1:	lda     L0463
+	clc
+	adc     #$01
+	and     #$03
+	sta     L0463
+L0466:	jsr     _kbhit
+	tax
+	beq     L04E0
+	jmp     _cgetc
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DrawFrame (register __near__ const struct $anon-struct-0008 *, unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DrawFrame: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldy     #$01
+	ldx     #$04
+	jsr     regswap2
+	ldy     #$0B
+	jsr     subysp
+	ldy     #$0B
+	lda     (sp),y
+	beq     L00CE
+	lda     #$01
+	jsr     _textcolor
+	ldy     #$00
+	sta     (sp),y
+	lda     #$2B
+	ldy     #$07
+	sta     (sp),y
+	dey
+	sta     (sp),y
+	dey
+	sta     (sp),y
+	jmp     L04E3
+L00CE:	lda     #$01
+	jsr     _textcolor
+	ldy     #$00
+	sta     (sp),y
+	lda     (regbank+4),y
+	ldy     #$07
+	sta     (sp),y
+	ldy     #$01
+	lda     (regbank+4),y
+	ldy     #$06
+	sta     (sp),y
+	ldy     #$02
+	lda     (regbank+4),y
+	ldy     #$05
+	sta     (sp),y
+	ldy     #$03
+	lda     (regbank+4),y
+L04E3:	ldy     #$04
+	sta     (sp),y
+	lda     (regbank+4),y
+	dey
+	sta     (sp),y
+	ldy     #$05
+	lda     (regbank+4),y
+	ldy     #$02
+	sta     (sp),y
+	ldy     #$08
+	lda     (regbank+4),y
+	ldy     #$01
+	sta     (sp),y
+	ldy     #$03
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$03
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$09
+	lda     (sp),y
+	jsr     _cputcxy
+	ldy     #$01
+	lda     (sp),y
+	jsr     _chline
+	ldy     #$06
+	lda     (sp),y
+	jsr     _cputc
+	ldy     #$03
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$03
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	jsr     pusha
+	ldy     #$09
+	lda     (regbank+4),y
+	jsr     _cvlinexy
+	ldy     #$05
+	lda     (sp),y
+	jsr     _cputc
+	ldy     #$01
+	lda     (sp),y
+	jsr     _chline
+	ldy     #$04
+	lda     (sp),y
+	jsr     _cputc
+	ldy     #$06
+	lda     (regbank+4),y
+	jsr     pusha
+	ldy     #$03
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$09
+	lda     (regbank+4),y
+	jsr     _cvlinexy
+	lda     #$01
+	jsr     _textcolor
+	ldy     #$0D
+	lda     (regbank+4),y
+	ldy     #$08
+	sta     (sp),y
+	ldy     #$0F
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	ldy     #$09
+	jsr     staxysp
+	jmp     L010B
+L0109:	ldy     #$03
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$0C
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     tosadda0
+	jsr     pusha
+	ldy     #$03
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$0D
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	jsr     tosadda0
+	jsr     pusha
+	ldy     #$0C
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     _cputsxy
+	ldy     #$09
+	ldx     #$00
+	lda     #$04
+	jsr     addeqysp
+L010B:	ldy     #$08
+	lda     (sp),y
+	pha
+	sec
+	sbc     #$01
+	sta     (sp),y
+	pla
+	tax
+	bne     L0109
+	lda     (sp,x)
+	jsr     _textcolor
+	ldy     #$0C
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	iny
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DrawFrames (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DrawFrames: near
+
+.segment	"CODE"
+
+	jsr     decsp3
+	lda     #$00
+	ldy     #$02
+L04E5:	sta     (sp),y
+	cmp     #$06
+	bcs     L0116
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L04E6
+	inx
+	clc
+L04E6:	adc     #<(_Frames)
+	tay
+	txa
+	adc     #>(_Frames)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     stax0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$0A
+	lda     (ptr1),y
+	beq     L0117
+	jsr     pushw0sp
+	lda     #$00
+	jsr     _DrawFrame
+L0117:	ldy     #$02
+	clc
+	lda     #$01
+	adc     (sp),y
+	jmp     L04E5
+L0116:	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ ActivateFrame (int, unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ActivateFrame: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jsr     decsp1
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	cpx     _ActiveFrame+1
+	bne     L04E9
+	cmp     _ActiveFrame
+	jeq     L0129
+L04E9:	ldx     _ActiveFrame+1
+	bmi     L012B
+	lda     _ActiveFrame
+	ldx     _ActiveFrame+1
+	jsr     aslax1
+	clc
+	adc     #<(_Frames)
+	tay
+	txa
+	adc     #>(_Frames)
+	tax
+	tya
+	jsr     pushw
+	lda     #$00
+	jsr     _DrawFrame
+L012B:	ldy     #$05
+	jsr     ldaxysp
+	sta     _ActiveFrame
+	stx     _ActiveFrame+1
+	txa
+	bmi     L0131
+	lda     _ActiveFrame
+	ldx     _ActiveFrame+1
+	jsr     aslax1
+	clc
+	adc     #<(_Frames)
+	tay
+	txa
+	adc     #>(_Frames)
+	tax
+	tya
+	jsr     ldaxi
+	sta     regbank+4
+	stx     regbank+4+1
+	ldy     #$03
+	lda     (sp),y
+	beq     L013B
+	ldy     #$05
+	lda     (regbank+4),y
+	clc
+	adc     #$01
+	ldy     #$02
+L04E8:	sta     (sp),y
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$07
+	lda     (regbank+4),y
+	jsr     tosicmp0
+	bcs     L013B
+	ldy     #$04
+	lda     (regbank+4),y
+	clc
+	adc     #$01
+	jsr     pusha
+	ldy     #$03
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$08
+	lda     (regbank+4),y
+	jsr     _cclearxy
+	ldy     #$02
+	clc
+	lda     #$01
+	adc     (sp),y
+	jmp     L04E8
+L013B:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	lda     #$01
+	jsr     _DrawFrame
+L0131:	lda     _ActivePrompt
+	ldx     _ActivePrompt+1
+	jsr     _DisplayPrompt
+L0129:	ldy     #$00
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ HelpPrompt (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_HelpPrompt: near
+
+.segment	"CODE"
+
+	lda     #<(L016A)
+	ldx     #>(L016A)
+	jmp     _DisplayPrompt
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ AnyKeyPrompt (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AnyKeyPrompt: near
+
+.segment	"CODE"
+
+	lda     #<(L016E)
+	ldx     #>(L016E)
+	jmp     _DisplayPrompt
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ IsAbortKey (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_IsAbortKey: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldx     #$00
+	txa
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ Input (__near__ unsigned char *, __near__ unsigned char *, unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Input: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jsr     decsp8
+	lda     #$00
+	jsr     pusha
+	lda     #$18
+	jsr     pusha
+	lda     #$28
+	jsr     _cclearxy
+	lda     #$01
+	jsr     _textcolor
+	ldy     #$05
+	sta     (sp),y
+	lda     #$00
+	jsr     pusha
+	lda     #$18
+	jsr     pusha
+	ldy     #$0E
+	jsr     ldaxysp
+	jsr     _cputsxy
+	lda     #$01
+	jsr     _textcolor
+	jsr     _wherex
+	ldy     #$03
+	sta     (sp),y
+	lda     #$01
+	jsr     _cursor
+	ldy     #$04
+	sta     (sp),y
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+L0189:	jsr     _cgetc
+	ldy     #$00
+	sta     (sp),y
+	ldx     #$00
+	jsr     _isalnum
+	stx     tmp1
+	ora     tmp1
+	beq     L018E
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$08
+	cmp     (sp),y
+	bcs     L018E
+	ldy     #$02
+	lda     (sp),y
+	clc
+	ldy     #$09
+	adc     (sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	ldy     #$00
+	lda     (sp),y
+	sta     (ptr1),y
+	ldy     #$02
+	lda     (sp),y
+	clc
+	iny
+	adc     (sp),y
+	jsr     pusha
+	lda     #$18
+	jsr     pusha
+	ldy     #$02
+	lda     (sp),y
+	jsr     _cputcxy
+	ldy     #$02
+	clc
+	lda     #$01
+	adc     (sp),y
+	jmp     L04ED
+L018E:	ldy     #$02
+	lda     (sp),y
+	beq     L019C
+	ldy     #$00
+	lda     (sp),y
+	cmp     #$08
+	bne     L04F4
+	ldy     #$02
+	lda     (sp),y
+	sec
+	sbc     #$01
+	sta     (sp),y
+	clc
+	iny
+	adc     (sp),y
+	jsr     pusha
+	lda     #$18
+	jsr     pusha
+	lda     #$20
+	jsr     _cputcxy
+	ldy     #$02
+	lda     (sp),y
+	clc
+	iny
+	adc     (sp),y
+	jsr     pusha
+	lda     #$18
+	jsr     _gotoxy
+	jmp     L01B2
+L019C:	tay
+L04F4:	lda     (sp),y
+	cmp     #$0A
+	bne     L04F2
+	ldy     #$02
+	lda     (sp),y
+	clc
+	ldy     #$09
+	adc     (sp),y
+	sta     ptr1
+	lda     #$00
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	lda     #$01
+	jmp     L04F3
+L04F2:	lda     (sp),y
+	jsr     _IsAbortKey
+	tax
+	beq     L01B2
+	lda     #$02
+L04F3:	ldy     #$01
+L04ED:	sta     (sp),y
+L01B2:	ldy     #$01
+	lda     (sp),y
+	jeq     L0189
+	ldy     #$04
+	lda     (sp),y
+	jsr     _cursor
+	ldy     #$05
+	lda     (sp),y
+	jsr     _textcolor
+	jsr     _DrawFrames
+	lda     _ActiveFrame
+	ldx     _ActiveFrame+1
+	ldy     #$06
+	jsr     staxysp
+	lda     #$FF
+	sta     _ActiveFrame
+	sta     _ActiveFrame+1
+	ldy     #$09
+	jsr     pushwysp
+	lda     #$00
+	jsr     _ActivateFrame
+	ldy     #$01
+	lda     (sp),y
+	cmp     #$01
+	jsr     booleq
+	ldy     #$0D
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ InputHex (__near__ unsigned char *, __near__ unsigned int *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_InputHex: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$0A
+	jsr     subysp
+	ldy     #$0F
+	jsr     pushwysp
+	lda     #$07
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$04
+	jsr     _Input
+	tax
+	jeq     L01F1
+	ldy     #$05
+	lda     (sp),y
+	ldx     #$00
+	jsr     _isxdigit
+	stx     tmp1
+	ora     tmp1
+	bne     L01C9
+	tax
+	jmp     L01F1
+L01C9:	lda     #$05
+	jsr     leaa0sp
+	ldy     #$03
+	jsr     staxysp
+	ldx     #$00
+	txa
+	jsr     stax0sp
+	jmp     L01D8
+L01D6:	jsr     ldax0sp
+	jsr     shlax4
+	jsr     stax0sp
+	ldy     #$02
+	lda     (sp),y
+	ldx     #$00
+	jsr     _isdigit
+	stx     tmp1
+	ora     tmp1
+	beq     L01E1
+	ldy     #$02
+	lda     (sp),y
+	sec
+	sbc     #$30
+	jmp     L04F6
+L01E1:	ldy     #$02
+	lda     (sp),y
+	ldx     #$00
+	jsr     _toupper
+	ldy     #$37
+	jsr     decaxy
+	ldy     #$02
+L04F6:	sta     (sp),y
+	ldx     #$00
+	jsr     addeq0sp
+	ldy     #$03
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L01D8:	ldy     #$04
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	ldy     #$02
+	sta     (sp),y
+	tax
+	beq     L04F5
+	lda     (sp),y
+	ldx     #$00
+	jsr     _isxdigit
+	stx     tmp1
+	ora     tmp1
+	bne     L01D6
+L04F5:	ldy     #$0B
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	jsr     ldax0sp
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	ldx     #$00
+	tya
+L01F1:	ldy     #$0E
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ ErrorPrompt (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ErrorPrompt: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     _ActivePrompt
+	ldx     _ActivePrompt+1
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _DisplayPrompt
+	jsr     _cgetc
+	jsr     ldax0sp
+	jsr     _DisplayPrompt
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ InputGoto (__near__ unsigned int *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_InputGoto: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp1
+	lda     #<(L01FD)
+	ldx     #>(L01FD)
+	jsr     pushax
+	ldy     #$04
+	jsr     ldaxysp
+	jsr     _InputHex
+	ldy     #$00
+	sta     (sp),y
+	lda     (sp),y
+	bne     L04FC
+	lda     #<(L0203)
+	ldx     #>(L0203)
+	jsr     _ErrorPrompt
+L04FC:	ldx     #$00
+	lda     (sp,x)
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ BreakInRomError (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_BreakInRomError: near
+
+.segment	"CODE"
+
+	lda     #<(L0208)
+	ldx     #>(L0208)
+	jmp     _ErrorPrompt
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DbgSetTmpBreak (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DbgSetTmpBreak: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     _DbgGetBreakSlot
+	jsr     pushax
+	jsr     ldax0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	jsr     ldax0sp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$80
+	ldy     #$03
+	sta     (ptr1),y
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DbgToggleUserBreak (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DbgToggleUserBreak: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _DbgIsBreak
+	sta     regbank+4
+	stx     regbank+4+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0213
+	lda     #$00
+	ldy     #$03
+	sta     (regbank+4),y
+	dec     _DbgBreakCount
+	jmp     L0223
+L0213:	lda     _DbgBreakCount
+	cmp     #$0A
+	bcc     L0219
+	lda     #<(L021C)
+	ldx     #>(L021C)
+	jsr     _ErrorPrompt
+	jmp     L0223
+L0219:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _DbgIsRAM
+	stx     tmp1
+	ora     tmp1
+	bne     L021F
+	jsr     _BreakInRomError
+	jmp     L0223
+L021F:	jsr     _DbgGetBreakSlot
+	sta     regbank+4
+	stx     regbank+4+1
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	tya
+	ldy     #$03
+	sta     (regbank+4),y
+	inc     _DbgBreakCount
+L0223:	ldy     #$00
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DbgResetTmpBreaks (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DbgResetTmpBreaks: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     #<(_DbgBreaks)
+	ldx     #>(_DbgBreaks)
+	jsr     pushax
+	lda     #$00
+	ldy     #$02
+L04FE:	sta     (sp),y
+	cmp     #$0A
+	bcs     L022E
+	jsr     ldax0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$03
+	lda     (ptr1),y
+	cmp     #$80
+	bne     L0235
+	jsr     ldax0sp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$00
+	ldy     #$03
+	sta     (ptr1),y
+L0235:	ldx     #$00
+	lda     #$04
+	jsr     addeq0sp
+	ldy     #$02
+	clc
+	lda     #$01
+	adc     (sp),y
+	jmp     L04FE
+L022E:	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ DbgTmpBreaksOk (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DbgTmpBreaksOk: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     #<(_DbgBreaks)
+	ldx     #>(_DbgBreaks)
+	jsr     pushax
+	lda     #$00
+	ldy     #$02
+L04FF:	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$0A
+	bcs     L0501
+	jsr     ldax0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$03
+	lda     (ptr1),y
+	cmp     #$80
+	bne     L0244
+	jsr     ldax0sp
+	jsr     ldaxi
+	jsr     _DbgIsRAM
+	stx     tmp1
+	ora     tmp1
+	bne     L0244
+	jsr     _BreakInRomError
+	jsr     _DbgResetTmpBreaks
+	ldx     #$00
+	txa
+	jmp     incsp3
+L0244:	ldx     #$00
+	lda     #$04
+	jsr     addeq0sp
+	ldy     #$02
+	clc
+	lda     #$01
+	adc     (sp),y
+	jmp     L04FF
+L0501:	lda     #$01
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ AsmBack (unsigned int, unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AsmBack: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldy     #$43
+	jsr     subysp
+	lda     #$06
+	jsr     pusha0
+L0251:	lda     #$00
+	ldy     #$02
+	sta     (sp),y
+	ldy     #$49
+	jsr     pushwysp
+	ldy     #$47
+	ldx     #$00
+	lda     (sp),y
+	jsr     mulax3
+	jsr     tossubax
+	sec
+	ldy     #$00
+	sbc     (sp),y
+	pha
+	txa
+	iny
+	sbc     (sp),y
+	tax
+	pla
+	ldy     #$43
+	jsr     staxysp
+L025A:	ldy     #$44
+	jsr     ldaxysp
+	jsr     _DbgDisAsmLen
+	ldy     #$43
+	jsr     addeqysp
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L0505
+	inx
+	clc
+L0505:	adc     #$03
+	bcc     L0263
+	inx
+	clc
+L0263:	adc     sp
+	sta     ptr1
+	txa
+	adc     sp+1
+	sta     ptr1+1
+	ldy     #$44
+	jsr     ldaxysp
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	iny
+	lda     (sp),y
+	clc
+	adc     #$01
+	and     #$1F
+	sta     (sp),y
+	ldy     #$44
+	jsr     ldaxysp
+	ldy     #$46
+	cmp     (sp),y
+	txa
+	iny
+	sbc     (sp),y
+	bcc     L025A
+	ldy     #$44
+	jsr     ldaxysp
+	ldy     #$46
+	cmp     (sp),y
+	bne     L0507
+	txa
+	iny
+	cmp     (sp),y
+	beq     L026B
+L0507:	ldy     #$01
+	lda     (sp),y
+	bne     L0509
+	dey
+	lda     (sp),y
+	cmp     #$0C
+	bne     L0509
+L026B:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	sec
+	ldy     #$45
+	sbc     (sp),y
+	sec
+	sbc     #$01
+	and     #$1F
+	asl     a
+	bcc     L0506
+	inx
+	clc
+L0506:	adc     #$03
+	bcc     L0271
+	inx
+	clc
+L0271:	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     ldaxi
+	jmp     L0252
+L0509:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	jmp     L0251
+L0252:	ldy     #$48
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ UpdateAsm (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_UpdateAsm: near
+
+.segment	"CODE"
+
+	ldy     #$2A
+	jsr     subysp
+	lda     _AsmFrame+8
+	jsr     pusha
+	lda     _AsmFrame+4
+	clc
+	adc     #$01
+	jsr     pusha
+	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     pushax
+	lda     #$02
+	jsr     _AsmBack
+	jsr     pushax
+	lda     _AsmFrame+5
+	clc
+	adc     #$01
+	ldy     #$04
+L050C:	sta     (sp),y
+	cmp     _AsmFrame+7
+	jcs     L027C
+	jsr     pushw0sp
+	lda     #$08
+	jsr     leaa0sp
+	jsr     pushax
+	ldy     #$07
+	lda     (sp),y
+	jsr     _DbgDisAsm
+	ldy     #$05
+	sta     (sp),y
+	jsr     ldax0sp
+	cpx     _brk_pc+1
+	bne     L0288
+	cmp     _brk_pc
+	bne     L0288
+	lda     #$2D
+	ldy     #$0A
+	sta     (sp),y
+	lda     #$3E
+	iny
+	sta     (sp),y
+L0288:	jsr     ldax0sp
+	jsr     _DbgIsBreak
+	stx     tmp1
+	ora     tmp1
+	beq     L0290
+	lda     #$2A
+	ldy     #$0B
+	sta     (sp),y
+L0290:	jsr     ldax0sp
+	cpx     _AsmAddr+1
+	bne     L0296
+	cmp     _AsmAddr
+	bne     L0296
+	lda     #$01
+	jsr     _revers
+	lda     #$01
+	jsr     pusha
+	ldy     #$05
+	lda     (sp),y
+	jsr     pusha
+	lda     #$08
+	jsr     leaa0sp
+	jsr     _cputsxy
+	lda     #$00
+	jsr     _revers
+	jmp     L02A0
+L0296:	lda     #$01
+	jsr     pusha
+	ldy     #$05
+	lda     (sp),y
+	jsr     pusha
+	lda     #$08
+	jsr     leaa0sp
+	jsr     _cputsxy
+L02A0:	ldy     #$05
+	lda     (sp),y
+	ldx     #$00
+	jsr     addeq0sp
+	ldy     #$04
+	clc
+	lda     #$01
+	adc     (sp),y
+	jmp     L050C
+L027C:	jsr     ldax0sp
+	ldy     #$2E
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ AsmArg16 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AsmArg16: near
+
+.segment	"CODE"
+
+	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     incax1
+	ldy     #$01
+	jmp     ldaxidx
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ AsmFollow (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AsmFollow: near
+
+.segment	"CODE"
+
+	lda     _AsmAddr+1
+	sta     ptr1+1
+	lda     _AsmAddr
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	cmp     #$10
+	beq     L02BA
+	cmp     #$20
+	beq     L02B0
+	cmp     #$30
+	beq     L02BA
+	cmp     #$40
+	beq     L0511
+	cmp     #$4C
+	beq     L02B0
+	cmp     #$50
+	beq     L02BA
+	cmp     #$60
+	beq     L0510
+	cmp     #$6C
+	beq     L02B6
+	cmp     #$70
+	beq     L02BA
+	cmp     #$90
+	beq     L02BA
+	cmp     #$B0
+	beq     L02BA
+	cmp     #$D0
+	beq     L02BA
+	cmp     #$F0
+	beq     L02BA
+	rts
+L02B0:	jsr     _AsmArg16
+	jmp     L0512
+L02B6:	jsr     _AsmArg16
+	jmp     L050E
+L02BA:	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     incax2
+	jsr     pushax
+	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     incax1
+	ldy     #$00
+	jsr     ldaidx
+	jsr     tosaddax
+	jmp     L0512
+L0510:	ldx     #$01
+	txa
+	clc
+	adc     _DbgSP
+	bcc     L050D
+	inx
+L050D:	jsr     ldaxi
+	jsr     incax1
+	jmp     L0512
+L0511:	ldx     #$01
+	lda     #$02
+	clc
+	adc     _DbgSP
+	bcc     L050E
+	inx
+L050E:	jsr     ldaxi
+L0512:	sta     _AsmAddr
+	stx     _AsmAddr+1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ AsmHome (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AsmHome: near
+
+.segment	"CODE"
+
+	lda     _brk_pc+1
+	sta     _AsmAddr+1
+	lda     _brk_pc
+	sta     _AsmAddr
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ InitAsm (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_InitAsm: near
+
+.segment	"CODE"
+
+	jsr     _AsmHome
+	jmp     _UpdateAsm
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ UpdateReg (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_UpdateReg: near
+
+.segment	"CODE"
+
+	lda     _RegFrame+4
+	clc
+	adc     #$05
+	jsr     pusha
+	ldy     #$00
+	lda     (sp),y
+	clc
+	adc     #$02
+	jsr     pusha
+	lda     _RegFrame+5
+	jsr     pusha
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	jsr     _gotoxy
+	lda     _brk_pc
+	ldx     _brk_pc+1
+	jsr     _cputhex16
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	jsr     _gotoxy
+	lda     _brk_sr
+	jsr     _cputhex8
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	jsr     _gotoxy
+	lda     _brk_a
+	jsr     _cputhex8
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	jsr     _gotoxy
+	lda     _brk_x
+	jsr     _cputhex8
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	jsr     _gotoxy
+	lda     _brk_y
+	jsr     _cputhex8
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	jsr     _gotoxy
+	lda     _DbgSP
+	jsr     _cputhex8
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	jsr     _gotoxy
+	lda     _DbgCS
+	ldx     _DbgCS+1
+	jsr     _cputhex16
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	jsr     _gotoxy
+	lda     _DbgHI
+	ldx     _DbgHI+1
+	jsr     _cputhex16
+	ldx     #$00
+	txa
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ InitReg (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_InitReg: near
+
+.segment	"CODE"
+
+	jmp     _UpdateReg
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ UpdateStack (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_UpdateStack: near
+
+.segment	"CODE"
+
+	lda     _StackAddr
+	jsr     pusha
+	lda     _StackFrame+4
+	clc
+	adc     #$01
+	jsr     pusha
+	ldy     #$00
+	lda     (sp),y
+	clc
+	adc     #$06
+	jsr     pusha
+	jsr     decsp1
+	lda     _StackFrame+7
+	sec
+	sbc     #$01
+	ldy     #$00
+L0516:	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	sec
+	sbc     _StackFrame+5
+	sta     tmp1
+	lda     tmp1
+	beq     L0347
+	bcc     L0347
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	lda     (sp),y
+	jsr     _gotoxy
+	ldy     #$03
+	lda     (sp),y
+	jsr     _cputhex8
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	lda     (sp),y
+	jsr     _gotoxy
+	ldx     #$01
+	lda     #$00
+	clc
+	ldy     #$03
+	adc     (sp),y
+	bcc     L0514
+	inx
+L0514:	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	jsr     _cputhex8
+	ldy     #$03
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$00
+	lda     (sp),y
+	sec
+	sbc     #$01
+	jmp     L0516
+L0347:	ldy     #$03
+	lda     (sp),y
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ StackHome (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_StackHome: near
+
+.segment	"CODE"
+
+	lda     _DbgSP
+	clc
+	adc     #$01
+	sta     _StackAddr
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ InitStack (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_InitStack: near
+
+.segment	"CODE"
+
+	jsr     _StackHome
+	jmp     _UpdateStack
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ UpdateCStack (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_UpdateCStack: near
+
+.segment	"CODE"
+
+	lda     _CStackAddr
+	ldx     _CStackAddr+1
+	jsr     pushax
+	lda     _CStackFrame+4
+	clc
+	adc     #$05
+	jsr     pusha
+	jsr     decsp1
+	lda     _CStackFrame+7
+	sec
+	sbc     #$01
+	ldy     #$00
+L0518:	sta     (sp),y
+	sec
+	sbc     _CStackFrame+5
+	sta     tmp1
+	lda     tmp1
+	beq     L0519
+	bcc     L0519
+	iny
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$01
+	lda     (sp),y
+	jsr     _gotoxy
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     ldaxi
+	jsr     _cputhex16
+	ldy     #$02
+	ldx     #$00
+	tya
+	jsr     addeqysp
+	ldy     #$00
+	lda     (sp),y
+	sec
+	sbc     #$01
+	jmp     L0518
+L0519:	lda     _CStackFrame+4
+	clc
+	adc     #$01
+	jsr     pusha
+	lda     _CStackFrame+7
+	sec
+	sbc     #$01
+	jsr     pusha
+	lda     #<(L0394)
+	ldx     #>(L0394)
+	jsr     _cputsxy
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ CStackHome (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_CStackHome: near
+
+.segment	"CODE"
+
+	lda     _DbgCS+1
+	sta     _CStackAddr+1
+	lda     _DbgCS
+	sta     _CStackAddr
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ InitCStack (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_InitCStack: near
+
+.segment	"CODE"
+
+	jsr     _CStackHome
+	jmp     _UpdateCStack
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ UpdateDump (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_UpdateDump: near
+
+.segment	"CODE"
+
+	ldy     #$29
+	jsr     subysp
+	lda     _DumpAddr
+	ldx     _DumpAddr+1
+	jsr     pushax
+	lda     _DumpFrame+4
+	clc
+	adc     #$01
+	jsr     pusha
+	ldy     #$04
+	jsr     pushwysp
+	lda     _DumpFrame+5
+	clc
+	adc     #$01
+	ldy     #$05
+L051A:	sta     (sp),y
+	cmp     _DumpFrame+7
+	bcs     L03C5
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$06
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$08
+	jsr     pushwysp
+	lda     #$0A
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$08
+	jsr     pusha
+	jsr     _DbgMemDump
+	jsr     _cputsxy
+	ldy     #$03
+	ldx     #$00
+	lda     #$08
+	jsr     addeqysp
+	ldy     #$05
+	clc
+	lda     #$01
+	adc     (sp),y
+	jmp     L051A
+L03C5:	dey
+	jsr     ldaxysp
+	ldy     #$2E
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DumpHome (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DumpHome: near
+
+.segment	"CODE"
+
+	lda     #$00
+	sta     _DumpAddr
+	sta     _DumpAddr+1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ GetArg16 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_GetArg16: near
+
+.segment	"CODE"
+
+	lda     _brk_pc
+	ldx     _brk_pc+1
+	jsr     incax1
+	ldy     #$01
+	jmp     ldaxidx
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ GetStack16 (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_GetStack16: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldx     #$00
+	lda     (sp,x)
+	clc
+	adc     _DbgSP
+	bcc     L051B
+	inx
+L051B:	sta     ptr1
+	stx     ptr1+1
+	ldx     #$01
+	txa
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	jsr     ldaxi
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ SetRTSBreak (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_SetRTSBreak: near
+
+.segment	"CODE"
+
+	lda     #$00
+	jsr     _GetStack16
+	jsr     incax1
+	jmp     _DbgSetTmpBreak
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ DbgEntry (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_DbgEntry: near
+
+.segment	"DATA"
+
+L047C:
+	.byte	$01
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     L047C
+	beq     L047E
+	lda     #$00
+	sta     L047C
+	jsr     _RedrawStatic
+	jsr     _InitAsm
+	jsr     _InitReg
+	jsr     _InitStack
+	jsr     _InitCStack
+	jsr     _UpdateDump
+L047E:	jsr     _AsmHome
+	jsr     _UpdateReg
+	jsr     _StackHome
+	jsr     _CStackHome
+	lda     #$00
+	tay
+	sta     (sp),y
+	jmp     L0520
+L048F:	lda     _ActiveFrame
+	ldx     _ActiveFrame+1
+	jsr     aslax1
+	clc
+	adc     #<(_Frames)
+	tay
+	txa
+	adc     #>(_Frames)
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$0C
+	jsr     ldaxidx
+	jsr     callax
+	ldy     #$01
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	jeq     L051F
+	cmp     #$0A
+	jeq     L04BF
+	cmp     #$20
+	jeq     L04B7
+	cmp     #$31
+	beq     L051E
+	cmp     #$32
+	beq     L051E
+	cmp     #$33
+	beq     L051E
+	cmp     #$34
+	beq     L051E
+	cmp     #$35
+	beq     L051E
+	cmp     #$3F
+	beq     L04A7
+	cmp     #$63
+	jeq     L051F
+	cmp     #$68
+	beq     L04AF
+	cmp     #$71
+	jeq     L04D7
+	cmp     #$72
+	jeq     L04D3
+	cmp     #$73
+	beq     L04CD
+	cmp     #$75
+	beq     L04AA
+	jmp     L0498
+L051E:	lda     (sp),y
+	ldy     #$31
+	jsr     decaxy
+	jsr     pushax
+	lda     #$00
+	jsr     _ActivateFrame
+	jmp     L0498
+L04A7:	jsr     _HelpHandler
+	jmp     L0498
+L04AA:	jsr     _SetRTSBreak
+	lda     #$01
+	ldy     #$00
+	sta     (sp),y
+	jmp     L0520
+L04AF:	lda     _brk_pc
+	ldx     _brk_pc+1
+	cpx     _AsmAddr+1
+	bne     L0521
+	cmp     _AsmAddr
+	beq     L0498
+L0521:	lda     _AsmAddr
+	ldx     _AsmAddr+1
+	jsr     _DbgSetTmpBreak
+	lda     #$01
+	ldy     #$00
+	sta     (sp),y
+	jmp     L0520
+L04B7:	tya
+	jsr     _SingleStep
+	jsr     _DbgTmpBreaksOk
+	tax
+	beq     L0498
+	lda     #$01
+	ldy     #$00
+	sta     (sp),y
+	jmp     L0520
+L04BF:	txa
+	jsr     _SingleStep
+	jsr     _DbgTmpBreaksOk
+	tax
+	beq     L0498
+	lda     #$01
+	ldy     #$00
+	sta     (sp),y
+	jmp     L0520
+L051F:	tya
+	dey
+	sta     (sp),y
+	jmp     L0520
+L04CD:	lda     _brk_pc
+	ldx     _brk_pc+1
+	jsr     _DbgDisAsmLen
+	clc
+	adc     _brk_pc
+	sta     _brk_pc
+	txa
+	adc     _brk_pc+1
+	sta     _brk_pc+1
+	jsr     _InitAsm
+	jmp     L0498
+L04D3:	lda     _ActiveFrame
+	jsr     _Redraw
+	jmp     L0498
+L04D7:	jsr     _clrscr
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0498:	ldy     #$00
+L0520:	lda     (sp),y
+	jeq     L048F
+	jmp     incsp2
+
+.endproc
+
@@ -0,0 +1,69 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_stderr
+	.import		_fprintf
+	.export		__poserror
+	.import		__stroserror
+	.import		__oserror
+
+.segment	"RODATA"
+
+L0002:
+	.byte	$25,$73,$3A,$20,$25,$73,$0A,$00
+L0003	:=	L0002+4
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ _poserror (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	__poserror: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     __oserror
+	jsr     __stroserror
+	jsr     pushax
+	ldy     #$03
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0006
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(L0002)
+	ldx     #>(L0002)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$08
+	jmp     L0012
+L0006:	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(L0003)
+	ldx     #>(L0003)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$06
+L0012:	jsr     _fprintf
+	jmp     incsp4
+
+.endproc
+
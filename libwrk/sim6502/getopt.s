@@ -0,0 +1,291 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_stderr
+	.import		_fputc
+	.import		_fputs
+	.import		_strchr
+	.export		_optarg
+	.export		_optind
+	.export		_opterr
+	.export		_optopt
+	.export		_getopt
+
+.segment	"DATA"
+
+_opterr:
+	.word	$0001
+_optind:
+	.word	$0001
+
+.segment	"RODATA"
+
+L0007:
+	.byte	$3A,$20,$6F,$70,$74,$69,$6F,$6E,$20,$72,$65,$71,$75,$69,$72,$65
+	.byte	$73,$20,$61,$6E,$20,$61,$72,$67,$75,$6D,$65,$6E,$74,$20,$2D,$2D
+	.byte	$20,$00
+L0005:
+	.byte	$3A,$20,$69,$6C,$6C,$65,$67,$61,$6C,$20,$6F,$70,$74,$69,$6F,$6E
+	.byte	$20,$2D,$2D,$20,$00
+L0006	:=	L0007+33
+L0008	:=	L0007+33
+L0004	:=	L0007+33
+
+.segment	"BSS"
+
+_optarg:
+	.res	2,$00
+_optopt:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ getopt (int, __near__ const __near__ unsigned char * *, __near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_getopt: near
+
+.segment	"DATA"
+
+L0009:
+	.addr	L0004
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	lda     L0009+1
+	sta     ptr1+1
+	lda     L0009
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	bne     L0016
+	lda     _optind
+	ldx     _optind+1
+	ldy     #$06
+	cmp     (sp),y
+	txa
+	iny
+	sbc     (sp),y
+	bvs     L0064
+	eor     #$80
+L0064:	bmi     L0067
+	lda     _optind
+	jsr     aslax1
+	clc
+	ldy     #$04
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	jsr     ldaxi
+	sta     L0009
+	stx     L0009+1
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	cmp     #$2D
+	bne     L0067
+	inc     L0009
+	bne     L0012
+	inc     L0009+1
+L0012:	lda     L0009+1
+	sta     ptr1+1
+	lda     L0009
+	sta     ptr1
+	lda     (ptr1),y
+	bne     L000D
+L0067:	ldx     #$FF
+	txa
+	jmp     L0003
+L000D:	lda     L0009+1
+	sta     ptr1+1
+	lda     L0009
+	sta     ptr1
+	lda     (ptr1),y
+	cmp     #$2D
+	bne     L0016
+	inc     _optind
+	bne     L0019
+	inc     _optind+1
+L0019:	ldx     #$FF
+	txa
+	jmp     L0003
+L0016:	lda     L0009
+	ldx     L0009+1
+	sta     regsave
+	stx     regsave+1
+	jsr     incax1
+	sta     L0009
+	stx     L0009+1
+	sty     _optopt+1
+	lda     (regsave),y
+	sta     _optopt
+	cmp     #$3A
+	beq     L0068
+	ldy     #$05
+	jsr     pushwysp
+	lda     _optopt
+	ldx     _optopt+1
+	jsr     _strchr
+	sta     regbank+4
+	stx     regbank+4+1
+	jsr     bnegax
+	beq     L001C
+L0068:	lda     L0009+1
+	sta     ptr1+1
+	lda     L0009
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	bne     L0026
+	inc     _optind
+	bne     L0026
+	inc     _optind+1
+L0026:	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushw
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     _fputs
+	lda     #<(L0005)
+	ldx     #>(L0005)
+	jsr     pushax
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     _fputs
+	lda     _optopt
+	ldx     _optopt+1
+	jsr     pushax
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     _fputc
+	lda     #$0A
+	jsr     pusha0
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     _fputc
+	ldx     #$00
+	lda     #$3F
+	jmp     L0003
+L001C:	inc     regbank+4
+	bne     L003A
+	inc     regbank+4+1
+L003A:	ldy     #$00
+	lda     (regbank+4),y
+	cmp     #$3A
+	beq     L0038
+	tya
+	sta     _optarg
+	sta     _optarg+1
+	lda     L0009+1
+	sta     ptr1+1
+	lda     L0009
+	sta     ptr1
+	lda     (ptr1),y
+	jne     L0041
+	jmp     L006B
+L0038:	lda     L0009+1
+	sta     ptr1+1
+	lda     L0009
+	sta     ptr1
+	lda     (ptr1),y
+	beq     L0042
+	lda     L0009+1
+	sta     _optarg+1
+	lda     L0009
+	sta     _optarg
+	jmp     L005A
+L0042:	ldy     #$09
+	jsr     pushwysp
+	inc     _optind
+	bne     L0049
+	inc     _optind+1
+L0049:	lda     _optind
+	ldx     _optind+1
+	jsr     tosicmp
+	beq     L0066
+	bpl     L0047
+L0066:	lda     #>(L0006)
+	sta     L0009+1
+	lda     #<(L0006)
+	sta     L0009
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushw
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     _fputs
+	lda     #<(L0007)
+	ldx     #>(L0007)
+	jsr     pushax
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     _fputs
+	lda     _optopt
+	ldx     _optopt+1
+	jsr     pushax
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     _fputc
+	lda     #$0A
+	jsr     pusha0
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     _fputc
+	ldx     #$00
+	lda     #$3F
+	jmp     L0003
+L0047:	lda     _optind
+	ldx     _optind+1
+	jsr     aslax1
+	clc
+	ldy     #$04
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	jsr     ldaxi
+	sta     _optarg
+	stx     _optarg+1
+L005A:	lda     #>(L0008)
+	sta     L0009+1
+	lda     #<(L0008)
+	sta     L0009
+L006B:	inc     _optind
+	bne     L0041
+	inc     _optind+1
+L0041:	lda     _optopt
+	ldx     _optopt+1
+L0003:	pha
+	ldy     #$00
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp8
+
+.endproc
+
@@ -0,0 +1,816 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_strlen
+	.import		_memcpy
+	.import		_sprintf
+	.import		__tz
+	.export		_strftime
+
+.segment	"RODATA"
+
+L0026:
+	.byte	$25,$2E,$33,$73,$20,$25,$2E,$33,$73,$25,$33,$64,$20,$25,$30,$32
+	.byte	$64,$3A,$25,$30,$32,$64,$3A,$25,$30,$32,$64,$20,$25,$64,$00
+L0019:
+	.byte	$25,$30,$34,$64,$2D,$25,$30,$32,$64,$2D,$25,$30,$32,$64,$00
+L002D	:=	L0019+0
+L0018:
+	.byte	$25,$30,$32,$64,$2F,$25,$30,$32,$64,$2F,$25,$30,$32,$64,$00
+L0022:
+	.byte	$25,$30,$32,$64,$3A,$25,$30,$32,$64,$3A,$25,$30,$32,$64,$00
+L0008:
+	.byte	$57,$65,$64,$6E,$65,$73,$64,$61,$79,$00
+L0014:
+	.byte	$53,$65,$70,$74,$65,$6D,$62,$65,$72,$00
+L000D:
+	.byte	$46,$65,$62,$72,$75,$61,$72,$79,$00
+L000B:
+	.byte	$53,$61,$74,$75,$72,$64,$61,$79,$00
+L0016:
+	.byte	$4E,$6F,$76,$65,$6D,$62,$65,$72,$00
+L0009:
+	.byte	$54,$68,$75,$72,$73,$64,$61,$79,$00
+L0017:
+	.byte	$44,$65,$63,$65,$6D,$62,$65,$72,$00
+L000C:
+	.byte	$4A,$61,$6E,$75,$61,$72,$79,$00
+L0015:
+	.byte	$4F,$63,$74,$6F,$62,$65,$72,$00
+L0007:
+	.byte	$54,$75,$65,$73,$64,$61,$79,$00
+L0013:
+	.byte	$41,$75,$67,$75,$73,$74,$00
+L000A:
+	.byte	$46,$72,$69,$64,$61,$79,$00
+L0005:
+	.byte	$53,$75,$6E,$64,$61,$79,$00
+L0006:
+	.byte	$4D,$6F,$6E,$64,$61,$79,$00
+L000E:
+	.byte	$4D,$61,$72,$63,$68,$00
+L000F:
+	.byte	$41,$70,$72,$69,$6C,$00
+L001B	:=	L0019+10
+L001C	:=	L0019+10
+L002E	:=	L0019+10
+L0011:
+	.byte	$4A,$75,$6E,$65,$00
+L001F	:=	L0019+10
+L0020	:=	L0019+10
+L0021	:=	L0019+10
+L0029	:=	L0019+10
+L0028:
+	.byte	$25,$30,$33,$64,$00
+L0024:
+	.byte	$25,$2E,$33,$73,$00
+L0025	:=	L0024+0
+L001A	:=	L0019+10
+L0027	:=	L0019+10
+L0012:
+	.byte	$4A,$75,$6C,$79,$00
+L0010:
+	.byte	$4D,$61,$79,$00
+L0023:
+	.byte	$25,$34,$64,$00
+L002B:
+	.byte	$41,$4D,$00
+L002C	:=	L0026+28
+L001E:
+	.byte	$61,$6D,$00
+L001D:
+	.byte	$70,$6D,$00
+L002A:
+	.byte	$50,$4D,$00
+
+; ---------------------------------------------------------------
+; unsigned int __near__ __fastcall__ strftime (__near__ unsigned char *, unsigned int, __near__ const unsigned char *, __near__ const struct tm *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_strftime: near
+
+.segment	"RODATA"
+
+L0030:
+	.addr	L0005
+	.addr	L0006
+	.addr	L0007
+	.addr	L0008
+	.addr	L0009
+	.addr	L000A
+	.addr	L000B
+L0039:
+	.addr	L000C
+	.addr	L000D
+	.addr	L000E
+	.addr	L000F
+	.addr	L0010
+	.addr	L0011
+	.addr	L0012
+	.addr	L0013
+	.addr	L0014
+	.addr	L0015
+	.addr	L0016
+	.addr	L0017
+
+.segment	"BSS"
+
+L0046:
+	.res	2,$00
+L0047:
+	.res	2,$00
+L0048:
+	.res	1,$00
+L004A:
+	.res	40,$00
+L004B:
+	.res	2,$00
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #$00
+	sta     L0046
+	sta     L0046+1
+L004E:	lda     L0046
+	ldy     #$04
+	cmp     (sp),y
+	lda     L0046+1
+	iny
+	sbc     (sp),y
+	bcc     L0052
+	ldx     #$00
+	txa
+	jmp     incsp8
+L0052:	ldy     #$03
+	jsr     ldaxysp
+	sta     regsave
+	stx     regsave+1
+	jsr     incax1
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$00
+	lda     (regsave),y
+	sta     L0048
+	cmp     #$00
+	bne     L0133
+	ldy     #$07
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	lda     L0046
+	ldx     L0046+1
+	jmp     incsp8
+L0133:	cmp     #$25
+	jne     L005C
+	lda     #>(L004A)
+	sta     L004B+1
+	lda     #<(L004A)
+	sta     L004B
+	ldy     #$03
+	jsr     ldaxysp
+	sta     regsave
+	stx     regsave+1
+	jsr     incax1
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$00
+	lda     (regsave),y
+	cmp     #$25
+	jeq     L0135
+	cmp     #$41
+	jeq     L006C
+	cmp     #$42
+	jeq     L0071
+	cmp     #$44
+	jeq     L0076
+	cmp     #$46
+	jeq     L007E
+	cmp     #$48
+	jeq     L0086
+	cmp     #$49
+	jeq     L008C
+	cmp     #$4D
+	jeq     L0093
+	cmp     #$50
+	jeq     L0099
+	cmp     #$53
+	jeq     L00A3
+	cmp     #$55
+	jeq     L00A9
+	cmp     #$57
+	jeq     L00B0
+	cmp     #$58
+	jeq     L00BC
+	cmp     #$59
+	jeq     L00C4
+	cmp     #$5A
+	jeq     L00CA
+	cmp     #$61
+	jeq     L00D2
+	cmp     #$62
+	jeq     L00D9
+	cmp     #$63
+	jeq     L00E0
+	cmp     #$64
+	jeq     L00EE
+	cmp     #$6A
+	jeq     L00F4
+	cmp     #$6D
+	jeq     L00FA
+	cmp     #$70
+	jeq     L0100
+	cmp     #$77
+	jeq     L010A
+	cmp     #$78
+	jeq     L0110
+	cmp     #$79
+	jeq     L0118
+	jmp     L0136
+L0135:	sta     L004A
+	sty     L004A+1
+	jmp     L0062
+L006C:	jsr     ldax0sp
+	ldy     #$0D
+	jsr     ldaxidx
+	jsr     aslax1
+	clc
+	adc     #<(L0030)
+	tay
+	txa
+	adc     #>(L0030)
+	tax
+	tya
+	jsr     ldaxi
+	sta     L004B
+	stx     L004B+1
+	jmp     L0062
+L0071:	jsr     ldax0sp
+	ldy     #$09
+	jsr     ldaxidx
+	jsr     aslax1
+	clc
+	adc     #<(L0039)
+	tay
+	txa
+	adc     #>(L0039)
+	tax
+	tya
+	jsr     ldaxi
+	sta     L004B
+	stx     L004B+1
+	jmp     L0062
+L0076:	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     pushax
+	lda     #<(L0018)
+	ldx     #>(L0018)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$09
+	jsr     ldaxidx
+	jsr     incax1
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     pushwidx
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$0B
+	jsr     pushwidx
+	ldx     #$00
+	lda     #$64
+	jsr     tosmoda0
+	jsr     pushax
+	ldy     #$0A
+	jsr     _sprintf
+	jmp     L0062
+L007E:	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     pushax
+	lda     #<(L0019)
+	ldx     #>(L0019)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$0B
+	jsr     ldaxidx
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$6C
+	clc
+	adc     ptr1
+	pha
+	lda     #$07
+	adc     ptr1+1
+	tax
+	pla
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$09
+	jsr     ldaxidx
+	jsr     incax1
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     pushwidx
+	ldy     #$0A
+	jsr     _sprintf
+	jmp     L0062
+L0086:	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     pushax
+	lda     #<(L001A)
+	ldx     #>(L001A)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     pushwidx
+	ldy     #$06
+	jsr     _sprintf
+	jmp     L0062
+L008C:	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     pushax
+	lda     #<(L001B)
+	ldx     #>(L001B)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     ldaxidx
+	ldy     #$0B
+	jsr     incaxy
+	jsr     pushax
+	ldx     #$00
+	lda     #$0C
+	jsr     tosmoda0
+	jsr     incax1
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	jmp     L0062
+L0093:	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     pushax
+	lda     #<(L001C)
+	ldx     #>(L001C)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     pushwidx
+	ldy     #$06
+	jsr     _sprintf
+	jmp     L0062
+L0099:	jsr     ldax0sp
+	ldy     #$05
+	jsr     ldaxidx
+	cmp     #$0C
+	txa
+	sbc     #$00
+	bvs     L009D
+	eor     #$80
+L009D:	bpl     L009E
+	lda     #<(L001D)
+	ldx     #>(L001D)
+	jmp     L00A0
+L009E:	lda     #<(L001E)
+	ldx     #>(L001E)
+L00A0:	sta     L004B
+	stx     L004B+1
+	jmp     L0062
+L00A3:	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     pushax
+	lda     #<(L001F)
+	ldx     #>(L001F)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushw
+	ldy     #$06
+	jsr     _sprintf
+	jmp     L0062
+L00A9:	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     pushax
+	lda     #<(L0020)
+	ldx     #>(L0020)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$0F
+	jsr     ldaxidx
+	jsr     incax7
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$0D
+	jsr     ldaxidx
+	jsr     tossubax
+	jsr     pushax
+	lda     #$07
+	jsr     tosdiva0
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	jmp     L0062
+L00B0:	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     pushax
+	lda     #<(L0021)
+	ldx     #>(L0021)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$0F
+	jsr     ldaxidx
+	jsr     incax7
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$0C
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	beq     L00B7
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$0D
+	jsr     ldaxidx
+	jsr     decax1
+	jmp     L00B9
+L00B7:	tax
+	lda     #$06
+L00B9:	jsr     tossubax
+	jsr     pushax
+	lda     #$07
+	jsr     tosdiva0
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	jmp     L0062
+L00BC:	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     pushax
+	lda     #<(L0022)
+	ldx     #>(L0022)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     pushwidx
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     pushwidx
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushw
+	ldy     #$0A
+	jsr     _sprintf
+	jmp     L0062
+L00C4:	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     pushax
+	lda     #<(L0023)
+	ldx     #>(L0023)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$0B
+	jsr     ldaxidx
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$6C
+	clc
+	adc     ptr1
+	pha
+	lda     #$07
+	adc     ptr1+1
+	tax
+	pla
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	jmp     L0062
+L00CA:	jsr     ldax0sp
+	ldy     #$10
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	beq     L00CD
+	lda     #<(__tz+10)
+	ldx     #>(__tz+10)
+	jmp     L00CF
+L00CD:	lda     #<(__tz+5)
+	ldx     #>(__tz+5)
+L00CF:	sta     L004B
+	stx     L004B+1
+	jmp     L0062
+L00D2:	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     pushax
+	lda     #<(L0024)
+	ldx     #>(L0024)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$0D
+	jsr     ldaxidx
+	jsr     aslax1
+	clc
+	adc     #<(L0030)
+	tay
+	txa
+	adc     #>(L0030)
+	tax
+	tya
+	jsr     pushw
+	ldy     #$06
+	jsr     _sprintf
+	jmp     L0062
+L00D9:	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     pushax
+	lda     #<(L0025)
+	ldx     #>(L0025)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$09
+	jsr     ldaxidx
+	jsr     aslax1
+	clc
+	adc     #<(L0039)
+	tay
+	txa
+	adc     #>(L0039)
+	tax
+	tya
+	jsr     pushw
+	ldy     #$06
+	jsr     _sprintf
+	jmp     L0062
+L00E0:	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     pushax
+	lda     #<(L0026)
+	ldx     #>(L0026)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$0D
+	jsr     ldaxidx
+	jsr     aslax1
+	clc
+	adc     #<(L0030)
+	tay
+	txa
+	adc     #>(L0030)
+	tax
+	tya
+	jsr     pushw
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$09
+	jsr     ldaxidx
+	jsr     aslax1
+	clc
+	adc     #<(L0039)
+	tay
+	txa
+	adc     #>(L0039)
+	tax
+	tya
+	jsr     pushw
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     pushwidx
+	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     pushwidx
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     pushwidx
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushw
+	ldy     #$11
+	jsr     ldaxysp
+	ldy     #$0B
+	jsr     ldaxidx
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$6C
+	clc
+	adc     ptr1
+	pha
+	lda     #$07
+	adc     ptr1+1
+	tax
+	pla
+	jsr     pushax
+	ldy     #$12
+	jsr     _sprintf
+	jmp     L0062
+L00EE:	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     pushax
+	lda     #<(L0027)
+	ldx     #>(L0027)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     pushwidx
+	ldy     #$06
+	jsr     _sprintf
+	jmp     L0062
+L00F4:	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     pushax
+	lda     #<(L0028)
+	ldx     #>(L0028)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$0F
+	jsr     ldaxidx
+	jsr     incax1
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	jmp     L0062
+L00FA:	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     pushax
+	lda     #<(L0029)
+	ldx     #>(L0029)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$09
+	jsr     ldaxidx
+	jsr     incax1
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	jmp     L0062
+L0100:	jsr     ldax0sp
+	ldy     #$05
+	jsr     ldaxidx
+	cmp     #$0C
+	txa
+	sbc     #$00
+	bvs     L0104
+	eor     #$80
+L0104:	bpl     L0105
+	lda     #<(L002A)
+	ldx     #>(L002A)
+	jmp     L0107
+L0105:	lda     #<(L002B)
+	ldx     #>(L002B)
+L0107:	sta     L004B
+	stx     L004B+1
+	jmp     L0062
+L010A:	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     pushax
+	lda     #<(L002C)
+	ldx     #>(L002C)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$0D
+	jsr     pushwidx
+	ldy     #$06
+	jsr     _sprintf
+	jmp     L0062
+L0110:	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     pushax
+	lda     #<(L002D)
+	ldx     #>(L002D)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$0B
+	jsr     ldaxidx
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$6C
+	clc
+	adc     ptr1
+	pha
+	lda     #$07
+	adc     ptr1+1
+	tax
+	pla
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$09
+	jsr     ldaxidx
+	jsr     incax1
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     pushwidx
+	ldy     #$0A
+	jsr     _sprintf
+	jmp     L0062
+L0118:	lda     #<(L004A)
+	ldx     #>(L004A)
+	jsr     pushax
+	lda     #<(L002E)
+	ldx     #>(L002E)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$0B
+	jsr     pushwidx
+	ldx     #$00
+	lda     #$64
+	jsr     tosmoda0
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	jmp     L0062
+L0136:	sty     L004A
+L0062:	lda     L004B
+	ldx     L004B+1
+	jsr     _strlen
+	sta     L0047
+	stx     L0047+1
+	clc
+	adc     L0046
+	sta     L0046
+	txa
+	adc     L0046+1
+	sta     L0046+1
+	lda     L0046
+	ldy     #$04
+	cmp     (sp),y
+	lda     L0046+1
+	iny
+	sbc     (sp),y
+	jcs     L004E
+	ldy     #$09
+	jsr     pushwysp
+	lda     L004B
+	ldx     L004B+1
+	jsr     pushax
+	lda     L0047
+	ldx     L0047+1
+	jsr     _memcpy
+	lda     L0047
+	ldx     L0047+1
+	ldy     #$06
+	jsr     addeqysp
+	jmp     L004E
+L005C:	ldy     #$07
+	jsr     ldaxysp
+	sta     regsave
+	stx     regsave+1
+	jsr     incax1
+	ldy     #$06
+	jsr     staxysp
+	lda     L0048
+	ldy     #$00
+	sta     (regsave),y
+	inc     L0046
+	jne     L004E
+	inc     L0046+1
+	jmp     L004E
+
+.endproc
+
@@ -0,0 +1,19 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.export		__longminstr
+
+.segment	"RODATA"
+
+__longminstr:
+	.byte	$2D,$32,$31,$34,$37,$34,$38,$33,$36,$34,$38,$00
+
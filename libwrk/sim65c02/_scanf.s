@@ -0,0 +1,1071 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_memset
+	.import		__setjmp
+	.import		_longjmp
+	.import		__seterrno
+	.import		_isdigit
+	.import		_isspace
+	.import		_isxdigit
+	.import		_tolower
+	.export		__scanf
+
+.segment	"RODATA"
+
+_Bits:
+	.byte	$01
+	.byte	$02
+	.byte	$04
+	.byte	$08
+	.byte	$10
+	.byte	$20
+	.byte	$40
+	.byte	$80
+
+.segment	"BSS"
+
+_format:
+	.res	2,$00
+_D_:
+	.res	2,$00
+_ap:
+	.res	2,$00
+_JumpBuf:
+	.res	5,$00
+_F:
+	.res	1,$00
+_CharCount:
+	.res	2,$00
+_C:
+	.res	2,$00
+_Width:
+	.res	2,$00
+_IntVal:
+	.res	4,$00
+_Assignments:
+	.res	2,$00
+_IntBytes:
+	.res	1,$00
+_Converted:
+	.res	1,$00
+_Positive:
+	.res	1,$00
+_NoAssign:
+	.res	1,$00
+_Invert:
+	.res	1,$00
+_CharSet:
+	.res	32,$00
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ _scanf (__near__ const struct scanfdata *, __near__ const unsigned char *, __near__ unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	__scanf: near
+
+.segment	"RODATA"
+
+L01B4:
+	.word	$0000
+L02BB:
+	.word	$0000
+L02CA:
+	.word	$0000
+L02D9:
+	.word	$0000
+
+.segment	"BSS"
+
+L0190:
+	.res	1,$00
+L0191:
+	.res	1,$00
+L0192:
+	.res	1,$00
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	sta     _D_
+	stx     _D_+1
+	ldy     #$05
+	jsr     ldaxysp
+	sta     _format
+	stx     _format+1
+	ldy     #$03
+	jsr     ldaxysp
+	sta     _ap
+	stx     _ap+1
+	stz     _Converted
+	stz     _Assignments
+	stz     _Assignments+1
+	stz     _CharCount
+	stz     _CharCount+1
+	lda     #<(_JumpBuf)
+	ldx     #>(_JumpBuf)
+	jsr     __setjmp
+	cmp     #$00
+	jne     L019F
+L01A2:	jsr     _ReadChar
+	jmp     L01FD
+L01A5:	lda     _F
+	cmp     #$25
+	beq     L01A9
+	ldx     #$00
+	jsr     _isspace
+	tax
+	beq     L01AB
+	jsr     _SkipWhite
+	jmp     L01FD
+L01AB:	lda     _C
+	ldx     _C+1
+	jsr     pushax
+	lda     _F
+	jsr     tosicmp0
+	beq     L01A2
+	jmp     L019F
+L01A9:	jsr     _GetFormat
+	cmp     #$25
+	beq     L01AB
+	lda     _F
+	cmp     #$2A
+	jsr     booleq
+	sta     _NoAssign
+	lda     _NoAssign
+	beq     L01BD
+	jsr     _GetFormat
+L01BD:	lda     #$FF
+	sta     _Width
+	sta     _Width+1
+	lda     _F
+	ldx     #$00
+	jsr     _isdigit
+	sta     L0190
+	lda     L0190
+	beq     L01CA
+	stz     _Width
+	stz     _Width+1
+L01C9:	lda     _Width
+	ldx     _Width+1
+	jsr     mulax10
+	sta     ptr1
+	lda     _F
+	and     #$0F
+	clc
+	adc     ptr1
+	bcc     L0334
+	inx
+L0334:	sta     _Width
+	stx     _Width+1
+	jsr     _GetFormat
+	ldx     #$00
+	jsr     _isdigit
+	tax
+	bne     L01C9
+L01CA:	lda     _Width
+	ora     _Width+1
+	bne     L01D1
+	lda     #$07
+	jsr     __seterrno
+	jmp     L033B
+L01D1:	lda     _Width
+	ldx     _Width+1
+	jsr     complax
+	sta     _Width
+	stx     _Width+1
+	lda     #$01
+	sta     _IntBytes
+	lda     _F
+	cmp     #$4C
+	beq     L01F5
+	cmp     #$68
+	beq     L01E2
+	cmp     #$6A
+	beq     L0321
+	cmp     #$6C
+	beq     L01EB
+	cmp     #$74
+	beq     L01F5
+	cmp     #$7A
+	beq     L01F5
+	bra     L0322
+L01E2:	lda     _format+1
+	sta     ptr1+1
+	lda     _format
+	sta     ptr1
+	lda     (ptr1)
+	cmp     #$68
+	bne     L01F5
+	stz     _IntBytes
+	inc     _format
+	bne     L01F5
+	inc     _format+1
+	bra     L01F5
+L01EB:	lda     _format+1
+	sta     ptr1+1
+	lda     _format
+	sta     ptr1
+	lda     (ptr1)
+	cmp     #$6C
+	bne     L0321
+	inc     _format
+	bne     L0321
+	inc     _format+1
+L0321:	lda     #$03
+	sta     _IntBytes
+L01F5:	jsr     _GetFormat
+L0322:	lda     _F
+	cmp     #$41
+	jeq     L02EF
+	cmp     #$43
+	jeq     L02EF
+	cmp     #$45
+	jeq     L02EF
+	cmp     #$46
+	jeq     L02EF
+	cmp     #$47
+	jeq     L02EF
+	cmp     #$53
+	jeq     L02EF
+	cmp     #$58
+	beq     L020D
+	cmp     #$5B
+	jeq     L025F
+	cmp     #$61
+	jeq     L02EF
+	cmp     #$63
+	jeq     L0327
+	cmp     #$64
+	beq     L01FF
+	cmp     #$65
+	jeq     L02EF
+	cmp     #$66
+	jeq     L02EF
+	cmp     #$67
+	jeq     L02EF
+	cmp     #$69
+	beq     L0205
+	cmp     #$6E
+	jeq     L02DF
+	cmp     #$6F
+	beq     L0209
+	cmp     #$70
+	jeq     L02C3
+	cmp     #$73
+	beq     L0213
+	cmp     #$75
+	beq     L01FF
+	cmp     #$78
+	beq     L020D
+	jmp     L0308
+L01FF:	lda     #$0A
+	jsr     _ScanInt
+	jmp     L01FD
+L0205:	lda     #$00
+	jsr     _ScanInt
+	jmp     L01FD
+L0209:	lda     #$08
+	jsr     _ScanInt
+	jmp     L01FD
+L020D:	lda     #$10
+	jsr     _ScanInt
+	jmp     L01FD
+L0213:	jsr     _SkipWhite
+	jsr     _CheckEnd
+	lda     #$01
+	sta     _Converted
+	lda     _NoAssign
+	bne     L0224
+	lda     _ap
+	sec
+	sbc     #$02
+	sta     _ap
+	bcs     L0221
+	dec     _ap+1
+L0221:	ldx     _ap+1
+	jsr     ldaxi
+	sta     regbank+4
+	stx     regbank+4+1
+	bra     L0224
+L0323:	lda     _NoAssign
+	bne     L022B
+	lda     regbank+4
+	ldx     regbank+4+1
+	sta     regsave
+	stx     regsave+1
+	ina
+	bne     L022E
+	inx
+L022E:	sta     regbank+4
+	stx     regbank+4+1
+	lda     _C
+	sta     (regsave)
+L022B:	jsr     _ReadChar
+L0224:	lda     _C+1
+	cmp     #$FF
+	bne     L0335
+	lda     _C
+	cmp     #$FF
+	beq     L0326
+L0335:	lda     _C
+	ldx     _C+1
+	jsr     _isspace
+	cmp     #$00
+	bne     L0326
+	inc     _Width
+	bne     L0229
+	inc     _Width+1
+L0229:	lda     _Width
+	ora     _Width+1
+	bne     L0323
+L0326:	lda     _NoAssign
+	jne     L01FD
+	sta     (regbank+4)
+	inc     _Assignments
+	jne     L01FD
+	inc     _Assignments+1
+	jmp     L01FD
+L0327:	lda     L0190
+	bne     L0239
+	ldx     #$FF
+	lda     #$FE
+	sta     _Width
+	stx     _Width+1
+L0239:	jsr     _CheckEnd
+	lda     #$01
+	sta     _Converted
+	lda     _NoAssign
+	bne     L0259
+	lda     _ap
+	sec
+	sbc     #$02
+	sta     _ap
+	bcs     L0249
+	dec     _ap+1
+L0249:	ldx     _ap+1
+	jsr     ldaxi
+	sta     regbank+4
+	stx     regbank+4+1
+	bra     L024C
+L024A:	jsr     _CheckEnd
+	lda     regbank+4
+	ldx     regbank+4+1
+	sta     regsave
+	stx     regsave+1
+	ina
+	bne     L0251
+	inx
+L0251:	sta     regbank+4
+	stx     regbank+4+1
+	lda     _C
+	sta     (regsave)
+	jsr     _ReadChar
+L024C:	inc     _Width
+	bne     L024E
+	inc     _Width+1
+L024E:	lda     _Width
+	ora     _Width+1
+	bne     L024A
+	inc     _Assignments
+	jne     L01FD
+	inc     _Assignments+1
+	jmp     L01FD
+L0257:	jsr     _CheckEnd
+	jsr     _ReadChar
+L0259:	inc     _Width
+	bne     L025B
+	inc     _Width+1
+L025B:	lda     _Width
+	ora     _Width+1
+	bne     L0257
+	jmp     L01FD
+L025F:	lda     #>(_CharSet)
+	sta     ptr1+1
+	lda     #<(_CharSet)
+	sta     ptr1
+	lda     #$00
+	ldy     #$1F
+L031A:	sta     (ptr1),y
+	dey
+	bpl     L031A
+	jsr     _GetFormat
+	cmp     #$5E
+	jsr     booleq
+	sta     _Invert
+	lda     _Invert
+	beq     L0328
+	jsr     _GetFormat
+L0328:	lda     _F
+	cmp     #$5D
+	bne     L0329
+	bra     L0337
+L0270:	lda     _format+1
+	sta     ptr1+1
+	lda     _format
+	sta     ptr1
+	lda     (ptr1)
+	cmp     #$2D
+	bne     L0276
+	lda     _F
+	sta     L0192
+	inc     _format
+	bne     L027B
+	inc     _format+1
+L027B:	jsr     _GetFormat
+	cmp     #$00
+	beq     L0280
+	cmp     #$5D
+	bne     L0288
+L0280:	lda     L0192
+	jsr     _AddCharToSet
+	lda     #$2D
+	jsr     _AddCharToSet
+	bra     L0329
+L0288:	lda     L0192
+	jsr     _AddCharToSet
+	lda     _F
+	cmp     L0192
+	beq     L0320
+	inc     L0192
+	bra     L0288
+L0276:	lda     _F
+L0337:	jsr     _AddCharToSet
+L0320:	jsr     _GetFormat
+L0329:	lda     _F
+	beq     L032D
+	cmp     #$5D
+	bne     L0270
+L032D:	lda     _F
+	bne     L0296
+	lda     _format
+	sec
+	sbc     #$01
+	sta     _format
+	bcs     L0296
+	dec     _format+1
+L0296:	lda     _Invert
+	beq     L0338
+	jsr     _InvertCharSet
+L0338:	stz     L0191
+	lda     _NoAssign
+	bne     L02AB
+	lda     _ap
+	sec
+	sbc     #$02
+	sta     _ap
+	bcs     L02A8
+	dec     _ap+1
+L02A8:	ldx     _ap+1
+	jsr     ldaxi
+	sta     regbank+4
+	stx     regbank+4+1
+	bra     L02AB
+L032E:	lda     _NoAssign
+	bne     L032F
+	lda     regbank+4
+	ldx     regbank+4+1
+	sta     regsave
+	stx     regsave+1
+	ina
+	bne     L02B3
+	inx
+L02B3:	sta     regbank+4
+	stx     regbank+4+1
+	lda     _C
+	sta     (regsave)
+L032F:	lda     #$01
+	sta     _Converted
+	sta     L0191
+	jsr     _ReadChar
+L02AB:	jsr     _IsCharInSet
+	tax
+	beq     L0332
+	inc     _Width
+	bne     L02AE
+	inc     _Width+1
+L02AE:	lda     _Width
+	ora     _Width+1
+	bne     L032E
+L0332:	lda     L0191
+	jeq     L019F
+	lda     _NoAssign
+	jne     L01FD
+	sta     (regbank+4)
+	inc     _Assignments
+	jne     L01FD
+	inc     _Assignments+1
+	jmp     L01FD
+L02C3:	jsr     _SkipWhite
+	lda     _C
+	cmp     #$30
+	jne     L019F
+	lda     #$01
+	sta     _Converted
+	jsr     _ReadChar
+	lda     _C
+	cmp     #$58
+	beq     L02D3
+	cmp     #$78
+	bne     L019F
+L02D3:	jsr     _ReadChar
+	lda     #$10
+	jsr     _ReadInt
+	jsr     _AssignInt
+	bra     L01FD
+L02DF:	lda     _CharCount
+	ldx     _CharCount+1
+	jsr     pushax
+	lda     _C+1
+	cmp     #$FF
+	bne     L02E5
+	lda     _C
+	cmp     #$FF
+	bne     L02E5
+	ina
+	bra     L02E7
+L02E5:	lda     #$01
+L02E7:	jsr     tossuba0
+	jsr     axulong
+	sta     _IntVal
+	stx     _IntVal+1
+	ldy     sreg
+	sty     _IntVal+2
+	ldy     sreg+1
+	sty     _IntVal+3
+	jsr     _AssignInt
+	lda     _NoAssign
+	bne     L01FD
+	lda     _Assignments
+	sec
+	sbc     #$01
+	sta     _Assignments
+	bcs     L01FD
+	dec     _Assignments+1
+	bra     L01FD
+L02EF:	lda     #$0D
+	jsr     __seterrno
+	bra     L033B
+L0308:	lda     #$07
+	jsr     __seterrno
+	bra     L033B
+L01FD:	jsr     _GetFormat
+	tax
+	jne     L01A5
+	bra     L0311
+L019F:	lda     _C+1
+	cmp     #$FF
+	bne     L0311
+	lda     _C
+	cmp     #$FF
+	bne     L0311
+	lda     _Converted
+	bne     L0311
+L033B:	lda     #$FF
+	sta     _Assignments
+	sta     _Assignments+1
+L0311:	jsr     _PushBack
+	lda     _Assignments
+	ldx     _Assignments+1
+	pha
+	lda     (sp)
+	sta     regbank+4
+	ldy     #$01
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ FindBit (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_FindBit: near
+
+.segment	"CODE"
+
+	pha
+	lsr     a
+	lsr     a
+	lsr     a
+	tax
+	pla
+	and     #$07
+	tay
+	lda     _Bits,y
+	jmp     L000F
+L000F:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ AddCharToSet (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AddCharToSet: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jsr     _FindBit
+	ora     _CharSet,x
+	sta     _CharSet,x
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ IsCharInSet (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_IsCharInSet: near
+
+.segment	"CODE"
+
+	lda     #$00
+	ldx     _C+1
+	bne     L1
+	lda     _C
+	jsr     _FindBit
+	and     _CharSet,x
+L1:	ldx     #$00
+	jmp     L002C
+L002C:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ InvertCharSet (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_InvertCharSet: near
+
+.segment	"CODE"
+
+	ldy     #$1F
+L1:	lda     _CharSet,y
+	eor     #$FF
+	sta     _CharSet,y
+	dey
+	bpl     L1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ PushBack (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_PushBack: near
+
+.segment	"CODE"
+
+	ldx     _C+1
+	bne     L0068
+	lda     _C
+	jsr     pusha0
+	lda     _D_+1
+	sta     ptr1+1
+	lda     _D_
+	sta     ptr1
+	ldy     #$02
+	lda     (ptr1),y
+	sta     jmpvec+1
+	iny
+	lda     (ptr1),y
+	sta     jmpvec+2
+	ldy     #$05
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     jmpvec
+	lda     _CharCount
+	bne     L0084
+	dec     _CharCount+1
+L0084:	dec     _CharCount
+L0068:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ ReadChar (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ReadChar: near
+
+.segment	"CODE"
+
+	lda     _D_+1
+	sta     ptr1+1
+	lda     _D_
+	sta     ptr1
+	lda     (ptr1)
+	sta     jmpvec+1
+	ldy     #$01
+	lda     (ptr1),y
+	sta     jmpvec+2
+	ldy     #$05
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     jmpvec
+	sta     _C
+	stx     _C+1
+	inx
+	beq     L00BC
+	inc     _CharCount
+	bne     L00BC
+	inc     _CharCount+1
+L00BC:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ Error (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Error: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	pha
+	lda     #<(_JumpBuf)
+	ldx     #>(_JumpBuf)
+	jsr     pushax
+	pla
+	ldx     #>$0000
+	jmp     _longjmp
+	jsr     incsp1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ CheckEnd (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_CheckEnd: near
+
+.segment	"CODE"
+
+	ldx     _C+1
+	beq     L00D7
+	lda     #$02
+	jmp     _Error
+L00D7:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ SkipWhite (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_SkipWhite: near
+
+.segment	"CODE"
+
+	bra     L00DF
+L00DD:	jsr     _ReadChar
+L00DF:	lda     _C
+	ldx     _C+1
+	jsr     _isspace
+	tax
+	bne     L00DD
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ ReadSign (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ReadSign: near
+
+.segment	"CODE"
+
+	lda     _C
+	cmp     #'-'
+	bne     L00F5
+	sta     _Converted
+	jsr     _ReadChar
+	lda     #$00
+	beq     L00FB
+L00F5:	cmp     #'+'
+	bne     L0100
+	sta     _Converted
+	jsr     _ReadChar
+L0100:	lda     #$01
+L00FB:	sta     _Positive
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ __fastcall__ HexVal (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_HexVal: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	lda     (sp)
+	ldx     #$00
+	jsr     _isdigit
+	beq     L010C
+	ldx     #$00
+	lda     (sp)
+	ldy     #$30
+	bra     L033C
+L010C:	lda     (sp)
+	ldx     #$00
+	jsr     _tolower
+	ldx     #$00
+	ldy     #$57
+L033C:	jsr     decaxy
+	ldx     #$00
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ ReadInt (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ReadInt: near
+
+.segment	"BSS"
+
+L0113:
+	.res	1,$00
+L0114:
+	.res	1,$00
+
+.segment	"CODE"
+
+	jsr     pusha
+	stz     L0114
+	stz     _IntVal
+	stz     _IntVal+1
+	stz     _IntVal+2
+	stz     _IntVal+3
+	bra     L011A
+L033E:	inc     L0114
+	lda     _IntVal+3
+	sta     sreg+1
+	lda     _IntVal+2
+	sta     sreg
+	ldx     _IntVal+1
+	lda     _IntVal
+	jsr     pusheax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	jsr     aulong
+	jsr     axulong
+	jsr     tosmuleax
+	jsr     pusheax
+	ldx     #$00
+	lda     L0113
+	jsr     aulong
+	jsr     axulong
+	jsr     tosaddeax
+	sta     _IntVal
+	stx     _IntVal+1
+	ldy     sreg
+	sty     _IntVal+2
+	ldy     sreg+1
+	sty     _IntVal+3
+	jsr     _ReadChar
+L011A:	lda     _C
+	ldx     _C+1
+	jsr     _isxdigit
+	tax
+	beq     L0341
+	inc     _Width
+	bne     L011E
+	inc     _Width+1
+L011E:	lda     _Width
+	ora     _Width+1
+	beq     L0341
+	lda     _C
+	jsr     _HexVal
+	sta     L0113
+	cmp     (sp)
+	txa
+	sbc     #$00
+	bcc     L033E
+L0341:	lda     L0114
+	bne     L0342
+	ina
+	jsr     _Error
+L0342:	lda     #$01
+	sta     _Converted
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ AssignInt (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AssignInt: near
+
+.segment	"CODE"
+
+	lda     _NoAssign
+	bne     L014F
+	lda     _ap
+	sec
+	sbc     #$02
+	sta     _ap
+	bcs     L0142
+	dec     _ap+1
+L0142:	ldx     _ap+1
+	jsr     ldaxi
+	sta     ptr1
+	stx     ptr1+1
+	ldy     _IntBytes
+L0146:	lda     _IntVal,y
+	sta     (ptr1),y
+	dey
+	bpl     L0146
+	inc     _Assignments
+	bne     L014F
+	inc     _Assignments+1
+L014F:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ ScanInt (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ScanInt: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jsr     _SkipWhite
+	jsr     _ReadSign
+	lda     (sp)
+	bne     L0346
+	lda     _C
+	cmp     #$30
+	bne     L0345
+	jsr     _ReadChar
+	lda     _C
+	cmp     #$58
+	beq     L0343
+	cmp     #$78
+	bne     L0344
+L0343:	lda     #$10
+	sta     (sp)
+	lda     #$01
+	sta     _Converted
+	jsr     _ReadChar
+	bra     L0346
+L0344:	lda     #$08
+	sta     (sp)
+	jsr     _PushBack
+	lda     #$30
+	sta     _C
+	stz     _C+1
+	bra     L0346
+L0345:	lda     #$0A
+	sta     (sp)
+L0346:	lda     (sp)
+	jsr     _ReadInt
+	lda     _Positive
+	bne     L0178
+	lda     _IntVal+3
+	sta     sreg+1
+	lda     _IntVal+2
+	sta     sreg
+	ldx     _IntVal+1
+	lda     _IntVal
+	jsr     negeax
+	sta     _IntVal
+	stx     _IntVal+1
+	ldy     sreg
+	sty     _IntVal+2
+	ldy     sreg+1
+	sty     _IntVal+3
+L0178:	jsr     _AssignInt
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ GetFormat (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_GetFormat: near
+
+.segment	"CODE"
+
+	lda     _format+1
+	sta     regsave+1
+	lda     _format
+	sta     regsave
+	inc     _format
+	bne     L0188
+	inc     _format+1
+L0188:	lda     (regsave)
+	ldx     #>$0000
+	sta     _F
+	rts
+
+.endproc
+
@@ -0,0 +1,89 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.export		_fseek
+	.import		__seterrno
+	.import		_lseek
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ fseek (register __near__ struct _FILE *, long, int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fseek: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$06
+	ldx     #$04
+	jsr     regswap2
+	jsr     decsp4
+	ldy     #$01
+	lda     (regbank+4),y
+	and     #$01
+	bne     L0022
+	lda     #$07
+	jsr     __seterrno
+	bra     L0026
+L0022:	lda     (regbank+4),y
+	and     #$08
+	beq     L000A
+	ldy     #$04
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L000A
+	tax
+	stz     sreg
+	stz     sreg+1
+	ina
+	iny
+	jsr     lsubeqysp
+L000A:	lda     (regbank+4)
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     _lseek
+	jsr     steax0sp
+	jsr     ldeax0sp
+	lda     sreg+1
+	bmi     L0016
+	ldy     #$01
+	lda     (regbank+4),y
+	and     #$F5
+	sta     (regbank+4),y
+	ldx     #$00
+	bra     L0027
+L0016:	ldy     #$01
+	lda     (regbank+4),y
+	ora     #$04
+	sta     (regbank+4),y
+L0026:	ldx     #$FF
+L0027:	txa
+	pha
+	ldy     #$0A
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	iny
+	jmp     addysp
+
+.endproc
+
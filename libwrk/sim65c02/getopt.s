@@ -0,0 +1,287 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_stderr
+	.import		_fputc
+	.import		_fputs
+	.import		_strchr
+	.export		_optarg
+	.export		_optind
+	.export		_opterr
+	.export		_optopt
+	.export		_getopt
+
+.segment	"DATA"
+
+_opterr:
+	.word	$0001
+_optind:
+	.word	$0001
+
+.segment	"RODATA"
+
+L0007:
+	.byte	$3A,$20,$6F,$70,$74,$69,$6F,$6E,$20,$72,$65,$71,$75,$69,$72,$65
+	.byte	$73,$20,$61,$6E,$20,$61,$72,$67,$75,$6D,$65,$6E,$74,$20,$2D,$2D
+	.byte	$20,$00
+L0005:
+	.byte	$3A,$20,$69,$6C,$6C,$65,$67,$61,$6C,$20,$6F,$70,$74,$69,$6F,$6E
+	.byte	$20,$2D,$2D,$20,$00
+L0006	:=	L0007+33
+L0008	:=	L0007+33
+L0004	:=	L0007+33
+
+.segment	"BSS"
+
+_optarg:
+	.res	2,$00
+_optopt:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ getopt (int, __near__ const __near__ unsigned char * *, __near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_getopt: near
+
+.segment	"DATA"
+
+L0009:
+	.addr	L0004
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	lda     L0009+1
+	sta     ptr1+1
+	lda     L0009
+	sta     ptr1
+	lda     (ptr1)
+	bne     L0016
+	lda     _optind
+	ldx     _optind+1
+	ldy     #$06
+	cmp     (sp),y
+	txa
+	iny
+	sbc     (sp),y
+	bvs     L0065
+	eor     #$80
+L0065:	bmi     L0068
+	lda     _optind
+	jsr     aslax1
+	clc
+	ldy     #$04
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	jsr     ldaxi
+	sta     L0009
+	stx     L0009+1
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	cmp     #$2D
+	bne     L0068
+	inc     L0009
+	bne     L0012
+	inc     L0009+1
+L0012:	lda     L0009+1
+	sta     ptr1+1
+	lda     L0009
+	sta     ptr1
+	lda     (ptr1)
+	bne     L000D
+L0068:	ldx     #$FF
+	txa
+	jmp     L0003
+L000D:	lda     L0009+1
+	sta     ptr1+1
+	lda     L0009
+	sta     ptr1
+	lda     (ptr1)
+	cmp     #$2D
+	bne     L0016
+	inc     _optind
+	bne     L0019
+	inc     _optind+1
+L0019:	ldx     #$FF
+	txa
+	jmp     L0003
+L0016:	lda     L0009
+	ldx     L0009+1
+	sta     regsave
+	stx     regsave+1
+	ina
+	bne     L0020
+	inx
+L0020:	sta     L0009
+	stx     L0009+1
+	stz     _optopt+1
+	lda     (regsave)
+	sta     _optopt
+	cmp     #$3A
+	beq     L0069
+	ldy     #$05
+	jsr     pushwysp
+	lda     _optopt
+	ldx     _optopt+1
+	jsr     _strchr
+	sta     regbank+4
+	stx     regbank+4+1
+	jsr     bnegax
+	beq     L001C
+L0069:	lda     L0009+1
+	sta     ptr1+1
+	lda     L0009
+	sta     ptr1
+	lda     (ptr1)
+	bne     L0027
+	inc     _optind
+	bne     L0027
+	inc     _optind+1
+L0027:	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushw
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     _fputs
+	lda     #<(L0005)
+	ldx     #>(L0005)
+	jsr     pushax
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     _fputs
+	lda     _optopt
+	ldx     _optopt+1
+	jsr     pushax
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     _fputc
+	lda     #$0A
+	jsr     pusha0
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     _fputc
+	ldx     #$00
+	lda     #$3F
+	jmp     L0003
+L001C:	inc     regbank+4
+	bne     L003B
+	inc     regbank+4+1
+L003B:	lda     (regbank+4)
+	cmp     #$3A
+	beq     L0039
+	stz     _optarg
+	stz     _optarg+1
+	lda     L0009+1
+	sta     ptr1+1
+	lda     L0009
+	sta     ptr1
+	lda     (ptr1)
+	jne     L0042
+	jmp     L006C
+L0039:	lda     L0009+1
+	sta     ptr1+1
+	lda     L0009
+	sta     ptr1
+	lda     (ptr1)
+	beq     L0043
+	lda     L0009+1
+	sta     _optarg+1
+	lda     L0009
+	sta     _optarg
+	jmp     L005B
+L0043:	ldy     #$09
+	jsr     pushwysp
+	inc     _optind
+	bne     L004A
+	inc     _optind+1
+L004A:	lda     _optind
+	ldx     _optind+1
+	jsr     tosicmp
+	beq     L0067
+	bpl     L0048
+L0067:	lda     #>(L0006)
+	sta     L0009+1
+	lda     #<(L0006)
+	sta     L0009
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushw
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     _fputs
+	lda     #<(L0007)
+	ldx     #>(L0007)
+	jsr     pushax
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     _fputs
+	lda     _optopt
+	ldx     _optopt+1
+	jsr     pushax
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     _fputc
+	lda     #$0A
+	jsr     pusha0
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     _fputc
+	ldx     #$00
+	lda     #$3F
+	bra     L0003
+L0048:	lda     _optind
+	ldx     _optind+1
+	jsr     aslax1
+	clc
+	ldy     #$04
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	jsr     ldaxi
+	sta     _optarg
+	stx     _optarg+1
+L005B:	lda     #>(L0008)
+	sta     L0009+1
+	lda     #<(L0008)
+	sta     L0009
+L006C:	inc     _optind
+	bne     L0042
+	inc     _optind+1
+L0042:	lda     _optopt
+	ldx     _optopt+1
+L0003:	pha
+	lda     (sp)
+	sta     regbank+4
+	ldy     #$01
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp8
+
+.endproc
+
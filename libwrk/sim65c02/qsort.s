@@ -0,0 +1,339 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.export		_qsort
+	.import		__swap
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ qsort (__near__ void *, unsigned int, unsigned int, __near__ __near__ __fastcall__ function returning int *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_qsort: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	cmp     #$02
+	txa
+	sbc     #$00
+	bcc     L0048
+	ldy     #$09
+	jsr     pushwysp
+	jsr     push0
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     decax1
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     tosumulax
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     _QuickSort
+L0048:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ QuickSort (register __near__ unsigned char *, int, int, register unsigned int, __near__ __near__ __fastcall__ function returning int *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_QuickSort: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$08
+	ldx     #$04
+	jsr     regswap2
+	ldy     #$02
+	ldx     #$02
+	jsr     regswap2
+	jsr     decsp4
+	jmp     L003E
+L0002:	ldy     #$0B
+	jsr     ldaxysp
+	clc
+	adc     regbank+2
+	pha
+	txa
+	adc     regbank+2+1
+	tax
+	pla
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     stax0sp
+	jmp     L0022
+L000E:	lda     regbank+2
+	ldx     regbank+2+1
+	ldy     #$02
+	jsr     addeqysp
+L0010:	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosicmp
+	beq     L0055
+	bpl     L001A
+L0055:	ldy     #$07
+	jsr     pushwysp
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosaddax
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     tosaddax
+	pha
+	ldy     #$02
+	lda     (sp),y
+	sta     jmpvec+1
+	iny
+	lda     (sp),y
+	sta     jmpvec+2
+	pla
+	jsr     jmpvec
+	jsr     incsp2
+	txa
+	bpl     L000E
+	bra     L001A
+L0018:	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     subeq0sp
+L001A:	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosicmp
+	beq     L0056
+	bpl     L0053
+L0056:	ldy     #$07
+	jsr     pushwysp
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosaddax
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosaddax
+	pha
+	ldy     #$02
+	lda     (sp),y
+	sta     jmpvec+1
+	iny
+	lda     (sp),y
+	sta     jmpvec+2
+	pla
+	jsr     jmpvec
+	jsr     incsp2
+	cpx     #$80
+	bcs     L0018
+L0053:	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosicmp
+	beq     L0057
+	bpl     L0022
+L0057:	ldy     #$03
+	jsr     ldaxysp
+	clc
+	adc     regbank+4
+	pha
+	txa
+	adc     regbank+4+1
+	tax
+	pla
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	clc
+	adc     regbank+4
+	pha
+	txa
+	adc     regbank+4+1
+	tax
+	pla
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     __swap
+	lda     regbank+2
+	ldx     regbank+2+1
+	ldy     #$02
+	jsr     addeqysp
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     subeq0sp
+L0022:	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosicmp
+	jmi     L0010
+	jeq     L0010
+	jsr     ldax0sp
+	ldy     #$0A
+	cmp     (sp),y
+	bne     L005A
+	txa
+	iny
+	cmp     (sp),y
+	beq     L002C
+L005A:	jsr     ldax0sp
+	clc
+	adc     regbank+4
+	pha
+	txa
+	adc     regbank+4+1
+	tax
+	pla
+	jsr     pushax
+	ldy     #$0D
+	jsr     ldaxysp
+	clc
+	adc     regbank+4
+	pha
+	txa
+	adc     regbank+4+1
+	tax
+	pla
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     __swap
+L002C:	jsr     ldax0sp
+	jsr     shlax1
+	jsr     pushax
+	ldy     #$0D
+	jsr     ldaxysp
+	clc
+	ldy     #$0A
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	jsr     tosicmp
+	bcc     L0032
+	beq     L0032
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	clc
+	adc     regbank+2
+	pha
+	txa
+	adc     regbank+2+1
+	tax
+	pla
+	jsr     pushax
+	ldy     #$0F
+	jsr     pushwysp
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     _QuickSort
+	jsr     ldax0sp
+	sec
+	sbc     regbank+2
+	pha
+	txa
+	sbc     regbank+2+1
+	tax
+	pla
+	ldy     #$08
+	bra     L0054
+L0032:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	ldy     #$0F
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	sec
+	sbc     regbank+2
+	pha
+	txa
+	sbc     regbank+2+1
+	tax
+	pla
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     _QuickSort
+	jsr     ldax0sp
+	clc
+	adc     regbank+2
+	pha
+	txa
+	adc     regbank+2+1
+	tax
+	pla
+	ldy     #$0A
+L0054:	jsr     staxysp
+L003E:	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     tosicmp
+	beq     L0058
+	jpl     L0002
+L0058:	ldy     #$0C
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	ldy     #$06
+	lda     (sp),y
+	sta     regbank+2
+	iny
+	lda     (sp),y
+	sta     regbank+3
+	ldy     #$0E
+	jmp     addysp
+
+.endproc
+
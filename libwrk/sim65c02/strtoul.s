@@ -0,0 +1,285 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_isdigit
+	.import		_islower
+	.import		_isspace
+	.import		_isupper
+	.import		__seterrno
+	.export		_strtoul
+
+; ---------------------------------------------------------------
+; unsigned long __near__ __fastcall__ strtoul (__near__ const unsigned char *, __near__ __near__ unsigned char * *, int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_strtoul: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	sta     regbank+4
+	stx     regbank+4+1
+	jsr     pushl0
+	jsr     pusha
+	jsr     pusha
+	jsr     push0
+	jsr     decsp6
+	bra     L0009
+L0007:	inc     regbank+4
+	bne     L0009
+	inc     regbank+4+1
+L0009:	lda     (regbank+4)
+	ldx     #$00
+	jsr     _isspace
+	stx     tmp1
+	ora     tmp1
+	bne     L0007
+	lda     (regbank+4)
+	cmp     #$2B
+	beq     L0016
+	cmp     #$2D
+	bne     L0010
+	lda     #$01
+	ldy     #$09
+	sta     (sp),y
+L0016:	inc     regbank+4
+	bne     L0010
+	inc     regbank+4+1
+L0010:	ldy     #$10
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0082
+	tax
+	lda     (regbank+4)
+	cmp     #$30
+	bne     L0081
+	inc     regbank+4
+	bne     L001F
+	inc     regbank+4+1
+L001F:	lda     (regbank+4)
+	cmp     #$78
+	beq     L007F
+	cmp     #$58
+	bne     L0080
+L007F:	inc     regbank+4
+	bne     L0024
+	inc     regbank+4+1
+L0024:	lda     #$10
+	bra     L0093
+L0080:	lda     #$08
+	dey
+	jsr     staxysp
+	bra     L002E
+L0081:	lda     #$0A
+L0093:	dey
+	jsr     staxysp
+	bra     L002E
+L0082:	lda     (sp),y
+	bne     L002E
+	dey
+	lda     (sp),y
+	cmp     #$10
+	bne     L002E
+	lda     (regbank+4)
+	cmp     #$30
+	bne     L002E
+	ldy     #$01
+	lda     (regbank+4),y
+	cmp     #$78
+	beq     L0087
+	cmp     #$58
+	bne     L002E
+L0087:	lda     #$02
+	clc
+	adc     regbank+4
+	sta     regbank+4
+	bcc     L002E
+	inc     regbank+4+1
+L002E:	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	ldy     #$15
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosumodeax
+	sta     (sp)
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	ldy     #$15
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosudiveax
+	ldy     #$01
+	jsr     steaxysp
+L003E:	lda     (regbank+4)
+	ldx     #$00
+	jsr     _isdigit
+	stx     tmp1
+	ora     tmp1
+	beq     L0042
+	ldx     #$00
+	lda     (regbank+4)
+	ldy     #$30
+	bra     L0098
+L0042:	lda     (regbank+4)
+	ldx     #$00
+	jsr     _isupper
+	stx     tmp1
+	ora     tmp1
+	beq     L0048
+	ldx     #$00
+	lda     (regbank+4)
+	ldy     #$37
+	bra     L0098
+L0048:	lda     (regbank+4)
+	ldx     #$00
+	jsr     _islower
+	stx     tmp1
+	ora     tmp1
+	jeq     L003F
+	ldx     #$00
+	lda     (regbank+4)
+	ldy     #$57
+L0098:	jsr     decaxy
+	ldy     #$05
+	sta     (sp),y
+	ldy     #$10
+	cmp     (sp),y
+	lda     #$00
+	iny
+	sbc     (sp),y
+	bcs     L003F
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$08
+	jsr     ldeaxysp
+	jsr     tosugteax
+	bne     L0059
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$08
+	jsr     ldeaxysp
+	jsr     toseqeax
+	beq     L0058
+	ldy     #$05
+	lda     (sp),y
+	sec
+	sbc     (sp)
+	sta     tmp1
+	lda     tmp1
+	beq     L0058
+	bcc     L0058
+L0059:	lda     #$01
+	ldy     #$08
+	sta     (sp),y
+L0058:	ldy     #$08
+	lda     (sp),y
+	bne     L0060
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$15
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosumuleax
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	jsr     axulong
+	jsr     tosaddeax
+	ldy     #$0A
+	jsr     steaxysp
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0060:	inc     regbank+4
+	jne     L003E
+	inc     regbank+4+1
+	jmp     L003E
+L003F:	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L006F
+	ldy     #$06
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L006A
+	ldy     #$13
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	lda     regbank+4
+	sta     (sreg)
+	ldy     #$01
+	lda     regbank+4+1
+	bra     L0095
+L006A:	ldy     #$13
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$15
+	jsr     ldaxysp
+	sta     (sreg)
+	ldy     #$01
+	txa
+L0095:	sta     (sreg),y
+L006F:	ldy     #$08
+	lda     (sp),y
+	beq     L0072
+	lda     #$0F
+	jsr     __seterrno
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	bra     L007A
+L0072:	iny
+	lda     (sp),y
+	beq     L0077
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     negeax
+	bra     L007A
+L0077:	ldy     #$0D
+	jsr     ldeaxysp
+L007A:	pha
+	ldy     #$0E
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	ldy     #$16
+	jmp     addysp
+
+.endproc
+
@@ -0,0 +1,194 @@
+;
+; File generated by cc65 v 2.18 - Git b995cb4
+;
+	.fopt		compiler,"cc65 v 2.18 - Git b995cb4"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_malloc
+	.import		_free
+	.import		_memcmp
+	.import		_open
+	.import		_close
+	.import		_read
+	.export		_tgi_load_vectorfont
+	.import		_tgi_error
+
+; ---------------------------------------------------------------
+; __near__ const struct tgi_vectorfont * __near__ __fastcall__ tgi_load_vectorfont (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_tgi_load_vectorfont: near
+
+.segment	"RODATA"
+
+L000B:
+	.byte	$54
+	.byte	$43
+	.byte	$48
+	.byte	$00
+L001A:
+	.word	$0000
+L0023:
+	.word	$0000
+L002B:
+	.word	$0000
+L0034:
+	.word	$0000
+L003C:
+	.word	$0000
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp8
+	jsr     push0
+	jsr     decsp3
+	lda     #$02
+	sta     _tgi_error
+	ldy     #$10
+	jsr     pushwysp
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _open
+	ldy     #$05
+	jsr     staxysp
+	cpx     #$80
+	jcs     L0019
+	ldy     #$08
+	jsr     pushwysp
+	lda     #$09
+	jsr     leaa0sp
+	jsr     pushax
+	ldx     #$00
+	lda     #$06
+	jsr     _read
+	cpx     #$00
+	jne     L0019
+	cmp     #$06
+	jne     L0019
+	ina
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #<(L000B)
+	ldx     #>(L000B)
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	jsr     _memcmp
+	cpx     #$00
+	jne     L0019
+	cmp     #$00
+	jne     L0019
+	ldy     #$0C
+	jsr     ldaxysp
+	jsr     _malloc
+	ldy     #$03
+	jsr     staxysp
+	cpx     #$00
+	bne     L002F
+	cmp     #$00
+	bne     L002F
+	lda     #$08
+	sta     _tgi_error
+	jmp     L0019
+L002F:	ldy     #$08
+	jsr     pushwysp
+	ldy     #$08
+	jsr     pushwysp
+	ldy     #$10
+	jsr     ldaxysp
+	jsr     _read
+	ldy     #$0B
+	cmp     (sp),y
+	bne     L005B
+	txa
+	iny
+	cmp     (sp),y
+	beq     L0035
+L005B:	ldy     #$04
+	jsr     ldaxysp
+	jsr     _free
+	bra     L0019
+L0035:	ldy     #$06
+	jsr     ldaxysp
+	jsr     _close
+	lda     #$20
+	clc
+	ldy     #$03
+	adc     (sp),y
+	pha
+	lda     #$01
+	iny
+	adc     (sp),y
+	tax
+	pla
+	ldy     #$01
+	jsr     staxysp
+	lda     #$00
+L0058:	sta     (sp)
+	cmp     #$5F
+	bcs     L005A
+	ldy     #$04
+	jsr     ldaxysp
+	ldy     #$62
+	jsr     incaxy
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (sp)
+	asl     a
+	bcc     L0059
+	inx
+	clc
+L0059:	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	jsr     pushax
+	jsr     ldaxi
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$04
+	jsr     ldaxysp
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$00
+	jsr     staxspidx
+	clc
+	lda     #$01
+	adc     (sp)
+	bra     L0058
+L005A:	stz     _tgi_error
+	ldy     #$04
+	jsr     ldaxysp
+	bra     L0009
+L0019:	ldy     #$06
+	jsr     ldaxysp
+	txa
+	bmi     L0051
+	ldy     #$06
+	jsr     ldaxysp
+	jsr     _close
+L0051:	ldx     #$00
+	txa
+L0009:	ldy     #$0F
+	jmp     addysp
+
+.endproc
+
@@ -120,84 +120,18 @@ void WriteData (FILE* F, const void* Data, unsigned Size)
 
 
 
-unsigned Read8 (FILE* F)
-/* Read an 8 bit value from the file */
-{
-    int C = getc (F);
-    if (C == EOF) {
-        Error ("Read error (file corrupt?)");
-    }
-    return C;
-}
-
-
-
-unsigned Read16 (FILE* F)
-/* Read a 16 bit value from the file */
-{
-    unsigned Lo = Read8 (F);
-    unsigned Hi = Read8 (F);
-    return (Hi << 8) | Lo;
-}
-
-
-
-unsigned long Read32 (FILE* F)
-/* Read a 32 bit value from the file */
-{
-    unsigned long Lo = Read16 (F);
-    unsigned long Hi = Read16 (F);
-    return (Hi << 16) | Lo;
-}
-
-
-
-unsigned long ReadVar (FILE* F)
-/* Read a variable size value from the file */
-{
-    /* The value was written to the file in 7 bit chunks LSB first. If there
-    ** are more bytes, bit 8 is set, otherwise it is clear.
-    */
-    unsigned char C;
-    unsigned long V = 0;
-    unsigned Shift = 0;
-    do {
-        /* Read one byte */
-        C = Read8 (F);
-        /* Encode it into the target value */
-        V |= ((unsigned long)(C & 0x7F)) << Shift;
-        /* Next value */
-        Shift += 7;
-    } while (C & 0x80);
-
-    /* Return the value read */
-    return V;
-}
-
-
-
-char* ReadStr (FILE* F)
+char* ReadStr (FileBuf* F)
 /* Read a string from the file (the memory will be malloc'ed) */
 {
-    /* Read the length */
-    unsigned Len = ReadVar (F);
+    /* Read the string */
+    StrBuf S;
+    unsigned Len = SB_GetLen (ReadStrBuf (F, &S));
 
-    /* Allocate memory and read the string itself */
-    char* S = xmalloc (Len + 1);
-    ReadData (F, S, Len);
+    /* Allocate memory and copy the string */
+    char* Str = xmalloc (Len + 1);
+    memcpy (Str, SB_GetConstBuf (&S), Len);
 
     /* Terminate the string and return it */
-    S [Len] = '\0';
-    return S;
-}
-
-
-
-void* ReadData (FILE* F, void* Data, unsigned Size)
-/* Read data from the file */
-{
-    if (fread (Data, 1, Size, F) != Size) {
-        Error ("Read error (file corrupt?)");
-    }
-    return Data;
+    Str [Len] = '\0';
+    return Str;
 }
@@ -40,6 +40,9 @@
 
 #include <stdio.h>
 
+/* common */
+#include "filebuf.h"
+
 
 
 /*****************************************************************************/
@@ -66,25 +69,9 @@ void WriteStr (FILE* F, const char* S);
 void WriteData (FILE* F, const void* Data, unsigned Size);
 /* Write data to the file */
 
-unsigned Read8 (FILE* F);
-/* Read an 8 bit value from the file */
-
-unsigned Read16 (FILE* F);
-/* Read a 16 bit value from the file */
-
-unsigned long Read32 (FILE* F);
-/* Read a 32 bit value from the file */
-
-unsigned long ReadVar (FILE* F);
-/* Read a variable size value from the file */
-
-char* ReadStr (FILE* F);
+char* ReadStr (FileBuf* F);
 /* Read a string from the file (the memory will be malloc'ed) */
 
-void* ReadData (FILE* F, void* Data, unsigned Size);
-/* Read data from the file */
-
-
 
 /* End of fileio.h */
 
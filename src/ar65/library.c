@@ -67,7 +67,7 @@ const char*             LibName = 0;
 static char*            NewLibName = 0;
 
 /* File descriptor for the library file */
-static FILE*            Lib = 0;
+static FileBuf*         Lib = 0;
 static FILE*            NewLib = 0;
 
 /* The library header */
@@ -90,7 +90,7 @@ static void ReadHeader (void)
 /* Read the header of a library file */
 {
     /* Seek to position zero */
-    fseek (Lib, 0, SEEK_SET);
+    FileSetPos (Lib, 0);
 
     /* Read the header fields, checking magic and version */
     Header.Magic   = Read32 (Lib);
@@ -129,7 +129,7 @@ static void ReadIndex (void)
     unsigned Count, I;
 
     /* Seek to the start of the index */
-    fseek (Lib, Header.IndexOffs, SEEK_SET);
+    FileSetPos (Lib, Header.IndexOffs);
 
     /* Read the object file count and calculate the cross ref size */
     Count = ReadVar (Lib);
@@ -224,7 +224,7 @@ void LibOpen (const char* Name, int MustExist, int NeedTemp)
     LibName = xstrdup (Name);
 
     /* Open the existing library for reading */
-    Lib = fopen (Name, "rb");
+    Lib = FB_Open (Name);
     if (Lib == 0) {
 
         /* File does not exist */
@@ -266,23 +266,16 @@ void LibOpen (const char* Name, int MustExist, int NeedTemp)
 
 
 
-unsigned long LibCopyTo (FILE* F, unsigned long Bytes)
+unsigned long LibCopyTo (FileBuf* F, unsigned long Bytes)
 /* Copy data from F to the temp library file, return the start position in
 ** the temporary library file.
 */
 {
-    unsigned char Buf [4096];
-
     /* Remember the position */
     unsigned long Pos = ftell (NewLib);
 
-    /* Copy loop */
-    while (Bytes) {
-        unsigned Count = (Bytes > sizeof (Buf))? sizeof (Buf) : Bytes;
-        ReadData (F, Buf, Count);
-        WriteData (NewLib, Buf, Count);
-        Bytes -= Count;
-    }
+    /* The data is in memory, so write it in one chunk */
+    WriteData (NewLib, ReadDataPtr (F, Bytes), Bytes);
 
     /* Return the start position */
     return Pos;
@@ -293,18 +286,11 @@ unsigned long LibCopyTo (FILE* F, unsigned long Bytes)
 void LibCopyFrom (unsigned long Pos, unsigned long Bytes, FILE* F)
 /* Copy data from the library file into another file */
 {
-    unsigned char Buf [4096];
-
     /* Seek to the correct position */
-    fseek (Lib, Pos, SEEK_SET);
-
-    /* Copy loop */
-    while (Bytes) {
-        unsigned Count = (Bytes > sizeof (Buf))? sizeof (Buf) : Bytes;
-        ReadData (Lib, Buf, Count);
-        WriteData (F, Buf, Count);
-        Bytes -= Count;
-    }
+    FileSetPos (Lib, Pos);
+
+    /* Write the data in one chunk */
+    WriteData (F, ReadDataPtr (Lib, Bytes), Bytes);
 }
 
 
@@ -344,6 +330,7 @@ void LibClose (void)
         unsigned I;
         unsigned char Buf [4096];
         size_t Count;
+        FILE* Out;
 
         /* Walk through the object file list, inserting exports into the
         ** export list checking for duplicates. Copy any data that is still
@@ -360,7 +347,7 @@ void LibClose (void)
             /* Copy data if needed */
             if ((O->Flags & OBJ_HAVEDATA) == 0) {
                 /* Data is still in the old library */
-                fseek (Lib, O->Start, SEEK_SET);
+                FileSetPos (Lib, O->Start);
                 O->Start = ftell (NewLib);
                 LibCopyTo (Lib, O->Size);
                 O->Flags |= OBJ_HAVEDATA;
@@ -373,14 +360,9 @@ void LibClose (void)
         /* Write the updated header */
         WriteHeader ();
 
-        /* Close the file */
-        if (Lib && fclose (Lib) != 0) {
-            Error ("Error closing library: %s", strerror (errno));
-        }
-
         /* Reopen the library and truncate it */
-        Lib = fopen (LibName, "wb");
-        if (Lib == 0) {
+        Out = fopen (LibName, "wb");
+        if (Out == 0) {
             Error ("Cannot open library '%s' for writing: %s",
                    LibName, strerror (errno));
         }
@@ -388,15 +370,18 @@ void LibClose (void)
         /* Copy the temporary library to the new one */
         fseek (NewLib, 0, SEEK_SET);
         while ((Count = fread (Buf, 1, sizeof (Buf), NewLib)) != 0) {
-            if (fwrite (Buf, 1, Count, Lib) != Count) {
+            if (fwrite (Buf, 1, Count, Out) != Count) {
                 Error ("Cannot write to '%s': %s", LibName, strerror (errno));
             }
         }
+        if (fclose (Out) != 0) {
+            Error ("Problem closing '%s': %s", LibName, strerror (errno));
+        }
     }
 
-    /* Close both files */
-    if (Lib && fclose (Lib) != 0) {
-        Error ("Problem closing '%s': %s", LibName, strerror (errno));
+    /* Close both files. The old library is in memory, so no error check */
+    if (Lib) {
+        FB_Close (Lib);
     }
     if (NewLib && fclose (NewLib) != 0) {
         Error ("Problem closing temporary library file: %s", strerror (errno));
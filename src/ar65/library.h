@@ -40,6 +40,9 @@
 
 #include <stdio.h>
 
+/* common */
+#include "filebuf.h"
+
 
 
 /*****************************************************************************/
@@ -65,7 +68,7 @@ void LibOpen (const char* Name, int MustExist, int NeedTemp);
 ** is created.
 */
 
-unsigned long LibCopyTo (FILE* F, unsigned long Bytes);
+unsigned long LibCopyTo (FileBuf* F, unsigned long Bytes);
 /* Copy data from F to the temp library file, return the start position in
 ** the temporary library file.
 */
@@ -77,7 +77,7 @@ static const char* GetModule (const char* Name)
 
 
 
-static void ObjReadHeader (FILE* Obj, ObjHeader* H, const char* Name)
+static void ObjReadHeader (FileBuf* Obj, ObjHeader* H, const char* Name)
 /* Read the header of the object file checking the signature */
 {
     H->Magic      = Read32 (Obj);
@@ -115,7 +115,7 @@ static void ObjReadHeader (FILE* Obj, ObjHeader* H, const char* Name)
 
 
 
-static void SkipExpr (FILE* F)
+static void SkipExpr (FileBuf* F)
 /* Skip an expression in F */
 {
     /* Get the operation and skip it */
@@ -152,7 +152,7 @@ static void SkipExpr (FILE* F)
 
 
 
-static void SkipLineInfoList (FILE* F)
+static void SkipLineInfoList (FileBuf* F)
 /* Skip a list of line infos in F */
 {
     /* Number of indices preceeds the list */
@@ -166,7 +166,7 @@ static void SkipLineInfoList (FILE* F)
 
 
 
-void ObjReadData (FILE* F, ObjData* O)
+void ObjReadData (FileBuf* F, ObjData* O)
 /* Read object file data from the given file. The function expects the Name
 ** and Start fields to be valid. Header and basic data are read.
 */
@@ -174,13 +174,13 @@ void ObjReadData (FILE* F, ObjData* O)
     unsigned long Count;
 
     /* Seek to the start of the object file data */
-    fseek (F, O->Start, SEEK_SET);
+    FileSetPos (F, O->Start);
 
     /* Read the object file header */
     ObjReadHeader (F, &O->Header, O->Name);
 
     /* Read the string pool */
-    fseek (F, O->Start + O->Header.StrPoolOffs, SEEK_SET);
+    FileSetPos (F, O->Start + O->Header.StrPoolOffs);
     Count = ReadVar (F);
     CollGrow (&O->Strings, Count);
     while (Count--) {
@@ -188,7 +188,7 @@ void ObjReadData (FILE* F, ObjData* O)
     }
 
     /* Read the exports */
-    fseek (F, O->Start + O->Header.ExportOffs, SEEK_SET);
+    FileSetPos (F, O->Start + O->Header.ExportOffs);
     Count = ReadVar (F);
     CollGrow (&O->Exports, Count);
     while (Count--) {
@@ -234,7 +234,7 @@ void ObjAdd (const char* Name)
     ObjData* O;
 
     /* Open the object file */
-    FILE* Obj = fopen (Name, "rb");
+    FileBuf* Obj = FB_Open (Name);
     if (Obj == 0) {
         Error ("Could not open '%s': %s", Name, strerror (errno));
     }
@@ -281,9 +281,8 @@ void ObjAdd (const char* Name)
     O->MTime    = (unsigned long) StatBuf.st_mtime;
     O->Start    = 0;
 
-    /* Determine the file size. Note: Race condition here */
-    fseek (Obj, 0, SEEK_END);
-    O->Size     = ftell (Obj);
+    /* The size of the file is known, since it was read into memory */
+    O->Size     = Obj->Size;
 
     /* Read the basic data from the object file */
     ObjReadData (Obj, O);
@@ -291,11 +290,11 @@ void ObjAdd (const char* Name)
     /* Copy the complete object data to the library file and update the
     ** starting offset
     */
-    fseek (Obj, 0, SEEK_SET);
+    FileSetPos (Obj, 0);
     O->Start    = LibCopyTo (Obj, O->Size);
 
-    /* Done, close the file (we read it only, so no error check) */
-    fclose (Obj);
+    /* Done, close the file */
+    FB_Close (Obj);
 }
 
 
@@ -40,6 +40,9 @@
 
 #include <stdio.h>
 
+/* common */
+#include "filebuf.h"
+
 
 
 /*****************************************************************************/
@@ -58,7 +61,7 @@ struct ObjData;
 
 
 
-void ObjReadData (FILE* F, struct ObjData* O);
+void ObjReadData (FileBuf* F, struct ObjData* O);
 /* Read object file data from the given file. The function expects the Name
 ** and Start fields to be valid. Header and basic data are read.
 */
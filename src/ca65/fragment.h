@@ -53,6 +53,13 @@
 
 
 
+/* Literal data that is stored outside of the fragment. This type is used
+** internally by the assembler only, it is written as FRAG_LITERAL.
+*/
+#define FRAG_BINARY     0x40
+
+
+
 typedef struct Fragment Fragment;
 struct Fragment {
     Fragment*           Next;       /* Pointer to next fragment in segment */
@@ -63,6 +70,7 @@ struct Fragment {
     union {
         unsigned char   Data[sizeof (ExprNode*)];       /* Literal values */
         ExprNode*       Expr;                           /* Expression */
+        const unsigned char* Bin;                       /* FRAG_BINARY data */
     } V;
 };
 
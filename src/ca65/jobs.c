@@ -0,0 +1,142 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  jobs.c                                   */
+/*                                                                           */
+/*              Parallel assembly of several files for ca65                  */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#if !defined(_WIN32)
+#  include <unistd.h>
+#  include <sys/types.h>
+#  include <sys/wait.h>
+#endif
+
+/* common */
+#include "abend.h"
+#include "attrib.h"
+
+/* ca65 */
+#include "jobs.h"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+#if defined(_WIN32)
+
+
+
+int RunJobs (const Collection* Files attribute ((unused)),
+             unsigned MaxJobs attribute ((unused)),
+             int (*Func) (const char* File) attribute ((unused)))
+/* Call Func for each of the given files in a separate worker process */
+{
+    /* There's no fork() on Windows, and the assembler state cannot be reset
+    ** between files.
+    */
+    AbEnd ("Cannot assemble more than one file at once on this system");
+    return EXIT_FAILURE;
+}
+
+
+
+#else
+
+
+
+static int WaitForJob (void)
+/* Wait until one of the workers terminates. Return true if it succeeded. */
+{
+    int Status;
+    pid_t Pid;
+
+    do {
+        Pid = wait (&Status);
+    } while (Pid < 0 && errno == EINTR);
+    if (Pid < 0) {
+        AbEnd ("Failure waiting for worker process: %s", strerror (errno));
+    }
+    return WIFEXITED (Status) && WEXITSTATUS (Status) == EXIT_SUCCESS;
+}
+
+
+
+int RunJobs (const Collection* Files, unsigned MaxJobs,
+             int (*Func) (const char* File))
+/* Call Func for each of the given files in a separate worker process */
+{
+    unsigned I;
+    unsigned Running = 0;
+    int OK = 1;
+
+    for (I = 0; I < CollCount (Files); ++I) {
+
+        pid_t Pid;
+
+        /* Wait for a free worker slot */
+        if (Running >= MaxJobs) {
+            OK &= WaitForJob ();
+            --Running;
+        }
+
+        /* Flush the output buffers, so the worker won't write their contents
+        ** a second time.
+        */
+        fflush (stdout);
+        fflush (stderr);
+
+        Pid = fork ();
+        if (Pid < 0) {
+            AbEnd ("Cannot fork: %s", strerror (errno));
+        } else if (Pid == 0) {
+            /* The worker */
+            exit (Func (CollConstAt (Files, I)));
+        }
+        ++Running;
+    }
+
+    /* Wait for the remaining workers */
+    while (Running > 0) {
+        OK &= WaitForJob ();
+        --Running;
+    }
+
+    return OK? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+
+
+#endif
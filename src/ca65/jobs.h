@@ -1,15 +1,12 @@
 /*****************************************************************************/
 /*                                                                           */
-/*                                 fileio.h                                  */
+/*                                  jobs.h                                   */
 /*                                                                           */
-/*              Binary file I/O for the co65 object file converter           */
+/*              Parallel assembly of several files for ca65                  */
 /*                                                                           */
 /*                                                                           */
 /*                                                                           */
-/* (C) 1998-2003 Ullrich von Bassewitz                                       */
-/*               Rmerstrasse 52                                             */
-/*               D-70794 Filderstadt                                         */
-/* EMail:        uz@cc65.org                                                 */
+/* (C) 2026, The cc65 authors                                                */
 /*                                                                           */
 /*                                                                           */
 /* This software is provided 'as-is', without any expressed or implied       */
@@ -33,15 +30,13 @@
 
 
 
-#ifndef FILEIO_H
-#define FILEIO_H
+#ifndef JOBS_H
+#define JOBS_H
 
 
 
-#include <stdio.h>
-
 /* common */
-#include "filepos.h"
+#include "coll.h"
 
 
 
@@ -51,23 +46,17 @@
 
 
 
-unsigned Read8 (FILE* F);
-/* Read an 8 bit value from the file */
-
-unsigned Read16 (FILE* F);
-/* Read a 16 bit value from the file */
-
-unsigned long Read24 (FILE* F);
-/* Read a 24 bit value from the file */
-
-unsigned long Read32 (FILE* F);
-/* Read a 32 bit value from the file */
-
-void* ReadData (FILE* F, void* Data, unsigned Size);
-/* Read data from the file */
+int RunJobs (const Collection* Files, unsigned MaxJobs,
+             int (*Func) (const char* File));
+/* Call Func for each of the given files in a separate worker process, with
+** at most MaxJobs workers running at the same time. Each worker starts with
+** a copy of the current assembler state, so Func may change global state as
+** it likes. Return EXIT_SUCCESS if all workers succeeded, EXIT_FAILURE
+** otherwise.
+*/
 
 
 
-/* End of fileio.h */
+/* End of jobs.h */
 
 #endif
@@ -364,6 +364,12 @@ void CreateListing (void)
                     }
                     break;
 
+                case FRAG_BINARY:
+                    for (I = 0; I < Frag->Len; ++I) {
+                        B = AddHex (B, Frag->V.Bin[I]);
+                    }
+                    break;
+
                 case FRAG_EXPR:
                 case FRAG_SEXPR:
                     B = AddMult (B, 'r', Frag->Len*2);
@@ -42,7 +42,9 @@
 #include "addrsize.h"
 #include "chartype.h"
 #include "cmdline.h"
+#include "coll.h"
 #include "debugflag.h"
+#include "fname.h"
 #include "mmodel.h"
 #include "print.h"
 #include "scopedefs.h"
@@ -50,6 +52,7 @@
 #include "target.h"
 #include "tgttrans.h"
 #include "version.h"
+#include "xmalloc.h"
 
 /* ca65 */
 #include "abend.h"
@@ -63,6 +66,7 @@
 #include "incpath.h"
 #include "instr.h"
 #include "istack.h"
+#include "jobs.h"
 #include "lineinfo.h"
 #include "listing.h"
 #include "macro.h"
@@ -81,6 +85,20 @@
 
 
 
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Input files given on the command line */
+static Collection InFiles = STATIC_COLLECTION_INITIALIZER;
+
+/* Maximum number of files assembled at the same time */
+static unsigned MaxJobs = 1;
+
+
+
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
@@ -90,7 +108,7 @@
 static void Usage (void)
 /* Print usage information and exit */
 {
-    printf ("Usage: %s [options] file\n"
+    printf ("Usage: %s [options] file ...\n"
             "Short options:\n"
             "  -D name[=value]\t\tDefine a symbol\n"
             "  -I dir\t\t\tSet an include directory search path\n"
@@ -101,6 +119,7 @@ static void Usage (void)
             "  -g\t\t\t\tAdd debug info to object file\n"
             "  -h\t\t\t\tHelp (this text)\n"
             "  -i\t\t\t\tIgnore case of symbols\n"
+            "  -j n\t\t\t\tAssemble up to n files at the same time\n"
             "  -l name\t\t\tCreate a listing file if assembly was ok\n"
             "  -mm model\t\t\tSet the memory model\n"
             "  -o name\t\t\tName the output file\n"
@@ -120,6 +139,7 @@ static void Usage (void)
             "  --help\t\t\tHelp (this text)\n"
             "  --ignore-case\t\t\tIgnore case of symbols\n"
             "  --include-dir dir\t\tSet an include directory search path\n"
+            "  --jobs n\t\t\tAssemble up to n files at the same time\n"
             "  --large-alignment\t\tDon't warn about large alignments\n"
             "  --listing name\t\tCreate a listing file if assembly was ok\n"
             "  --list-bytes n\t\tMaximum number of bytes per listing line\n"
@@ -515,6 +535,18 @@ static void OptIncludeDir (const char* Opt attribute ((unused)), const char* Arg
 
 
 
+static void OptJobs (const char* Opt, const char* Arg)
+/* Handle the --jobs option */
+{
+    int Jobs = atoi (Arg);
+    if (Jobs < 1) {
+        AbEnd ("Argument for option '%s' is out of range", Opt);
+    }
+    MaxJobs = Jobs;
+}
+
+
+
 static void OptLargeAlignment (const char* Opt attribute ((unused)),
                                const char* Arg attribute ((unused)))
 /* Don't warn about large alignments */
@@ -644,6 +676,32 @@ static void OptVersion (const char* Opt attribute ((unused)),
 
 
 
+static void CheckExtOption (const char* Opt, const StrBuf* Name)
+/* When assembling several files, the name given with an option that creates
+** an additional output file must be an extension. Check that.
+*/
+{
+    if (SB_NotEmpty (Name) && SB_AtUnchecked (Name, 0) != '.') {
+        AbEnd ("The argument for option '%s' must be an extension like '.d' "
+               "when assembling more than one file", Opt);
+    }
+}
+
+
+
+static void MakeExtName (StrBuf* Name, const char* File)
+/* If Name is an extension, replace it by File with this extension */
+{
+    if (SB_NotEmpty (Name)) {
+        char* FileName = MakeFilename (File, SB_GetConstBuf (Name));
+        SB_CopyStr (Name, FileName);
+        SB_Terminate (Name);
+        xfree (FileName);
+    }
+}
+
+
+
 static void DoPCAssign (void)
 /* Start absolute code */
 {
@@ -902,6 +960,96 @@ static void CreateObjFile (void)
 
 
 
+static int AssembleFile (const char* File)
+/* Assemble one file and create the output files. Return the exit code. */
+{
+    /* Initialize the scanner, open the input file */
+    InFile = File;
+    InitScanner (InFile);
+
+    /* Define the default options */
+    SetOptions ();
+
+    /* Assemble the input */
+    Assemble ();
+
+    /* If we didn't have any errors, check the pseudo insn stacks */
+    if (ErrorCount == 0) {
+        CheckPseudo ();
+    }
+
+    /* If we didn't have any errors, check and cleanup the unnamed labels */
+    if (ErrorCount == 0) {
+        ULabDone ();
+    }
+
+    /* If we didn't have any errors, check the symbol table */
+    if (ErrorCount == 0) {
+        SymCheck ();
+    }
+
+    /* If we didn't have any errors, check the hll debug symbols */
+    if (ErrorCount == 0) {
+        DbgInfoCheck ();
+    }
+
+    /* If we didn't have any errors, close the file scope lexical level */
+    if (ErrorCount == 0) {
+        SymLeaveLevel ();
+    }
+
+    /* If we didn't have any errors, check and resolve the segment data */
+    if (ErrorCount == 0) {
+        SegDone ();
+    }
+
+    /* If we didn't have any errors, check the assertions */
+    if (ErrorCount == 0) {
+        CheckAssertions ();
+    }
+
+    /* Dump the data */
+    if (Verbosity >= 2) {
+        SymDump (stdout);
+        SegDump ();
+    }
+
+    /* If we didn't have an errors, finish off the line infos */
+    DoneLineInfo ();
+
+    /* If we didn't have any errors, create the object, listing and
+    ** dependency files
+    */
+    if (ErrorCount == 0) {
+        CreateObjFile ();
+        if (SB_GetLen (&ListingName) > 0) {
+            CreateListing ();
+        }
+       CreateDependencies ();
+    }
+
+    /* Close the input file */
+    DoneScanner ();
+
+    /* Return an apropriate exit code */
+    return (ErrorCount == 0)? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+
+
+static int AssembleJob (const char* File)
+/* Assemble one of several files. Return the exit code. */
+{
+    /* Derive the names of the additional output files from the input file */
+    MakeExtName (&ListingName, File);
+    MakeExtName (&DepName, File);
+    MakeExtName (&FullDepName, File);
+
+    return AssembleFile (File);
+}
+
+
+
 int main (int argc, char* argv [])
 /* Assembler main program */
 {
@@ -918,6 +1066,7 @@ int main (int argc, char* argv [])
         { "--help",             0,      OptHelp                 },
         { "--ignore-case",      0,      OptIgnoreCase           },
         { "--include-dir",      1,      OptIncludeDir           },
+        { "--jobs",             1,      OptJobs                 },
         { "--large-alignment",  0,      OptLargeAlignment       },
         { "--list-bytes",       1,      OptListBytes            },
         { "--listing",          1,      OptListing              },
@@ -988,6 +1137,10 @@ int main (int argc, char* argv [])
                     OptIgnoreCase (Arg, 0);
                     break;
 
+                case 'j':
+                    OptJobs (Arg, GetArg (&I, 2));
+                    break;
+
                 case 'l':
                     OptListing (Arg, GetArg (&I, 2));
                     break;
@@ -1042,14 +1195,8 @@ int main (int argc, char* argv [])
 
             }
         } else {
-            /* Filename. Check if we already had one */
-            if (InFile) {
-                fprintf (stderr, "%s: Don't know what to do with '%s'\n",
-                         ProgName, Arg);
-                exit (EXIT_FAILURE);
-            } else {
-                InFile = Arg;
-            }
+            /* Filename */
+            CollAppend (&InFiles, (void*) Arg);
         }
 
         /* Next argument */
@@ -1057,11 +1204,23 @@ int main (int argc, char* argv [])
     }
 
     /* Do we have an input file? */
-    if (InFile == 0) {
+    if (CollCount (&InFiles) == 0) {
         fprintf (stderr, "%s: No input files\n", ProgName);
         exit (EXIT_FAILURE);
     }
 
+    /* The names of the output files are derived from the input files when
+    ** assembling more than one file.
+    */
+    if (CollCount (&InFiles) > 1) {
+        if (OutFile) {
+            AbEnd ("Cannot use option '-o' when assembling more than one file");
+        }
+        CheckExtOption ("-l", &ListingName);
+        CheckExtOption ("--create-dep", &DepName);
+        CheckExtOption ("--create-full-dep", &FullDepName);
+    }
+
     /* Add the default include search paths. */
     FinishIncludePaths ();
 
@@ -1082,73 +1241,10 @@ int main (int argc, char* argv [])
     /* Set the default segment sizes according to the memory model */
     SetSegmentSizes ();
 
-    /* Initialize the scanner, open the input file */
-    InitScanner (InFile);
-
-    /* Define the default options */
-    SetOptions ();
-
-    /* Assemble the input */
-    Assemble ();
-
-    /* If we didn't have any errors, check the pseudo insn stacks */
-    if (ErrorCount == 0) {
-        CheckPseudo ();
-    }
-
-    /* If we didn't have any errors, check and cleanup the unnamed labels */
-    if (ErrorCount == 0) {
-        ULabDone ();
-    }
-
-    /* If we didn't have any errors, check the symbol table */
-    if (ErrorCount == 0) {
-        SymCheck ();
-    }
-
-    /* If we didn't have any errors, check the hll debug symbols */
-    if (ErrorCount == 0) {
-        DbgInfoCheck ();
-    }
-
-    /* If we didn't have any errors, close the file scope lexical level */
-    if (ErrorCount == 0) {
-        SymLeaveLevel ();
-    }
-
-    /* If we didn't have any errors, check and resolve the segment data */
-    if (ErrorCount == 0) {
-        SegDone ();
-    }
-
-    /* If we didn't have any errors, check the assertions */
-    if (ErrorCount == 0) {
-        CheckAssertions ();
-    }
-
-    /* Dump the data */
-    if (Verbosity >= 2) {
-        SymDump (stdout);
-        SegDump ();
-    }
-
-    /* If we didn't have an errors, finish off the line infos */
-    DoneLineInfo ();
-
-    /* If we didn't have any errors, create the object, listing and
-    ** dependency files
-    */
-    if (ErrorCount == 0) {
-        CreateObjFile ();
-        if (SB_GetLen (&ListingName) > 0) {
-            CreateListing ();
-        }
-       CreateDependencies ();
+    /* Assemble the input files */
+    if (CollCount (&InFiles) == 1) {
+        return AssembleFile (CollAtUnchecked (&InFiles, 0));
+    } else {
+        return RunJobs (&InFiles, MaxJobs, AssembleJob);
     }
-
-    /* Close the input file */
-    DoneScanner ();
-
-    /* Return an apropriate exit code */
-    return (ErrorCount == 0)? EXIT_SUCCESS : EXIT_FAILURE;
 }
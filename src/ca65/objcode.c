@@ -191,6 +191,33 @@ void EmitStrBuf (const StrBuf* Data)
 
 
 
+void EmitBinary (const void* D, unsigned long Size)
+/* Emit a block of data into the current segment without copying it. The
+** data must stay valid until the object file has been written.
+*/
+{
+    /* Make a useful pointer from Data */
+    const unsigned char* Data = D;
+
+    /* Create one fragment for each 64K chunk */
+    while (Size) {
+
+        /* Determine the length of the next fragment */
+        unsigned Len = (Size > 0xFFFFUL)? 0xFFFFU : (unsigned) Size;
+
+        /* Create a new fragment referencing the data */
+        Fragment* F = GenFragment (FRAG_BINARY, Len);
+        F->V.Bin = Data;
+
+        /* Next chunk */
+        Data += Len;
+        Size -= Len;
+
+    }
+}
+
+
+
 void EmitByte (ExprNode* Expr)
 /* Emit one byte */
 {
@@ -74,6 +74,11 @@ void EmitData (const void* Data, unsigned Size);
 void EmitStrBuf (const StrBuf* Data);
 /* Emit a string into the current segment */
 
+void EmitBinary (const void* Data, unsigned long Size);
+/* Emit a block of data into the current segment without copying it. The
+** data must stay valid until the object file has been written.
+*/
+
 void EmitByte (ExprNode* Expr);
 /* Emit one byte */
 
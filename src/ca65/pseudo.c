@@ -1302,28 +1302,20 @@ static void DoIncBin (void)
     /* Seek to the start position */
     fseek (F, Start, SEEK_SET);
 
-    /* Read chunks and insert them into the output */
-    while (Count > 0) {
-
-        unsigned char Buf [1024];
-
-        /* Calculate the number of bytes to read */
-        size_t BytesToRead = (Count > (long)sizeof(Buf))? sizeof(Buf) : (size_t) Count;
-
-        /* Read chunk */
-        size_t BytesRead = fread (Buf, 1, BytesToRead, F);
-        if (BytesToRead != BytesRead) {
+    /* Read the data in one go and insert it into the output. The buffer is
+    ** referenced by the fragments until the object file is written, so it
+    ** is never freed.
+    */
+    if (Count > 0) {
+        unsigned char* Buf = xmalloc (Count);
+        if (fread (Buf, 1, Count, F) != (size_t) Count) {
             /* Some sort of error */
             ErrorSkip ("Cannot read from include file '%m%p': %s",
                        &Name, strerror (errno));
-            break;
+            xfree (Buf);
+        } else {
+            EmitBinary (Buf, Count);
         }
-
-        /* Insert it into the output */
-        EmitData (Buf, BytesRead);
-
-        /* Keep the counters current */
-        Count -= BytesRead;
     }
 
 Done:
@@ -128,7 +128,7 @@ static Segment* NewSegment (const char* Name, unsigned char AddrSize)
 /* Create a new segment, insert it into the global list and return it */
 {
     /* Check for too many segments */
-    if (CollCount (&SegmentList) >= 256) {
+    if (CollCount (&SegmentList) >= 0x10000) {
         Fatal ("Too many segments");
     }
 
@@ -446,14 +446,16 @@ void SegDump (void)
         printf ("New segment: %s", S->Def->Name);
         F = S->Root;
         while (F) {
-            if (F->Type == FRAG_LITERAL) {
+            if (F->Type == FRAG_LITERAL || F->Type == FRAG_BINARY) {
+                const unsigned char* Data;
+                Data = (F->Type == FRAG_LITERAL)? F->V.Data : F->V.Bin;
                 if (State != 0) {
                     printf ("\n  Literal:");
                     X = 15;
                     State = 0;
                 }
                 for (I = 0; I < F->Len; ++I) {
-                    printf (" %02X", F->V.Data [I]);
+                    printf (" %02X", Data[I]);
                     X += 3;
                 }
             } else if (F->Type == FRAG_EXPR || F->Type == FRAG_SEXPR) {
@@ -558,6 +560,12 @@ static void WriteOneSeg (Segment* Seg)
                 ObjWriteData (Frag->V.Data, Frag->Len);
                 break;
 
+            case FRAG_BINARY:
+                ObjWrite8 (FRAG_LITERAL);
+                ObjWriteVar (Frag->Len);
+                ObjWriteData (Frag->V.Bin, Frag->Len);
+                break;
+
             case FRAG_EXPR:
                 switch (Frag->Len) {
                     case 1:   ObjWrite8 (FRAG_EXPR8);   break;
@@ -37,6 +37,7 @@
 
 /* common */
 #include "check.h"
+#include "strpool.h"
 #include "xmalloc.h"
 
 /* ca65 */
@@ -58,6 +59,12 @@
 /* Number of currently pushed token lists */
 static unsigned PushCounter = 0;
 
+/* Pool with the string values of all tokens in token lists. The strings are
+** never freed, so a replayed token may reference them instead of getting a
+** copy. The pool is separate from the one written to the object file.
+*/
+static StringPool* TokStrings = 0;
+
 
 
 /*****************************************************************************/
@@ -70,13 +77,23 @@ TokNode* NewTokNode (void)
 /* Create and return a token node with the current token value */
 {
 
+    const StrBuf* S;
+
     /* Allocate memory */
     TokNode* N = xmalloc (sizeof (TokNode));
 
-    /* Initialize the token contents */
+    /* Create the string pool if we don't have it */
+    if (TokStrings == 0) {
+        TokStrings = NewStringPool (1103);
+    }
+
+    /* Initialize the token contents. The string value is interned and
+    ** referenced, not copied.
+    */
+    S = SP_Get (TokStrings, SP_Add (TokStrings, &CurTok.SVal));
     N->Next     = 0;
-    SB_Init (&N->T.SVal);
-    CopyToken (&N->T, &CurTok);
+    N->T        = CurTok;
+    SB_InitFromBuf (&N->T.SVal, SB_GetConstBuf (S), SB_GetLen (S));
 
     /* Return the node */
     return N;
@@ -87,7 +104,7 @@ TokNode* NewTokNode (void)
 void FreeTokNode (TokNode* N)
 /* Free the given token node */
 {
-    SB_Done (&N->T.SVal);
+    /* The string value is owned by the string pool */
     xfree (N);
 }
 
@@ -96,9 +113,12 @@ void FreeTokNode (TokNode* N)
 void TokSet (TokNode* N)
 /* Set the scanner token from the given token node. */
 {
-    /* Set the values */
-    CopyToken (&CurTok, &N->T);
-    SB_Terminate (&CurTok.SVal);
+    /* Release the string owned by the current token, then set the values.
+    ** The string value of the node is interned and zero terminated, so it
+    ** is referenced without making a copy. It is copied on write.
+    */
+    SB_Done (&CurTok.SVal);
+    CurTok = N->T;
 }
 
 
@@ -45,6 +45,17 @@
 
 
 
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Number to generate unique labels */
+static unsigned NextLabel = 0;
+
+
+
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
@@ -54,9 +65,6 @@
 unsigned GetLocalLabel (void)
 /* Get an unused label. Will never return zero. */
 {
-    /* Number to generate unique labels */
-    static unsigned NextLabel = 0;
-
     /* Check for an overflow */
     if (NextLabel >= 0xFFFF) {
         Internal ("Local label overflow");
@@ -68,6 +76,14 @@ unsigned GetLocalLabel (void)
 
 
 
+void ResetLocalLabels (void)
+/* Start over with the label numbers for a new translation unit */
+{
+    NextLabel = 0;
+}
+
+
+
 const char* LocalLabelName (unsigned L)
 /* Make a label name from the given label number. The label name will be
 ** created in static storage and overwritten when calling the function
@@ -47,6 +47,9 @@
 unsigned GetLocalLabel (void);
 /* Get an unused assembler label. Will never return zero. */
 
+void ResetLocalLabels (void);
+/* Start over with the label numbers for a new translation unit */
+
 const char* LocalLabelName (unsigned L);
 /* Make a label name from the given label number. The label name will be
 ** created in static storage and overwritten when calling the function
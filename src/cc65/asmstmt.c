@@ -40,6 +40,7 @@
 
 /* cc65 */
 #include "asmlabel.h"
+#include "callgraph.h"
 #include "codegen.h"
 #include "codeseg.h"
 #include "datatype.h"
@@ -424,6 +425,9 @@ void AsmStatement (void)
     /* Skip the ASM */
     NextToken ();
 
+    /* The code may call anything */
+    CG_AddAsmCode ();
+
     /* An optional volatile qualifier disables optimization for
     ** the entire function [same as #pragma optimize(push, off)].
     */
@@ -0,0 +1,435 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                callgraph.c                                */
+/*                                                                           */
+/*                   Call graph and overlaid static locals                   */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <string.h>
+
+/* common */
+#include "check.h"
+#include "coll.h"
+#include "xmalloc.h"
+
+/* cc65 */
+#include "asmlabel.h"
+#include "codegen.h"
+#include "global.h"
+#include "symentry.h"
+#include "callgraph.h"
+
+
+
+/* With --overlay-locals, the static locals of each function are allocated in
+** a frame. The frames of all functions of the translation unit share one
+** overlay area in the BSS segment. Two frames may occupy the same memory if
+** the functions can never be active at the same time. Since static locals
+** already rule out recursion, this is true if there is no chain of calls
+** between the two functions. Calls to code outside the translation unit (or
+** through pointers) may come back through any function that is visible from
+** the outside, so such calls are handled as calls to all of these functions.
+*/
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Node flags */
+#define CGF_NONE        0x00U
+#define CGF_UNKNOWN     0x01U           /* Calls unknown code */
+
+/* A strongly connected component of the call graph. The frames of its members
+** are placed one after the other.
+*/
+typedef struct CGComp CGComp;
+struct CGComp {
+    Collection          Nodes;          /* Members of this component */
+    unsigned            Offs;           /* Offset in the overlay area */
+};
+
+/* One node in the call graph */
+typedef struct CGNode CGNode;
+struct CGNode {
+    SymEntry*           Func;           /* The function */
+    unsigned            Flags;          /* CGF_xxx */
+    unsigned            FrameLabel;     /* Label of the frame or zero */
+    unsigned            FrameSize;      /* Size of the static locals */
+    unsigned            Offs;           /* Offset in the overlay area */
+    Collection          Calls;          /* Names of called functions */
+    Collection          Succ;           /* Resolved callees */
+    CGComp*             Comp;           /* Component this node belongs to */
+    int                 Index;          /* Used for finding components */
+    int                 LowLink;        /* Used for finding components */
+    int                 OnStack;        /* Used for finding components */
+};
+
+/* All functions of the translation unit, and the current one */
+static Collection       Nodes = STATIC_COLLECTION_INITIALIZER;
+static CGNode*          CurNode = 0;
+
+/* Names of functions whose address was taken */
+static Collection       AddrTaken = STATIC_COLLECTION_INITIALIZER;
+
+/* Set if inline assembler code was seen, that may call anything */
+static int              AsmSeen = 0;
+
+
+
+/*****************************************************************************/
+/*                                  Helpers                                  */
+/*****************************************************************************/
+
+
+
+static CGNode* NewCGNode (SymEntry* Func)
+/* Create a new call graph node */
+{
+    /* Allocate memory */
+    CGNode* N = xmalloc (sizeof (CGNode));
+
+    /* Initialize the fields */
+    N->Func       = Func;
+    N->Flags      = CGF_NONE;
+    N->FrameLabel = 0;
+    N->FrameSize  = 0;
+    N->Offs       = 0;
+    InitCollection (&N->Calls);
+    InitCollection (&N->Succ);
+    N->Comp       = 0;
+    N->Index      = -1;
+    N->LowLink    = -1;
+    N->OnStack    = 0;
+
+    /* Return the new node */
+    return N;
+}
+
+
+
+static CGNode* FindCGNode (const char* Name)
+/* Find the node for the function with the given name. Return NULL if the
+** function isn't defined in this translation unit.
+*/
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&Nodes); ++I) {
+        CGNode* N = CollAtUnchecked (&Nodes, I);
+        if (strcmp (N->Func->Name, Name) == 0) {
+            return N;
+        }
+    }
+    return 0;
+}
+
+
+
+static int IsEntry (const CGNode* N)
+/* Return true if the function may be called by code we know nothing about */
+{
+    unsigned I;
+
+    if (AsmSeen || (N->Func->Flags & SC_EXTERN) != 0) {
+        return 1;
+    }
+    for (I = 0; I < CollCount (&AddrTaken); ++I) {
+        if (strcmp (CollConstAt (&AddrTaken, I), N->Func->Name) == 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+
+static void FindComps (CGNode* N, Collection* Stack, Collection* Comps,
+                       int* Index)
+/* Find the strongly connected components reachable from N. The components
+** are appended to Comps in reverse topological order, so each component is
+** added after all components it calls into.
+*/
+{
+    unsigned I;
+
+    N->Index   = *Index;
+    N->LowLink = *Index;
+    ++*Index;
+    CollAppend (Stack, N);
+    N->OnStack = 1;
+
+    for (I = 0; I < CollCount (&N->Succ); ++I) {
+        CGNode* S = CollAtUnchecked (&N->Succ, I);
+        if (S->Index < 0) {
+            FindComps (S, Stack, Comps, Index);
+            if (S->LowLink < N->LowLink) {
+                N->LowLink = S->LowLink;
+            }
+        } else if (S->OnStack && S->Index < N->LowLink) {
+            N->LowLink = S->Index;
+        }
+    }
+
+    /* If N is the root of a component, pop it from the stack */
+    if (N->LowLink == N->Index) {
+        CGNode* M;
+        CGComp* C = xmalloc (sizeof (CGComp));
+        InitCollection (&C->Nodes);
+        C->Offs = 0;
+        do {
+            M = CollPop (Stack);
+            M->OnStack = 0;
+            M->Comp = C;
+            CollAppend (&C->Nodes, M);
+        } while (M != N);
+        CollAppend (Comps, C);
+    }
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void CG_EnterFunc (struct SymEntry* Func)
+/* Start recording the calls and static local frame of the given function.
+** Called for each function body if overlaid locals are enabled.
+*/
+{
+    CHECK (CurNode == 0);
+    CurNode = NewCGNode (Func);
+    CollAppend (&Nodes, CurNode);
+}
+
+
+
+void CG_LeaveFunc (void)
+/* Stop recording for the current function */
+{
+    CurNode = 0;
+}
+
+
+
+void CG_AddCall (const char* Name)
+/* Record a direct call of the function with the given name from the current
+** function.
+*/
+{
+    if (CurNode) {
+        CollAppend (&CurNode->Calls, (void*) Name);
+    }
+}
+
+
+
+void CG_AddUnknownCall (void)
+/* Record a call from the current function to code we know nothing about,
+** for example a call through a function pointer.
+*/
+{
+    if (CurNode) {
+        CurNode->Flags |= CGF_UNKNOWN;
+    }
+}
+
+
+
+void CG_AddAsmCode (void)
+/* Record inline assembler code. Since it may call any function of the
+** translation unit, all functions are handled as being visible from the
+** outside.
+*/
+{
+    if (OverlayLocals) {
+        AsmSeen = 1;
+        CG_AddUnknownCall ();
+    }
+}
+
+
+
+void CG_AddressTaken (const char* Name)
+/* Record that the address of the function with the given name was taken, so
+** it may be called from anywhere.
+*/
+{
+    if (OverlayLocals) {
+        CollAppend (&AddrTaken, (void*) Name);
+    }
+}
+
+
+
+void CG_AllocLocal (unsigned Label, unsigned Size)
+/* Allocate Size bytes for a static local variable in the frame of the
+** current function and define Label as an alias for its location.
+*/
+{
+    CHECK (CurNode != 0);
+
+    /* Allocate the frame label when it's needed for the first time */
+    if (CurNode->FrameLabel == 0) {
+        CurNode->FrameLabel = GetLocalLabel ();
+    }
+
+    /* Define the variable label */
+    g_usebss ();
+    g_aliasdatalabel (Label, CurNode->FrameLabel, CurNode->FrameSize);
+
+    /* Reserve the space in the frame */
+    CurNode->FrameSize += Size;
+}
+
+
+
+void CG_EmitFrames (void)
+/* Compute the frame offsets within the overlay area from the call graph and
+** emit the area together with the frame labels of all functions.
+*/
+{
+    unsigned    I, J, K;
+    unsigned    Size;
+    unsigned    Label;
+    int         Index;
+    Collection  Stack = AUTO_COLLECTION_INITIALIZER;
+    Collection  Comps = AUTO_COLLECTION_INITIALIZER;
+
+    /* Resolve the calls. Calls to functions not defined here are calls to
+    ** unknown code.
+    */
+    for (I = 0; I < CollCount (&Nodes); ++I) {
+        CGNode* N = CollAtUnchecked (&Nodes, I);
+        for (J = 0; J < CollCount (&N->Calls); ++J) {
+            CGNode* Callee = FindCGNode (CollConstAt (&N->Calls, J));
+            if (Callee) {
+                CollAppend (&N->Succ, Callee);
+            } else {
+                N->Flags |= CGF_UNKNOWN;
+            }
+        }
+    }
+
+    /* Unknown code may call any function visible from the outside. A node
+    ** doesn't need an edge to itself, since static locals aren't reentrant
+    ** anyway.
+    */
+    for (I = 0; I < CollCount (&Nodes); ++I) {
+        CGNode* N = CollAtUnchecked (&Nodes, I);
+        if (N->Flags & CGF_UNKNOWN) {
+            for (J = 0; J < CollCount (&Nodes); ++J) {
+                CGNode* E = CollAtUnchecked (&Nodes, J);
+                if (E != N && IsEntry (E)) {
+                    CollAppend (&N->Succ, E);
+                }
+            }
+        }
+    }
+
+    /* Determine the strongly connected components */
+    Index = 0;
+    for (I = 0; I < CollCount (&Nodes); ++I) {
+        CGNode* N = CollAtUnchecked (&Nodes, I);
+        if (N->Index < 0) {
+            FindComps (N, &Stack, &Comps, &Index);
+        }
+    }
+
+    /* Walk over the components in topological order. Each component is
+    ** placed behind the frames of all its callers, the members of a component
+    ** are placed one after the other.
+    */
+    Size = 0;
+    I = CollCount (&Comps);
+    while (I-- > 0) {
+        CGComp* C = CollAtUnchecked (&Comps, I);
+        unsigned Offs = C->Offs;
+        for (J = 0; J < CollCount (&C->Nodes); ++J) {
+            CGNode* N = CollAtUnchecked (&C->Nodes, J);
+            N->Offs = Offs;
+            Offs += N->FrameSize;
+        }
+        if (Offs > Size) {
+            Size = Offs;
+        }
+        for (J = 0; J < CollCount (&C->Nodes); ++J) {
+            CGNode* N = CollAtUnchecked (&C->Nodes, J);
+            for (K = 0; K < CollCount (&N->Succ); ++K) {
+                CGNode* S = CollAtUnchecked (&N->Succ, K);
+                if (S->Comp != C && S->Comp->Offs < Offs) {
+                    S->Comp->Offs = Offs;
+                }
+            }
+        }
+        DoneCollection (&C->Nodes);
+        xfree (C);
+    }
+
+    /* Emit the overlay area and the frame labels */
+    if (Size > 0) {
+        g_usebss ();
+        Label = GetLocalLabel ();
+        g_defdatalabel (Label);
+        g_res (Size);
+        for (I = 0; I < CollCount (&Nodes); ++I) {
+            const CGNode* N = CollConstAt (&Nodes, I);
+            if (N->FrameLabel) {
+                g_aliasdatalabel (N->FrameLabel, Label, N->Offs);
+            }
+        }
+    }
+
+    /* Free the call graph */
+    CG_Reset ();
+    DoneCollection (&Stack);
+    DoneCollection (&Comps);
+}
+
+
+
+void CG_Reset (void)
+/* Free the call graph, so recording starts over */
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&Nodes); ++I) {
+        CGNode* N = CollAtUnchecked (&Nodes, I);
+        DoneCollection (&N->Calls);
+        DoneCollection (&N->Succ);
+        xfree (N);
+    }
+    CollDeleteAll (&Nodes);
+    CollDeleteAll (&AddrTaken);
+    CurNode = 0;
+    AsmSeen = 0;
+}
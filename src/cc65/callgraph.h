@@ -0,0 +1,100 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                callgraph.h                                */
+/*                                                                           */
+/*                   Call graph and overlaid static locals                   */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef CALLGRAPH_H
+#define CALLGRAPH_H
+
+
+
+/*****************************************************************************/
+/*                                 Forwards                                  */
+/*****************************************************************************/
+
+
+
+struct SymEntry;
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void CG_EnterFunc (struct SymEntry* Func);
+/* Start recording the calls and static local frame of the given function.
+** Called for each function body if overlaid locals are enabled.
+*/
+
+void CG_LeaveFunc (void);
+/* Stop recording for the current function */
+
+void CG_AddCall (const char* Name);
+/* Record a direct call of the function with the given name from the current
+** function.
+*/
+
+void CG_AddUnknownCall (void);
+/* Record a call from the current function to code we know nothing about,
+** for example a call through a function pointer.
+*/
+
+void CG_AddAsmCode (void);
+/* Record inline assembler code. Since it may call any function of the
+** translation unit, all functions are handled as being visible from the
+** outside.
+*/
+
+void CG_AddressTaken (const char* Name);
+/* Record that the address of the function with the given name was taken, so
+** it may be called from anywhere.
+*/
+
+void CG_AllocLocal (unsigned Label, unsigned Size);
+/* Allocate Size bytes for a static local variable in the frame of the
+** current function and define Label as an alias for its location.
+*/
+
+void CG_EmitFrames (void);
+/* Compute the frame offsets within the overlay area from the call graph and
+** emit the area together with the frame labels of all functions.
+*/
+
+void CG_Reset (void);
+/* Free the call graph, so recording starts over */
+
+
+
+/* End of callgraph.h */
+
+#endif
@@ -39,6 +39,7 @@
 #include "chartype.h"
 #include "check.h"
 #include "debugflag.h"
+#include "strpool.h"
 #include "xmalloc.h"
 #include "xsprintf.h"
 
@@ -62,6 +63,9 @@
 /* Empty argument */
 static char EmptyArg[] = "";
 
+/* Names of memory locations held in registers */
+static StringPool* MemLocNames = 0;
+
 
 
 /*****************************************************************************/
@@ -210,6 +214,241 @@ static void SetUseChgInfo (CodeEntry* E, const OPCDesc* D)
 
 
 
+static void ForgetMemLoc (RegContents* RC, unsigned Loc)
+/* Forget that registers hold the given memory location */
+{
+    if (RC->MemA == Loc) {
+        RC->MemA = UNKNOWN_MEMLOC;
+    }
+    if (RC->MemX == Loc) {
+        RC->MemX = UNKNOWN_MEMLOC;
+    }
+    if (RC->MemY == Loc) {
+        RC->MemY = UNKNOWN_MEMLOC;
+    }
+}
+
+
+
+static unsigned ForgetMemLoc1 (unsigned Loc, unsigned Types, unsigned Chg)
+/* Helper for ForgetMemLocs */
+{
+    unsigned Type = MEMLOC_TYPE (Loc);
+    if (Loc != UNKNOWN_MEMLOC) {
+        if ((Types & (1U << Type)) != 0                             ||
+            (Type == MEMLOC_ZPREG && (MEMLOC_VAL (Loc) & Chg) != 0) ||
+            (Type == MEMLOC_STACK && (Chg & REG_SP) != 0)) {
+            return UNKNOWN_MEMLOC;
+        }
+    }
+    return Loc;
+}
+
+
+
+static void ForgetMemLocs (RegContents* RC, unsigned Types, unsigned Chg)
+/* Forget that registers hold memory locations of the given types (a bit
+** mask with bit n set for type n), zero page registers that are changed
+** according to Chg, and stack locations if Chg contains the stack pointer.
+*/
+{
+    RC->MemA = ForgetMemLoc1 (RC->MemA, Types, Chg);
+    RC->MemX = ForgetMemLoc1 (RC->MemX, Types, Chg);
+    RC->MemY = ForgetMemLoc1 (RC->MemY, Types, Chg);
+}
+
+
+
+static void WriteMemLoc (RegContents* RC, unsigned Loc)
+/* Update the memory locations held in registers for a write to Loc */
+{
+    switch (MEMLOC_TYPE (Loc)) {
+
+        case MEMLOC_STACK:
+        case MEMLOC_ZPREG:
+            /* These don't have other names */
+            ForgetMemLoc (RC, Loc);
+            break;
+
+        case MEMLOC_NAMED:
+            /* Different names may be used for the same location */
+            ForgetMemLocs (RC, 1U << MEMLOC_NAMED, REG_NONE);
+            break;
+
+        default:
+            /* The insn may write anywhere */
+            ForgetMemLocs (RC, ~0U, REG_ALL);
+            break;
+    }
+}
+
+
+
+static void GenMemLocInfo (const CodeEntry* E, const RegContents* In, RegContents* Out)
+/* Track the memory locations whose contents are held in the registers */
+{
+    unsigned Loc;
+
+    /* Registers changed by the insn do no longer hold a memory location. The
+    ** same is true for registers loaded from zero page registers that are
+    ** changed, or from the stack if the stack pointer is changed.
+    */
+    if (E->Chg & REG_A) {
+        Out->MemA = UNKNOWN_MEMLOC;
+    }
+    if (E->Chg & REG_X) {
+        Out->MemX = UNKNOWN_MEMLOC;
+    }
+    if (E->Chg & REG_Y) {
+        Out->MemY = UNKNOWN_MEMLOC;
+    }
+    ForgetMemLocs (Out, 0, E->Chg);
+
+    switch (E->OPC) {
+
+        case OP65_LDA:
+            Out->MemA = CE_GetMemLoc (E, In);
+            break;
+
+        case OP65_LDX:
+            Out->MemX = CE_GetMemLoc (E, In);
+            break;
+
+        case OP65_LDY:
+            Out->MemY = CE_GetMemLoc (E, In);
+            break;
+
+        case OP65_TAX:
+            Out->MemX = In->MemA;
+            break;
+
+        case OP65_TAY:
+            Out->MemY = In->MemA;
+            break;
+
+        case OP65_TXA:
+            Out->MemA = In->MemX;
+            break;
+
+        case OP65_TYA:
+            Out->MemA = In->MemY;
+            break;
+
+        case OP65_STA:
+            Loc = CE_GetMemLoc (E, In);
+            WriteMemLoc (Out, Loc);
+            if (Loc != UNKNOWN_MEMLOC) {
+                Out->MemA = Loc;
+            }
+            break;
+
+        case OP65_STX:
+            Loc = CE_GetMemLoc (E, In);
+            WriteMemLoc (Out, Loc);
+            if (Loc != UNKNOWN_MEMLOC) {
+                Out->MemX = Loc;
+            }
+            break;
+
+        case OP65_STY:
+            Loc = CE_GetMemLoc (E, In);
+            WriteMemLoc (Out, Loc);
+            if (Loc != UNKNOWN_MEMLOC) {
+                Out->MemY = Loc;
+            }
+            break;
+
+        case OP65_STZ:
+        case OP65_TRB:
+        case OP65_TSB:
+            WriteMemLoc (Out, CE_GetMemLoc (E, In));
+            break;
+
+        case OP65_ASL:
+        case OP65_DEC:
+        case OP65_INC:
+        case OP65_LSR:
+        case OP65_ROL:
+        case OP65_ROR:
+            if (E->AM != AM65_ACC && E->AM != AM65_IMP) {
+                WriteMemLoc (Out, CE_GetMemLoc (E, In));
+            }
+            break;
+
+        case OP65_JSR:
+            /* The function may write to any variable. The function info is
+            ** used above for the zero page registers, but it is complete
+            ** only for tmp1, ptr1 and sreg. Notably, it doesn't contain
+            ** changes of the stack pointer.
+            */
+            ForgetMemLocs (Out, (1U << MEMLOC_STACK) | (1U << MEMLOC_NAMED),
+                           REG_ZP & ~(REG_TMP1 | REG_PTR1 | REG_SREG));
+            break;
+
+        case OP65_ADC:
+        case OP65_AND:
+        case OP65_BCC:
+        case OP65_BCS:
+        case OP65_BEQ:
+        case OP65_BIT:
+        case OP65_BMI:
+        case OP65_BNE:
+        case OP65_BPL:
+        case OP65_BRA:
+        case OP65_BVC:
+        case OP65_BVS:
+        case OP65_CLC:
+        case OP65_CLD:
+        case OP65_CLI:
+        case OP65_CLV:
+        case OP65_CMP:
+        case OP65_CPX:
+        case OP65_CPY:
+        case OP65_DEA:
+        case OP65_DEX:
+        case OP65_DEY:
+        case OP65_EOR:
+        case OP65_INA:
+        case OP65_INX:
+        case OP65_INY:
+        case OP65_JCC:
+        case OP65_JCS:
+        case OP65_JEQ:
+        case OP65_JMI:
+        case OP65_JMP:
+        case OP65_JNE:
+        case OP65_JPL:
+        case OP65_JVC:
+        case OP65_JVS:
+        case OP65_NOP:
+        case OP65_ORA:
+        case OP65_PHA:
+        case OP65_PHP:
+        case OP65_PHX:
+        case OP65_PHY:
+        case OP65_PLA:
+        case OP65_PLP:
+        case OP65_PLX:
+        case OP65_PLY:
+        case OP65_RTS:
+        case OP65_SBC:
+        case OP65_SEC:
+        case OP65_SED:
+        case OP65_SEI:
+        case OP65_TSX:
+        case OP65_TXS:
+            /* No memory is written */
+            break;
+
+        default:
+            /* Be careful with everything else */
+            ForgetMemLocs (Out, ~0U, REG_ALL);
+            break;
+    }
+}
+
+
+
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
@@ -489,6 +728,53 @@ void CE_FreeRegInfo (CodeEntry* E)
 
 
 
+unsigned CE_GetMemLoc (const CodeEntry* E, const RegContents* RC)
+/* Return the memory location read or written by E, or UNKNOWN_MEMLOC if it
+** cannot be tracked. RC are the register contents on input of E.
+*/
+{
+    const ZPInfo* Info;
+
+    switch (E->AM) {
+
+        case AM65_ZP:
+        case AM65_ABS:
+            /* Numeric addresses may be I/O ports, so use symbols only */
+            if (!IsAlpha (E->Arg[0]) && E->Arg[0] != '_') {
+                break;
+            }
+            Info = GetZPInfo (E->Arg);
+            if (Info && Info->ByteUse != REG_NONE &&
+                (Info->ByteUse & (Info->ByteUse - 1)) == 0) {
+                return MAKE_MEMLOC (MEMLOC_ZPREG, Info->ByteUse);
+            }
+            if (MemLocNames == 0) {
+                MemLocNames = NewStringPool (1103);
+            }
+            return MAKE_MEMLOC (MEMLOC_NAMED, SP_AddStr (MemLocNames, E->Arg));
+
+        case AM65_ZP_INDY:
+            if (strcmp (E->Arg, "sp") == 0 && RegValIsKnown (RC->RegY)) {
+                return MAKE_MEMLOC (MEMLOC_STACK, RC->RegY);
+            }
+            break;
+
+        case AM65_ZP_IND:
+            if (strcmp (E->Arg, "sp") == 0) {
+                return MAKE_MEMLOC (MEMLOC_STACK, 0);
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    /* Unknown location */
+    return UNKNOWN_MEMLOC;
+}
+
+
+
 void CE_GenRegInfo (CodeEntry* E, RegContents* InputRegs)
 /* Generate register info for this instruction. If an old info exists, it is
 ** overwritten.
@@ -1330,6 +1616,9 @@ void CE_GenRegInfo (CodeEntry* E, RegContents* InputRegs)
             break;
 
     }
+
+    /* Track the memory locations held in the registers */
+    GenMemLocInfo (E, In, Out);
 }
 
 
@@ -227,6 +227,11 @@ int CE_UseLoadFlags (CodeEntry* E);
 void CE_FreeRegInfo (CodeEntry* E);
 /* Free an existing register info struct */
 
+unsigned CE_GetMemLoc (const CodeEntry* E, const RegContents* RC);
+/* Return the memory location read or written by E, or UNKNOWN_MEMLOC if it
+** cannot be tracked. RC are the register contents on input of E.
+*/
+
 void CE_GenRegInfo (CodeEntry* E, RegContents* InputRegs);
 /* Generate register info for this instruction. If an old info exists, it is
 ** overwritten.
@@ -232,17 +232,24 @@ void g_usebss (void)
 
 
 
+static DataSeg* GetDataSegFor (segment_t Seg)
+/* Return the data segment for Seg in the current segment list */
+{
+    switch (Seg) {
+        case SEG_RODATA: return CS->ROData;
+        case SEG_DATA:   return CS->Data;
+        case SEG_BSS:    return CS->BSS;
+        default:         return 0;
+    }
+}
+
+
+
 void g_segname (segment_t Seg)
 /* Emit the name of a segment if necessary */
 {
     /* Emit a segment directive for the data style segments */
-    DataSeg* S;
-    switch (Seg) {
-        case SEG_RODATA: S = CS->ROData; break;
-        case SEG_DATA:   S = CS->Data;   break;
-        case SEG_BSS:    S = CS->BSS;    break;
-        default:         S = 0;          break;
-    }
+    DataSeg* S = GetDataSegFor (Seg);
     if (S) {
         DS_AddLine (S, ".segment\t\"%s\"", GetSegName (Seg));
     }
@@ -250,6 +257,20 @@ void g_segname (segment_t Seg)
 
 
 
+void g_sectionname (segment_t Seg, const char* AsmName)
+/* Emit the name of the segment for the data object with the given assembler
+** name if it gets a section of its own. Use g_segname to switch back.
+*/
+{
+    DataSeg* S = GetDataSegFor (Seg);
+    const char* Name = GetSectionName (Seg, AsmName);
+    if (S && strcmp (Name, GetSegName (Seg)) != 0) {
+        DS_AddLine (S, ".segment\t\"%s\"", Name);
+    }
+}
+
+
+
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
@@ -130,6 +130,11 @@ void g_usebss (void);
 void g_segname (segment_t Seg);
 /* Emit the name of a segment if necessary */
 
+void g_sectionname (segment_t Seg, const char* AsmName);
+/* Emit the name of the segment for the data object with the given assembler
+** name if it gets a section of its own. Use g_segname to switch back.
+*/
+
 
 
 /*****************************************************************************/
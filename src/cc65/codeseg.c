@@ -486,6 +486,7 @@ CodeSeg* NewCodeSeg (const char* SegName, SymEntry* Func)
     /* Copy the global optimization settings */
     S->Optimize       = (unsigned char) IS_Get (&Optimize);
     S->CodeSizeFactor = (unsigned) IS_Get (&CodeSizeFactor);
+    S->Volatile       = 0;
 
     /* Return the new struct */
     return S;
@@ -1538,6 +1539,15 @@ void CS_GenRegInfo (CodeSeg* S)
                     if (J->RI->Out2.Tmp1 != Regs.Tmp1) {
                         Regs.Tmp1 = UNKNOWN_REGVAL;
                     }
+                    if (J->RI->Out2.MemA != Regs.MemA) {
+                        Regs.MemA = UNKNOWN_MEMLOC;
+                    }
+                    if (J->RI->Out2.MemX != Regs.MemX) {
+                        Regs.MemX = UNKNOWN_MEMLOC;
+                    }
+                    if (J->RI->Out2.MemY != Regs.MemY) {
+                        Regs.MemY = UNKNOWN_MEMLOC;
+                    }
                     ++Entry;
                 }
 
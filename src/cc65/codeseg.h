@@ -80,6 +80,7 @@ struct CodeSeg {
     Collection      Labels;                     /* Labels for next insn */
     CodeLabel*      LabelHash[CS_LABEL_HASH_SIZE]; /* Label hash table */
     unsigned short  ExitRegs;                   /* Register use on exit */
+    unsigned char   Volatile;                   /* Accesses volatile objects */
 
     /* Optimization settings for this segment */
     unsigned char   Optimize;                   /* On/off switch */
@@ -38,7 +38,9 @@
 
 /* common */
 #include "debugflag.h"
+#include "intstack.h"
 #include "segnames.h"
+#include "tgttrans.h"
 #include "version.h"
 #include "xmalloc.h"
 #include "xsprintf.h"
@@ -46,6 +48,7 @@
 /* cc65 */
 #include "asmlabel.h"
 #include "asmstmt.h"
+#include "callgraph.h"
 #include "codegen.h"
 #include "codeopt.h"
 #include "compile.h"
@@ -58,10 +61,52 @@
 #include "litpool.h"
 #include "macrotab.h"
 #include "output.h"
+#include "pch.h"
 #include "pragma.h"
 #include "preproc.h"
+#include "segments.h"
 #include "standard.h"
 #include "symtab.h"
+#include "wrappedcall.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Options that may be changed by #pragmas */
+static IntStack* const StackableOptions[] = {
+    &WritableStrings,
+    &LocalStrings,
+    &InlineStdFuncs,
+    &EagerlyInlineFuncs,
+    &EnableRegVars,
+    &AllowRegVarAddr,
+    &RegVarsToCallStack,
+    &StaticLocals,
+    &SignedChars,
+    &CheckStack,
+    &Optimize,
+    &CodeSizeFactor,
+    &DataAlignment,
+    &WarnEnable,
+    &WarningsAreErrors,
+    &WarnConstComparison,
+    &WarnNoEffect,
+    &WarnRemapZero,
+    &WarnStructParam,
+    &WarnUnknownPragma,
+    &WarnUnusedLabel,
+    &WarnUnusedParam,
+    &WarnUnusedVar,
+};
+#define OPTION_COUNT    (sizeof (StackableOptions) / sizeof (StackableOptions[0]))
+
+/* Their values saved by SaveCompilerState */
+static IntStack SavedOptions[OPTION_COUNT];
 
 
 
@@ -224,6 +269,9 @@ static void Parse (void)
                         g_usedata ();
                     }
 
+                    /* Use a separate section if requested */
+                    g_sectionname (CS->CurDSeg, Entry->AsmName);
+
                     /* Define a label */
                     g_defgloblabel (Entry->Name);
 
@@ -232,6 +280,11 @@ static void Parse (void)
 
                     /* Parse the initialization */
                     ParseInit (Entry->Type);
+
+                    /* Switch back from the separate section */
+                    if (FunctionSections) {
+                        g_segname (CS->CurDSeg);
+                    }
                 } else {
 
                     if (IsTypeVoid (Decl.Type)) {
@@ -381,9 +434,19 @@ void Compile (const char* FileName)
     /* Generate the code generator preamble */
     g_preamble ();
 
+    /* Remember the predefined macros if precompiled headers are used */
+    if (SB_NotEmpty (&PCHCreateName) || SB_NotEmpty (&PCHUseName)) {
+        PCH_Init ();
+    }
+
     /* Open the input file */
     OpenMainFile (FileName);
 
+    /* Read a precompiled header if requested */
+    if (SB_NotEmpty (&PCHUseName)) {
+        PCH_Read (SB_GetConstBuf (&PCHUseName));
+    }
+
     /* Are we supposed to compile or just preprocess the input? */
     if (PreprocessOnly) {
 
@@ -426,6 +489,11 @@ void FinishCompile (void)
     */
     SetSegName (SEG_BSS, SEGNAME_BSS);
 
+    /* Emit the area for the overlaid static locals */
+    if (OverlayLocals) {
+        CG_EmitFrames ();
+    }
+
     /* Walk over all global symbols:
     ** - for functions, do clean-up and optimizations
     ** - generate code for uninitialized global variables
@@ -445,8 +513,12 @@ void FinishCompile (void)
                 g_segname (SEG_BSS);
             }
             g_usebss ();
+            g_sectionname (SEG_BSS, Entry->AsmName);
             g_defgloblabel (Entry->Name);
             g_res (SizeOf (Entry->Type));
+            if (FunctionSections) {
+                g_segname (SEG_BSS);
+            }
             /* Mark as defined; so that it will be exported, not imported */
             Entry->Flags |= SC_DEF;
         }
@@ -464,3 +536,41 @@ void FinishCompile (void)
     /* Leave the main lexical level */
     LeaveGlobalLevel ();
 }
+
+
+
+void SaveCompilerState (void)
+/* Remember the state set up by the command line, so that it can be restored
+** by RestoreCompilerState before compiling another translation unit.
+*/
+{
+    unsigned I;
+    for (I = 0; I < OPTION_COUNT; ++I) {
+        SavedOptions[I] = *StackableOptions[I];
+    }
+    SaveMacroTab ();
+    SaveSegNames ();
+}
+
+
+
+void RestoreCompilerState (void)
+/* Reset everything that was changed by the last translation unit to the
+** state saved by SaveCompilerState.
+*/
+{
+    unsigned I;
+    for (I = 0; I < OPTION_COUNT; ++I) {
+        *StackableOptions[I] = SavedOptions[I];
+    }
+    RestoreMacroTab ();
+    RestoreSegNames ();
+    ResetLexicalLevels ();
+    ResetInputFiles ();
+    ResetLocalLabels ();
+    ResetWrappedCalls ();
+    CG_Reset ();
+    TgtTranslateInit ();
+    ErrorCount   = 0;
+    WarningCount = 0;
+}
@@ -50,6 +50,16 @@ void Compile (const char* FileName);
 void FinishCompile (void);
 /* Emit literals, externals, do cleanup and optimizations */
 
+void SaveCompilerState (void);
+/* Remember the state set up by the command line, so that it can be restored
+** by RestoreCompilerState before compiling another translation unit.
+*/
+
+void RestoreCompilerState (void);
+/* Reset everything that was changed by the last translation unit to the
+** state saved by SaveCompilerState.
+*/
+
 
 
 /* End of compile.h */
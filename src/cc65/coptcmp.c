@@ -539,7 +539,7 @@ unsigned OptCmp4 (CodeSeg* S)
             L[0]->OPC == OP65_LDX            &&
             !CE_HasLabel (L[0])              &&
             IsImmCmp16 (L+1)                 &&
-            !RegAXUsed (S, I+6)) {
+            !RegAXUsed (S, I+5)) {
 
             if ((L[4]->Info & OF_FBRA) != 0 && L[1]->Num == 0 && L[3]->Num == 0) {
                 /* The value is zero, we may use the simple code version. */
@@ -200,6 +200,18 @@ static short RegVal (unsigned short Use, const RegContents* RC)
 
 
 
+static int MemLocIsReusable (const CodeSeg* S, unsigned Loc)
+/* Return true if a register holding the memory location Loc may be used
+** instead of accessing the location. Named locations in functions that
+** access volatile objects are not reused.
+*/
+{
+    return Loc != UNKNOWN_MEMLOC &&
+           (MEMLOC_TYPE (Loc) != MEMLOC_NAMED || !S->Volatile);
+}
+
+
+
 /*****************************************************************************/
 /*                        Replace jumps to RTS by RTS                        */
 /*****************************************************************************/
@@ -1193,6 +1205,14 @@ unsigned OptDupLoads (CodeSeg* S)
                     In->RegA == ZPRegVal (E->Chg, In)) { /* Value identical */
 
                     Delete = 1;
+
+                /* If A was loaded from the same location, the store is not
+                ** needed.
+                */
+                } else if (MemLocIsReusable (S, In->MemA)          &&
+                           In->MemA == CE_GetMemLoc (E, In)) {
+
+                    Delete = 1;
                 }
                 break;
 
@@ -1207,6 +1227,14 @@ unsigned OptDupLoads (CodeSeg* S)
 
                     Delete = 1;
 
+                /* If X was loaded from the same location, the store is not
+                ** needed.
+                */
+                } else if (MemLocIsReusable (S, In->MemX)          &&
+                           In->MemX == CE_GetMemLoc (E, In)) {
+
+                    Delete = 1;
+
                 /* If the value in the X register is known and the same as
                 ** that in the A register, replace the store by a STA. The
                 ** optimizer will then remove the load instruction for X
@@ -1233,6 +1261,14 @@ unsigned OptDupLoads (CodeSeg* S)
 
                     Delete = 1;
 
+                /* If Y was loaded from the same location, the store is not
+                ** needed.
+                */
+                } else if (MemLocIsReusable (S, In->MemY)          &&
+                           In->MemY == CE_GetMemLoc (E, In)) {
+
+                    Delete = 1;
+
                 /* If the value in the Y register is known and the same as
                 ** that in the A register, replace the store by a STA. The
                 ** optimizer will then remove the load instruction for Y
@@ -1332,6 +1368,108 @@ unsigned OptDupLoads (CodeSeg* S)
 
 
 
+unsigned OptMemLoads (CodeSeg* S)
+/* Remove loads of memory locations whose contents are already in the
+** register, and replace loads of locations held in another register by a
+** transfer.
+*/
+{
+    unsigned Changes = 0;
+    unsigned I;
+
+    /* Walk over the entries */
+    I = 0;
+    while (I < CS_GetEntryCount (S)) {
+
+        CodeEntry* N;
+        unsigned Loc;
+
+        /* Get next entry */
+        CodeEntry* E = CS_GetEntry (S, I);
+
+        /* Get a pointer to the input registers of the insn */
+        const RegContents* In = &E->RI->In;
+
+        /* Assume we won't change anything */
+        int Delete = 0;
+        opc_t Xfr  = OP65_NOP;
+
+        /* Check for a load of a memory location we know */
+        if ((E->Info & OF_LOAD) != 0 &&
+            MemLocIsReusable (S, Loc = CE_GetMemLoc (E, In))) {
+
+            switch (E->OPC) {
+
+                case OP65_LDA:
+                    if (In->MemA == Loc) {
+                        Delete = 1;
+                    } else if (In->MemX == Loc) {
+                        Xfr = OP65_TXA;
+                    } else if (In->MemY == Loc) {
+                        Xfr = OP65_TYA;
+                    }
+                    break;
+
+                case OP65_LDX:
+                    if (In->MemX == Loc) {
+                        Delete = 1;
+                    } else if (In->MemA == Loc) {
+                        Xfr = OP65_TAX;
+                    }
+                    break;
+
+                case OP65_LDY:
+                    if (In->MemY == Loc) {
+                        Delete = 1;
+                    } else if (In->MemA == Loc) {
+                        Xfr = OP65_TAY;
+                    }
+                    break;
+
+                default:
+                    break;
+            }
+        }
+
+        /* The load sets the flags, so it can only be removed if the next
+        ** insn doesn't use them. A transfer sets them in the same way.
+        */
+        if (Delete                            &&
+            (N = CS_GetNextEntry (S, I)) != 0 &&
+            !CE_UseLoadFlags (N)) {
+
+            /* Remove the load */
+            CS_DelEntry (S, I);
+
+            /* Remember, we had changes */
+            ++Changes;
+
+        } else {
+
+            if (Xfr != OP65_NOP) {
+
+                /* Replace the load by a transfer */
+                CodeEntry* X = NewCodeEntry (Xfr, AM65_IMP, 0, 0, E->LI);
+                CS_InsertEntry (S, X, I+1);
+                CS_DelEntry (S, I);
+
+                /* Remember, we had changes */
+                ++Changes;
+            }
+
+            /* Next entry */
+            ++I;
+
+        }
+
+    }
+
+    /* Return the number of changes made */
+    return Changes;
+}
+
+
+
 unsigned OptStoreLoad (CodeSeg* S)
 /* Remove a store followed by a load from the same location. */
 {
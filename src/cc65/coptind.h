@@ -115,6 +115,12 @@ unsigned OptUnusedStores (CodeSeg* S);
 unsigned OptDupLoads (CodeSeg* S);
 /* Remove loads of registers where the value loaded is already in the register. */
 
+unsigned OptMemLoads (CodeSeg* S);
+/* Remove loads of memory locations whose contents are already in the
+** register, and replace loads of locations held in another register by a
+** transfer.
+*/
+
 unsigned OptStoreLoad (CodeSeg* S);
 /* Remove a store followed by a load from the same location. */
 
@@ -0,0 +1,257 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                               coptinline.c                                */
+/*                                                                           */
+/*                    Inlining of small static functions                     */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <string.h>
+
+/* common */
+#include "coll.h"
+
+/* cc65 */
+#include "codeent.h"
+#include "codeinfo.h"
+#include "coptinline.h"
+#include "segments.h"
+#include "symtab.h"
+
+
+
+/*****************************************************************************/
+/*                             Helper functions                              */
+/*****************************************************************************/
+
+
+
+static CodeSeg* GetInlineCandidate (const CodeSeg* S, const CodeEntry* E)
+/* If E is a call to a static function defined in this module that is small
+** enough to be inlined into S, return the code segment of the function.
+** Otherwise return NULL.
+*/
+{
+    const SymEntry* Func;
+    CodeSeg*        Code;
+    unsigned        MaxSize;
+    unsigned        Size;
+    unsigned        I;
+
+    /* Must be a call to a C function */
+    if (E->OPC != OP65_JSR || E->AM != AM65_ABS || E->Arg[0] != '_') {
+        return 0;
+    }
+
+    /* Must be a static function that is defined in this module */
+    Func = FindGlobalSym (E->Arg + 1);
+    if (Func == 0                                       ||
+        !IsTypeFunc (Func->Type)                        ||
+        !SymIsDef (Func)                                ||
+        (Func->Flags & SC_EXTERN) != 0                  ||
+        Func->V.F.Seg == 0                              ||
+        SymGetAsmName (Func) == 0                       ||
+        strcmp (SymGetAsmName (Func), E->Arg) != 0      ||
+        Func == S->Func) {
+        return 0;
+    }
+    Code = Func->V.F.Seg->Code;
+
+    /* Don't touch functions that have the optimizer disabled */
+    if (!Code->Optimize) {
+        return 0;
+    }
+
+    /* Functions declared inline are always considered, all others only if
+    ** the code size factor allows larger code.
+    */
+    if (Func->Flags & SC_INLINE) {
+        MaxSize = S->CodeSizeFactor / 4;
+    } else if (S->CodeSizeFactor > 100) {
+        MaxSize = (S->CodeSizeFactor - 100) / 4;
+    } else {
+        return 0;
+    }
+
+    /* Check the function body */
+    Size = 0;
+    for (I = 0; I < CS_GetEntryCount (Code); ++I) {
+
+        const CodeEntry* X = CS_GetEntry (Code, I);
+
+        /* Code that accesses the return address on the hardware stack, or
+        ** returns with rti cannot be moved.
+        */
+        if (X->OPC == OP65_TSX || X->OPC == OP65_TXS || X->OPC == OP65_RTI) {
+            return 0;
+        }
+
+        /* Jumps must either go to a label inside the function, or be tail
+        ** calls of other functions. Indirect jumps are not allowed.
+        */
+        if (X->Info & OF_BRA) {
+            if (X->AM != AM65_BRA) {
+                return 0;
+            }
+            if (X->JumpTo == 0) {
+                if (X->OPC != OP65_JMP) {
+                    return 0;
+                }
+            } else if (X->JumpTo->Owner == 0) {
+                return 0;
+            }
+        }
+
+        /* Check the size */
+        Size += X->Size;
+        if (Size > MaxSize) {
+            return 0;
+        }
+    }
+
+    /* Ok, inline it */
+    return Code;
+}
+
+
+
+static unsigned InlineCall (CodeSeg* S, unsigned Index, CodeSeg* Code)
+/* Replace the call at Index in S by a copy of the code in Code. Returns the
+** number of entries inserted.
+*/
+{
+    Collection  Copies = AUTO_COLLECTION_INITIALIZER;
+    Collection  Map    = AUTO_COLLECTION_INITIALIZER;
+    CodeLabel*  Ret;
+    unsigned    Count = CS_GetEntryCount (Code);
+    unsigned    I;
+
+    /* All returns jump to the instruction following the call */
+    Ret = CS_GenLabel (S, CS_GetEntry (S, Index + 1));
+
+    /* Copy the entries. Map contains the copy for each entry of the original
+    ** code. Jumps to labels inside the function are resolved in a second
+    ** pass, since they may be forward references.
+    */
+    for (I = 0; I < Count; ++I) {
+
+        const CodeEntry* E = CS_GetEntry (Code, I);
+        CodeEntry* X;
+
+        if (E->OPC == OP65_RTS) {
+            X = NewCodeEntry (OP65_JMP, AM65_BRA, Ret->Name, Ret, E->LI);
+        } else if (E->OPC == OP65_JMP && E->JumpTo == 0) {
+            /* Tail call of another function. Call it and return. */
+            X = NewCodeEntry (OP65_JSR, AM65_ABS, E->Arg, 0, E->LI);
+        } else {
+            X = NewCodeEntry (E->OPC, E->AM, E->Arg, 0, E->LI);
+        }
+        CollAppend (&Map, X);
+        CollAppend (&Copies, X);
+        if (X->OPC == OP65_JSR && E->OPC == OP65_JMP) {
+            CollAppend (&Copies, NewCodeEntry (OP65_JMP, AM65_BRA, Ret->Name,
+                                               Ret, E->LI));
+        }
+
+        /* The copy of a labeled entry gets a label of its own */
+        if (CE_HasLabel (E)) {
+            CS_GenLabel (S, X);
+        }
+    }
+
+    /* Resolve the jumps inside the function */
+    for (I = 0; I < Count; ++I) {
+        const CodeEntry* E = CS_GetEntry (Code, I);
+        if (E->JumpTo != 0) {
+            CodeEntry* X = CollAtUnchecked (&Map, I);
+            unsigned   Target = CS_GetEntryIndex (Code, E->JumpTo->Owner);
+            CodeLabel* L = CE_GetLabel (CollAtUnchecked (&Map, Target), 0);
+            CE_SetArg (X, L->Name);
+            X->JumpTo = L;
+            CollAppend (&L->JumpFrom, X);
+        }
+    }
+
+    /* Insert the copies behind the call */
+    for (I = 0; I < CollCount (&Copies); ++I) {
+        CS_InsertEntry (S, CollAtUnchecked (&Copies, I), Index + 1 + I);
+    }
+
+    /* Remove the call. Any labels are moved to the first inserted entry. */
+    CS_DelEntry (S, Index);
+
+    /* Cleanup */
+    I = CollCount (&Copies);
+    DoneCollection (&Copies);
+    DoneCollection (&Map);
+
+    /* Return the number of inserted entries */
+    return I;
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+unsigned OptInline (CodeSeg* S)
+/* Replace calls to small static functions defined in the same module by a
+** copy of the function body. Returns the number of changes made.
+*/
+{
+    unsigned Changes = 0;
+
+    /* Walk over the entries. Code that was inlined is not looked at again,
+    ** so recursive functions cannot blow up the code.
+    */
+    unsigned I = 0;
+    while (I + 1 < CS_GetEntryCount (S)) {
+
+        /* Check if this is a call of a function we can inline */
+        CodeSeg* Code = GetInlineCandidate (S, CS_GetEntry (S, I));
+        if (Code) {
+
+            /* Replace the call by the function body and skip it */
+            I += InlineCall (S, I, Code);
+
+            /* Remember, we had changes */
+            ++Changes;
+
+        } else {
+
+            /* Next entry */
+            ++I;
+
+        }
+    }
+
+    /* Return the number of changes made */
+    return Changes;
+}
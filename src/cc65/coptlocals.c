@@ -0,0 +1,904 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                               coptlocals.c                                */
+/*                                                                           */
+/*                Optimizations for variables on the C stack                 */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <string.h>
+
+
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* common */
+#include "xmalloc.h"
+
+/* cc65 */
+#include "codeent.h"
+#include "codeinfo.h"
+#include "codegen.h"
+#include "coptlocals.h"
+#include "datatype.h"
+#include "funcdesc.h"
+#include "global.h"
+#include "symtab.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Range of the tracked stack locations. Locations are given relative to the
+** stack pointer on entry of the function, so locals have negative and
+** parameters pushed by the caller have positive offsets.
+*/
+#define LOC_FIRST       (-256)
+#define LOC_COUNT       512
+
+/* A set of stack locations */
+typedef struct LocSet LocSet;
+struct LocSet {
+    unsigned char       Bits[LOC_COUNT / CHAR_BIT];
+};
+
+/* Stack depth of an insn that hasn't been reached */
+#define DEPTH_UNKNOWN   INT_MIN
+
+/* Flags for the stack effect of an insn */
+#define SE_NONE         0x00U
+#define SE_READALL      0x01U   /* Reads unknown stack locations */
+#define SE_EXIT         0x02U   /* Leaves the function */
+#define SE_STORE        0x04U   /* Only stores, may be removed */
+#define SE_WRITEALL     0x08U   /* Writes unknown stack locations */
+
+/* The effect of an insn on the C stack. Offsets are relative to the stack
+** pointer before the insn.
+*/
+typedef struct StackEffect StackEffect;
+struct StackEffect {
+    int                 ReadOfs;        /* First byte read */
+    unsigned            ReadCount;      /* Number of bytes read */
+    int                 WriteOfs;       /* First byte written */
+    unsigned            WriteCount;     /* Number of bytes written */
+    int                 Pop;            /* Bytes removed, negative if pushed */
+    unsigned            Flags;          /* SE_xxx */
+};
+
+/* Information about an insn */
+typedef struct InsnInfo InsnInfo;
+struct InsnInfo {
+    StackEffect         Eff;            /* Effect on the stack */
+    int                 Depth;          /* Bytes pushed since function entry */
+    int                 Next;           /* Index of the next insn or -1 */
+    int                 Target;         /* Index of the jump target or -1 */
+    int                 Ptr1;           /* Location loaded into ptr1 or PTR1_NONE */
+    LocSet              LiveIn;         /* Locations live before the insn */
+};
+
+/* Contents of ptr1 before an insn that hasn't been reached, and if it isn't
+** a stack location.
+*/
+#define PTR1_UNKNOWN    INT_MIN
+#define PTR1_NONE       INT_MAX
+
+/* Flags for the runtime functions */
+#define RF_NONE         0x00U
+#define RF_READ_Y       0x01U   /* Read offset is relative to Y */
+#define RF_WRITE_Y      0x02U   /* Write offset is relative to Y */
+#define RF_STORE        0x04U   /* Only stores, may be removed */
+#define RF_ADDYSP       0x08U   /* Removes Y bytes */
+#define RF_SUBYSP       0x10U   /* Pushes Y bytes */
+#define RF_REGSWAP      0x20U   /* Swaps A bytes at Y with the register bank */
+#define RF_UNKNOWN      0x40U   /* Unknown effect */
+
+/* Effect of the runtime functions that use the C stack */
+typedef struct RuntimeFunc RuntimeFunc;
+struct RuntimeFunc {
+    const char*         Name;
+    signed char         ReadOfs;        /* First byte read */
+    unsigned char       ReadCount;      /* Number of bytes read */
+    signed char         WriteOfs;       /* First byte written */
+    unsigned char       WriteCount;     /* Number of bytes written */
+    signed char         Pop;            /* Bytes removed, negative if pushed */
+    unsigned char       Flags;          /* RF_xxx */
+};
+
+/* This table must contain all functions from the table in codeinfo.c that
+** use the C stack, with the exception of the tosxxx functions, which are
+** handled in GetRuntimeEffect. Keep it sorted.
+*/
+static const RuntimeFunc RuntimeFuncs[] = {
+    { "addeq0sp",    0, 2,  0, 2,  0, RF_NONE                       },
+    { "addeqysp",    0, 2,  0, 2,  0, RF_READ_Y | RF_WRITE_Y        },
+    { "addysp",      0, 0,  0, 0,  0, RF_ADDYSP                     },
+    { "callax",      0, 0,  0, 0,  0, RF_UNKNOWN                    },
+    { "decsp1",      0, 0,  0, 0, -1, RF_NONE                       },
+    { "decsp2",      0, 0,  0, 0, -2, RF_NONE                       },
+    { "decsp3",      0, 0,  0, 0, -3, RF_NONE                       },
+    { "decsp4",      0, 0,  0, 0, -4, RF_NONE                       },
+    { "decsp5",      0, 0,  0, 0, -5, RF_NONE                       },
+    { "decsp6",      0, 0,  0, 0, -6, RF_NONE                       },
+    { "decsp7",      0, 0,  0, 0, -7, RF_NONE                       },
+    { "decsp8",      0, 0,  0, 0, -8, RF_NONE                       },
+    { "incsp1",      0, 0,  0, 0,  1, RF_NONE                       },
+    { "incsp2",      0, 0,  0, 0,  2, RF_NONE                       },
+    { "incsp3",      0, 0,  0, 0,  3, RF_NONE                       },
+    { "incsp4",      0, 0,  0, 0,  4, RF_NONE                       },
+    { "incsp5",      0, 0,  0, 0,  5, RF_NONE                       },
+    { "incsp6",      0, 0,  0, 0,  6, RF_NONE                       },
+    { "incsp7",      0, 0,  0, 0,  7, RF_NONE                       },
+    { "incsp8",      0, 0,  0, 0,  8, RF_NONE                       },
+    { "laddeq0sp",   0, 4,  0, 4,  0, RF_NONE                       },
+    { "laddeqysp",   0, 4,  0, 4,  0, RF_READ_Y | RF_WRITE_Y        },
+    { "ldax0sp",     0, 2,  0, 0,  0, RF_NONE                       },
+    { "ldaxysp",    -1, 2,  0, 0,  0, RF_READ_Y                     },
+    { "ldeax0sp",    0, 4,  0, 0,  0, RF_NONE                       },
+    { "ldeaxysp",   -3, 4,  0, 0,  0, RF_READ_Y                     },
+    { "leaa0sp",     0, 0,  0, 0,  0, RF_UNKNOWN                    },
+    { "leaaxsp",     0, 0,  0, 0,  0, RF_UNKNOWN                    },
+    { "lsubeq0sp",   0, 4,  0, 4,  0, RF_NONE                       },
+    { "lsubeqysp",   0, 4,  0, 4,  0, RF_READ_Y | RF_WRITE_Y        },
+    { "popa",        0, 1,  0, 0,  1, RF_NONE                       },
+    { "popax",       0, 2,  0, 0,  2, RF_NONE                       },
+    { "popeax",      0, 4,  0, 0,  4, RF_NONE                       },
+    { "popptr1",     0, 2,  0, 0,  2, RF_NONE                       },
+    { "popsreg",     0, 2,  0, 0,  2, RF_NONE                       },
+    { "push0",       0, 0, -2, 2, -2, RF_NONE                       },
+    { "push0ax",     0, 0, -4, 4, -4, RF_NONE                       },
+    { "push1",       0, 0, -2, 2, -2, RF_NONE                       },
+    { "push2",       0, 0, -2, 2, -2, RF_NONE                       },
+    { "push3",       0, 0, -2, 2, -2, RF_NONE                       },
+    { "push4",       0, 0, -2, 2, -2, RF_NONE                       },
+    { "push5",       0, 0, -2, 2, -2, RF_NONE                       },
+    { "push6",       0, 0, -2, 2, -2, RF_NONE                       },
+    { "push7",       0, 0, -2, 2, -2, RF_NONE                       },
+    { "pusha",       0, 0, -1, 1, -1, RF_NONE                       },
+    { "pusha0",      0, 0, -2, 2, -2, RF_NONE                       },
+    { "pusha0sp",    0, 1, -1, 1, -1, RF_NONE                       },
+    { "pushax",      0, 0, -2, 2, -2, RF_NONE                       },
+    { "pushaysp",    0, 1, -1, 1, -1, RF_READ_Y                     },
+    { "pushc0",      0, 0, -1, 1, -1, RF_NONE                       },
+    { "pushc1",      0, 0, -1, 1, -1, RF_NONE                       },
+    { "pushc2",      0, 0, -1, 1, -1, RF_NONE                       },
+    { "pusheax",     0, 0, -4, 4, -4, RF_NONE                       },
+    { "pushl0",      0, 0, -4, 4, -4, RF_NONE                       },
+    { "pushw",       0, 0, -2, 2, -2, RF_NONE                       },
+    { "pushw0sp",    0, 2, -2, 2, -2, RF_NONE                       },
+    { "pushwidx",    0, 0, -2, 2, -2, RF_NONE                       },
+    { "pushwysp",   -3, 2, -2, 2, -2, RF_READ_Y                     },
+    { "regswap",     0, 0,  0, 0,  0, RF_REGSWAP                    },
+    { "regswap1",    0, 1,  0, 1,  0, RF_READ_Y | RF_WRITE_Y        },
+    { "regswap2",    0, 2,  0, 2,  0, RF_READ_Y | RF_WRITE_Y        },
+    { "staspidx",    0, 2,  0, 0,  2, RF_NONE                       },
+    { "stax0sp",     0, 0,  0, 2,  0, RF_STORE                      },
+    { "staxspidx",   0, 2,  0, 0,  2, RF_NONE                       },
+    { "staxysp",     0, 0,  0, 2,  0, RF_WRITE_Y | RF_STORE         },
+    { "steax0sp",    0, 0,  0, 4,  0, RF_STORE                      },
+    { "steaxysp",    0, 0,  0, 4,  0, RF_WRITE_Y | RF_STORE         },
+    { "subeq0sp",    0, 2,  0, 2,  0, RF_NONE                       },
+    { "subeqysp",    0, 2,  0, 2,  0, RF_READ_Y | RF_WRITE_Y        },
+    { "subysp",      0, 0,  0, 0,  0, RF_SUBYSP                     },
+    { "tosint",      0, 0,  0, 0,  0, RF_UNKNOWN                    },
+    { "toslong",     0, 0,  0, 0,  0, RF_UNKNOWN                    },
+    { "tosulong",    0, 0,  0, 0,  0, RF_UNKNOWN                    },
+};
+#define RuntimeFuncCount (sizeof (RuntimeFuncs) / sizeof (RuntimeFuncs[0]))
+
+
+
+/*****************************************************************************/
+/*                             Helper functions                              */
+/*****************************************************************************/
+
+
+
+static int CompareRuntimeFunc (const void* Name, const void* Func)
+/* Compare function for bsearch */
+{
+    return strcmp ((const char*) Name, ((const RuntimeFunc*) Func)->Name);
+}
+
+
+
+static int EndsWith (const char* S, const char* Tail)
+/* Return true if the string S ends with Tail */
+{
+    size_t Len     = strlen (S);
+    size_t TailLen = strlen (Tail);
+    return Len >= TailLen && strcmp (S + Len - TailLen, Tail) == 0;
+}
+
+
+
+static int IsStackPtr (const char* Arg)
+/* Return true if the argument references the C stack pointer */
+{
+    return strcmp (Arg, "sp") == 0 || strncmp (Arg, "sp+", 3) == 0;
+}
+
+
+
+static unsigned CallerParamSize (const SymEntry* Func)
+/* Return the number of parameter bytes pushed by the caller of a function
+** with a fixed parameter list. The last parameter of a fastcall function is
+** passed in registers.
+*/
+{
+    const FuncDesc* D = GetFuncDesc (Func->Type);
+    unsigned Size = D->ParamSize;
+    if (D->ParamCount > 0 &&
+        (AutoCDecl ? IsQualFastcall (Func->Type) : !IsQualCDecl (Func->Type))) {
+        Size -= CheckedSizeOf (D->LastParam->Type);
+    }
+    return Size;
+}
+
+
+
+static int GetCallEffect (const CodeEntry* E, const char* Name, StackEffect* Eff)
+/* Determine the effect of a call to the C function Name. Return false if it
+** is unknown.
+*/
+{
+    /* Search for the function, skip the leading underscore */
+    const SymEntry* Func = FindGlobalSym (Name + 1);
+    if (Func == 0 || !IsTypeFunc (Func->Type) ||
+        (GetFuncDesc (Func->Type)->Flags & FD_CALL_WRAPPER) != 0) {
+        return 0;
+    }
+
+    /* The callee reads its parameters and removes them from the stack. For
+    ** variadic functions, the caller passes the size in Y.
+    */
+    if ((TypeOf (Func->Type) & CF_FIXARGC) == 0) {
+        if (!RegValIsKnown (E->RI->In.RegY)) {
+            return 0;
+        }
+        Eff->Pop = E->RI->In.RegY;
+    } else {
+        Eff->Pop = CallerParamSize (Func);
+    }
+    Eff->ReadOfs   = 0;
+    Eff->ReadCount = Eff->Pop;
+    return 1;
+}
+
+
+
+static int GetRuntimeEffect (const CodeEntry* E, const char* Name, StackEffect* Eff)
+/* Determine the effect of a call to the runtime function Name. Return false
+** if it is unknown.
+*/
+{
+    const RegContents* In = &E->RI->In;
+    const RuntimeFunc* F;
+    unsigned short Use, Chg;
+    int Y;
+
+    F = bsearch (Name, RuntimeFuncs, RuntimeFuncCount, sizeof (RuntimeFuncs[0]),
+                 CompareRuntimeFunc);
+    if (F == 0) {
+
+        /* The operators taking their left operand from the stack remove it.
+        ** It is a long for the functions ending with "eax" and "0ax", and an
+        ** int otherwise.
+        */
+        if (strncmp (Name, "tos", 3) == 0) {
+            if (EndsWith (Name, "eax") || EndsWith (Name, "0ax") ||
+                strcmp (Name, "toslcmp") == 0) {
+                Eff->Pop = 4;
+            } else {
+                Eff->Pop = 2;
+            }
+            Eff->ReadCount = Eff->Pop;
+            return 1;
+        }
+
+        /* Other functions known to the optimizer don't use the C stack */
+        GetFuncInfo (Name, &Use, &Chg);
+        return Use != REG_ALL || Chg != REG_ALL;
+    }
+
+    if (F->Flags & RF_UNKNOWN) {
+        return 0;
+    }
+
+    /* Get the value of Y if it is needed */
+    Y = 0;
+    if (F->Flags & (RF_READ_Y | RF_WRITE_Y | RF_ADDYSP | RF_SUBYSP | RF_REGSWAP)) {
+        Y = In->RegY;
+        if (!RegValIsKnown (Y)) {
+            /* Accesses of unknown locations are allowed if they don't
+            ** change the stack pointer.
+            */
+            if (F->Flags & RF_STORE) {
+                Eff->Flags |= SE_WRITEALL;
+                return 1;
+            } else if (F->Pop == 0 && (F->Flags & (RF_ADDYSP | RF_SUBYSP)) == 0) {
+                Eff->Flags |= SE_READALL | SE_WRITEALL;
+                return 1;
+            }
+            return 0;
+        }
+    }
+
+    Eff->ReadOfs    = F->ReadOfs + ((F->Flags & RF_READ_Y)? Y : 0);
+    Eff->ReadCount  = F->ReadCount;
+    Eff->WriteOfs   = F->WriteOfs + ((F->Flags & RF_WRITE_Y)? Y : 0);
+    Eff->WriteCount = F->WriteCount;
+    Eff->Pop        = F->Pop;
+    if (F->Flags & RF_STORE) {
+        Eff->Flags |= SE_STORE;
+    }
+    if (F->Flags & RF_ADDYSP) {
+        Eff->Pop = Y;
+    } else if (F->Flags & RF_SUBYSP) {
+        Eff->Pop = -Y;
+    } else if (F->Flags & RF_REGSWAP) {
+        if (!RegValIsKnown (In->RegA)) {
+            return 0;
+        }
+        Eff->ReadOfs   = Eff->WriteOfs = Y;
+        Eff->ReadCount = Eff->WriteCount = In->RegA;
+    }
+    return 1;
+}
+
+
+
+static int GetStackEffect (const CodeEntry* E, StackEffect* Eff)
+/* Determine the effect of E on the C stack. Return false if it is unknown. */
+{
+    /* Assume no effect */
+    memset (Eff, 0, sizeof (*Eff));
+
+    /* Calls and jumps to subroutines outside of the function */
+    if (E->OPC == OP65_JSR || (E->OPC == OP65_JMP && E->JumpTo == 0)) {
+        if (E->AM != AM65_ABS && E->AM != AM65_BRA) {
+            return 0;
+        }
+        if (E->OPC == OP65_JMP) {
+            Eff->Flags |= SE_EXIT;
+        }
+        if (E->Arg[0] == '_') {
+            return GetCallEffect (E, E->Arg, Eff);
+        } else {
+            return GetRuntimeEffect (E, E->Arg, Eff);
+        }
+    }
+
+    /* Accesses of stack locations */
+    if ((E->AM == AM65_ZP_INDY || E->AM == AM65_ZP_IND) && IsStackPtr (E->Arg)) {
+        int Y = (E->AM == AM65_ZP_IND)? 0 : E->RI->In.RegY;
+        switch (E->OPC) {
+            case OP65_STA:
+                if (RegValIsKnown (Y)) {
+                    Eff->WriteOfs   = Y;
+                    Eff->WriteCount = 1;
+                    Eff->Flags     |= SE_STORE;
+                } else {
+                    Eff->Flags |= SE_WRITEALL;
+                }
+                return 1;
+            case OP65_ADC:
+            case OP65_AND:
+            case OP65_CMP:
+            case OP65_EOR:
+            case OP65_LDA:
+            case OP65_ORA:
+            case OP65_SBC:
+                if (RegValIsKnown (Y)) {
+                    Eff->ReadOfs   = Y;
+                    Eff->ReadCount = 1;
+                } else {
+                    Eff->Flags |= SE_READALL;
+                }
+                return 1;
+            default:
+                return 0;
+        }
+    }
+
+    /* Any other use of the stack pointer may take the address of a local */
+    if (IsStackPtr (E->Arg)) {
+        return 0;
+    }
+
+    switch (E->OPC) {
+        case OP65_RTI:
+        case OP65_RTS:
+            Eff->Flags |= SE_EXIT;
+            return 1;
+        case OP65_BRK:
+            return 0;
+        default:
+            /* Branches must stay inside of the function */
+            return (E->Info & OF_BRA) == 0 || E->JumpTo != 0;
+    }
+}
+
+
+
+static void SetLoc (LocSet* Set, int Loc)
+/* Add a location to a set */
+{
+    Loc -= LOC_FIRST;
+    Set->Bits[Loc / CHAR_BIT] |= (unsigned char) (1U << (Loc % CHAR_BIT));
+}
+
+
+
+static void ClearLoc (LocSet* Set, int Loc)
+/* Remove a location from a set */
+{
+    Loc -= LOC_FIRST;
+    Set->Bits[Loc / CHAR_BIT] &= (unsigned char) ~(1U << (Loc % CHAR_BIT));
+}
+
+
+
+static int HasLoc (const LocSet* Set, int Loc)
+/* Return true if the location is in the set */
+{
+    Loc -= LOC_FIRST;
+    return (Set->Bits[Loc / CHAR_BIT] & (1U << (Loc % CHAR_BIT))) != 0;
+}
+
+
+
+static int RangeIsValid (int First, unsigned Count)
+/* Return true if the locations First to First+Count-1 are tracked */
+{
+    return Count == 0 ||
+           (First >= LOC_FIRST && First + (int) Count <= LOC_FIRST + LOC_COUNT);
+}
+
+
+
+static int GetDepths (InsnInfo* Info, unsigned Count, int ExitDepth)
+/* Determine the stack depth for all insns reachable from the function entry.
+** Return false if it is not the same on all paths to an insn, or if an insn
+** has an unknown effect on the stack.
+*/
+{
+    Collection Work = AUTO_COLLECTION_INITIALIZER;
+    unsigned I;
+    int OK = 1;
+
+    for (I = 0; I < Count; ++I) {
+        Info[I].Depth = DEPTH_UNKNOWN;
+    }
+    Info[0].Depth = 0;
+    CollAppend (&Work, &Info[0]);
+
+    while (OK && CollCount (&Work) > 0) {
+
+        InsnInfo* N = CollPop (&Work);
+        int Succ[2];
+        unsigned J;
+        int Depth;
+
+        /* Compute the depth after the insn, and check the locations */
+        Depth = N->Depth - N->Eff.Pop;
+        if (!RangeIsValid (N->Eff.ReadOfs - N->Depth, N->Eff.ReadCount)   ||
+            !RangeIsValid (N->Eff.WriteOfs - N->Depth, N->Eff.WriteCount) ||
+            Depth < LOC_FIRST || Depth > -LOC_FIRST) {
+            OK = 0;
+            break;
+        }
+
+        /* On exit, the parameters must have been removed */
+        if (N->Eff.Flags & SE_EXIT) {
+            if (Depth != ExitDepth) {
+                OK = 0;
+            }
+            continue;
+        }
+
+        /* Propagate the depth to the successors */
+        Succ[0] = N->Next;
+        Succ[1] = N->Target;
+        for (J = 0; J < 2; ++J) {
+            if (Succ[J] >= 0) {
+                InsnInfo* X = &Info[Succ[J]];
+                if (X->Depth == DEPTH_UNKNOWN) {
+                    X->Depth = Depth;
+                    CollAppend (&Work, X);
+                } else if (X->Depth != Depth) {
+                    OK = 0;
+                }
+            }
+        }
+    }
+
+    DoneCollection (&Work);
+    return OK;
+}
+
+
+
+static void GetLiveOut (const InsnInfo* Info, const InsnInfo* N, LocSet* Out)
+/* Get the locations live after an insn */
+{
+    unsigned I;
+
+    memset (Out, 0, sizeof (*Out));
+    if ((N->Eff.Flags & SE_EXIT) == 0) {
+        if (N->Next >= 0) {
+            *Out = Info[N->Next].LiveIn;
+        }
+        if (N->Target >= 0) {
+            const LocSet* T = &Info[N->Target].LiveIn;
+            for (I = 0; I < sizeof (Out->Bits); ++I) {
+                Out->Bits[I] |= T->Bits[I];
+            }
+        }
+    }
+}
+
+
+
+static void GetLiveness (InsnInfo* Info, unsigned Count)
+/* Determine the stack locations live before each reachable insn */
+{
+    unsigned I;
+    int Changed;
+
+    for (I = 0; I < Count; ++I) {
+        memset (&Info[I].LiveIn, 0, sizeof (Info[I].LiveIn));
+    }
+
+    /* Iterate backwards until nothing changes */
+    do {
+        Changed = 0;
+        I = Count;
+        while (I-- > 0) {
+
+            InsnInfo* N = &Info[I];
+            LocSet Live;
+            unsigned J;
+
+            if (N->Depth == DEPTH_UNKNOWN) {
+                continue;
+            }
+
+            GetLiveOut (Info, N, &Live);
+            for (J = 0; J < N->Eff.WriteCount; ++J) {
+                ClearLoc (&Live, N->Eff.WriteOfs - N->Depth + (int) J);
+            }
+            if (N->Eff.Flags & SE_READALL) {
+                memset (&Live, 0xFF, sizeof (Live));
+            } else {
+                for (J = 0; J < N->Eff.ReadCount; ++J) {
+                    SetLoc (&Live, N->Eff.ReadOfs - N->Depth + (int) J);
+                }
+            }
+
+            if (memcmp (&Live, &N->LiveIn, sizeof (Live)) != 0) {
+                N->LiveIn = Live;
+                Changed = 1;
+            }
+        }
+    } while (Changed);
+}
+
+
+
+static InsnInfo* GetInsnInfo (CodeSeg* S)
+/* Determine the effect of all insns on the C stack, the control flow, and the
+** stack depth. Return NULL if the function cannot be handled.
+*/
+{
+    unsigned Count = CS_GetEntryCount (S);
+    InsnInfo* Info;
+    unsigned I;
+
+    /* Stores to volatile locals must stay */
+    if (Count == 0 || S->Func == 0 || S->Volatile) {
+        return 0;
+    }
+
+    /* Functions with a variable parameter list use enter and leave, which
+    ** are not tracked. Other functions remove their parameters on return.
+    */
+    if ((TypeOf (S->Func->Type) & CF_FIXARGC) == 0) {
+        return 0;
+    }
+
+    /* Determine the effect of the insns and the control flow */
+    Info = xmalloc (Count * sizeof (Info[0]));
+    for (I = 0; I < Count; ++I) {
+
+        CodeEntry* E = CS_GetEntry (S, I);
+        InsnInfo* N = &Info[I];
+
+        if (!GetStackEffect (E, &N->Eff)) {
+            goto Fail;
+        }
+
+        N->Next = N->Target = -1;
+        if ((E->Info & OF_BRA) != 0 && E->JumpTo != 0) {
+            N->Target = CS_GetEntryIndex (S, E->JumpTo->Owner);
+        }
+        if ((E->Info & OF_DEAD) == 0 && (N->Eff.Flags & SE_EXIT) == 0) {
+            if (I + 1 >= Count) {
+                goto Fail;
+            }
+            N->Next = I + 1;
+        }
+    }
+
+    /* Track the stack pointer */
+    if (GetDepths (Info, Count, -(int) CallerParamSize (S->Func))) {
+        return Info;
+    }
+
+Fail:
+    xfree (Info);
+    return 0;
+}
+
+
+
+static int IsPtr1Load (CodeSeg* S, unsigned I, const InsnInfo* Info)
+/* Check if the insns at I load a pointer from the stack into ptr1:
+**
+**      jsr     ldaxysp
+**      sta     ptr1
+**      stx     ptr1+1
+**
+** If so, return the location of the pointer, otherwise PTR1_NONE.
+*/
+{
+    CodeEntry* L[3];
+    int Ofs;
+
+    if (Info[I].Depth == DEPTH_UNKNOWN          ||
+        !CS_GetEntries (S, L, I, 3)             ||
+        L[0]->OPC != OP65_JSR                   ||
+        L[1]->OPC != OP65_STA                   ||
+        L[1]->AM != AM65_ZP                     ||
+        strcmp (L[1]->Arg, "ptr1") != 0         ||
+        L[2]->OPC != OP65_STX                   ||
+        L[2]->AM != AM65_ZP                     ||
+        strcmp (L[2]->Arg, "ptr1+1") != 0       ||
+        CS_RangeHasLabel (S, I+1, 2)) {
+        return PTR1_NONE;
+    }
+
+    if (strcmp (L[0]->Arg, "ldax0sp") == 0) {
+        Ofs = 0;
+    } else if (strcmp (L[0]->Arg, "ldaxysp") == 0 &&
+               RegValIsKnown (L[0]->RI->In.RegY)) {
+        Ofs = L[0]->RI->In.RegY - 1;
+    } else {
+        return PTR1_NONE;
+    }
+    return Ofs - Info[I].Depth;
+}
+
+
+
+static void GetPtr1 (CodeSeg* S, InsnInfo* Info, unsigned Count)
+/* Determine which stack location is held in ptr1 before each insn */
+{
+    Collection Work = AUTO_COLLECTION_INITIALIZER;
+    unsigned I;
+
+    for (I = 0; I < Count; ++I) {
+        Info[I].Ptr1 = PTR1_UNKNOWN;
+    }
+    Info[0].Ptr1 = PTR1_NONE;
+    CollAppend (&Work, &Info[0]);
+
+    while (CollCount (&Work) > 0) {
+
+        InsnInfo* N = CollPop (&Work);
+        const StackEffect* Eff = &N->Eff;
+        unsigned Index = N - Info;
+        int Succ[2];
+        unsigned J;
+        int Ptr1;
+
+        /* Determine the contents of ptr1 after the insn */
+        Ptr1 = N->Ptr1;
+        if (Index >= 2 && IsPtr1Load (S, Index - 2, Info) != PTR1_NONE) {
+            Ptr1 = IsPtr1Load (S, Index - 2, Info);
+        } else if ((CS_GetEntry (S, Index)->Chg & REG_PTR1) != 0) {
+            Ptr1 = PTR1_NONE;
+        } else if (Ptr1 != PTR1_NONE) {
+            int First = Ptr1 + N->Depth;
+            if ((Eff->Flags & SE_WRITEALL) != 0                           ||
+                (Eff->WriteCount > 0                                    &&
+                 Eff->WriteOfs < First + 2                              &&
+                 Eff->WriteOfs + (int) Eff->WriteCount > First)         ||
+                First < Eff->Pop) {
+                /* Overwritten, or removed from the stack */
+                Ptr1 = PTR1_NONE;
+            }
+        }
+
+        /* Propagate it to the successors */
+        if (Eff->Flags & SE_EXIT) {
+            continue;
+        }
+        Succ[0] = N->Next;
+        Succ[1] = N->Target;
+        for (J = 0; J < 2; ++J) {
+            if (Succ[J] >= 0) {
+                InsnInfo* X = &Info[Succ[J]];
+                if (X->Ptr1 == PTR1_UNKNOWN) {
+                    X->Ptr1 = Ptr1;
+                    CollAppend (&Work, X);
+                } else if (X->Ptr1 != Ptr1 && X->Ptr1 != PTR1_NONE) {
+                    X->Ptr1 = PTR1_NONE;
+                    CollAppend (&Work, X);
+                }
+            }
+        }
+    }
+
+    DoneCollection (&Work);
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+unsigned OptDeadStores (CodeSeg* S)
+/* Remove stores to locations on the C stack that are not read again before
+** they are overwritten or the function returns.
+*/
+{
+    unsigned Changes = 0;
+    unsigned Count = CS_GetEntryCount (S);
+    InsnInfo* Info;
+    unsigned I;
+
+    /* Track the stack pointer and the live locations */
+    Info = GetInsnInfo (S);
+    if (Info == 0) {
+        return 0;
+    }
+    GetLiveness (Info, Count);
+
+    /* Remove the stores that aren't live later. Go backwards, so the indices
+    ** of the remaining insns don't change.
+    */
+    I = Count;
+    while (I-- > 0) {
+
+        const InsnInfo* N = &Info[I];
+        CodeEntry* E = CS_GetEntry (S, I);
+        LocSet Live;
+        unsigned J;
+
+        if (N->Depth == DEPTH_UNKNOWN           ||
+            (N->Eff.Flags & SE_STORE) == 0      ||
+            N->Eff.WriteCount == 0) {
+            continue;
+        }
+
+        GetLiveOut (Info, N, &Live);
+        for (J = 0; J < N->Eff.WriteCount; ++J) {
+            if (HasLoc (&Live, N->Eff.WriteOfs - N->Depth + (int) J)) {
+                break;
+            }
+        }
+        if (J < N->Eff.WriteCount) {
+            continue;
+        }
+
+        /* The registers changed by a store subroutine must be unused, and
+        ** the flags it leaves must not be evaluated.
+        */
+        if (E->OPC == OP65_JSR) {
+            CodeEntry* X = CS_GetNextEntry (S, I);
+            if ((GetRegInfo (S, I+1, E->Chg) & E->Chg) != 0 ||
+                X == 0 || CE_UseLoadFlags (X)) {
+                continue;
+            }
+        }
+
+        CS_DelEntry (S, I);
+        ++Changes;
+    }
+
+    xfree (Info);
+
+    /* Return the number of changes made */
+    return Changes;
+}
+
+
+
+unsigned OptPtr1Reloads (CodeSeg* S)
+/* Remove loads of a pointer from the C stack into ptr1 if ptr1 holds it
+** already.
+*/
+{
+    unsigned Changes = 0;
+    unsigned Count = CS_GetEntryCount (S);
+    InsnInfo* Info;
+    unsigned I;
+
+    /* Track the stack pointer and the contents of ptr1 */
+    Info = GetInsnInfo (S);
+    if (Info == 0) {
+        return 0;
+    }
+    GetPtr1 (S, Info, Count);
+
+    /* Replace the loads. Go backwards, so the indices of the remaining insns
+    ** don't change.
+    */
+    I = Count;
+    while (I-- > 0) {
+
+        const InsnInfo* N = &Info[I];
+        CodeEntry* E;
+        CodeEntry* X;
+
+        if (N->Ptr1 == PTR1_UNKNOWN     ||
+            N->Ptr1 == PTR1_NONE        ||
+            IsPtr1Load (S, I, Info) != N->Ptr1) {
+            continue;
+        }
+
+        /* ldaxysp leaves the offset of the low byte in Y */
+        if ((GetRegInfo (S, I+3, REG_Y) & REG_Y) != 0) {
+            continue;
+        }
+
+        /* Load the pointer from ptr1 instead. The loads are removed later
+        ** if the registers are unused.
+        */
+        E = CS_GetEntry (S, I);
+        X = NewCodeEntry (OP65_LDX, AM65_ZP, "ptr1+1", 0, E->LI);
+        CS_InsertEntry (S, X, I+3);
+        X = NewCodeEntry (OP65_LDA, AM65_ZP, "ptr1", 0, E->LI);
+        CS_InsertEntry (S, X, I+4);
+        CS_DelEntries (S, I, 3);
+        ++Changes;
+    }
+
+    xfree (Info);
+
+    /* Return the number of changes made */
+    return Changes;
+}
@@ -1,15 +1,12 @@
 /*****************************************************************************/
 /*                                                                           */
-/*                                 fileio.c                                  */
+/*                               coptlocals.h                                */
 /*                                                                           */
-/*              Binary file I/O for the co65 object file converter           */
+/*                Optimizations for variables on the C stack                 */
 /*                                                                           */
 /*                                                                           */
 /*                                                                           */
-/* (C) 1998-2003 Ullrich von Bassewitz                                       */
-/*               Rmerstrasse 52                                             */
-/*               D-70794 Filderstadt                                         */
-/* EMail:        uz@cc65.org                                                 */
+/* (C) 2026, The cc65 authors                                                */
 /*                                                                           */
 /*                                                                           */
 /* This software is provided 'as-is', without any expressed or implied       */
@@ -35,71 +32,42 @@
 
 #include <string.h>
 
-/* common */
-#include "xmalloc.h"
 
-/* ld65 */
-#include "error.h"
-#include "fileio.h"
 
-
-
-/*****************************************************************************/
-/*                                   Code                                    */
-/*****************************************************************************/
+#ifndef COPTLOCALS_H
+#define COPTLOCALS_H
 
 
 
-unsigned Read8 (FILE* F)
-/* Read an 8 bit value from the file */
-{
-    int C = getc (F);
-    if (C == EOF) {
-        Error ("Read error (file corrupt?)");
-    }
-    return C;
-}
+/* cc65 */
+#include "codeseg.h"
 
 
 
-unsigned Read16 (FILE* F)
-/* Read a 16 bit value from the file */
-{
-    unsigned Lo = Read8 (F);
-    unsigned Hi = Read8 (F);
-    return (Hi << 8) | Lo;
-}
-
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
 
 
-unsigned long Read24 (FILE* F)
-/* Read a 24 bit value from the file */
-{
-    unsigned long Lo = Read16 (F);
-    unsigned long Hi = Read8 (F);
-    return (Hi << 16) | Lo;
-}
 
+unsigned OptDeadStores (CodeSeg* S);
+/* Remove stores to locations on the C stack that are not read again before
+** they are overwritten or the function returns. The locations read on each
+** path through the function are determined by a liveness analysis over the
+** whole function, which tracks the stack pointer across pushes, pops and
+** calls. Functions that take the address of a stack location, or call
+** routines with an unknown effect on the stack, are left alone.
+*/
 
+unsigned OptPtr1Reloads (CodeSeg* S);
+/* Remove loads of a pointer from the C stack into ptr1 if ptr1 still holds
+** the same pointer, so repeated dereferences of a pointer parameter or local
+** use the pointer in ptr1. The contents of ptr1 are tracked across branches
+** and loops.
+*/
 
-unsigned long Read32 (FILE* F)
-/* Read a 32 bit value from the file */
-{
-    unsigned long Lo = Read16 (F);
-    unsigned long Hi = Read16 (F);
-    return (Hi << 16) | Lo;
-}
 
 
+/* End of coptlocals.h */
 
-void* ReadData (FILE* F, void* Data, unsigned Size)
-/* Read data from the file */
-{
-    /* Explicitly allow reading zero bytes */
-    if (Size > 0) {
-        if (fread (Data, 1, Size, F) != Size) {
-            Error ("Read error (file corrupt?)");
-        }
-    }
-    return Data;
-}
+#endif
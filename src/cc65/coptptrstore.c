@@ -215,6 +215,52 @@ static const char* LoadAXImm (CodeSeg* S, unsigned I)
 
 
 
+static int IsIndexedStoreValueInsn (const CodeEntry* E)
+/* Check if E may be part of the code that loads the value for the store in
+** OptPtrStore4. The code may not change memory, leave the basic block or use
+** ptr1.
+*/
+{
+    if (CE_HasLabel (E) || ((E->Use | E->Chg) & REG_PTR1) != 0) {
+        return 0;
+    }
+    switch (E->OPC) {
+        case OP65_LDA:
+        case OP65_LDX:
+        case OP65_LDY:
+        case OP65_TAX:
+        case OP65_TAY:
+        case OP65_TXA:
+        case OP65_TYA:
+        case OP65_AND:
+        case OP65_ORA:
+        case OP65_EOR:
+        case OP65_ADC:
+        case OP65_SBC:
+        case OP65_CLC:
+        case OP65_SEC:
+        case OP65_CMP:
+        case OP65_CPX:
+        case OP65_CPY:
+        case OP65_INX:
+        case OP65_DEX:
+        case OP65_INY:
+        case OP65_DEY:
+        case OP65_INA:
+        case OP65_DEA:
+            return 1;
+        case OP65_ASL:
+        case OP65_LSR:
+        case OP65_ROL:
+        case OP65_ROR:
+            return (E->AM == AM65_ACC || E->AM == AM65_IMP);
+        default:
+            return 0;
+    }
+}
+
+
+
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
@@ -756,3 +802,221 @@ unsigned OptPtrStore3 (CodeSeg* S)
     /* Return the number of changes made */
     return Changes;
 }
+
+
+
+unsigned OptPtrStore4 (CodeSeg* S)
+/* Search for the sequence:
+**
+**      clc
+**      adc     xxx
+**      bcc     L
+**      inx
+** L:   sta     ptr1
+**      stx     ptr1+1
+**      <load>
+**      ldy     #$00
+**      sta     (ptr1),y
+**
+** where the value in A/X before the sequence is the address of a label or a
+** constant, and <load> is a short sequence of instructions that doesn't use
+** A, X or the carry before setting them, and doesn't store anything. The
+** sequence is replaced by:
+**
+**      <load>
+**      ldy     xxx
+**      sta     label,y
+**
+** If xxx is (sp),y, the replacement is either
+**
+**      ldy     #yyy
+**      lda     (sp),y
+**      tax
+**      <load>
+**      sta     label,x
+**
+** if <load> doesn't touch X, or
+**
+**      <load>
+**      pha
+**      ldy     #yyy
+**      lda     (sp),y
+**      tay
+**      pla
+**      sta     label,y
+**
+** This is the code generated for a store into a static array with a byte
+** sized index, as it is often seen in loops.
+*/
+{
+    unsigned Changes = 0;
+
+    /* Walk over the entries */
+    unsigned I = 0;
+    while (I < CS_GetEntryCount (S)) {
+
+        CodeEntry* L[6];
+        CodeEntry* E;
+        CodeEntry* N;
+        const char* Loc;
+        unsigned K;
+        unsigned Set;
+        unsigned Chg;
+        int CarrySet;
+        int Ok;
+
+        /* Get next entry */
+        L[0] = CS_GetEntry (S, I);
+
+        /* Check for the start of the sequence */
+        if (L[0]->OPC != OP65_CLC                               ||
+            !CS_GetEntries (S, L+1, I+1, 5)                     ||
+            L[1]->OPC != OP65_ADC                               ||
+            (L[1]->AM != AM65_ABS                       &&
+             L[1]->AM != AM65_ZP                        &&
+             L[1]->AM != AM65_IMM                       &&
+             (L[1]->AM != AM65_ZP_INDY                  ||
+              strcmp (L[1]->Arg, "sp") != 0             ||
+              !RegValIsKnown (L[1]->RI->In.RegY)))              ||
+            ((L[1]->Use | L[1]->Chg) & REG_PTR1) != 0           ||
+            (L[2]->OPC != OP65_BCC && L[2]->OPC != OP65_JCC)    ||
+            L[2]->JumpTo == 0                                   ||
+            L[2]->JumpTo->Owner != L[4]                         ||
+            L[3]->OPC != OP65_INX                               ||
+            L[4]->OPC != OP65_STA                               ||
+            L[4]->AM != AM65_ZP                                 ||
+            strcmp (L[4]->Arg, "ptr1") != 0                     ||
+            L[5]->OPC != OP65_STX                               ||
+            L[5]->AM != AM65_ZP                                 ||
+            strcmp (L[5]->Arg, "ptr1+1") != 0                   ||
+            CS_RangeHasLabel (S, I+1, 3)                        ||
+            CE_GetLabelCount (L[4]) != 1                        ||
+            CL_GetRefCount (L[2]->JumpTo) != 1                  ||
+            CE_HasLabel (L[5])) {
+            ++I;
+            continue;
+        }
+
+        /* Check the code loading the value. It may not use A, X or the
+        ** carry before setting them, since these contain the address.
+        */
+        K        = I + 6;
+        Set      = REG_NONE;
+        Chg      = REG_NONE;
+        CarrySet = 0;
+        Ok       = 0;
+        while ((E = CS_GetEntry (S, K)) != 0 && K < I + 6 + 8) {
+            if (E->OPC == OP65_LDY                              &&
+                CE_IsKnownImm (E, 0)                            &&
+                (N = CS_GetNextEntry (S, K)) != 0               &&
+                N->OPC == OP65_STA                              &&
+                N->AM == AM65_ZP_INDY                           &&
+                strcmp (N->Arg, "ptr1") == 0                    &&
+                !CE_HasLabel (E)                                &&
+                !CE_HasLabel (N)) {
+                Ok = 1;
+                break;
+            }
+            if (!IsIndexedStoreValueInsn (E)                    ||
+                (E->Use & ~Set & REG_AX) != 0) {
+                break;
+            }
+            if (E->OPC == OP65_ADC || E->OPC == OP65_SBC        ||
+                E->OPC == OP65_ROL || E->OPC == OP65_ROR) {
+                if (!CarrySet) {
+                    break;
+                }
+            } else if (E->OPC == OP65_CLC || E->OPC == OP65_SEC ||
+                       E->OPC == OP65_CMP || E->OPC == OP65_CPX ||
+                       E->OPC == OP65_CPY || E->OPC == OP65_ASL ||
+                       E->OPC == OP65_LSR) {
+                CarrySet = 1;
+            }
+            Set |= E->Chg & REG_AXY;
+            Chg |= E->Use | E->Chg;
+            ++K;
+        }
+
+        /* The value must be in A, the address in ptr1 must not be used
+        ** later, and the flags set by the ldy #$00 must not be used.
+        */
+        if (!Ok                                                 ||
+            (Set & REG_A) == 0                                  ||
+            ((N = CS_GetEntry (S, K+2)) != 0 && CE_UseLoadFlags (N)) ||
+            (GetRegInfo (S, K+2, REG_PTR1) & REG_PTR1) != 0     ||
+            ((Set & REG_X) == 0 && RegXUsed (S, K+2))           ||
+            (Loc = LoadAXImm (S, I)) == 0) {
+            ++I;
+            continue;
+        }
+
+        /* If the zero in Y is used later, keep the load. The replacement
+        ** code is inserted in front of it.
+        */
+        if (RegYUsed (S, K+2)) {
+            CodeEntry* X = NewCodeEntry (OP65_LDY, AM65_IMM, "$00", 0, L[5]->LI);
+            CS_InsertEntry (S, X, K+2);
+        }
+
+        if (L[1]->AM != AM65_ZP_INDY) {
+
+            /* Replace the store through ptr1 by an indexed store */
+            CodeEntry* X = NewCodeEntry (OP65_LDY, L[1]->AM, L[1]->Arg, 0, L[1]->LI);
+            CS_InsertEntry (S, X, K+2);
+            X = NewCodeEntry (OP65_STA, AM65_ABSY, Loc, 0, L[4]->LI);
+            CS_InsertEntry (S, X, K+3);
+
+            /* Remove the old code */
+            CS_DelEntries (S, K, 2);
+            CS_DelEntries (S, I, 6);
+
+        } else if ((Chg & REG_X) == 0 && !RegXUsed (S, K+2)) {
+
+            /* Load the index into X before the value */
+            const char* Arg = MakeHexArg (L[1]->RI->In.RegY);
+            CodeEntry* X = NewCodeEntry (OP65_STA, AM65_ABSX, Loc, 0, L[4]->LI);
+            CS_InsertEntry (S, X, K+2);
+            CS_DelEntries (S, K, 2);
+
+            X = NewCodeEntry (OP65_LDY, AM65_IMM, Arg, 0, L[1]->LI);
+            CS_InsertEntry (S, X, I+6);
+            X = NewCodeEntry (OP65_LDA, AM65_ZP_INDY, "sp", 0, L[1]->LI);
+            CS_InsertEntry (S, X, I+7);
+            X = NewCodeEntry (OP65_TAX, AM65_IMP, 0, 0, L[1]->LI);
+            CS_InsertEntry (S, X, I+8);
+            CS_DelEntries (S, I, 6);
+
+        } else {
+
+            /* Save the value while loading the index into Y */
+            const char* Arg = MakeHexArg (L[1]->RI->In.RegY);
+            CodeEntry* X = NewCodeEntry (OP65_PHA, AM65_IMP, 0, 0, L[4]->LI);
+            CS_InsertEntry (S, X, K+2);
+            X = NewCodeEntry (OP65_LDY, AM65_IMM, Arg, 0, L[1]->LI);
+            CS_InsertEntry (S, X, K+3);
+            X = NewCodeEntry (OP65_LDA, AM65_ZP_INDY, "sp", 0, L[1]->LI);
+            CS_InsertEntry (S, X, K+4);
+            X = NewCodeEntry (OP65_TAY, AM65_IMP, 0, 0, L[1]->LI);
+            CS_InsertEntry (S, X, K+5);
+            X = NewCodeEntry (OP65_PLA, AM65_IMP, 0, 0, L[4]->LI);
+            CS_InsertEntry (S, X, K+6);
+            X = NewCodeEntry (OP65_STA, AM65_ABSY, Loc, 0, L[4]->LI);
+            CS_InsertEntry (S, X, K+7);
+
+            /* Remove the old code */
+            CS_DelEntries (S, K, 2);
+            CS_DelEntries (S, I, 6);
+
+        }
+
+        /* Remember, we had changes */
+        ++Changes;
+
+        /* Next entry */
+        ++I;
+
+    }
+
+    /* Return the number of changes made */
+    return Changes;
+}
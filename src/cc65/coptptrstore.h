@@ -171,6 +171,29 @@ unsigned OptPtrStore3 (CodeSeg* S);
 ** use the register bank instead of ptr1.
 */
 
+unsigned OptPtrStore4 (CodeSeg* S);
+/* Search for the sequence:
+**
+**      clc
+**      adc     xxx
+**      bcc     L
+**      inx
+** L:   sta     ptr1
+**      stx     ptr1+1
+**      <load>
+**      ldy     #$00
+**      sta     (ptr1),y
+**
+** where A/X contains the address of a label or a constant before, and
+** <load> doesn't depend on A, X or the carry. Replace it by
+**
+**      <load>
+**      ldy     xxx
+**      sta     label,y
+**
+** or a similar sequence using X or the stack if xxx is (sp),y.
+*/
+
 
 
 /* End of coptptrstore.h */
@@ -56,10 +56,23 @@
 #define F_NONE          0x0000U /* No extra flags */
 #define F_SLOWER        0x0001U /* Function call is slower */
 
+/* Register values expected by a function, same as in RegContents */
+typedef struct CallRegs CallRegs;
+struct CallRegs {
+    short       RegA;
+    short       RegX;
+    short       RegY;
+    short       SRegLo;
+    short       SRegHi;
+    short       Ptr1Lo;
+    short       Ptr1Hi;
+    short       Tmp1;
+};
+
 typedef struct CallDesc CallDesc;
 struct CallDesc {
     const char* LongFunc;       /* Long function name */
-    RegContents Regs;           /* Register contents */
+    CallRegs    Regs;           /* Register contents */
     unsigned    Flags;          /* Flags from above */
     const char* ShortFunc;      /* Short function name */
 };
@@ -98,6 +98,7 @@ typedef enum {
     OP_LHS_LOAD_DIRECT  = 0x0C,         /* Must have direct load insn for LHS */
     OP_RHS_LOAD         = 0x10,         /* Must have load insns for RHS */
     OP_RHS_LOAD_DIRECT  = 0x30,         /* Must have direct load insn for RHS */
+    OP_RHS_ANY          = 0x40,         /* Doesn't use the RHS load info */
 } OP_FLAGS;
 
 /* Structure forward decl */
@@ -1683,8 +1684,8 @@ static unsigned Opt_tosxorax (StackOpData* D)
 
 static const OptFuncDesc FuncTable[] = {
     { "__bzero",    Opt___bzero,   REG_NONE, OP_X_ZERO | OP_A_KNOWN     },
-    { "staspidx",   Opt_staspidx,  REG_NONE, OP_NONE                    },
-    { "staxspidx",  Opt_staxspidx, REG_AX,   OP_NONE                    },
+    { "staspidx",   Opt_staspidx,  REG_NONE, OP_RHS_ANY                 },
+    { "staxspidx",  Opt_staxspidx, REG_AX,   OP_RHS_ANY                 },
     { "tosaddax",   Opt_tosaddax,  REG_NONE, OP_NONE                    },
     { "tosandax",   Opt_tosandax,  REG_NONE, OP_NONE                    },
     { "tosaslax",   Opt_tosaslax,  REG_NONE, OP_NONE                    },
@@ -1854,8 +1855,9 @@ static int PreCondOk (StackOpData* D)
             }
         }
     }
-    if ((D->Rhs.A.Flags | D->Rhs.X.Flags) & LI_DUP_LOAD) {
-        /* Cannot optimize */
+    if ((D->OptFunc->Flags & OP_RHS_ANY) == 0 &&
+        ((D->Rhs.A.Flags | D->Rhs.X.Flags) & LI_DUP_LOAD) != 0) {
+        /* Cannot optimize, since the function works with the load insns */
         return 0;
     }
 
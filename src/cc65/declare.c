@@ -452,6 +452,20 @@ static void ParseStorageClass (DeclSpec* D, unsigned DefStorage)
 
 
 
+static void OptionalFuncSpec (DeclSpec* D)
+/* Parse an optional inline function specifier */
+{
+    while (CurTok.Tok == TOK_INLINE) {
+        if (D->Flags & DS_INLINE) {
+            Warning ("Duplicate function specifier: 'inline'");
+        }
+        D->Flags |= DS_INLINE;
+        NextToken ();
+    }
+}
+
+
+
 static void ParseEnumDecl (void)
 /* Process an enum declaration . */
 {
@@ -1597,6 +1611,11 @@ void ParseDecl (const DeclSpec* Spec, Declaration* D, declmode_t Mode)
     /* If we have a function, add a special storage class */
     if (IsTypeFunc (D->Type)) {
         D->StorageClass |= SC_FUNC;
+        if (Spec->Flags & DS_INLINE) {
+            D->StorageClass |= SC_INLINE;
+        }
+    } else if (Spec->Flags & DS_INLINE) {
+        Error ("'inline' is only allowed for functions");
     }
 
     /* Parse attributes for this declaration */
@@ -1682,8 +1701,12 @@ void ParseDeclSpec (DeclSpec* D, unsigned DefStorage, long DefType)
     /* There may be qualifiers *before* the storage class specifier */
     Qualifiers = OptionalQualifiers (T_QUAL_CONST | T_QUAL_VOLATILE);
 
+    /* The inline specifier may come before or after the storage class */
+    OptionalFuncSpec (D);
+
     /* Now get the storage class specifier for this declaration */
     ParseStorageClass (D, DefStorage);
+    OptionalFuncSpec (D);
 
     /* Parse the type specifiers passing any initial type qualifiers */
     ParseTypeSpec (D, DefType, Qualifiers);
@@ -57,6 +57,7 @@
 #define DS_DEF_STORAGE          0x0001U /* Default storage class used   */
 #define DS_DEF_TYPE             0x0002U /* Default type used            */
 #define DS_EXTRA_TYPE           0x0004U /* Extra type declared          */
+#define DS_INLINE               0x0008U /* inline function specifier    */
 
 /* Result of ParseDeclSpec */
 typedef struct DeclSpec DeclSpec;
@@ -19,7 +19,9 @@
 #include "asmlabel.h"
 #include "asmstmt.h"
 #include "assignment.h"
+#include "callgraph.h"
 #include "codegen.h"
+#include "codeseg.h"
 #include "declare.h"
 #include "error.h"
 #include "funcdesc.h"
@@ -30,6 +32,7 @@
 #include "macrotab.h"
 #include "preproc.h"
 #include "scanner.h"
+#include "segments.h"
 #include "shiftexpr.h"
 #include "stackptr.h"
 #include "standard.h"
@@ -100,6 +103,22 @@ static unsigned GlobalModeFlags (const ExprDesc* Expr)
 
 
 
+static void MarkVolatile (Type* T)
+/* If an object of type T is volatile, note that the current function
+** accesses volatile objects. The optimizer will then not remove loads
+** and stores of variables in this function.
+*/
+{
+    while (IsTypeArray (T)) {
+        T = GetElementType (T);
+    }
+    if (IsQualVolatile (T)) {
+        CS->Code->Volatile = 1;
+    }
+}
+
+
+
 void ExprWithCheck (void (*Func) (ExprDesc*), ExprDesc* Expr)
 /* Call an expression function with checks. */
 {
@@ -516,6 +535,9 @@ static void FunctionCall (ExprDesc* Expr)
             PtrOffs = StackPtr;
         }
 
+        /* We don't know which function is called */
+        CG_AddUnknownCall ();
+
     } else {
         /* Check function attributes */
         if (Expr->Sym && SymHasAttr (Expr->Sym, atNoReturn)) {
@@ -526,9 +548,8 @@ static void FunctionCall (ExprDesc* Expr)
         /* Check for known standard functions and inline them */
         if (Expr->Name != 0) {
             int StdFunc = FindStdFunc ((const char*) Expr->Name);
-            if (StdFunc >= 0) {
-                /* Inline this function */
-                HandleStdFunc (StdFunc, Func, Expr);
+            if (StdFunc >= 0 && HandleStdFunc (StdFunc, Func, Expr)) {
+                /* The function was inlined */
                 return;
             }
         }
@@ -639,9 +660,11 @@ static void FunctionCall (ExprDesc* Expr)
             SB_Done (&S);
 
             g_call (TypeOf (Expr->Type), Func->WrappedCall->Name, ParamSize);
+            CG_AddCall (Func->WrappedCall->Name);
         } else {
             g_call (TypeOf (Expr->Type), (const char*) Expr->Name, ParamSize);
         }
+        CG_AddCall ((const char*) Expr->Name);
 
     }
 
@@ -752,6 +775,7 @@ static void Primary (ExprDesc* E)
 
                 /* The expression type is the symbol type */
                 E->Type = Sym->Type;
+                MarkVolatile (E->Type);
 
                 /* Check for legal symbol types */
                 if ((Sym->Flags & SC_CONST) == SC_CONST) {
@@ -762,6 +786,10 @@ static void Primary (ExprDesc* E)
                     /* Function */
                     E->Flags = E_LOC_GLOBAL | E_RTYPE_LVAL;
                     E->Name = (uintptr_t) Sym->Name;
+                    /* Anything but a call may take the address */
+                    if (CurTok.Tok != TOK_LPAREN) {
+                        CG_AddressTaken (Sym->Name);
+                    }
                 } else if ((Sym->Flags & SC_AUTO) == SC_AUTO) {
                     /* Local variable. If this is a parameter for a variadic
                     ** function, we have to add some address calculations, and the
@@ -1234,6 +1262,7 @@ static void StructRef (ExprDesc* Expr)
         FinalType = TypeDup (Field->Type);
         FinalType->C |= Q;
     }
+    MarkVolatile (FinalType);
 
     /* A struct is usually an lvalue. If not, it is a struct in the primary
     ** register.
@@ -40,12 +40,14 @@
 /* cc65 */
 #include "asmcode.h"
 #include "asmlabel.h"
+#include "callgraph.h"
 #include "codegen.h"
 #include "error.h"
 #include "funcdesc.h"
 #include "global.h"
 #include "litpool.h"
 #include "locals.h"
+#include "regvars.h"
 #include "scanner.h"
 #include "stackptr.h"
 #include "standard.h"
@@ -250,27 +252,45 @@ void F_AllocLocalSpace (Function* F)
 
 
 
-int F_AllocRegVar (Function* F, const Type* Type)
-/* Allocate a register variable for the given variable type. If the allocation
-** was successful, return the offset of the register variable in the register
-** bank (zero page storage). If there is no register space left, return -1.
+int F_AllocRegVar (Function* F, const char* Name, const Type* Type, int* Shared)
+/* Allocate a register variable with the given name and type. If the
+** allocation was successful, return the offset of the register variable in
+** the register bank (zero page storage). If there is no register space left,
+** or the variable is not worth a register, return -1. If Shared is not NULL,
+** the variable may also get the slot of another register variable that is
+** never live at the same time. *Shared is set to true in this case, and the
+** variable must not save and restore the slot.
 */
 {
+    if (Shared) {
+        *Shared = 0;
+    }
+
     /* Allow register variables only on top level and if enabled */
     if (IS_Get (&EnableRegVars) && GetLexicalLevel () == LEX_LEVEL_FUNCTION) {
 
         /* Get the size of the variable */
         unsigned Size = CheckedSizeOf (Type);
 
-        /* Do we have space left? */
-        if (F->RegOffs >= Size) {
+        /* Do we have space left, and is the variable used enough? */
+        if (F->RegOffs >= Size && RV_Select (Name, Size, F->RegOffs)) {
             /* Space left. We allocate the variables from high to low addresses,
             ** so the addressing is compatible with the saved values on stack.
             ** This allows shorter code when saving/restoring the variables.
             */
             F->RegOffs -= Size;
+            RV_Assign (Name, F->RegOffs);
             return F->RegOffs;
         }
+
+        /* Try to share the slot of a variable with a disjoint lifetime */
+        if (Shared) {
+            int Offs = RV_FindShared (Name, Size);
+            if (Offs >= 0) {
+                *Shared = 1;
+                return Offs;
+            }
+        }
     }
 
     /* No space left or no allocation */
@@ -297,9 +317,11 @@ static void F_RestoreRegVars (Function* F)
     /* Get the first symbol from the function symbol table */
     Sym = F->FuncEntry->V.F.Func->SymTab->SymHead;
 
-    /* Walk through all symbols checking for register variables */
+    /* Walk through all symbols checking for register variables. Variables
+    ** that share the slot of another one don't have a save area.
+    */
     while (Sym) {
-        if (SymIsRegVar (Sym)) {
+        if (SymIsRegVar (Sym) && (Sym->Flags & SC_SHARED) == 0) {
 
             /* Check for more than one variable */
             int Offs       = Sym->V.R.SaveOffs;
@@ -309,7 +331,8 @@ static void F_RestoreRegVars (Function* F)
 
                 /* Find next register variable */
                 const SymEntry* NextSym = Sym->NextSym;
-                while (NextSym && !SymIsRegVar (NextSym)) {
+                while (NextSym && (!SymIsRegVar (NextSym) ||
+                                   (NextSym->Flags & SC_SHARED) != 0)) {
                     NextSym = NextSym->NextSym;
                 }
 
@@ -460,6 +483,11 @@ void NewFunc (SymEntry* Func)
     /* Allocate code and data segments for this function */
     Func->V.F.Seg = PushSegments (Func);
 
+    /* Record calls and static locals for the overlay */
+    if (OverlayLocals) {
+        CG_EnterFunc (Func);
+    }
+
     /* Allocate a new literal pool */
     PushLiteralPool (Func);
 
@@ -491,6 +519,11 @@ void NewFunc (SymEntry* Func)
     /* Setup the stack */
     StackPtr = 0;
 
+    /* Read ahead the function body to find out how the register variables
+    ** are used.
+    */
+    RV_ScanBody (D);
+
     /* Walk through the parameter list and allocate register variable space
     ** for parameters declared as register. Generate code to swap the contents
     ** of the register bank with the save area on the stack.
@@ -502,7 +535,7 @@ void NewFunc (SymEntry* Func)
         if (SymIsRegVar (Param)) {
 
             /* Allocate space */
-            int Reg = F_AllocRegVar (CurrentFunc, Param->Type);
+            int Reg = F_AllocRegVar (CurrentFunc, Param->Name, Param->Type, 0);
 
             /* Could we allocate a register? */
             if (Reg < 0) {
@@ -576,6 +609,14 @@ void NewFunc (SymEntry* Func)
     /* Leave the lexical level */
     LeaveFunctionLevel ();
 
+    /* Forget the register variable usage */
+    RV_Done ();
+
+    /* Stop recording for the overlay */
+    if (OverlayLocals) {
+        CG_LeaveFunc ();
+    }
+
     /* Eat the closing brace */
     ConsumeRCurly ();
 
@@ -132,10 +132,14 @@ void F_AllocLocalSpace (Function* F);
 ** nothing if there is no reserved local space.
 */
 
-int F_AllocRegVar (Function* F, const Type* Type);
-/* Allocate a register variable for the given variable type. If the allocation
-** was successful, return the offset of the register variable in the register
-** bank (zero page storage). If there is no register space left, return -1.
+int F_AllocRegVar (Function* F, const char* Name, const Type* Type, int* Shared);
+/* Allocate a register variable with the given name and type. If the
+** allocation was successful, return the offset of the register variable in
+** the register bank (zero page storage). If there is no register space left,
+** or the variable is not worth a register, return -1. If Shared is not NULL,
+** the variable may also get the slot of another register variable that is
+** never live at the same time. *Shared is set to true in this case, and the
+** variable must not save and restore the slot.
 */
 
 void NewFunc (struct SymEntry* Func);
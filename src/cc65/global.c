@@ -48,6 +48,8 @@ unsigned char AutoCDecl         = 0;    /* Make functions default to __cdecl__ *
 unsigned char DebugInfo         = 0;    /* Add debug info to the obj */
 unsigned char PreprocessOnly    = 0;    /* Just preprocess the input */
 unsigned char DebugOptOutput    = 0;    /* Output debug stuff */
+unsigned char OverlayLocals     = 0;    /* Overlay static locals */
+unsigned char FunctionSections  = 0;    /* Separate sections per object */
 unsigned      RegisterSpace     = 6;    /* Space available for register vars */
 
 /* Stackable options */
@@ -69,3 +71,5 @@ IntStack DataAlignment      = INTSTACK(1);  /* Alignment for data */
 StrBuf DepName     = STATIC_STRBUF_INITIALIZER; /* Name of dependencies file */
 StrBuf FullDepName = STATIC_STRBUF_INITIALIZER; /* Name of full dependencies file */
 StrBuf DepTarget   = STATIC_STRBUF_INITIALIZER; /* Name of dependency target */
+StrBuf PCHCreateName = STATIC_STRBUF_INITIALIZER; /* Precompiled header to create */
+StrBuf PCHUseName    = STATIC_STRBUF_INITIALIZER; /* Precompiled header to use */
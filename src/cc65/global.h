@@ -56,6 +56,8 @@ extern unsigned char    AutoCDecl;              /* Make functions default to __c
 extern unsigned char    DebugInfo;              /* Add debug info to the obj */
 extern unsigned char    PreprocessOnly;         /* Just preprocess the input */
 extern unsigned char    DebugOptOutput;         /* Output debug stuff */
+extern unsigned char    OverlayLocals;          /* Overlay static locals */
+extern unsigned char    FunctionSections;       /* Separate sections per object */
 extern unsigned         RegisterSpace;          /* Space available for register vars */
 
 /* Stackable options */
@@ -77,6 +79,8 @@ extern IntStack         DataAlignment;          /* Alignment for data */
 extern StrBuf           DepName;                /* Name of dependencies file */
 extern StrBuf           FullDepName;            /* Name of full dependencies file */
 extern StrBuf           DepTarget;              /* Name of dependency target */
+extern StrBuf           PCHCreateName;          /* Precompiled header to create */
+extern StrBuf           PCHUseName;             /* Precompiled header to use */
 
 
 
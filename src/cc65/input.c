@@ -42,7 +42,10 @@
 #include "coll.h"
 #include "filestat.h"
 #include "fname.h"
+#include "hashfunc.h"
+#include "hashtab.h"
 #include "print.h"
+#include "searchpath.h"
 #include "strbuf.h"
 #include "xmalloc.h"
 
@@ -53,10 +56,31 @@
 #include "incpath.h"
 #include "input.h"
 #include "lineinfo.h"
+#include "macrotab.h"
 #include "output.h"
 
 
 
+/*****************************************************************************/
+/*                                 Forwards                                  */
+/*****************************************************************************/
+
+
+
+static unsigned HT_GenHash (const void* Key);
+/* Generate the hash over a key. */
+
+static const void* HT_GetKey (const void* Entry);
+/* Given a pointer to the user entry data, return a pointer to the key. */
+
+static int HT_Compare (const void* Key1, const void* Key2);
+/* Compare two keys. The function must return a value less than zero if
+** Key1 is smaller than Key2, zero if both are equal, and a value greater
+** than zero if Key1 is greater then Key2.
+*/
+
+
+
 /*****************************************************************************/
 /*                                   Data                                    */
 /*****************************************************************************/
@@ -81,16 +105,38 @@ struct IFile {
     unsigned long   Size;       /* File size */
     unsigned long   MTime;      /* Time of last modification */
     InputType       Type;       /* Type of input file */
+    char*           Guard;      /* Include guard macro if any */
+    unsigned char   Once;       /* File contains #pragma once */
     char            Name[1];    /* Name of file (dynamically allocated) */
 };
 
+/* States of the include guard detection for an active file */
+typedef enum {
+    GUARD_START,                /* Nothing seen so far */
+    GUARD_INSIDE,               /* Inside the #ifndef of a possible guard */
+    GUARD_AFTER,                /* After the #endif of the guard */
+    GUARD_NONE,                 /* The file has no include guard */
+} GuardState;
+
 /* Struct that describes an active input file */
 typedef struct AFile AFile;
 struct AFile {
     unsigned    Line;           /* Line number for this file */
-    FILE*       F;              /* Input file stream */
+    FILE*       F;              /* Input file stream, NULL for text */
+    StrBuf      Text;           /* Preprocessed text if F is NULL */
     IFile*      Input;          /* Points to corresponding IFile */
     int         SearchPath;     /* True if we've added a path for this file */
+    GuardState  Guard;          /* State of the include guard detection */
+    int         GuardLevel;     /* #if level of the guard */
+    char*       GuardName;      /* Name of the guard macro */
+};
+
+/* A cached result of an include file search */
+typedef struct IncSearch IncSearch;
+struct IncSearch {
+    HashNode    Node;           /* Node for the hash table */
+    StrBuf      Key;            /* Search path list and file name */
+    char*       Name;           /* Complete path, NULL if not found */
 };
 
 /* List of all input files */
@@ -102,6 +148,54 @@ static Collection AFiles = STATIC_COLLECTION_INITIALIZER;
 /* Input stack used when preprocessing. */
 static Collection InputStack = STATIC_COLLECTION_INITIALIZER;
 
+/* True if the current line was read from preprocessed text */
+static int LinePreprocessed = 0;
+
+/* Hash table functions */
+static const HashFunctions HashFunc = {
+    HT_GenHash,
+    HT_GetKey,
+    HT_Compare
+};
+
+/* Include file searches done so far. The file system doesn't change while
+** compiling, so the result only depends on the search path list and name.
+*/
+static HashTable IncSearches = STATIC_HASHTABLE_INITIALIZER (31, &HashFunc);
+
+
+
+/*****************************************************************************/
+/*                           Hash table functions                            */
+/*****************************************************************************/
+
+
+
+static unsigned HT_GenHash (const void* Key)
+/* Generate the hash over a key. */
+{
+    return HashBuf (Key);
+}
+
+
+
+static const void* HT_GetKey (const void* Entry)
+/* Given a pointer to the user entry data, return a pointer to the key */
+{
+    return &((const IncSearch*) Entry)->Key;
+}
+
+
+
+static int HT_Compare (const void* Key1, const void* Key2)
+/* Compare two keys. The function must return a value less than zero if
+** Key1 is smaller than Key2, zero if both are equal, and a value greater
+** than zero if Key1 is greater then Key2.
+*/
+{
+    return SB_Compare (Key1, Key2);
+}
+
 
 
 /*****************************************************************************/
@@ -125,6 +219,8 @@ static IFile* NewIFile (const char* Name, InputType Type)
     IF->Size  = 0;
     IF->MTime = 0;
     IF->Type  = Type;
+    IF->Guard = 0;
+    IF->Once  = 0;
     memcpy (IF->Name, Name, Len+1);
 
     /* Insert the new structure into the IFile collection */
@@ -153,9 +249,13 @@ static AFile* NewAFile (IFile* IF, FILE* F)
     AFile* AF = (AFile*) xmalloc (sizeof (AFile));
 
     /* Initialize the fields */
-    AF->Line  = 0;
-    AF->F     = F;
-    AF->Input = IF;
+    AF->Line       = 0;
+    AF->F          = F;
+    SB_Init (&AF->Text);
+    AF->Input      = IF;
+    AF->Guard      = GUARD_START;
+    AF->GuardLevel = 0;
+    AF->GuardName  = 0;
 
     /* Increment the usage counter of the corresponding IFile. If this
     ** is the first use, set the file data and output debug info if
@@ -204,6 +304,8 @@ static AFile* NewAFile (IFile* IF, FILE* F)
 static void FreeAFile (AFile* AF)
 /* Free an AFile structure */
 {
+    SB_Done (&AF->Text);
+    xfree (AF->GuardName);
     xfree (AF);
 }
 
@@ -238,6 +340,40 @@ static IFile* FindFile (const char* Name)
 
 
 
+static char* FindIncludeFile (const SearchPaths* P, const char* Name)
+/* Search for an include file like SearchFile does, but cache the results, so
+** the file system is checked only once for each path list and name.
+*/
+{
+    unsigned   I;
+    IncSearch* S;
+    StrBuf     Key = AUTO_STRBUF_INITIALIZER;
+
+    /* Build the key from the search paths and the name */
+    for (I = 0; I < CollCount (P); ++I) {
+        SB_AppendStr (&Key, CollConstAt (P, I));
+        SB_AppendChar (&Key, '\n');
+    }
+    SB_AppendStr (&Key, Name);
+
+    /* Search the cache, add a new entry if we don't have one */
+    S = HT_Find (&IncSearches, &Key);
+    if (S == 0) {
+        S = xmalloc (sizeof (IncSearch));
+        InitHashNode (&S->Node);
+        SB_Init (&S->Key);
+        SB_Copy (&S->Key, &Key);
+        S->Name = SearchFile (P, Name);
+        HT_Insert (&IncSearches, S);
+    }
+    SB_Done (&Key);
+
+    /* Return a copy of the result */
+    return S->Name? xstrdup (S->Name) : 0;
+}
+
+
+
 void OpenMainFile (const char* Name)
 /* Open the main file. Will call Fatal() in case of failures. */
 {
@@ -282,7 +418,7 @@ void OpenIncludeFile (const char* Name, InputType IT)
     }
 
     /* Search for the file */
-    N = SearchFile ((IT == IT_SYSINC)? SysIncSearchPath : UsrIncSearchPath, Name);
+    N = FindIncludeFile ((IT == IT_SYSINC)? SysIncSearchPath : UsrIncSearchPath, Name);
     if (N == 0) {
         PPError ("Include file '%s' not found", Name);
         return;
@@ -299,6 +435,14 @@ void OpenIncludeFile (const char* Name, InputType IT)
     /* We don't need N any longer, since we may now use IF->Name */
     xfree (N);
 
+    /* If the file was read before, and it is known that including it again
+    ** has no effect, don't even open it.
+    */
+    if (IF->Once || (IF->Guard && IsMacro (IF->Guard))) {
+        Print (stdout, 1, "Skipped include file '%s'\n", IF->Name);
+        return;
+    }
+
     /* Open the file */
     F = fopen (IF->Name, "r");
     if (F == 0) {
@@ -316,6 +460,27 @@ void OpenIncludeFile (const char* Name, InputType IT)
 
 
 
+void OpenPreprocessedInput (const char* Name, const StrBuf* Text)
+/* Push already preprocessed source text onto the input stack. The text is
+** read before the remainder of the current file and is not passed through
+** the preprocessor again. Name is used for diagnostics and dependencies.
+*/
+{
+    AFile* AF;
+
+    /* Search the list of all input files for this file */
+    IFile* IF = FindFile (Name);
+    if (IF == 0) {
+        IF = NewIFile (Name, IT_USRINC);
+    }
+
+    /* Allocate a new AFile structure without a stream and set the text */
+    AF = NewAFile (IF, 0);
+    SB_Copy (&AF->Text, Text);
+}
+
+
+
 static void CloseIncludeFile (void)
 /* Close an include file and switch to the higher level file. Set Input to
 ** NULL if this was the main file.
@@ -332,8 +497,17 @@ static void CloseIncludeFile (void)
     /* Get the current active input file */
     Input = (AFile*) CollLast (&AFiles);
 
+    /* If the complete file was enclosed in an include guard, remember it */
+    if (Input->Guard == GUARD_AFTER) {
+        xfree (Input->Input->Guard);
+        Input->Input->Guard = Input->GuardName;
+        Input->GuardName    = 0;
+    }
+
     /* Close the current input file (we're just reading so no error check) */
-    fclose (Input->F);
+    if (Input->F) {
+        fclose (Input->F);
+    }
 
     /* Delete the last active file from the active file collection */
     CollDelete (&AFiles, AFileCount-1);
@@ -444,6 +618,7 @@ int NextLine (void)
     ClearLine ();
 
     /* If there is no file open, bail out, otherwise get the current input file */
+    LinePreprocessed = 0;
     if (CollCount (&AFiles) == 0) {
         return 0;
     }
@@ -453,7 +628,14 @@ int NextLine (void)
     while (1) {
 
         /* Read the next character */
-        int C = fgetc (Input->F);
+        int C;
+        if (Input->F) {
+            C = fgetc (Input->F);
+        } else if (SB_GetIndex (&Input->Text) < SB_GetLen (&Input->Text)) {
+            C = (unsigned char) SB_Get (&Input->Text);
+        } else {
+            C = EOF;
+        }
 
         /* Check for EOF */
         if (C == EOF) {
@@ -517,12 +699,96 @@ int NextLine (void)
     /* Create line information for this line */
     UpdateLineInfo (Input->Input, Input->Line, Line);
 
+    /* Remember if the line needs preprocessing */
+    LinePreprocessed = (Input->F == 0);
+
     /* Done */
     return 1;
 }
 
 
 
+void GuardIfndef (const char* Name, int Level)
+/* Must be called for each #ifndef in the current file. Level is the level of
+** the new #if clause. If the #ifndef is the first thing in the file, it may
+** be an include guard.
+*/
+{
+    AFile* AF = CollLast (&AFiles);
+    if (AF->Guard == GUARD_START) {
+        AF->Guard      = GUARD_INSIDE;
+        AF->GuardLevel = Level;
+        AF->GuardName  = xstrdup (Name);
+    } else if (AF->Guard == GUARD_AFTER) {
+        AF->Guard = GUARD_NONE;
+    }
+}
+
+
+
+void GuardEndif (int Level, int HadElse)
+/* Must be called for each #endif in the current file. Level is the level of
+** the #if clause that is closed, HadElse is true if it had an #else or #elif
+** part.
+*/
+{
+    AFile* AF = CollLast (&AFiles);
+    if (AF->Guard == GUARD_INSIDE) {
+        if (Level == AF->GuardLevel) {
+            AF->Guard = HadElse? GUARD_NONE : GUARD_AFTER;
+        }
+    } else {
+        AF->Guard = GUARD_NONE;
+    }
+}
+
+
+
+void GuardContent (void)
+/* Must be called for all other directives and for all non empty lines in
+** the current file. Content outside of the #ifndef means the file has no
+** include guard.
+*/
+{
+    AFile* AF = CollLast (&AFiles);
+    if (AF->Guard != GUARD_INSIDE) {
+        AF->Guard = GUARD_NONE;
+    }
+}
+
+
+
+void PragmaOnce (void)
+/* Mark the current file, so it is not included again */
+{
+    AFile* AF = CollLast (&AFiles);
+    AF->Input->Once = 1;
+}
+
+
+
+int InputIsPreprocessed (void)
+/* Return true if the current input line was read from preprocessed text and
+** must not be passed through the preprocessor.
+*/
+{
+    return LinePreprocessed;
+}
+
+
+
+void ResetInputFiles (void)
+/* Forget the input files of the last translation unit. The IFile structures
+** are not freed, since line infos may still reference them. The results of
+** include file searches are kept, the file system doesn't change.
+*/
+{
+    PRECONDITION (CollCount (&AFiles) == 0);
+    CollDeleteAll (&IFiles);
+}
+
+
+
 const char* GetInputFile (const struct IFile* IF)
 /* Return a filename from an IFile struct */
 {
@@ -84,6 +84,12 @@ void OpenMainFile (const char* Name);
 void OpenIncludeFile (const char* Name, InputType IT);
 /* Open an include file and insert it into the tables. */
 
+void OpenPreprocessedInput (const char* Name, const StrBuf* Text);
+/* Push already preprocessed source text onto the input stack. The text is
+** read before the remainder of the current file and is not passed through
+** the preprocessor again. Name is used for diagnostics and dependencies.
+*/
+
 void NextChar (void);
 /* Read the next character from the input stream and make CurC and NextC
 ** valid. If end of line is reached, both are set to NUL, no more lines
@@ -101,6 +107,38 @@ StrBuf* InitLine (StrBuf* Buf);
 int NextLine (void);
 /* Get a line from the current input. Returns 0 on end of file. */
 
+int InputIsPreprocessed (void);
+/* Return true if the current input line was read from preprocessed text and
+** must not be passed through the preprocessor.
+*/
+
+void GuardIfndef (const char* Name, int Level);
+/* Must be called for each #ifndef in the current file. Level is the level of
+** the new #if clause. If the #ifndef is the first thing in the file, it may
+** be an include guard.
+*/
+
+void GuardEndif (int Level, int HadElse);
+/* Must be called for each #endif in the current file. Level is the level of
+** the #if clause that is closed, HadElse is true if it had an #else or #elif
+** part.
+*/
+
+void GuardContent (void);
+/* Must be called for all other directives and for all non empty lines in
+** the current file. Content outside of the #ifndef means the file has no
+** include guard.
+*/
+
+void PragmaOnce (void);
+/* Mark the current file, so it is not included again */
+
+void ResetInputFiles (void);
+/* Forget the input files of the last translation unit. The IFile structures
+** are not freed, since line infos may still reference them. The results of
+** include file searches are kept, the file system doesn't change.
+*/
+
 const char* GetInputFile (const struct IFile* IF);
 /* Return a filename from an IFile struct */
 
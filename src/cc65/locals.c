@@ -40,6 +40,7 @@
 /* cc65 */
 #include "anonname.h"
 #include "asmlabel.h"
+#include "callgraph.h"
 #include "codegen.h"
 #include "declare.h"
 #include "error.h"
@@ -95,9 +96,23 @@ static void AllocStorage (unsigned Label, void (*UseSeg) (), unsigned Size)
 
 
 
-static void ParseRegisterDecl (Declaration* Decl, int Reg)
+static void AllocStaticLocal (unsigned Label, unsigned Size)
+/* Reserve Size bytes of storage for a local variable that was made static */
+{
+    if (OverlayLocals) {
+        /* Place it into the frame of the current function */
+        CG_AllocLocal (Label, Size);
+    } else {
+        AllocStorage (Label, g_usebss, Size);
+    }
+}
+
+
+
+static void ParseRegisterDecl (Declaration* Decl, int Reg, int Shared)
 /* Parse the declaration of a register variable. Reg is the offset of the
-** variable in the register bank.
+** variable in the register bank. If Shared is true, the variable uses the
+** slot of another register variable, which is already saved.
 */
 {
     SymEntry* Sym;
@@ -110,7 +125,11 @@ static void ParseRegisterDecl (Declaration* Decl, int Reg)
 
     /* Save the current contents of the register variable on stack */
     F_AllocLocalSpace (CurrentFunc);
-    g_save_regvars (Reg, Size);
+    if (Shared) {
+        Decl->StorageClass |= SC_SHARED;
+    } else {
+        g_save_regvars (Reg, Size);
+    }
 
     /* Add the symbol to the symbol table. We do that now, because for register
     ** variables the current stack pointer is implicitly used as location for
@@ -275,7 +294,7 @@ static void ParseAutoDecl (Declaration* Decl)
             ** We abuse the Collection somewhat by using it to store line
             ** numbers.
             */
-            CollReplace (&CurrentFunc->LocalsBlockStack, (void *)(long)GetCurrentLine (),
+            CollReplace (&CurrentFunc->LocalsBlockStack, (void *)(long)GetInputLine (NextTok.LI),
                 CollCount (&CurrentFunc->LocalsBlockStack) - 1);
 
         } else {
@@ -320,7 +339,7 @@ static void ParseAutoDecl (Declaration* Decl)
                 Size = ParseInit (Sym->Type);
 
                 /* Allocate space for the variable */
-                AllocStorage (DataLabel, g_usebss, Size);
+                AllocStaticLocal (DataLabel, Size);
 
                 /* Generate code to copy this data into the variable space */
                 g_initstatic (InitLabel, DataLabel, Size);
@@ -328,7 +347,7 @@ static void ParseAutoDecl (Declaration* Decl)
             } else {
 
                 /* Allocate space for the variable */
-                AllocStorage (DataLabel, g_usebss, Size);
+                AllocStaticLocal (DataLabel, Size);
 
                 /* Parse the expression */
                 hie1 (&Expr);
@@ -349,7 +368,7 @@ static void ParseAutoDecl (Declaration* Decl)
         } else {
 
             /* No assignment - allocate a label and space for the variable */
-            AllocStorage (DataLabel, g_usebss, Size);
+            AllocStaticLocal (DataLabel, Size);
 
         }
     }
@@ -454,8 +473,9 @@ static void ParseOneDecl (const DeclSpec* Spec)
         ** convert the declaration to "auto" if this is not possible.
         */
         int Reg = 0;    /* Initialize to avoid gcc complains */
+        int Shared = 0;
         if ((Decl.StorageClass & SC_REGISTER) != 0 &&
-            (Reg = F_AllocRegVar (CurrentFunc, Decl.Type)) < 0) {
+            (Reg = F_AllocRegVar (CurrentFunc, Decl.Ident, Decl.Type, &Shared)) < 0) {
             /* No space for this register variable, convert to auto */
             Decl.StorageClass = (Decl.StorageClass & ~SC_REGISTER) | SC_AUTO;
         }
@@ -463,7 +483,7 @@ static void ParseOneDecl (const DeclSpec* Spec)
         /* Check the variable type */
         if ((Decl.StorageClass & SC_REGISTER) == SC_REGISTER) {
             /* Register variable */
-            ParseRegisterDecl (&Decl, Reg);
+            ParseRegisterDecl (&Decl, Reg, Shared);
         } else if ((Decl.StorageClass & SC_AUTO) == SC_AUTO) {
             /* Auto variable */
             ParseAutoDecl (&Decl);
@@ -56,6 +56,9 @@
 #define MACRO_TAB_SIZE  211
 static Macro* MacroTab[MACRO_TAB_SIZE];
 
+/* Copies of the macros saved by SaveMacroTab */
+static Collection SavedMacros = STATIC_COLLECTION_INITIALIZER;
+
 
 
 /*****************************************************************************/
@@ -281,6 +284,83 @@ int MacroCmp (const Macro* M1, const Macro* M2)
 
 
 
+void CollectMacros (Collection* C)
+/* Append all macros from the macro table to the given collection */
+{
+    unsigned I;
+    Macro* M;
+
+    for (I = 0; I < MACRO_TAB_SIZE; ++I) {
+        for (M = MacroTab[I]; M; M = M->Next) {
+            CollAppend (C, M);
+        }
+    }
+}
+
+
+
+static Macro* CloneMacro (const Macro* M)
+/* Return a copy of the given macro that is not inserted into the table */
+{
+    unsigned I;
+
+    Macro* C = NewMacro (M->Name);
+    C->ArgCount = M->ArgCount;
+    C->MaxArgs  = M->MaxArgs;
+    for (I = 0; I < CollCount (&M->FormalArgs); ++I) {
+        CollAppend (&C->FormalArgs, xstrdup (CollConstAt (&M->FormalArgs, I)));
+    }
+    SB_Copy (&C->Replacement, &M->Replacement);
+    C->Variadic = M->Variadic;
+
+    return C;
+}
+
+
+
+void SaveMacroTab (void)
+/* Remember the current contents of the macro table, so it can be restored
+** by RestoreMacroTab.
+*/
+{
+    unsigned I;
+    Macro* M;
+
+    for (I = 0; I < MACRO_TAB_SIZE; ++I) {
+        for (M = MacroTab[I]; M; M = M->Next) {
+            CollAppend (&SavedMacros, CloneMacro (M));
+        }
+    }
+}
+
+
+
+void RestoreMacroTab (void)
+/* Delete all macros and restore the ones saved by SaveMacroTab */
+{
+    unsigned I;
+
+    /* Delete the current macros */
+    for (I = 0; I < MACRO_TAB_SIZE; ++I) {
+        while (MacroTab[I]) {
+            Macro* M = MacroTab[I];
+            MacroTab[I] = M->Next;
+            FreeMacro (M);
+        }
+    }
+
+    /* Insert copies of the saved ones. Going backwards keeps the order of
+    ** macros in the same hash chain, so redefinitions still shadow the
+    ** older ones.
+    */
+    I = CollCount (&SavedMacros);
+    while (I-- > 0) {
+        InsertMacro (CloneMacro (CollConstAt (&SavedMacros, I)));
+    }
+}
+
+
+
 void PrintMacroStats (FILE* F)
 /* Print macro statistics to the given text file. */
 {
@@ -121,6 +121,17 @@ void AddMacroArg (Macro* M, const char* Arg);
 int MacroCmp (const Macro* M1, const Macro* M2);
 /* Compare two macros and return zero if both are identical. */
 
+void CollectMacros (Collection* C);
+/* Append all macros from the macro table to the given collection */
+
+void SaveMacroTab (void);
+/* Remember the current contents of the macro table, so it can be restored
+** by RestoreMacroTab.
+*/
+
+void RestoreMacroTab (void);
+/* Delete all macros and restore the ones saved by SaveMacroTab */
+
 void PrintMacroStats (FILE* F);
 /* Print macro statistics to the given text file. */
 
@@ -42,6 +42,7 @@
 #include "abend.h"
 #include "chartype.h"
 #include "cmdline.h"
+#include "coll.h"
 #include "cpu.h"
 #include "debugflag.h"
 #include "fname.h"
@@ -64,6 +65,7 @@
 #include "input.h"
 #include "macrotab.h"
 #include "output.h"
+#include "pch.h"
 #include "scanner.h"
 #include "segments.h"
 #include "standard.h"
@@ -79,7 +81,7 @@
 static void Usage (void)
 /* Print usage information to stderr */
 {
-    printf ("Usage: %s [options] file\n"
+    printf ("Usage: %s [options] file [...]\n"
             "Short options:\n"
             "  -Cl\t\t\t\tMake local variables static\n"
             "  -Dsym[=defn]\t\t\tDefine a symbol\n"
@@ -120,6 +122,7 @@ static void Usage (void)
             "  --disable-opt name\t\tDisable an optimization step\n"
             "  --eagerly-inline-funcs\tEagerly inline some known functions\n"
             "  --enable-opt name\t\tEnable an optimization step\n"
+            "  --function-sections\t\tPlace functions and data in separate sections\n"
             "  --help\t\t\tHelp (this text)\n"
             "  --include-dir dir\t\tSet an include directory search path\n"
             "  --inline-stdfuncs\t\tInline some standard functions\n"
@@ -127,6 +130,9 @@ static void Usage (void)
             "  --list-warnings\t\tList available warning types for -W\n"
             "  --local-strings\t\tEmit string literals immediately\n"
             "  --memory-model model\t\tSet the memory model\n"
+            "  --overlay-locals\t\tMake local variables static and overlay them\n"
+            "  --pch-create name\t\tWrite a precompiled header instead of code\n"
+            "  --pch-use name\t\tRead a precompiled header before the input\n"
             "  --register-space b\t\tSet space available for register variables\n"
             "  --register-vars\t\tEnable register variables\n"
             "  --rodata-name seg\t\tSet the name of the RODATA segment\n"
@@ -696,6 +702,22 @@ static void OptMemoryModel (const char* Opt, const char* Arg)
 
 
 
+static void OptPCHCreate (const char* Opt, const char* Arg)
+/* Handle the --pch-create option */
+{
+    FileNameOption (Opt, Arg, &PCHCreateName);
+}
+
+
+
+static void OptPCHUse (const char* Opt, const char* Arg)
+/* Handle the --pch-use option */
+{
+    FileNameOption (Opt, Arg, &PCHUseName);
+}
+
+
+
 static void OptRegisterSpace (const char* Opt, const char* Arg)
 /* Handle the --register-space option */
 {
@@ -753,6 +775,25 @@ static void OptStandard (const char* Opt, const char* Arg)
 
 
 
+static void OptFunctionSections (const char* Opt attribute ((unused)),
+                                 const char* Arg attribute ((unused)))
+/* Place each function and data object in a section of its own */
+{
+    FunctionSections = 1;
+}
+
+
+
+static void OptOverlayLocals (const char* Opt attribute ((unused)),
+                              const char* Arg attribute ((unused)))
+/* Place local variables in static storage shared between functions */
+{
+    OverlayLocals = 1;
+    IS_Set (&StaticLocals, 1);
+}
+
+
+
 static void OptStaticLocals (const char* Opt attribute ((unused)),
                              const char* Arg attribute ((unused)))
 /* Place local variables in static storage */
@@ -844,6 +885,45 @@ static void OptWritableStrings (const char* Opt attribute ((unused)),
 
 
 
+static void CompileFile (const char* InputFile)
+/* Compile one translation unit and write the output files */
+{
+    /* Create the output file name if it was not explicitly given */
+    MakeDefaultOutputName (InputFile);
+
+    /* Compile the file */
+    Compile (InputFile);
+
+    /* Create the output file if we didn't had any errors */
+    if (SB_NotEmpty (&PCHCreateName)) {
+
+        /* Write the precompiled header instead of code */
+        if (ErrorCount == 0) {
+            PCH_Write (SB_GetConstBuf (&PCHCreateName));
+        }
+
+    } else if (PreprocessOnly == 0 && (ErrorCount == 0 || Debug)) {
+
+        /* Emit literals, externals, do cleanup and optimizations */
+        FinishCompile ();
+
+        /* Open the file */
+        OpenOutputFile ();
+
+        /* Write the output to the file */
+        WriteAsmOutput ();
+        Print (stdout, 1, "Wrote output to '%s'\n", OutputFilename);
+
+        /* Close the file, check for errors */
+        CloseOutputFile ();
+
+        /* Create dependencies if requested */
+        CreateDependencies ();
+    }
+}
+
+
+
 int main (int argc, char* argv[])
 {
     /* Program long options */
@@ -866,6 +946,7 @@ int main (int argc, char* argv[])
         { "--disable-opt",          1,      OptDisableOpt           },
         { "--eagerly-inline-funcs", 0,      OptEagerlyInlineFuncs   },
         { "--enable-opt",           1,      OptEnableOpt            },
+        { "--function-sections",    0,      OptFunctionSections     },
         { "--help",                 0,      OptHelp                 },
         { "--include-dir",          1,      OptIncludeDir           },
         { "--inline-stdfuncs",      0,      OptInlineStdFuncs       },
@@ -873,6 +954,9 @@ int main (int argc, char* argv[])
         { "--list-warnings",        0,      OptListWarnings         },
         { "--local-strings",        0,      OptLocalStrings         },
         { "--memory-model",         1,      OptMemoryModel          },
+        { "--overlay-locals",       0,      OptOverlayLocals        },
+        { "--pch-create",           1,      OptPCHCreate            },
+        { "--pch-use",              1,      OptPCHUse               },
         { "--register-space",       1,      OptRegisterSpace        },
         { "--register-vars",        0,      OptRegisterVars         },
         { "--rodata-name",          1,      OptRodataName           },
@@ -886,9 +970,10 @@ int main (int argc, char* argv[])
     };
 
     unsigned I;
+    unsigned Failures = 0;
 
-    /* Initialize the input file name */
-    const char* InputFile  = 0;
+    /* The input files */
+    Collection InputFiles = AUTO_COLLECTION_INITIALIZER;
 
     /* Initialize the cmdline module */
     InitCmdLine (&argc, &argv, "cc65");
@@ -1018,11 +1103,7 @@ int main (int argc, char* argv[])
                     break;
             }
         } else {
-            if (InputFile) {
-                fprintf (stderr, "additional file specs ignored\n");
-            } else {
-                InputFile = Arg;
-            }
+            CollAppend (&InputFiles, (void*) Arg);
         }
 
         /* Next argument */
@@ -1030,16 +1111,28 @@ int main (int argc, char* argv[])
     }
 
     /* Did we have a file spec on the command line? */
-    if (InputFile == 0) {
+    if (CollCount (&InputFiles) == 0) {
         AbEnd ("No input files");
     }
 
+    /* Options that name a single output file cannot be used if several
+    ** translation units are compiled.
+    */
+    if (CollCount (&InputFiles) > 1) {
+        if (OutputFilename) {
+            AbEnd ("Cannot use -o with more than one input file");
+        }
+        if (SB_NotEmpty (&DepName) || SB_NotEmpty (&FullDepName)) {
+            AbEnd ("Cannot create dependencies for more than one input file");
+        }
+        if (SB_NotEmpty (&PCHCreateName)) {
+            AbEnd ("Cannot create a precompiled header from more than one input file");
+        }
+    }
+
     /* Add the default include search paths. */
     FinishIncludePaths ();
 
-    /* Create the output file name if it was not explicitly given */
-    MakeDefaultOutputName (InputFile);
-
     /* If no CPU given, use the default CPU for the target */
     if (CPU == CPU_UNKNOWN) {
         if (Target != TGT_UNKNOWN) {
@@ -1059,29 +1152,24 @@ int main (int argc, char* argv[])
         IS_Set (&Standard, STD_DEFAULT);
     }
 
-    /* Go! */
-    Compile (InputFile);
-
-    /* Create the output file if we didn't had any errors */
-    if (PreprocessOnly == 0 && (ErrorCount == 0 || Debug)) {
-
-        /* Emit literals, externals, do cleanup and optimizations */
-        FinishCompile ();
-
-        /* Open the file */
-        OpenOutputFile ();
-
-        /* Write the output to the file */
-        WriteAsmOutput ();
-        Print (stdout, 1, "Wrote output to '%s'\n", OutputFilename);
-
-        /* Close the file, check for errors */
-        CloseOutputFile ();
+    /* Remember the state set up by the command line, since each translation
+    ** unit must start with it.
+    */
+    SaveCompilerState ();
 
-        /* Create dependencies if requested */
-        CreateDependencies ();
+    /* Go! */
+    for (I = 0; I < CollCount (&InputFiles); ++I) {
+        if (I > 0) {
+            RestoreCompilerState ();
+            SetOutputName (0);
+        }
+        CompileFile (CollConstAt (&InputFiles, I));
+        if (ErrorCount > 0) {
+            ++Failures;
+        }
     }
+    DoneCollection (&InputFiles);
 
     /* Return an apropriate exit code */
-    return (ErrorCount > 0)? EXIT_FAILURE : EXIT_SUCCESS;
+    return (Failures > 0)? EXIT_FAILURE : EXIT_SUCCESS;
 }
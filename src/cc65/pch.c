@@ -0,0 +1,382 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                   pch.c                                   */
+/*                                                                           */
+/*                       Precompiled header snapshots                        */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+/* common */
+#include "attrib.h"
+#include "coll.h"
+#include "filebuf.h"
+#include "print.h"
+#include "version.h"
+#include "xmalloc.h"
+
+/* cc65 */
+#include "error.h"
+#include "global.h"
+#include "input.h"
+#include "macrotab.h"
+#include "pch.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* File format */
+#define PCH_MAGIC       0x48435043UL    /* "CPCH" */
+#define PCH_VERSION     0x0001U
+
+/* The predefined macros in file format, used to check if a snapshot was
+** created with the same options and command line macros.
+*/
+static StrBuf Signature = STATIC_STRBUF_INITIALIZER;
+
+/* The names of the predefined macros */
+static Collection Predefined = STATIC_COLLECTION_INITIALIZER;
+
+/* The preprocessed text if a snapshot is being created */
+static int Recording = 0;
+static StrBuf Text = STATIC_STRBUF_INITIALIZER;
+
+
+
+/*****************************************************************************/
+/*                              Helper functions                             */
+/*****************************************************************************/
+
+
+
+static void Put8 (StrBuf* B, unsigned V)
+/* Append an 8 bit value to the buffer */
+{
+    SB_AppendChar (B, (char) V);
+}
+
+
+
+static void Put16 (StrBuf* B, unsigned V)
+/* Append a 16 bit value to the buffer */
+{
+    Put8 (B, V & 0xFF);
+    Put8 (B, (V >> 8) & 0xFF);
+}
+
+
+
+static void Put32 (StrBuf* B, unsigned long V)
+/* Append a 32 bit value to the buffer */
+{
+    Put16 (B, (unsigned) (V & 0xFFFF));
+    Put16 (B, (unsigned) ((V >> 16) & 0xFFFF));
+}
+
+
+
+static void PutVar (StrBuf* B, unsigned long V)
+/* Append a variable size value to the buffer. The encoding is the one used
+** in the object files, so ReadVar can read it.
+*/
+{
+    do {
+        unsigned C = (unsigned) (V & 0x7F);
+        V >>= 7;
+        if (V) {
+            C |= 0x80;
+        }
+        Put8 (B, C);
+    } while (V);
+}
+
+
+
+static void PutStr (StrBuf* B, const char* S, unsigned Len)
+/* Append a string with a length prefix to the buffer */
+{
+    PutVar (B, Len);
+    SB_AppendBuf (B, S, Len);
+}
+
+
+
+static void ReadStr (FileBuf* F, StrBuf* S)
+/* Read a string from the file into S and terminate it */
+{
+    StrBuf Tmp;
+    ReadStrBuf (F, &Tmp);
+    SB_Copy (S, &Tmp);
+    SB_Terminate (S);
+}
+
+
+
+static int CmpMacro (void* Data attribute ((unused)),
+                     const void* Left, const void* Right)
+/* Compare two macros by name */
+{
+    return strcmp (((const Macro*) Left)->Name, ((const Macro*) Right)->Name);
+}
+
+
+
+static void GetMacros (Collection* C)
+/* Collect the macros that are part of a snapshot and sort them by name. The
+** values of __DATE__ and __TIME__ change with every run, and redefined
+** macros leave shadowed definitions in the table. Both are skipped.
+*/
+{
+    unsigned I = 0;
+
+    CollectMacros (C);
+    while (I < CollCount (C)) {
+        const Macro* M = CollConstAt (C, I);
+        if (FindMacro (M->Name) != M        ||
+            strcmp (M->Name, "__DATE__") == 0 ||
+            strcmp (M->Name, "__TIME__") == 0) {
+            CollDelete (C, I);
+        } else {
+            ++I;
+        }
+    }
+    CollSort (C, CmpMacro, 0);
+}
+
+
+
+static void PutMacros (StrBuf* B, const Collection* C)
+/* Append the macros in the collection to the buffer */
+{
+    unsigned I, J;
+
+    PutVar (B, CollCount (C));
+    for (I = 0; I < CollCount (C); ++I) {
+        const Macro* M = CollConstAt (C, I);
+        PutStr (B, M->Name, strlen (M->Name));
+        PutVar (B, (unsigned long) (M->ArgCount + 1));
+        Put8 (B, M->Variadic);
+        PutVar (B, CollCount (&M->FormalArgs));
+        for (J = 0; J < CollCount (&M->FormalArgs); ++J) {
+            const char* Arg = CollConstAt (&M->FormalArgs, J);
+            PutStr (B, Arg, strlen (Arg));
+        }
+        PutStr (B, SB_GetConstBuf (&M->Replacement), SB_GetLen (&M->Replacement));
+    }
+}
+
+
+
+static Macro* ReadMacro (FileBuf* F)
+/* Read one macro from the file and return it */
+{
+    Macro*   M;
+    unsigned Count;
+    StrBuf   S = AUTO_STRBUF_INITIALIZER;
+
+    ReadStr (F, &S);
+    M = NewMacro (SB_GetConstBuf (&S));
+    M->ArgCount = (int) ReadVar (F) - 1;
+    M->Variadic = (unsigned char) Read8 (F);
+    Count = ReadVar (F);
+    while (Count--) {
+        ReadStr (F, &S);
+        CollAppend (&M->FormalArgs, xstrdup (SB_GetConstBuf (&S)));
+    }
+    ReadStr (F, &S);
+    SB_Copy (&M->Replacement, &S);
+
+    SB_Done (&S);
+    return M;
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void PCH_Init (void)
+/* Remember the macros that are predefined when compilation starts. Must be
+** called after all predefined macros are known and before the main file is
+** opened. If a precompiled header is created, start recording the input.
+*/
+{
+    unsigned I;
+    Collection Macros = AUTO_COLLECTION_INITIALIZER;
+
+    /* Forget the macros of an earlier translation unit */
+    SB_Clear (&Signature);
+    for (I = 0; I < CollCount (&Predefined); ++I) {
+        xfree (CollAtUnchecked (&Predefined, I));
+    }
+    CollDeleteAll (&Predefined);
+
+    GetMacros (&Macros);
+    PutMacros (&Signature, &Macros);
+    for (I = 0; I < CollCount (&Macros); ++I) {
+        const Macro* M = CollConstAt (&Macros, I);
+        CollAppend (&Predefined, xstrdup (M->Name));
+    }
+    DoneCollection (&Macros);
+
+    Recording = SB_NotEmpty (&PCHCreateName);
+}
+
+
+
+void PCH_AddLine (const StrBuf* L)
+/* Add a preprocessed line to the snapshot if one is being created */
+{
+    if (Recording) {
+        SB_Append (&Text, L);
+        SB_AppendChar (&Text, '\n');
+    }
+}
+
+
+
+void PCH_Write (const char* Name)
+/* Write the snapshot to the given file. The file contains the macro table
+** and the preprocessed text read so far.
+*/
+{
+    unsigned    I;
+    FILE*       F;
+    Collection  Undefs = AUTO_COLLECTION_INITIALIZER;
+    Collection  Macros = AUTO_COLLECTION_INITIALIZER;
+    StrBuf      B      = AUTO_STRBUF_INITIALIZER;
+
+    /* Header */
+    Put32 (&B, PCH_MAGIC);
+    Put16 (&B, PCH_VERSION);
+    Put32 (&B, GetVersionAsNumber ());
+    PutStr (&B, SB_GetConstBuf (&Signature), SB_GetLen (&Signature));
+
+    /* Predefined macros that were removed by the header */
+    for (I = 0; I < CollCount (&Predefined); ++I) {
+        const char* N = CollConstAt (&Predefined, I);
+        if (!IsMacro (N)) {
+            CollAppend (&Undefs, (void*) N);
+        }
+    }
+    PutVar (&B, CollCount (&Undefs));
+    for (I = 0; I < CollCount (&Undefs); ++I) {
+        const char* N = CollConstAt (&Undefs, I);
+        PutStr (&B, N, strlen (N));
+    }
+
+    /* The macro table */
+    GetMacros (&Macros);
+    PutMacros (&B, &Macros);
+
+    /* The preprocessed text */
+    PutStr (&B, SB_GetConstBuf (&Text), SB_GetLen (&Text));
+
+    /* Write the file */
+    F = fopen (Name, "wb");
+    if (F == 0) {
+        Fatal ("Cannot create precompiled header '%s': %s", Name, strerror (errno));
+    }
+    if (fwrite (SB_GetConstBuf (&B), 1, SB_GetLen (&B), F) != SB_GetLen (&B)) {
+        Fatal ("Cannot write to '%s': %s", Name, strerror (errno));
+    }
+    if (fclose (F) != 0) {
+        Fatal ("Cannot write to '%s': %s", Name, strerror (errno));
+    }
+    Print (stdout, 1, "Wrote precompiled header to '%s'\n", Name);
+
+    /* Cleanup */
+    DoneCollection (&Undefs);
+    DoneCollection (&Macros);
+    SB_Done (&B);
+}
+
+
+
+void PCH_Read (const char* Name)
+/* Read a snapshot from the given file. The macro table is restored, and the
+** preprocessed text is pushed onto the input stack, so it is parsed before
+** the remainder of the main file.
+*/
+{
+    unsigned Count;
+    StrBuf   T;
+    StrBuf   S = AUTO_STRBUF_INITIALIZER;
+
+    /* Read the complete file */
+    FileBuf* F = FB_Open (Name);
+    if (F == 0) {
+        Fatal ("Cannot open precompiled header '%s': %s", Name, strerror (errno));
+    }
+
+    /* Check the header */
+    if (Read32 (F) != PCH_MAGIC || Read16 (F) != PCH_VERSION) {
+        Fatal ("'%s' is not a valid precompiled header", Name);
+    }
+    if (Read32 (F) != GetVersionAsNumber ()) {
+        Fatal ("Precompiled header '%s' was created by a different compiler version",
+               Name);
+    }
+    ReadStr (F, &S);
+    if (SB_Compare (&S, &Signature) != 0) {
+        Fatal ("Precompiled header '%s' was created with different options", Name);
+    }
+
+    /* Remove the predefined macros that the header removed */
+    Count = ReadVar (F);
+    while (Count--) {
+        ReadStr (F, &S);
+        UndefineMacro (SB_GetConstBuf (&S));
+    }
+
+    /* Restore the macro table */
+    Count = ReadVar (F);
+    while (Count--) {
+        Macro* M = ReadMacro (F);
+        UndefineMacro (M->Name);
+        InsertMacro (M);
+    }
+
+    /* Push the preprocessed text */
+    OpenPreprocessedInput (Name, ReadStrBuf (F, &T));
+    Print (stdout, 1, "Read precompiled header '%s'\n", Name);
+
+    /* Cleanup */
+    SB_Done (&S);
+    FB_Close (F);
+}
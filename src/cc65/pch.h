@@ -0,0 +1,73 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                   pch.h                                   */
+/*                                                                           */
+/*                       Precompiled header snapshots                        */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef PCH_H
+#define PCH_H
+
+
+
+/* common */
+#include "strbuf.h"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void PCH_Init (void);
+/* Remember the macros that are predefined when compilation starts. Must be
+** called after all predefined macros are known and before the main file is
+** opened. If a precompiled header is created, start recording the input.
+*/
+
+void PCH_AddLine (const StrBuf* L);
+/* Add a preprocessed line to the snapshot if one is being created */
+
+void PCH_Write (const char* Name);
+/* Write the snapshot to the given file. The file contains the macro table
+** and the preprocessed text read so far.
+*/
+
+void PCH_Read (const char* Name);
+/* Read a snapshot from the given file. The macro table is restored, and the
+** preprocessed text is pushed onto the input stack, so it is parsed before
+** the remainder of the main file.
+*/
+
+
+
+/* End of pch.h */
+
+#endif
@@ -55,6 +55,7 @@
 #include "input.h"
 #include "lineinfo.h"
 #include "macrotab.h"
+#include "pch.h"
 #include "preproc.h"
 #include "scanner.h"
 #include "standard.h"
@@ -1102,7 +1103,12 @@ static int DoIfDef (int skip, int flag)
     if (MacName (Ident) == 0) {
         return 0;
     } else {
-        return PushIf (skip, flag, IsMacro(Ident));
+        skip = PushIf (skip, flag, IsMacro(Ident));
+        if (flag == 0) {
+            /* May be an include guard */
+            GuardIfndef (Ident, IfIndex);
+        }
+        return skip;
     }
 }
 
@@ -1183,6 +1189,14 @@ static void DoPragma (void)
     SB_Clear (MLine);
     Pass1 (Line, MLine);
 
+    /* #pragma once is handled here, since it's about the input file */
+    SB_Terminate (MLine);
+    if (strcmp (SB_GetConstBuf (MLine), "once") == 0) {
+        PragmaOnce ();
+        ClearLine ();
+        return;
+    }
+
     /* Convert the directive into the operator */
     SB_CopyStr (Line, "_Pragma (");
     SB_Reset (MLine);
@@ -1225,6 +1239,20 @@ static void DoWarning (void)
 
 
 
+static int LineIsBlank (void)
+/* Return true if the remainder of the current line is white space only */
+{
+    unsigned I;
+    for (I = SB_GetIndex (Line); I < SB_GetLen (Line); ++I) {
+        if (!IsSpace (SB_AtUnchecked (Line, I))) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
+
 void Preprocess (void)
 /* Preprocess a line */
 {
@@ -1236,6 +1264,11 @@ void Preprocess (void)
         MLine = NewStrBuf ();
     }
 
+    /* Lines from a precompiled header are already preprocessed */
+    if (InputIsPreprocessed ()) {
+        goto Done;
+    }
+
     /* Skip white space at the beginning of the line */
     SkipWhitespace (0);
 
@@ -1255,7 +1288,16 @@ void Preprocess (void)
                 PPError ("Preprocessor directive expected");
                 ClearLine ();
             } else {
-                switch (FindPPToken (Directive)) {
+                pptoken_t Tok = FindPPToken (Directive);
+
+                /* Everything but the include guard itself, and #pragma which
+                ** is checked later, is content outside of the guard.
+                */
+                if (Tok != PP_IFNDEF && Tok != PP_ENDIF && Tok != PP_PRAGMA) {
+                    GuardContent ();
+                }
+
+                switch (Tok) {
 
                     case PP_DEFINE:
                         if (!Skip) {
@@ -1311,9 +1353,13 @@ void Preprocess (void)
                             /* Stack may not be empty here or something is wrong */
                             CHECK (IfIndex >= 0);
 
+                            /* Check for the end of an include guard */
+                            GuardEndif (IfIndex, (IfStack[IfIndex] & IFCOND_ELSE) != 0);
+
                             /* Remove the clause that needs a terminator */
                             Skip = (IfStack[IfIndex--] & IFCOND_SKIP) != 0;
                         } else {
+                            GuardContent ();
                             PPError ("Unexpected '#endif'");
                         }
                         break;
@@ -1388,6 +1434,7 @@ void Preprocess (void)
         if (NextLine () == 0) {
             if (IfIndex >= 0) {
                 PPError ("'#endif' expected");
+                IfIndex = -1;
             }
             return;
         }
@@ -1397,6 +1444,14 @@ void Preprocess (void)
     PreprocessLine ();
 
 Done:
+    /* A non empty line is content for the include guard detection */
+    if (!LineIsBlank ()) {
+        GuardContent ();
+    }
+
+    /* Remember the line if we're creating a precompiled header */
+    PCH_AddLine (Line);
+
     if (Verbosity > 1 && SB_NotEmpty (Line)) {
         printf ("%s(%u): %.*s\n", GetCurrentFile (), GetCurrentLine (),
                 (int) SB_GetLen (Line), SB_GetConstBuf (Line));
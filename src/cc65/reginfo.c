@@ -58,6 +58,9 @@ void RC_Invalidate (RegContents* C)
     C->Ptr1Lo = UNKNOWN_REGVAL;
     C->Ptr1Hi = UNKNOWN_REGVAL;
     C->Tmp1   = UNKNOWN_REGVAL;
+    C->MemA   = UNKNOWN_MEMLOC;
+    C->MemX   = UNKNOWN_MEMLOC;
+    C->MemY   = UNKNOWN_MEMLOC;
 }
 
 
@@ -54,6 +54,20 @@
 /* Encoding for an unknown register value */
 #define UNKNOWN_REGVAL  -1
 
+/* Encoding for an unknown memory location */
+#define UNKNOWN_MEMLOC  0U
+
+/* Memory locations whose contents may be held in a register. The type is in
+** the low two bits, the remaining bits depend on the type.
+*/
+#define MEMLOC_STACK    1U      /* Byte on the C stack, offset from sp */
+#define MEMLOC_NAMED    2U      /* Symbol, index of the name in a pool */
+#define MEMLOC_ZPREG    3U      /* Zero page register, single REG_xxx bit */
+
+#define MAKE_MEMLOC(Type, Val)  (((unsigned) (Val) << 2) | (Type))
+#define MEMLOC_TYPE(Loc)        ((Loc) & 0x03U)
+#define MEMLOC_VAL(Loc)         ((Loc) >> 2)
+
 /* Register contents */
 typedef struct RegContents RegContents;
 struct RegContents {
@@ -65,6 +79,9 @@ struct RegContents {
     short       Ptr1Lo;
     short       Ptr1Hi;
     short       Tmp1;
+    unsigned    MemA;           /* Memory location held in A */
+    unsigned    MemX;           /* Memory location held in X */
+    unsigned    MemY;           /* Memory location held in Y */
 };
 
 /* Register change info */
@@ -0,0 +1,725 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 regvars.c                                 */
+/*                                                                           */
+/*               Usage based allocation of register variables                */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <limits.h>
+#include <string.h>
+
+/* common */
+#include "attrib.h"
+#include "coll.h"
+#include "xmalloc.h"
+
+/* cc65 */
+#include "datatype.h"
+#include "funcdesc.h"
+#include "global.h"
+#include "scanner.h"
+#include "symentry.h"
+#include "symtab.h"
+#include "regvars.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Register variable flags */
+#define RV_NONE         0x00U
+#define RV_PARAM        0x01U   /* Variable is a parameter */
+#define RV_INIT         0x02U   /* Variable has an initializer */
+#define RV_ADDR         0x04U   /* Address of the variable may be taken */
+#define RV_MULTI        0x08U   /* Name is declared more than once */
+#define RV_DECIDED      0x10U   /* Slot allocation was decided */
+
+/* Usage information for one register variable */
+typedef struct RegVar RegVar;
+struct RegVar {
+    const char*         Name;           /* Name of the variable */
+    unsigned            Flags;          /* RV_xxx flags */
+    unsigned            Order;          /* Order of declaration */
+    unsigned            Size;           /* Size if known, zero otherwise */
+    unsigned            DeclIndex;      /* Token index of the declaration */
+    unsigned long       Weight;         /* References weighted by loop depth */
+    unsigned            First;          /* First token where the var is live */
+    unsigned            Last;           /* Last token where the var is live */
+    int                 RegOffs;        /* Slot in the register bank or -1 */
+    RegVar*             Owner;          /* Owner of a shared slot or NULL */
+};
+
+/* A loop that is not nested in another one, as a range of tokens */
+typedef struct LoopRange LoopRange;
+struct LoopRange {
+    unsigned            Start;
+    unsigned            End;
+};
+
+/* State of a loop while scanning the tokens */
+typedef enum {
+    LS_HEAD,                            /* Controlling expression(s) */
+    LS_BODY,                            /* Next token starts the body */
+    LS_BLOCK,                           /* Body is a compound statement */
+    LS_STMT,                            /* Body is some other statement */
+    LS_DOTAIL,                          /* Waiting for "while" of a do loop */
+    LS_DOHEAD,                          /* Condition of a do loop */
+    LS_DOEND                            /* Waiting for ';' of a do loop */
+} LoopState;
+
+typedef struct LoopScan LoopScan;
+struct LoopScan {
+    LoopState           State;          /* Current state */
+    unsigned            Braces;         /* Brace depth of the loop keyword */
+    unsigned            Parens;         /* Paren depth of the loop keyword */
+    int                 IsDo;           /* True for a do loop */
+};
+
+/* Maximum loop depth used for weighting references. Each level multiplies
+** the weight by 8.
+*/
+#define MAX_WEIGHT_DEPTH        5U
+
+/* Usage information for the current function */
+static Collection       RegVars = STATIC_COLLECTION_INITIALIZER;
+static int              HaveInfo = 0;   /* Information is valid */
+static int              HaveJumps = 0;  /* Function contains goto or asm */
+
+
+
+/*****************************************************************************/
+/*                             Helper functions                              */
+/*****************************************************************************/
+
+
+
+static RegVar* NewRegVar (const char* Name, unsigned Flags)
+/* Create a new register variable entry and add it to the list */
+{
+    RegVar* R = xmalloc (sizeof (RegVar));
+
+    R->Name      = xstrdup (Name);
+    R->Flags     = Flags;
+    R->Order     = CollCount (&RegVars);
+    R->Size      = 0;
+    R->DeclIndex = UINT_MAX;
+    R->Weight    = 0;
+    R->First     = UINT_MAX;
+    R->Last      = 0;
+    R->RegOffs   = -1;
+    R->Owner     = 0;
+
+    CollAppend (&RegVars, R);
+    return R;
+}
+
+
+
+static RegVar* FindRegVar (const char* Name)
+/* Find the register variable with the given name. Return NULL if not found */
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&RegVars); ++I) {
+        RegVar* R = CollAtUnchecked (&RegVars, I);
+        if (strcmp (R->Name, Name) == 0) {
+            return R;
+        }
+    }
+    return 0;
+}
+
+
+
+static token_t TokAt (const Collection* Tokens, unsigned I)
+/* Return the token at index I, or TOK_CEOF if I is out of range */
+{
+    if (I < CollCount (Tokens)) {
+        return ((const Token*) CollConstAt (Tokens, I))->Tok;
+    }
+    return TOK_CEOF;
+}
+
+
+
+static unsigned SkipNested (const Collection* Tokens, unsigned I)
+/* The token at I is a left paren or bracket. Return the index of the
+** matching right paren or bracket.
+*/
+{
+    unsigned Depth = 0;
+    while (I < CollCount (Tokens)) {
+        switch (TokAt (Tokens, I)) {
+            case TOK_LPAREN:
+            case TOK_LBRACK:
+                ++Depth;
+                break;
+            case TOK_RPAREN:
+            case TOK_RBRACK:
+                if (--Depth == 0) {
+                    return I;
+                }
+                break;
+            default:
+                break;
+        }
+        ++I;
+    }
+    return I;
+}
+
+
+
+static void AddDecl (const Collection* Tokens, unsigned Index, unsigned Flags)
+/* Add a register variable declared by the identifier at Index */
+{
+    const Token* T = CollConstAt (Tokens, Index);
+    RegVar* R = FindRegVar (T->Ident);
+    if (R) {
+        R->Flags |= RV_MULTI;
+    } else {
+        R = NewRegVar (T->Ident, Flags);
+        R->DeclIndex = Index;
+    }
+}
+
+
+
+static unsigned ParseRegisterDecl (const Collection* Tokens, unsigned I)
+/* The token at I is the keyword "register". Determine the variables declared
+** and add them to the list. Returns the index of the token that ends the
+** declaration.
+*/
+{
+    int      Name = -1;         /* Index of the last identifier */
+    int      InInit = 0;        /* True while skipping an initializer */
+    unsigned Depth = 0;         /* Nesting depth inside an initializer */
+
+    while (++I < CollCount (Tokens)) {
+
+        token_t Tok = TokAt (Tokens, I);
+
+        if (InInit) {
+            /* Skip the initializer up to the next declarator */
+            if (Tok == TOK_LPAREN || Tok == TOK_LBRACK || Tok == TOK_LCURLY) {
+                ++Depth;
+            } else if (Tok == TOK_RPAREN || Tok == TOK_RBRACK || Tok == TOK_RCURLY) {
+                --Depth;
+            } else if (Depth == 0 && Tok == TOK_COMMA) {
+                InInit = 0;
+            } else if (Depth == 0 && Tok == TOK_SEMI) {
+                break;
+            }
+            continue;
+        }
+
+        switch (Tok) {
+
+            case TOK_IDENT:
+                Name = I;
+                break;
+
+            case TOK_LPAREN:
+                /* A parameter list follows an identifier or a closing paren.
+                ** Other parens are used for grouping.
+                */
+                if (Name >= 0 && (TokAt (Tokens, I-1) == TOK_IDENT ||
+                                  TokAt (Tokens, I-1) == TOK_RPAREN)) {
+                    I = SkipNested (Tokens, I);
+                }
+                break;
+
+            case TOK_LBRACK:
+                I = SkipNested (Tokens, I);
+                break;
+
+            case TOK_ASSIGN:
+                if (Name >= 0) {
+                    AddDecl (Tokens, Name, RV_INIT);
+                    Name = -1;
+                }
+                InInit = 1;
+                Depth  = 0;
+                break;
+
+            case TOK_COMMA:
+            case TOK_SEMI:
+                if (Name >= 0) {
+                    AddDecl (Tokens, Name, RV_NONE);
+                    Name = -1;
+                }
+                if (Tok == TOK_SEMI) {
+                    return I;
+                }
+                break;
+
+            case TOK_LCURLY:
+            case TOK_RCURLY:
+            case TOK_CEOF:
+                /* Something's wrong, bail out */
+                return I;
+
+            default:
+                break;
+        }
+    }
+    return I;
+}
+
+
+
+static int EndsStatement (const Collection* Tokens, unsigned I,
+                          const LoopScan* L, unsigned Braces, unsigned Parens)
+/* Check if the token at I ends the body of loop L, given the nesting depth
+** after the token.
+*/
+{
+    token_t Tok = TokAt (Tokens, I);
+
+    if (L->State == LS_BLOCK) {
+        return Tok == TOK_RCURLY && Braces == L->Braces;
+    }
+
+    /* An "else" following the statement belongs to it */
+    if (TokAt (Tokens, I+1) == TOK_ELSE) {
+        return 0;
+    }
+    return Braces < L->Braces                                               ||
+           (Tok == TOK_SEMI && Braces == L->Braces && Parens == L->Parens) ||
+           (Tok == TOK_RCURLY && Braces == L->Braces);
+}
+
+
+
+static void ScanLoops (const Collection* Tokens, unsigned char* Depth,
+                       int* Outer, Collection* Loops)
+/* Determine the loop nesting depth of all tokens. Outer receives the index
+** of the outermost loop that contains the token in Loops, or -1 if the token
+** is not inside a loop. The ranges of the outermost loops are a conservative
+** approximation: They may extend past the actual end of the loop, but never
+** end too early.
+*/
+{
+    Collection  Stack  = AUTO_COLLECTION_INITIALIZER;
+    unsigned    Braces = 0;
+    unsigned    Parens = 0;
+    unsigned    I;
+
+    for (I = 0; I < CollCount (Tokens); ++I) {
+
+        token_t   Tok = TokAt (Tokens, I);
+        LoopScan* L   = CollCount (&Stack)? CollLast (&Stack) : 0;
+
+        /* The first token of a loop body decides about the kind of body */
+        if (L && L->State == LS_BODY) {
+            L->State = (Tok == TOK_LCURLY)? LS_BLOCK : LS_STMT;
+        }
+
+        /* Check for the start of a new loop */
+        if (L && L->State == LS_DOTAIL && Tok == TOK_WHILE) {
+            L->State = LS_DOHEAD;
+        } else if (Tok == TOK_FOR || Tok == TOK_WHILE || Tok == TOK_DO) {
+            LoopScan* N = xmalloc (sizeof (LoopScan));
+            N->State  = (Tok == TOK_DO)? LS_BODY : LS_HEAD;
+            N->Braces = Braces;
+            N->Parens = Parens;
+            N->IsDo   = (Tok == TOK_DO);
+            if (CollCount (&Stack) == 0) {
+                LoopRange* R = xmalloc (sizeof (LoopRange));
+                R->Start = I;
+                R->End   = CollCount (Tokens) - 1;
+                CollAppend (Loops, R);
+            }
+            CollAppend (&Stack, N);
+        }
+
+        /* Remember the loop depth of the token */
+        if (CollCount (&Stack) > 0) {
+            unsigned D = CollCount (&Stack);
+            Depth[I] = (D > MAX_WEIGHT_DEPTH)? MAX_WEIGHT_DEPTH : D;
+            Outer[I] = CollCount (Loops) - 1;
+        } else {
+            Depth[I] = 0;
+            Outer[I] = -1;
+        }
+
+        /* Track the nesting depth */
+        switch (Tok) {
+            case TOK_LPAREN:    ++Parens;                       break;
+            case TOK_RPAREN:    if (Parens > 0) --Parens;       break;
+            case TOK_LCURLY:    ++Braces;                       break;
+            case TOK_RCURLY:    if (Braces > 0) --Braces;       break;
+            default:                                            break;
+        }
+
+        /* Check for the end of loops */
+        while ((L = CollCount (&Stack)? CollLast (&Stack) : 0) != 0) {
+
+            if (L->State == LS_HEAD || L->State == LS_DOHEAD) {
+                if (Tok == TOK_RPAREN && Parens == L->Parens) {
+                    L->State = (L->State == LS_HEAD)? LS_BODY : LS_DOEND;
+                }
+                break;
+            }
+
+            if (L->State == LS_DOEND) {
+                if (Tok != TOK_SEMI) {
+                    break;
+                }
+            } else if (L->State != LS_BLOCK && L->State != LS_STMT) {
+                break;
+            } else if (!EndsStatement (Tokens, I, L, Braces, Parens)) {
+                break;
+            } else if (L->IsDo) {
+                L->State = LS_DOTAIL;
+                break;
+            }
+
+            /* The loop ends here, check the enclosing one with this token */
+            xfree (CollPop (&Stack));
+            if (CollCount (&Stack) == 0) {
+                ((LoopRange*) CollLast (Loops))->End = I;
+            }
+        }
+    }
+
+    /* Free loops that didn't end because of syntax errors */
+    while (CollCount (&Stack) > 0) {
+        xfree (CollPop (&Stack));
+    }
+    DoneCollection (&Stack);
+}
+
+
+
+static void CountRefs (const Collection* Tokens)
+/* Count the references to the register variables and determine the token
+** ranges where they are live.
+*/
+{
+    unsigned       Count = CollCount (Tokens);
+    unsigned char* Depth = xmalloc (Count + 1);
+    int*           Outer = xmalloc ((Count + 1) * sizeof (int));
+    Collection     Loops = AUTO_COLLECTION_INITIALIZER;
+    unsigned       I;
+
+    /* Determine the loop structure */
+    ScanLoops (Tokens, Depth, Outer, &Loops);
+
+    for (I = 0; I < Count; ++I) {
+
+        const Token* T = CollConstAt (Tokens, I);
+        RegVar*      R;
+        unsigned     First, Last;
+
+        /* Jumps make the live ranges meaningless */
+        if (T->Tok == TOK_GOTO || T->Tok == TOK_ASM) {
+            HaveJumps = 1;
+            continue;
+        }
+
+        /* Check for a reference to a register variable */
+        if (T->Tok != TOK_IDENT || (R = FindRegVar (T->Ident)) == 0 ||
+            I == R->DeclIndex) {
+            continue;
+        }
+
+        /* Count it */
+        R->Weight += 1UL << (3 * Depth[I]);
+
+        /* Be conservative with anything that looks like an address */
+        if (I > 0 && TokAt (Tokens, I-1) == TOK_AND) {
+            R->Flags |= RV_ADDR;
+        }
+
+        /* A variable that is used inside a loop is live in the whole loop */
+        if (Outer[I] >= 0) {
+            const LoopRange* L = CollConstAt (&Loops, Outer[I]);
+            First = L->Start;
+            Last  = L->End;
+        } else {
+            First = Last = I;
+        }
+        if (First < R->First) {
+            R->First = First;
+        }
+        if (Last > R->Last) {
+            R->Last = Last;
+        }
+    }
+
+    /* Parameters are live from the start, initialized variables from their
+    ** declaration.
+    */
+    for (I = 0; I < CollCount (&RegVars); ++I) {
+        RegVar* R = CollAtUnchecked (&RegVars, I);
+        if (R->Flags & RV_PARAM) {
+            R->First = 0;
+        } else if ((R->Flags & RV_INIT) && R->DeclIndex < R->First) {
+            R->First = R->DeclIndex;
+        }
+    }
+
+    /* Free the loop data */
+    for (I = 0; I < CollCount (&Loops); ++I) {
+        xfree (CollAtUnchecked (&Loops, I));
+    }
+    DoneCollection (&Loops);
+    xfree (Outer);
+    xfree (Depth);
+}
+
+
+
+static int CmpPriority (void* Data attribute ((unused)),
+                        const void* Left, const void* Right)
+/* Compare function for CollSort: Higher weights first, then declaration order */
+{
+    const RegVar* L = Left;
+    const RegVar* R = Right;
+    if (L->Weight != R->Weight) {
+        return (L->Weight > R->Weight)? -1 : 1;
+    }
+    return (int) L->Order - (int) R->Order;
+}
+
+
+
+static int Disjoint (const RegVar* A, const RegVar* B)
+/* Return true if the live ranges of A and B don't overlap */
+{
+    return A->Last < B->First || B->Last < A->First;
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void RV_ScanBody (const FuncDesc* D)
+/* Must be called with CurTok on the opening curly brace of the body of the
+** function described by D. Reads ahead the complete body and collects usage
+** information for the register variables declared at function level: a
+** reference count weighted by loop depth and the range of tokens where the
+** variable is live.
+*/
+{
+    Collection      Tokens = AUTO_COLLECTION_INITIALIZER;
+    const SymEntry* Param;
+    unsigned        Braces;
+    unsigned        I;
+
+    /* Forget anything from the last function */
+    RV_Done ();
+
+    /* Nothing to do if register variables are disabled */
+    if (!IS_Get (&EnableRegVars) || CurTok.Tok != TOK_LCURLY) {
+        return;
+    }
+
+    /* Read ahead the function body */
+    LookAheadBlock (&Tokens);
+
+    /* Parameters declared as register are allocated first */
+    Param = D->SymTab->SymHead;
+    while (Param && (Param->Flags & SC_PARAM) != 0) {
+        if (SymIsRegVar (Param)) {
+            RegVar* R = NewRegVar (Param->Name, RV_PARAM);
+            R->Size = CheckedSizeOf (Param->Type);
+        }
+        Param = Param->NextSym;
+    }
+
+    /* Find the register variables declared at function level */
+    Braces = 1;
+    for (I = 0; I < CollCount (&Tokens); ++I) {
+        switch (TokAt (&Tokens, I)) {
+            case TOK_LCURLY:
+                ++Braces;
+                break;
+            case TOK_RCURLY:
+                --Braces;
+                break;
+            case TOK_REGISTER:
+                if (Braces == 1) {
+                    I = ParseRegisterDecl (&Tokens, I);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    /* Count the references */
+    if (CollCount (&RegVars) > 0) {
+        CountRefs (&Tokens);
+        HaveInfo = 1;
+    }
+
+    /* The tokens are owned by the scanner */
+    DoneCollection (&Tokens);
+}
+
+
+
+void RV_Done (void)
+/* Free the usage information for the current function */
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&RegVars); ++I) {
+        RegVar* R = CollAtUnchecked (&RegVars, I);
+        xfree ((char*) R->Name);
+        xfree (R);
+    }
+    CollDeleteAll (&RegVars);
+    HaveInfo  = 0;
+    HaveJumps = 0;
+}
+
+
+
+int RV_Select (const char* Name, unsigned Size, unsigned Free)
+/* Decide if the register variable Name with the given size should get a slot
+** in the register bank, if Free bytes are left. Variables that are never
+** used don't get one, and space is kept for variables that are declared
+** later but are used more often. Returns true if no usage information is
+** available.
+*/
+{
+    RegVar*     R = HaveInfo? FindRegVar (Name) : 0;
+    Collection  Cand = AUTO_COLLECTION_INITIALIZER;
+    int         Selected = 0;
+    unsigned    I;
+
+    /* Use the declaration order if we don't know anything about the var */
+    if (R == 0 || (R->Flags & RV_DECIDED) != 0) {
+        return 1;
+    }
+    R->Size   = Size;
+    R->Flags |= RV_DECIDED;
+
+    /* Unused variables don't get a register */
+    if (R->Weight == 0) {
+        return 0;
+    }
+
+    /* Collect this one and all variables not yet decided on */
+    CollAppend (&Cand, R);
+    for (I = 0; I < CollCount (&RegVars); ++I) {
+        RegVar* C = CollAtUnchecked (&RegVars, I);
+        if ((C->Flags & RV_DECIDED) == 0 && C->Weight > 0) {
+            CollAppend (&Cand, C);
+        }
+    }
+
+    /* Give slots to the most used ones. The size of variables that are not
+    ** yet declared is unknown, assume an int or a pointer.
+    */
+    CollSort (&Cand, CmpPriority, 0);
+    for (I = 0; I < CollCount (&Cand); ++I) {
+        RegVar*  C = CollAtUnchecked (&Cand, I);
+        unsigned S = C->Size? C->Size : 2;
+        if (S <= Free) {
+            if (C == R) {
+                Selected = 1;
+                break;
+            }
+            Free -= S;
+        } else if (C == R) {
+            break;
+        }
+    }
+
+    DoneCollection (&Cand);
+    return Selected;
+}
+
+
+
+void RV_Assign (const char* Name, unsigned RegOffs)
+/* Remember that the register variable Name got the slot at RegOffs */
+{
+    RegVar* R = HaveInfo? FindRegVar (Name) : 0;
+    if (R) {
+        R->RegOffs = RegOffs;
+    }
+}
+
+
+
+int RV_FindShared (const char* Name, unsigned Size)
+/* Search for the slot of a register variable whose lifetime is disjoint to
+** that of Name and that is large enough to hold Size bytes. If one is found,
+** the variable is recorded as sharing it, and the offset of the slot is
+** returned. Otherwise -1 is returned.
+*/
+{
+    RegVar*  R = HaveInfo? FindRegVar (Name) : 0;
+    unsigned I, J;
+
+    /* Check if we know enough about this variable */
+    if (R == 0 || HaveJumps || R->Weight == 0 ||
+        (R->Flags & (RV_PARAM | RV_ADDR | RV_MULTI)) != 0) {
+        return -1;
+    }
+
+    /* Check all variables that own a slot */
+    for (I = 0; I < CollCount (&RegVars); ++I) {
+
+        RegVar* O = CollAtUnchecked (&RegVars, I);
+        if (O == R || O->RegOffs < 0 || O->Owner != 0 || O->Size < Size ||
+            (O->Flags & (RV_ADDR | RV_MULTI)) != 0 || !Disjoint (O, R)) {
+            continue;
+        }
+
+        /* The slot may already be shared with other variables */
+        for (J = 0; J < CollCount (&RegVars); ++J) {
+            const RegVar* S = CollAtUnchecked (&RegVars, J);
+            if (S->Owner == O && !Disjoint (S, R)) {
+                break;
+            }
+        }
+        if (J < CollCount (&RegVars)) {
+            continue;
+        }
+
+        /* Use this slot */
+        R->Owner   = O;
+        R->RegOffs = O->RegOffs;
+        return R->RegOffs;
+    }
+
+    /* Nothing found */
+    return -1;
+}
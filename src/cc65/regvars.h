@@ -0,0 +1,87 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 regvars.h                                 */
+/*                                                                           */
+/*               Usage based allocation of register variables                */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef REGVARS_H
+#define REGVARS_H
+
+
+
+/*****************************************************************************/
+/*                                 Forwards                                  */
+/*****************************************************************************/
+
+
+
+struct FuncDesc;
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void RV_ScanBody (const struct FuncDesc* D);
+/* Must be called with CurTok on the opening curly brace of the body of the
+** function described by D. Reads ahead the complete body and collects usage
+** information for the register variables declared at function level: a
+** reference count weighted by loop depth and the range of tokens where the
+** variable is live.
+*/
+
+void RV_Done (void);
+/* Free the usage information for the current function */
+
+int RV_Select (const char* Name, unsigned Size, unsigned Free);
+/* Decide if the register variable Name with the given size should get a slot
+** in the register bank, if Free bytes are left. Variables that are never
+** used don't get one, and space is kept for variables that are declared
+** later but are used more often. Returns true if no usage information is
+** available.
+*/
+
+void RV_Assign (const char* Name, unsigned RegOffs);
+/* Remember that the register variable Name got the slot at RegOffs */
+
+int RV_FindShared (const char* Name, unsigned Size);
+/* Search for the slot of a register variable whose lifetime is disjoint to
+** that of Name and that is large enough to hold Size bytes. If one is found,
+** the variable is recorded as sharing it, and the offset of the slot is
+** returned. Otherwise -1 is returned.
+*/
+
+
+
+/* End of regvars.h */
+
+#endif
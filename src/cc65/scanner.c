@@ -42,8 +42,11 @@
 
 /* common */
 #include "chartype.h"
+#include "check.h"
+#include "coll.h"
 #include "fp.h"
 #include "tgttrans.h"
+#include "xmalloc.h"
 
 /* cc65 */
 #include "datatype.h"
@@ -70,6 +73,15 @@
 Token CurTok;           /* The current token */
 Token NextTok;          /* The next token */
 
+/* Tokens read ahead by LookAheadBlock that are returned again by NextToken */
+static Collection       TokenQueue = STATIC_COLLECTION_INITIALIZER;
+static unsigned         TokenQueueIndex = 0;
+
+/* True while LookAheadBlock reads tokens. Character constants keep the source
+** character then, and are translated when NextToken returns them.
+*/
+static int              LookingAhead = 0;
+
 
 
 /* Token types */
@@ -386,8 +398,10 @@ static void CharConst (void)
     /* Setup values and attributes */
     NextTok.Tok  = TOK_CCONST;
 
-    /* Translate into target charset */
-    NextTok.IVal = SignExtendChar (TgtTranslateChar (C));
+    /* Translate into target charset. When reading ahead, this is done later,
+    ** since a #pragma charmap before the use may change the translation.
+    */
+    NextTok.IVal = LookingAhead? C : SignExtendChar (TgtTranslateChar (C));
 
     /* Character constants have type int */
     NextTok.Type = type_int;
@@ -690,17 +704,61 @@ static void NumericConst (void)
 
 
 
+static void ShiftQueuedToken (void)
+/* Make the next token from the read ahead queue the lookahead token */
+{
+    const Token* T = CollAtUnchecked (&TokenQueue, TokenQueueIndex++);
+
+    /* Current token is the lookahead token */
+    if (CurTok.LI) {
+        ReleaseLineInfo (CurTok.LI);
+    }
+    CurTok = NextTok;
+
+    /* The queue keeps its copy, so the line info needs another reference */
+    NextTok    = *T;
+    NextTok.LI = UseLineInfo (T->LI);
+
+    /* Translate character constants into the target charset. The first
+    ** queued token was read before looking ahead and is translated already.
+    */
+    if (NextTok.Tok == TOK_CCONST && TokenQueueIndex > 1) {
+        NextTok.IVal = SignExtendChar (TgtTranslateChar (NextTok.IVal));
+    }
+
+    /* Free the queue if all tokens have been returned */
+    if (TokenQueueIndex == CollCount (&TokenQueue)) {
+        unsigned I;
+        for (I = 0; I < CollCount (&TokenQueue); ++I) {
+            Token* Q = CollAtUnchecked (&TokenQueue, I);
+            ReleaseLineInfo (Q->LI);
+            xfree (Q);
+        }
+        CollDeleteAll (&TokenQueue);
+        TokenQueueIndex = 0;
+    }
+}
+
+
+
 void NextToken (void)
 /* Get next token from input stream */
 {
     ident token;
+    int   GotEOF;
+
+    /* If we have tokens that were read ahead, return those first */
+    if (TokenQueueIndex < CollCount (&TokenQueue)) {
+        ShiftQueuedToken ();
+        return;
+    }
 
     /* We have to skip white space here before shifting tokens, since the
     ** tokens and the current line info is invalid at startup and will get
     ** initialized by reading the first time from the file. Remember if
     ** we were at end of input and handle that later.
     */
-    int GotEOF = (SkipWhite() == 0);
+    GotEOF = (SkipWhite() == 0);
 
     /* Current token is the lookahead token */
     if (CurTok.LI) {
@@ -1004,6 +1062,63 @@ void NextToken (void)
 
 
 
+void LookAheadBlock (Collection* Tokens)
+/* CurTok must be a left curly brace. Read all tokens up to and including the
+** matching right curly brace and append pointers to them to Tokens. The
+** tokens are not consumed: NextToken will return them again in the same
+** order, so the parser sees an unchanged token stream. The pointers are valid
+** until NextToken has returned the last one of them.
+*/
+{
+    Token    Start;
+    unsigned Depth = 1;
+    unsigned First = CollCount (Tokens);
+    unsigned I;
+
+    PRECONDITION (CurTok.Tok == TOK_LCURLY && CollCount (&TokenQueue) == 0);
+
+    /* Remember the current token, it is restored when we're done */
+    Start    = CurTok;
+    Start.LI = UseLineInfo (CurTok.LI);
+
+    /* Record the lookahead token until we reach the end of the block */
+    LookingAhead = 1;
+    while (1) {
+
+        /* Append a copy of the lookahead token to the list */
+        Token* T = xmalloc (sizeof (Token));
+        *T = NextTok;
+        T->LI = UseLineInfo (NextTok.LI);
+        CollAppend (Tokens, T);
+
+        /* Check for the end of the block */
+        if (T->Tok == TOK_LCURLY) {
+            ++Depth;
+        } else if ((T->Tok == TOK_RCURLY && --Depth == 0) || T->Tok == TOK_CEOF) {
+            break;
+        }
+
+        /* Read the next token */
+        NextToken ();
+    }
+    LookingAhead = 0;
+
+    /* Queue the tokens. The first one becomes the lookahead token again and
+    ** the token we started with is restored. The input is positioned after
+    ** the last queued token.
+    */
+    for (I = First; I < CollCount (Tokens); ++I) {
+        CollAppend (&TokenQueue, CollAtUnchecked (Tokens, I));
+    }
+    ReleaseLineInfo (CurTok.LI);
+    CurTok.LI = 0;
+    ShiftQueuedToken ();
+    ReleaseLineInfo (CurTok.LI);
+    CurTok = Start;
+}
+
+
+
 void SkipTokens (const token_t* TokenList, unsigned TokenCount)
 /* Skip tokens until we reach TOK_CEOF or a token in the given token list.
 ** This routine is used for error recovery.
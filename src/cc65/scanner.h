@@ -39,6 +39,7 @@
 
 
 /* common */
+#include "coll.h"
 #include "fp.h"
 
 /* cc65 */
@@ -264,6 +265,14 @@ int IsSym (char* S);
 void NextToken (void);
 /* Get next token from input stream */
 
+void LookAheadBlock (Collection* Tokens);
+/* CurTok must be a left curly brace. Read all tokens up to and including the
+** matching right curly brace and append pointers to them to Tokens. The
+** tokens are not consumed: NextToken will return them again in the same
+** order, so the parser sees an unchanged token stream. The pointers are valid
+** until NextToken has returned the last one of them.
+*/
+
 void SkipTokens (const token_t* TokenList, unsigned TokenCount);
 /* Skip tokens until we reach TOK_CEOF or a token in the given token list.
 ** This routine is used for error recovery.
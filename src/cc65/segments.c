@@ -42,6 +42,7 @@
 #include "coll.h"
 #include "scanner.h"
 #include "segnames.h"
+#include "strbuf.h"
 #include "strstack.h"
 #include "xmalloc.h"
 
@@ -50,6 +51,7 @@
 #include "codeseg.h"
 #include "dataseg.h"
 #include "error.h"
+#include "global.h"
 #include "textseg.h"
 #include "segments.h"
 
@@ -70,6 +72,9 @@ Segments* GS = 0;
 /* Actual names for the segments */
 static StrStack SegmentNames[SEG_COUNT];
 
+/* Segment names saved by SaveSegNames */
+static char* SavedSegNames[SEG_COUNT];
+
 /* We're using a collection for the stack instead of a linked list. Since
 ** functions may not be nested (at least in the current implementation), the
 ** maximum stack depth is 2, so there is not really a need for a better
@@ -128,6 +133,39 @@ void PopSegName (segment_t Seg)
 
 
 
+void SaveSegNames (void)
+/* Remember the current segment names, so they can be restored by
+** RestoreSegNames.
+*/
+{
+    unsigned I;
+    for (I = 0; I < SEG_COUNT; ++I) {
+        xfree (SavedSegNames[I]);
+        SavedSegNames[I] = xstrdup (SS_Get (&SegmentNames[I]));
+    }
+}
+
+
+
+void RestoreSegNames (void)
+/* Restore the segment names saved by SaveSegNames, dropping anything left on
+** the segment name stacks. The segment lists of the last translation unit
+** are forgotten.
+*/
+{
+    unsigned I;
+    for (I = 0; I < SEG_COUNT; ++I) {
+        while (SS_GetCount (&SegmentNames[I]) > 1) {
+            SS_Drop (&SegmentNames[I]);
+        }
+        SS_Set (&SegmentNames[I], SavedSegNames[I]);
+    }
+    CollDeleteAll (&SegmentStack);
+    CS = GS = 0;
+}
+
+
+
 const char* GetSegName (segment_t Seg)
 /* Get the name of the given segment */
 {
@@ -136,18 +174,58 @@ const char* GetSegName (segment_t Seg)
 
 
 
+const char* GetSectionName (segment_t Seg, const char* AsmName)
+/* Get the name of the segment for the object with the given assembler name.
+** If function sections are enabled, this is "SEG.name", so the object gets
+** a section of its own that the linker may remove if it is unused. The name
+** is returned in static storage.
+*/
+{
+    static StrBuf Name = STATIC_STRBUF_INITIALIZER;
+
+    const char* SegName = GetSegName (Seg);
+
+    /* The assembler knows the zero page segments by name, so they cannot be
+    ** split. Names that contain a dot already are left alone.
+    */
+    if (!FunctionSections                               ||
+        strcmp (SegName, SEGNAME_ZEROPAGE) == 0         ||
+        strcmp (SegName, "EXTZP") == 0                  ||
+        strchr (SegName, '.') != 0) {
+        return SegName;
+    }
+
+    /* Don't split if the name would get too long */
+    SB_Printf (&Name, "%s.%s", SegName, AsmName);
+    if (!ValidSegName (SB_GetConstBuf (&Name))) {
+        return SegName;
+    }
+    return SB_GetConstBuf (&Name);
+}
+
+
+
 static Segments* NewSegments (SymEntry* Func)
 /* Initialize a Segments structure (set all fields to NULL) */
 {
     /* Allocate memory */
     Segments* S = xmalloc (sizeof (Segments));
 
-    /* Initialize the fields */
+    /* Initialize the fields. The segments of a function may get a section
+    ** of their own.
+    */
     S->Text     = NewTextSeg (Func);
-    S->Code     = NewCodeSeg (GetSegName (SEG_CODE), Func);
-    S->Data     = NewDataSeg (GetSegName (SEG_DATA), Func);
-    S->ROData   = NewDataSeg (GetSegName (SEG_RODATA), Func);
-    S->BSS      = NewDataSeg (GetSegName (SEG_BSS), Func);
+    if (Func) {
+        S->Code     = NewCodeSeg (GetSectionName (SEG_CODE, Func->AsmName), Func);
+        S->Data     = NewDataSeg (GetSectionName (SEG_DATA, Func->AsmName), Func);
+        S->ROData   = NewDataSeg (GetSectionName (SEG_RODATA, Func->AsmName), Func);
+        S->BSS      = NewDataSeg (GetSectionName (SEG_BSS, Func->AsmName), Func);
+    } else {
+        S->Code     = NewCodeSeg (GetSegName (SEG_CODE), Func);
+        S->Data     = NewDataSeg (GetSegName (SEG_DATA), Func);
+        S->ROData   = NewDataSeg (GetSegName (SEG_RODATA), Func);
+        S->BSS      = NewDataSeg (GetSegName (SEG_BSS), Func);
+    }
     S->CurDSeg  = SEG_DATA;
 
     /* Return the new struct */
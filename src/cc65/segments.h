@@ -114,9 +114,27 @@ void PushSegName (segment_t Seg, const char* Name);
 void PopSegName (segment_t Seg);
 /* Restore a segment name from the segment name stack */
 
+void SaveSegNames (void);
+/* Remember the current segment names, so they can be restored by
+** RestoreSegNames.
+*/
+
+void RestoreSegNames (void);
+/* Restore the segment names saved by SaveSegNames, dropping anything left on
+** the segment name stacks. The segment lists of the last translation unit
+** are forgotten.
+*/
+
 const char* GetSegName (segment_t Seg);
 /* Get the name of the given segment */
 
+const char* GetSectionName (segment_t Seg, const char* AsmName);
+/* Get the name of the segment for the object with the given assembler name.
+** If function sections are enabled, this is "SEG.name", so the object gets
+** a section of its own that the linker may remove if it is unused. The name
+** is returned in static storage.
+*/
+
 Segments* PushSegments (struct SymEntry* Func);
 /* Make the new segment list current but remember the old one */
 
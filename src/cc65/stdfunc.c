@@ -38,11 +38,15 @@
 
 /* common */
 #include "attrib.h"
+#include "chartype.h"
 #include "check.h"
+#include "tgttrans.h"
+#include "xmalloc.h"
 
 /* cc65 */
 #include "asmcode.h"
 #include "asmlabel.h"
+#include "callgraph.h"
 #include "codegen.h"
 #include "error.h"
 #include "funcdesc.h"
@@ -63,8 +67,13 @@
 
 
 
+static int CheckPrintf (const FuncDesc*, const ExprDesc*);
+static int CheckFPrintf (const FuncDesc*, const ExprDesc*);
+static void StdFunc_fprintf (FuncDesc*, ExprDesc*);
 static void StdFunc_memcpy (FuncDesc*, ExprDesc*);
 static void StdFunc_memset (FuncDesc*, ExprDesc*);
+static void StdFunc_printf (FuncDesc*, ExprDesc*);
+static void StdFunc_sprintf (FuncDesc*, ExprDesc*);
 static void StdFunc_strcmp (FuncDesc*, ExprDesc*);
 static void StdFunc_strcpy (FuncDesc*, ExprDesc*);
 static void StdFunc_strlen (FuncDesc*, ExprDesc*);
@@ -78,17 +87,22 @@ static void StdFunc_strlen (FuncDesc*, ExprDesc*);
 
 
 /* Table with all known functions and their handlers. Must be sorted
-** alphabetically!
+** alphabetically! If there is a check function, and it returns false, the
+** call is compiled as a normal function call.
 */
 static struct StdFuncDesc {
     const char*         Name;
+    int                 (*Check) (const FuncDesc*, const ExprDesc*);
     void                (*Handler) (FuncDesc*, ExprDesc*);
 } StdFuncs[] = {
-    {   "memcpy",       StdFunc_memcpy          },
-    {   "memset",       StdFunc_memset          },
-    {   "strcmp",       StdFunc_strcmp          },
-    {   "strcpy",       StdFunc_strcpy          },
-    {   "strlen",       StdFunc_strlen          },
+    {   "fprintf",      CheckFPrintf,   StdFunc_fprintf         },
+    {   "memcpy",       0,              StdFunc_memcpy          },
+    {   "memset",       0,              StdFunc_memset          },
+    {   "printf",       CheckPrintf,    StdFunc_printf          },
+    {   "sprintf",      CheckFPrintf,   StdFunc_sprintf         },
+    {   "strcmp",       0,              StdFunc_strcmp          },
+    {   "strcpy",       0,              StdFunc_strcpy          },
+    {   "strlen",       0,              StdFunc_strlen          },
 
 };
 #define FUNC_COUNT      (sizeof (StdFuncs) / sizeof (StdFuncs[0]))
@@ -104,6 +118,22 @@ struct ArgDesc {
     unsigned    Flags;          /* Code generation flags */
 };
 
+/* Bits of the conversion spec passed to the printf output primitives in Y */
+#define PF_WIDTH        0x1FU           /* Field width */
+#define PF_UPPER        0x20U           /* Upper case hex digits */
+#define PF_ZERO         0x40U           /* Pad with zeroes */
+#define PF_LEFT         0x80U           /* Left justify */
+
+/* An argument of a specialized printf call */
+typedef struct FmtArg FmtArg;
+struct FmtArg {
+    ExprDesc    Expr;           /* Argument expression */
+    Type*       ArgType;        /* Type for the conversion or NULL */
+    int         Pushed;         /* True if the value was pushed */
+    int         Offs;           /* Stack offset of a pushed value */
+    unsigned    Flags;          /* Code generation flags for the push */
+};
+
 
 
 /*****************************************************************************/
@@ -762,6 +792,495 @@ ExitPoint:
 
 
 
+/*****************************************************************************/
+/*                                  printf                                   */
+/*****************************************************************************/
+
+
+
+static const char* ParseConv (const char* F, char* Conv, unsigned* Spec)
+/* Parse the conversion spec following a percent sign in a printf format.
+** Return a pointer behind the spec, or NULL if the output primitives cannot
+** handle the conversion.
+*/
+{
+    unsigned Width = 0;
+
+    /* Flags */
+    *Spec = 0;
+    while (1) {
+        if (*F == '-') {
+            *Spec |= PF_LEFT;
+        } else if (*F == '0') {
+            *Spec |= PF_ZERO;
+        } else {
+            break;
+        }
+        ++F;
+    }
+
+    /* Field width */
+    while (IsDigit (*F)) {
+        Width = Width * 10 + (*F++ - '0');
+        if (Width > PF_WIDTH) {
+            return 0;
+        }
+    }
+    *Spec |= Width;
+
+    /* Conversion. Precision, length modifiers and all other conversions are
+    ** left to the library formatter.
+    */
+    switch (*F) {
+        case 'X':
+            *Spec |= PF_UPPER;
+            /* FALLTHROUGH */
+        case 'c':
+        case 'd':
+        case 'i':
+        case 's':
+        case 'u':
+        case 'x':
+            *Conv = *F;
+            return F + 1;
+        default:
+            return 0;
+    }
+}
+
+
+
+static int CanSpecializePrintf (StrBuf* Convs)
+/* Check if the format of a printf like function, which must be the current
+** token, is a string literal with conversions the output primitives can
+** handle. If so, return true and append the conversion characters to Convs.
+*/
+{
+    const char* P;
+    char        Conv;
+    unsigned    Spec;
+
+    if (CurTok.Tok != TOK_SCONST                                ||
+        (NextTok.Tok != TOK_COMMA && NextTok.Tok != TOK_RPAREN)) {
+        return 0;
+    }
+
+    P = GetLiteralStr (CurTok.SVal);
+    while (*P) {
+        if (*P++ == '%') {
+            if (*P == '%') {
+                ++P;
+            } else if ((P = ParseConv (P, &Conv, &Spec)) == 0) {
+                return 0;
+            } else {
+                SB_AppendChar (Convs, Conv);
+            }
+        }
+    }
+    return 1;
+}
+
+
+
+static int IsLibPrintf (const FuncDesc* F, const ExprDesc* Expr,
+                        unsigned FixedParams)
+/* Check if replacing printf like functions is enabled, and if the called
+** function may be the one from the library: It must be variadic, have the
+** given number of fixed parameters and not be defined in this file.
+*/
+{
+    return IS_Get (&InlineStdFuncs)                     &&
+           (F->Flags & FD_VARIADIC) != 0                &&
+           F->ParamCount == FixedParams                 &&
+           (Expr->Sym == 0 || !SymIsDef (Expr->Sym));
+}
+
+
+
+static int CheckPrintf (const FuncDesc* F, const ExprDesc* Expr)
+/* Check if a printf call may be replaced. The format is the current token. */
+{
+    StrBuf Convs = AUTO_STRBUF_INITIALIZER;
+    int    Ok = IsLibPrintf (F, Expr, 1) && CanSpecializePrintf (&Convs);
+
+    SB_Done (&Convs);
+    return Ok;
+}
+
+
+
+static int CheckFPrintf (const FuncDesc* F, const ExprDesc* Expr)
+/* Check if a fprintf or sprintf call may be replaced. The format follows the
+** first argument, so it is checked later.
+*/
+{
+    return IsLibPrintf (F, Expr, 2) && CurTok.Tok != TOK_RPAREN;
+}
+
+
+
+static int FmtArgMatches (const Type* T, char Conv)
+/* Check if an argument of the given type matches a printf conversion */
+{
+    if (Conv == 's') {
+        return IsClassPtr (T);
+    } else if (IsClassInt (T)) {
+        return SizeOf (T) <= SIZEOF_INT;
+    } else {
+        /* Pointers may be output as unsigned numbers */
+        return IsClassPtr (T) && Conv != 'c' && Conv != 'd' && Conv != 'i';
+    }
+}
+
+
+
+static void ParseFmtArg (FmtArg* Arg, Type* ArgType, int KeepLVal)
+/* Parse an argument of a specialized printf call. Constants and, if KeepLVal
+** is true, variables are loaded when they're output. All other values are
+** calculated and pushed now, since the calculation may have side effects.
+*/
+{
+    MarkedExprWithCheck (hie1, &Arg->Expr);
+
+    /* Remember the type the value is converted to. Pointers are passed as is,
+    ** so they may be output as numbers.
+    */
+    Arg->ArgType = IsClassPtr (Arg->Expr.Type)? 0 : ArgType;
+
+    Arg->Pushed = !ED_CodeRangeIsEmpty (&Arg->Expr)    ||
+                  IsQualVolatile (Arg->Expr.Type)       ||
+                  (!KeepLVal                            &&
+                   ED_IsLVal (&Arg->Expr)               &&
+                   !IsTypeArray (Arg->Expr.Type));
+}
+
+
+
+static void ConvertFmtArg (FmtArg* Arg)
+/* Convert an argument of a specialized printf call and load it */
+{
+    if (Arg->ArgType) {
+        TypeConversion (&Arg->Expr, Arg->ArgType);
+    } else {
+        Arg->Expr.Type = PtrConversion (Arg->Expr.Type);
+    }
+    LoadExpr (CF_NONE, &Arg->Expr);
+    Arg->Flags = TypeOf (Arg->Expr.Type);
+}
+
+
+
+static void PushFmtArg (FmtArg* Arg)
+/* Push an argument of a specialized printf call */
+{
+    ConvertFmtArg (Arg);
+    g_push (Arg->Flags, 0);
+    Arg->Offs = StackPtr;
+}
+
+
+
+static void LoadFmtArg (FmtArg* Arg)
+/* Load an argument of a specialized printf call into the primary */
+{
+    if (Arg->Pushed) {
+        g_getlocal (Arg->Flags, Arg->Offs);
+    } else {
+        ConvertFmtArg (Arg);
+    }
+}
+
+
+
+static void PutFmtText (StrBuf* Text)
+/* Output the literal text collected from a format and clear the buffer */
+{
+    if (SB_GetLen (Text) == 1) {
+
+        /* Single characters are passed by value */
+        AddCodeLine ("lda #$%02X",
+                     (unsigned char) TgtTranslateChar ((unsigned char) SB_AtUnchecked (Text, 0)));
+        AddCodeLine ("jsr _%s", Func__pfputc);
+
+    } else if (SB_GetLen (Text) > 1) {
+
+        /* Make a new string literal from the text and output it */
+        ExprDesc Str;
+        Literal* L;
+
+        SB_Terminate (Text);
+        L = AddLiteralBuf (SB_GetConstBuf (Text), SB_GetLen (Text) + 1);
+
+        ED_Init (&Str);
+        Str.LVal  = UseLiteral (L);
+        Str.Type  = GetCharArrayType (GetLiteralSize (L));
+        Str.Flags = E_LOC_LITERAL | E_RTYPE_RVAL;
+        Str.Name  = GetLiteralLabel (L);
+        LoadExpr (CF_NONE, &Str);
+        AddCodeLine ("jsr _%s", Func__pfputs);
+    }
+
+    SB_Clear (Text);
+}
+
+
+
+static void PrintfCall (FuncDesc* F, ExprDesc* Expr, unsigned ParamCount,
+                        unsigned ParamSize, int HaveComma)
+/* Parse the remaining arguments of a printf like function and emit a regular
+** call, with the same checks as for other calls. ParamCount arguments with
+** a size of ParamSize are already pushed. HaveComma is true if the comma
+** behind them was already read.
+*/
+{
+    SymEntry* Param = F->SymTab->SymHead;
+    ExprDesc  Arg;
+    unsigned  Flags;
+    unsigned  I;
+
+    /* Skip the parameters already pushed */
+    for (I = 1; I < ParamCount; ++I) {
+        Param = Param->NextSym;
+    }
+
+    while (HaveComma || CurTok.Tok == TOK_COMMA) {
+
+        /* Skip the comma and check for a stray one */
+        if (!HaveComma) {
+            NextToken ();
+        }
+        HaveComma = 0;
+        if (CurTok.Tok == TOK_RPAREN) {
+            Error ("Argument expected after comma");
+            break;
+        }
+
+        hie1 (&Arg);
+        Flags = CF_NONE;
+        if (++ParamCount <= F->ParamCount) {
+            /* A fixed parameter */
+            if (ParamCount > 1) {
+                Param = Param->NextSym;
+            }
+            TypeConversion (&Arg, Param->Type);
+            Flags |= CF_FORCECHAR;
+        } else {
+            Arg.Type = PtrConversion (Arg.Type);
+        }
+        LoadExpr (Flags, &Arg);
+
+        Flags |= TypeOf (Arg.Type);
+        g_push (Flags, 0);
+        ParamSize += sizeofarg (Flags);
+    }
+    if (ParamCount < F->ParamCount) {
+        Error ("Too few arguments in function call");
+    }
+    ConsumeRParen ();
+
+    /* Call the function */
+    g_call (TypeOf (Expr->Type), (const char*) Expr->Name, ParamSize);
+    CG_AddCall ((const char*) Expr->Name);
+
+    /* The function result is an rvalue in the primary register */
+    ED_MakeRValExpr (Expr);
+    Expr->Type = GetFuncReturn (Expr->Type);
+}
+
+
+
+static void DoPrintf (FuncDesc* F, ExprDesc* Expr, const char* Start)
+/* Handle a printf like function. Start is the output primitive that sets up
+** the destination. If the format is a string literal, and all conversions
+** are simple enough, the call is replaced by calls to output primitives for
+** the literal text and the conversions, so the format is neither parsed at
+** runtime nor is the library formatter linked.
+*/
+{
+    FmtArg      Dest;
+    FmtArg*     Args;
+    StrBuf      Convs = AUTO_STRBUF_INITIALIZER;
+    StrBuf      Fmt   = AUTO_STRBUF_INITIALIZER;
+    StrBuf      Text  = AUTO_STRBUF_INITIALIZER;
+    int         HasDest = (Start != Func__pfstdout);
+    int         OldStackPtr = StackPtr;
+    unsigned    ConvCount;
+    unsigned    ArgCount;
+    unsigned    I;
+    const char* P;
+
+    /* Parse the output file or buffer. It is converted to the parameter
+    ** type even if it is a pointer, so wrong pointers are diagnosed.
+    */
+    if (HasDest) {
+        ParseFmtArg (&Dest, 0, 1);
+        Dest.ArgType = F->SymTab->SymHead->Type;
+
+        /* If the format isn't a string literal, or it can't be handled, call
+        ** the function as usual.
+        */
+        if (CurTok.Tok != TOK_COMMA || NextTok.Tok != TOK_SCONST) {
+            PushFmtArg (&Dest);
+            PrintfCall (F, Expr, 1, sizeofarg (Dest.Flags), 0);
+            goto ExitPoint;
+        }
+        NextToken ();
+        if (!CanSpecializePrintf (&Convs)) {
+            PushFmtArg (&Dest);
+            PrintfCall (F, Expr, 1, sizeofarg (Dest.Flags), 1);
+            goto ExitPoint;
+        }
+    } else {
+        /* Get the conversions of the format checked before */
+        CanSpecializePrintf (&Convs);
+    }
+
+    /* Remember the format and skip it */
+    SB_CopyStr (&Fmt, GetLiteralStr (CurTok.SVal));
+    SB_Terminate (&Fmt);
+    NextToken ();
+
+    if (HasDest && Dest.Pushed) {
+        PushFmtArg (&Dest);
+    }
+
+    /* Parse the arguments. Variables passed to sprintf are read before the
+    ** output starts, since they may live in the output buffer.
+    */
+    ConvCount = SB_GetLen (&Convs);
+    Args = xmalloc ((ConvCount + 1) * sizeof (FmtArg));
+    ArgCount = 0;
+    while (CurTok.Tok == TOK_COMMA) {
+        NextToken ();
+        if (CurTok.Tok == TOK_RPAREN) {
+            Error ("Argument expected after comma");
+            break;
+        }
+        if (ArgCount < ConvCount) {
+            FmtArg* Arg = Args + ArgCount;
+            char    Conv = SB_AtUnchecked (&Convs, ArgCount);
+            Type*   ArgType;
+
+            if (Conv == 'u' || Conv == 'x' || Conv == 'X') {
+                ArgType = type_uint;
+            } else if (Conv == 's') {
+                ArgType = 0;
+            } else {
+                ArgType = type_int;
+            }
+            ParseFmtArg (Arg, ArgType, Start != Func__pftobuf);
+            if (!FmtArgMatches (Arg->Expr.Type, Conv)) {
+                Warning ("Argument %u doesn't match conversion '%%%c'",
+                         ArgCount + 1, Conv);
+            }
+            if (Arg->Pushed) {
+                PushFmtArg (Arg);
+            }
+        } else {
+            ExprDesc Extra;
+            if (ArgCount == ConvCount) {
+                Warning ("Too many arguments for format");
+            }
+            hie1 (&Extra);
+        }
+        ++ArgCount;
+    }
+    ConsumeRParen ();
+    if (ArgCount < ConvCount) {
+        Warning ("Too few arguments for format");
+    }
+
+    /* Setup the destination */
+    if (HasDest) {
+        LoadFmtArg (&Dest);
+    }
+    AddCodeLine ("jsr _%s", Start);
+
+    /* Output the format. Each primitive returns the number of characters
+    ** written so far, which is the result of the call.
+    */
+    P = SB_GetConstBuf (&Fmt);
+    I = 0;
+    while (*P) {
+        char     Conv;
+        unsigned Spec;
+
+        if (*P != '%') {
+            SB_AppendChar (&Text, *P++);
+        } else if (*++P == '%') {
+            SB_AppendChar (&Text, *P++);
+        } else {
+            P = ParseConv (P, &Conv, &Spec);
+            PutFmtText (&Text);
+            if (I < ArgCount) {
+                LoadFmtArg (Args + I);
+                AddCodeLine ("ldy #$%02X", Spec);
+                switch (Conv) {
+                    case 'c':
+                        AddCodeLine ("jsr _%s", Func__pfchar);
+                        break;
+                    case 's':
+                        AddCodeLine ("jsr _%s", Func__pfstr);
+                        break;
+                    case 'u':
+                        AddCodeLine ("jsr _%s", Func__pfuint);
+                        break;
+                    case 'x':
+                    case 'X':
+                        AddCodeLine ("jsr _%s", Func__pfhex);
+                        break;
+                    default:
+                        AddCodeLine ("jsr _%s", Func__pfint);
+                        break;
+                }
+            }
+            ++I;
+        }
+    }
+    PutFmtText (&Text);
+
+    /* Drop the pushed arguments */
+    g_drop (OldStackPtr - StackPtr);
+    StackPtr = OldStackPtr;
+
+    /* The function result is an rvalue in the primary register */
+    ED_MakeRValExpr (Expr);
+    Expr->Type = GetFuncReturn (Expr->Type);
+
+    xfree (Args);
+
+ExitPoint:
+    SB_Done (&Convs);
+    SB_Done (&Fmt);
+    SB_Done (&Text);
+}
+
+
+
+static void StdFunc_fprintf (FuncDesc* F, ExprDesc* Expr)
+/* Handle the fprintf function */
+{
+    DoPrintf (F, Expr, Func__pftofile);
+}
+
+
+
+static void StdFunc_printf (FuncDesc* F, ExprDesc* Expr)
+/* Handle the printf function */
+{
+    DoPrintf (F, Expr, Func__pfstdout);
+}
+
+
+
+static void StdFunc_sprintf (FuncDesc* F, ExprDesc* Expr)
+/* Handle the sprintf function */
+{
+    DoPrintf (F, Expr, Func__pftobuf);
+}
+
+
+
 /*****************************************************************************/
 /*                                  strcmp                                   */
 /*****************************************************************************/
@@ -1383,8 +1902,10 @@ int FindStdFunc (const char* Name)
 
 
 
-void HandleStdFunc (int Index, FuncDesc* F, ExprDesc* lval)
-/* Generate code for a known standard function. */
+int HandleStdFunc (int Index, FuncDesc* F, ExprDesc* lval)
+/* Generate code for a known standard function. Return false without reading
+** any tokens if the call must be compiled as a normal function call.
+*/
 {
     struct StdFuncDesc* D;
 
@@ -1392,6 +1913,12 @@ void HandleStdFunc (int Index, FuncDesc* F, ExprDesc* lval)
     CHECK (Index >= 0 && Index < (int)FUNC_COUNT);
     D = StdFuncs + Index;
 
+    /* Check if the function is handled for this call */
+    if (D->Check && !D->Check (F, lval)) {
+        return 0;
+    }
+
     /* Call the handler function */
     D->Handler (F, lval);
+    return 1;
 }
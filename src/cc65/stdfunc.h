@@ -61,8 +61,10 @@ int FindStdFunc (const char* Name);
 ** called in a special way. If so, return the index, otherwise return -1.
 */
 
-void HandleStdFunc (int Index, struct FuncDesc* F, ExprDesc* lval);
-/* Generate code for a known standard function. */
+int HandleStdFunc (int Index, struct FuncDesc* F, ExprDesc* lval);
+/* Generate code for a known standard function. Return false without reading
+** any tokens if the call must be compiled as a normal function call.
+*/
 
 
 
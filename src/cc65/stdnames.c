@@ -45,6 +45,16 @@
 
 
 const char Func__bzero[]        = "_bzero";     /* Asm name of "_bzero" */
+const char Func__pfchar[]       = "_pfchar";    /* Asm name of "_pfchar" */
+const char Func__pfhex[]        = "_pfhex";     /* Asm name of "_pfhex" */
+const char Func__pfint[]        = "_pfint";     /* Asm name of "_pfint" */
+const char Func__pfputc[]       = "_pfputc";    /* Asm name of "_pfputc" */
+const char Func__pfputs[]       = "_pfputs";    /* Asm name of "_pfputs" */
+const char Func__pfstdout[]     = "_pfstdout";  /* Asm name of "_pfstdout" */
+const char Func__pfstr[]        = "_pfstr";     /* Asm name of "_pfstr" */
+const char Func__pftobuf[]      = "_pftobuf";   /* Asm name of "_pftobuf" */
+const char Func__pftofile[]     = "_pftofile";  /* Asm name of "_pftofile" */
+const char Func__pfuint[]       = "_pfuint";    /* Asm name of "_pfuint" */
 const char Func_memcpy[]        = "memcpy";     /* Asm name of "memcpy" */
 const char Func_memset[]        = "memset";     /* Asm name of "memset" */
 const char Func_strcmp[]        = "strcmp";     /* Asm name of "strcmp" */
@@ -45,6 +45,16 @@
 
 
 extern const char Func__bzero[];        /* Asm name of "_bzero" */
+extern const char Func__pfchar[];       /* Asm name of "_pfchar" */
+extern const char Func__pfhex[];        /* Asm name of "_pfhex" */
+extern const char Func__pfint[];        /* Asm name of "_pfint" */
+extern const char Func__pfputc[];       /* Asm name of "_pfputc" */
+extern const char Func__pfputs[];       /* Asm name of "_pfputs" */
+extern const char Func__pfstdout[];     /* Asm name of "_pfstdout" */
+extern const char Func__pfstr[];        /* Asm name of "_pfstr" */
+extern const char Func__pftobuf[];      /* Asm name of "_pftobuf" */
+extern const char Func__pftofile[];     /* Asm name of "_pftofile" */
+extern const char Func__pfuint[];       /* Asm name of "_pfuint" */
 extern const char Func_memcpy[];        /* Asm name of "memcpy" */
 extern const char Func_memset[];        /* Asm name of "memset" */
 extern const char Func_strcmp[];        /* Asm name of "strcmp" */
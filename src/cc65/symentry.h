@@ -103,6 +103,10 @@ struct CodeEntry;
 #define SC_SPADJUSTMENT 0x40000U
 #define SC_GOTO_IND     0x80000U        /* Indirect goto */
 
+#define SC_INLINE       0x100000U       /* Function declared inline */
+
+#define SC_SHARED       0x200000U       /* Register var shares another one's slot */
+
 
 
 
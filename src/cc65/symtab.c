@@ -254,6 +254,21 @@ void LeaveGlobalLevel (void)
 
 
 
+void ResetLexicalLevels (void)
+/* Drop all lexical levels including the global one, without the checks done
+** when leaving them. Used before another translation unit is compiled,
+** since the global level isn't left if the last one had errors.
+*/
+{
+    LexicalLevel = 0;
+    SymTab0      = SymTab = 0;
+    TagTab0      = TagTab = 0;
+    LabelTab     = 0;
+    SPAdjustTab  = 0;
+}
+
+
+
 void EnterFunctionLevel (void)
 /* Enter function lexical level */
 {
@@ -670,7 +685,7 @@ DefOrRef* AddDefOrRef (SymEntry* E, unsigned Flags)
 
     DOR = xmalloc (sizeof (DefOrRef));
     CollAppend (E->V.L.DefsOrRefs, DOR);
-    DOR->Line = GetCurrentLine ();
+    DOR->Line = GetInputLine (NextTok.LI);
     DOR->LocalsBlockId = (long)CollLast (&CurrentFunc->LocalsBlockStack);
     DOR->Flags = Flags;
     DOR->StackPtr = StackPtr;
@@ -734,7 +749,7 @@ SymEntry* AddLabelSym (const char* Name, unsigned Flags)
                     (long)CollAt (AIC, DOR->Depth - 1) != DOR->LocalsBlockId)) {
                     Warning ("Goto at line %d to label %s jumps into a block with "
                     "initialization of an object that has automatic storage duration",
-                    GetCurrentLine (), Name);
+                    GetInputLine (NextTok.LI), Name);
                 }
             }
 
@@ -89,6 +89,12 @@ void EnterGlobalLevel (void);
 void LeaveGlobalLevel (void);
 /* Leave the program global lexical level */
 
+void ResetLexicalLevels (void);
+/* Drop all lexical levels including the global one, without the checks done
+** when leaving them. Used before another translation unit is compiled,
+** since the global level isn't left if the last one had errors.
+*/
+
 void EnterFunctionLevel (void);
 /* Enter function lexical level */
 
@@ -88,6 +88,16 @@ void PopWrappedCall (void)
 
 
 
+void ResetWrappedCalls (void)
+/* Drop all entries from the WrappedCall stack */
+{
+    while (!IPS_IsEmpty (&WrappedCalls)) {
+        IPS_Drop (&WrappedCalls);
+    }
+}
+
+
+
 void GetWrappedCall (void **Ptr, unsigned char *Val)
 /* Get the current WrappedCall */
 {
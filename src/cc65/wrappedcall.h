@@ -56,6 +56,9 @@ void PushWrappedCall (void *Ptr, unsigned char Val);
 void PopWrappedCall (void);
 /* Pop the current WrappedCall */
 
+void ResetWrappedCalls (void);
+/* Drop all entries from the WrappedCall stack */
+
 void GetWrappedCall (void **Ptr, unsigned char *Val);
 /* Get the current WrappedCall, if any */
 
@@ -116,6 +116,9 @@ static CmdDesc GRC  = { 0, 0, 0, 0, 0, 0, 0 };
 static int DoLink       = 1;
 static int DoAssemble   = 1;
 
+/* Compile consecutive C files with one compiler run */
+static int BatchCompile = 0;
+
 /* The name of the output file, NULL if none given */
 static const char* OutputName = 0;
 
@@ -612,6 +615,15 @@ static void Compile (const char* File)
     /* Remember the current compiler argument count */
     unsigned ArgCount = CC65.ArgCount;
 
+    /* In batch mode, remember the file and compile it later together with
+    ** the C files following it. This works only if each file gets its own
+    ** default output file.
+    */
+    if (BatchCompile && DoAssemble && !DepName && !FullDepName) {
+        CmdAddFile (&CC65, File);
+        return;
+    }
+
     /* Set the target system */
     CmdSetTarget (&CC65, Target);
 
@@ -666,6 +678,48 @@ static void Compile (const char* File)
 
 
 
+static void CompileBatch (void)
+/* Compile the C files collected in batch mode with one compiler run, then
+** assemble the generated files.
+*/
+{
+    unsigned I;
+
+    /* Remember the current compiler argument count */
+    unsigned ArgCount = CC65.ArgCount;
+
+    /* Bail out if there is nothing to do */
+    if (CC65.FileCount == 0) {
+        return;
+    }
+
+    /* Set the target system */
+    CmdSetTarget (&CC65, Target);
+
+    /* Add the files as arguments for the compiler */
+    for (I = 0; I < CC65.FileCount; ++I) {
+        CmdAddArg (&CC65, CC65.Files[I]);
+    }
+
+    /* Add a NULL pointer to terminate the argument list */
+    CmdAddArg (&CC65, 0);
+
+    /* Run the compiler */
+    ExecProgram (&CC65);
+
+    /* Remove the excess arguments */
+    CmdDelArgs (&CC65, ArgCount);
+
+    /* Assemble the generated files and forget the C files */
+    for (I = 0; I < CC65.FileCount; ++I) {
+        AssembleIntermediate (CC65.Files[I]);
+        xfree (CC65.Files[I]);
+    }
+    CC65.FileCount = 0;
+}
+
+
+
 static void CompileRes (const char* File)
 /* Compile the given geos resource file */
 {
@@ -785,6 +839,7 @@ static void Usage (void)
             "  --asm-args options\t\tPass options to the assembler\n"
             "  --asm-define sym[=v]\t\tDefine an assembler symbol\n"
             "  --asm-include-dir dir\t\tSet an assembler include directory\n"
+            "  --batch-compile\t\tCompile consecutive C files in one run\n"
             "  --bin-include-dir dir\t\tSet an assembler binary include directory\n"
             "  --bss-label name\t\tDefine and export a BSS segment label\n"
             "  --bss-name seg\t\tSet the name of the BSS segment\n"
@@ -804,6 +859,7 @@ static void Usage (void)
             "  --debug-info\t\t\tAdd debug info\n"
             "  --feature name\t\tSet an emulation feature\n"
             "  --force-import sym\t\tForce an import of symbol 'sym'\n"
+            "  --function-sections\t\tPlace functions and data in separate sections\n"
             "  --help\t\t\tHelp (this text)\n"
             "  --include-dir dir\t\tSet a compiler include directory path\n"
             "  --ld-args options\t\tPass options to the linker\n"
@@ -820,6 +876,8 @@ static void Usage (void)
             "  --o65-model model\t\tOverride the o65 model\n"
             "  --obj file\t\t\tLink this object file\n"
             "  --obj-path path\t\tSpecify an object file search path\n"
+            "  --overlay-locals\t\tMake local variables static and overlay them\n"
+            "  --pch-use name\t\tRead a precompiled header before C files\n"
             "  --print-target-path\t\tPrint the target file path\n"
             "  --register-space b\t\tSet space available for register variables\n"
             "  --register-vars\t\tEnable register variables\n"
@@ -879,6 +937,15 @@ static void OptAsmIncludeDir (const char* Opt attribute ((unused)), const char*
 
 
 
+static void OptBatchCompile (const char* Opt attribute ((unused)),
+                             const char* Arg attribute ((unused)))
+/* Compile consecutive C files with one compiler run */
+{
+    BatchCompile = 1;
+}
+
+
+
 static void OptBinIncludeDir (const char* Opt attribute ((unused)), const char* Arg)
 /* Binary include directory (assembler) */
 {
@@ -1054,6 +1121,14 @@ static void OptForceImport (const char* Opt attribute ((unused)), const char* Ar
 
 
 
+static void OptFunctionSections (const char* Opt, const char* Arg attribute ((unused)))
+/* Place each function and data object in a section of its own (compiler) */
+{
+    CmdAddArg (&CC65, Opt);
+}
+
+
+
 static void OptHelp (const char* Opt attribute ((unused)),
                      const char* Arg attribute ((unused)))
 /* Print help - cl65 */
@@ -1205,6 +1280,22 @@ static void OptObjPath (const char* Opt attribute ((unused)), const char* Arg)
 
 
 
+static void OptOverlayLocals (const char* Opt, const char* Arg attribute ((unused)))
+/* Place local variables in static storage shared between functions */
+{
+    CmdAddArg (&CC65, Opt);
+}
+
+
+
+static void OptPCHUse (const char* Opt attribute ((unused)), const char* Arg)
+/* Read a precompiled header before each C file (compiler) */
+{
+    CmdAddArg2 (&CC65, "--pch-use", Arg);
+}
+
+
+
 static void OptPrintTargetPath (const char* Opt attribute ((unused)),
                                 const char* Arg attribute ((unused)))
 /* Print the target file path */
@@ -1352,6 +1443,7 @@ int main (int argc, char* argv [])
         { "--asm-args",          1, OptAsmArgs        },
         { "--asm-define",        1, OptAsmDefine      },
         { "--asm-include-dir",   1, OptAsmIncludeDir  },
+        { "--batch-compile",     0, OptBatchCompile   },
         { "--bin-include-dir",   1, OptBinIncludeDir  },
         { "--bss-label",         1, OptBssLabel       },
         { "--bss-name",          1, OptBssName        },
@@ -1371,6 +1463,7 @@ int main (int argc, char* argv [])
         { "--debug-info",        0, OptDebugInfo      },
         { "--feature",           1, OptFeature        },
         { "--force-import",      1, OptForceImport    },
+        { "--function-sections", 0, OptFunctionSections },
         { "--help",              0, OptHelp           },
         { "--include-dir",       1, OptIncludeDir     },
         { "--ld-args",           1, OptLdArgs         },
@@ -1387,6 +1480,8 @@ int main (int argc, char* argv [])
         { "--o65-model",         1, OptO65Model       },
         { "--obj",               1, OptObj            },
         { "--obj-path",          1, OptObjPath        },
+        { "--overlay-locals",    0, OptOverlayLocals  },
+        { "--pch-use",           1, OptPCHUse         },
         { "--print-target-path", 0, OptPrintTargetPath},
         { "--register-space",    1, OptRegisterSpace  },
         { "--register-vars",     0, OptRegisterVars   },
@@ -1441,6 +1536,14 @@ int main (int argc, char* argv [])
         /* Get the argument */
         const char* Arg = ArgVec[I];
 
+        /* Compile the C files collected in batch mode before anything else
+        ** is done, so options and the order of the object files apply as
+        ** without batch mode.
+        */
+        if (Arg [0] == '-' || GetFileType (Arg) != FILETYPE_C) {
+            CompileBatch ();
+        }
+
         /* Check for an option */
         if (Arg [0] == '-') {
 
@@ -1641,6 +1744,9 @@ int main (int argc, char* argv [])
         ++I;
     }
 
+    /* Compile the remaining C files collected in batch mode */
+    CompileBatch ();
+
     /* Check if we had any input files */
     if (FirstInput == 0) {
         Warning ("No input files");
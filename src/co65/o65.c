@@ -39,11 +39,11 @@
 
 /* common */
 #include "chartype.h"
+#include "filebuf.h"
 #include "xmalloc.h"
 
 /* co65 */
 #include "error.h"
-#include "fileio.h"
 #include "o65.h"
 
 
@@ -81,7 +81,7 @@ static O65Data* NewO65Data (void)
 
 
 
-static unsigned long ReadO65Size (FILE* F, const O65Header* H)
+static unsigned long ReadO65Size (FileBuf* F, const O65Header* H)
 /* Read a size variable (16 or 32 bit, depending on the mode word in the
 ** header) from the o65 file.
 */
@@ -97,7 +97,7 @@ static unsigned long ReadO65Size (FILE* F, const O65Header* H)
 
 
 
-static void ReadO65Header (FILE* F, O65Header* H)
+static void ReadO65Header (FileBuf* F, O65Header* H)
 /* Read an o65 header from the given file. The function will call Error if
 ** something is wrong.
 */
@@ -143,7 +143,7 @@ static void ReadO65Header (FILE* F, O65Header* H)
 
 
 
-static O65Option* ReadO65Option (FILE* F)
+static O65Option* ReadO65Option (FileBuf* F)
 /* Read the next O65 option from the given file. The option is stored into a
 ** dynamically allocated O65Option struct which is returned. On end of options,
 ** NULL is returned. On error, Error is called which terminates the program.
@@ -175,7 +175,7 @@ static O65Option* ReadO65Option (FILE* F)
 
 
 
-static O65Import* ReadO65Import (FILE* F)
+static O65Import* ReadO65Import (FileBuf* F)
 /* Read an o65 import from the file */
 {
     O65Import* I;
@@ -205,7 +205,7 @@ static O65Import* ReadO65Import (FILE* F)
 
 
 
-static void ReadO65RelocInfo (FILE* F, const O65Data* D, Collection* Reloc)
+static void ReadO65RelocInfo (FileBuf* F, const O65Data* D, Collection* Reloc)
 /* Read relocation data for one segment */
 {
     /* Relocation starts at (start address - 1) */
@@ -270,7 +270,7 @@ static void ReadO65RelocInfo (FILE* F, const O65Data* D, Collection* Reloc)
 
 
 
-static O65Export* ReadO65Export (FILE* F, const O65Header* H)
+static O65Export* ReadO65Export (FileBuf* F, const O65Header* H)
 /* Read an o65 export from the file */
 {
     O65Export* E;
@@ -302,7 +302,7 @@ static O65Export* ReadO65Export (FILE* F, const O65Header* H)
 
 
 
-static O65Data* ReadO65Data (FILE* F)
+static O65Data* ReadO65Data (FileBuf* F)
 /* Read a complete o65 file into dynamically allocated memory and return the
 ** created O65Data struct.
 */
@@ -359,7 +359,7 @@ O65Data* ReadO65File (const char* Name)
     O65Data* D;
 
     /* Open the o65 input file */
-    FILE* F = fopen (Name, "rb");
+    FileBuf* F = FB_Open (Name);
     if (F == 0) {
         Error ("Cannot open '%s': %s", Name, strerror (errno));
     }
@@ -367,8 +367,8 @@ O65Data* ReadO65File (const char* Name)
     /* Read the file data */
     D = ReadO65Data (F);
 
-    /* Close the input file. Ignore errors since we were only reading */
-    fclose (F);
+    /* Close the input file */
+    FB_Close (F);
 
     /* Return the data read */
     return D;
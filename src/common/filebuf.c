@@ -0,0 +1,269 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 filebuf.c                                 */
+/*                                                                           */
+/*                  Read binary files from a memory buffer                   */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <string.h>
+#include <errno.h>
+
+/* common */
+#include "abend.h"
+#include "filebuf.h"
+#include "xmalloc.h"
+
+
+
+/*****************************************************************************/
+/*                             Helper functions                              */
+/*****************************************************************************/
+
+
+
+static const unsigned char* Need (FileBuf* F, unsigned long Size)
+/* Check that Size bytes are available at the current position, and return a
+** pointer to them. The read position is advanced by Size.
+*/
+{
+    const unsigned char* Data;
+    if (Size > F->Size - F->Pos) {
+        AbEnd ("Read error at position %lu in '%s' (file corrupt?)",
+               F->Pos, F->Name);
+    }
+    Data = F->Data + F->Pos;
+    F->Pos += Size;
+    return Data;
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+FileBuf* FB_Open (const char* Name)
+/* Read the file with the given name into memory and return a FileBuf for it.
+** If the file cannot be opened or read, NULL is returned and errno is set.
+*/
+{
+    FileBuf*        F;
+    unsigned char*  Data;
+    long            Size;
+
+    /* Open the file */
+    FILE* File = fopen (Name, "rb");
+    if (File == 0) {
+        return 0;
+    }
+
+    /* Determine the size and read the complete file */
+    if (fseek (File, 0, SEEK_END) != 0 || (Size = ftell (File)) < 0) {
+        int Err = errno;
+        fclose (File);
+        errno = Err;
+        return 0;
+    }
+    Data = xmalloc (Size + 1);
+    rewind (File);
+    if (fread (Data, 1, Size, File) != (size_t) Size) {
+        int Err = ferror (File)? errno : EIO;
+        xfree (Data);
+        fclose (File);
+        errno = Err;
+        return 0;
+    }
+
+    /* The file isn't needed any longer, ignore errors since it's r/o */
+    (void) fclose (File);
+
+    /* Create the FileBuf */
+    F = xmalloc (sizeof (FileBuf));
+    F->Name = xstrdup (Name);
+    F->Data = Data;
+    F->Size = Size;
+    F->Pos  = 0;
+
+    /* Return the new buffer */
+    return F;
+}
+
+
+
+void FB_Close (FileBuf* F)
+/* Free a FileBuf and the file data */
+{
+    if (F) {
+        xfree ((void*) F->Data);
+        xfree (F->Name);
+        xfree (F);
+    }
+}
+
+
+
+void FileSetPos (FileBuf* F, unsigned long Pos)
+/* Seek to the given absolute position, fail on errors */
+{
+    if (Pos > F->Size) {
+        AbEnd ("Cannot seek to position %lu in '%s' (file corrupt?)",
+               Pos, F->Name);
+    }
+    F->Pos = Pos;
+}
+
+
+
+unsigned long FileGetPos (const FileBuf* F)
+/* Return the current file position */
+{
+    return F->Pos;
+}
+
+
+
+unsigned Read8 (FileBuf* F)
+/* Read an 8 bit value from the file */
+{
+    return *Need (F, 1);
+}
+
+
+
+unsigned Read16 (FileBuf* F)
+/* Read a 16 bit value from the file */
+{
+    const unsigned char* D = Need (F, 2);
+    return D[0] | ((unsigned) D[1] << 8);
+}
+
+
+
+unsigned long Read24 (FileBuf* F)
+/* Read a 24 bit value from the file */
+{
+    const unsigned char* D = Need (F, 3);
+    return D[0] | ((unsigned long) D[1] << 8) | ((unsigned long) D[2] << 16);
+}
+
+
+
+unsigned long Read32 (FileBuf* F)
+/* Read a 32 bit value from the file */
+{
+    const unsigned char* D = Need (F, 4);
+    return D[0]                         |
+           ((unsigned long) D[1] << 8)  |
+           ((unsigned long) D[2] << 16) |
+           ((unsigned long) D[3] << 24);
+}
+
+
+
+long Read32Signed (FileBuf* F)
+/* Read a 32 bit value from the file. Sign extend the value. */
+{
+    /* Read a 32 bit value */
+    unsigned long V = Read32 (F);
+
+    /* Sign extend the value */
+    if (V & 0x80000000UL) {
+        /* Signed value */
+        V |= ~0xFFFFFFFFUL;
+    }
+
+    /* Return it as a long */
+    return (long) V;
+}
+
+
+
+unsigned long ReadVar (FileBuf* F)
+/* Read a variable size value from the file */
+{
+    /* The value was written to the file in 7 bit chunks LSB first. If there
+    ** are more bytes, bit 8 is set, otherwise it is clear.
+    */
+    unsigned char C;
+    unsigned long V = 0;
+    unsigned Shift = 0;
+    do {
+        /* Read one byte */
+        C = *Need (F, 1);
+        /* Encode it into the target value */
+        V |= ((unsigned long)(C & 0x7F)) << Shift;
+        /* Next value */
+        Shift += 7;
+    } while (C & 0x80);
+
+    /* Return the value read */
+    return V;
+}
+
+
+
+void* ReadData (FileBuf* F, void* Data, unsigned long Size)
+/* Read data from the file */
+{
+    /* Explicitly allow reading zero bytes */
+    if (Size > 0) {
+        memcpy (Data, Need (F, Size), Size);
+    }
+    return Data;
+}
+
+
+
+const void* ReadDataPtr (FileBuf* F, unsigned long Size)
+/* Skip Size bytes of data in the file and return a pointer to them. The
+** data is not copied, the pointer is valid until the FileBuf is closed.
+*/
+{
+    return Need (F, Size);
+}
+
+
+
+StrBuf* ReadStrBuf (FileBuf* F, StrBuf* S)
+/* Read a string from the file. S is initialized so that it references the
+** string data in the file buffer, so no memory is allocated, and S may be
+** "forgotten" without calling SB_Done. The string is not terminated.
+*/
+{
+    /* Read the length */
+    unsigned long Len = ReadVar (F);
+
+    /* Reference the string data */
+    S->Buf       = (char*) Need (F, Len);
+    S->Len       = Len;
+    S->Index     = 0;
+    S->Allocated = 0;
+    return S;
+}
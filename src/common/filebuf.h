@@ -0,0 +1,126 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 filebuf.h                                 */
+/*                                                                           */
+/*                  Read binary files from a memory buffer                   */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+/* The reader loads a complete file into memory. All read functions check
+** the bounds of the buffer and abort the program with an error message if a
+** read goes past the end of the file, so callers don't need to check for
+** errors. Strings and data blocks may be accessed in place without copying.
+*/
+
+
+
+#ifndef FILEBUF_H
+#define FILEBUF_H
+
+
+
+#include <stdio.h>
+
+/* common */
+#include "strbuf.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* A file in memory */
+typedef struct FileBuf FileBuf;
+struct FileBuf {
+    char*                   Name;       /* Name of the file */
+    const unsigned char*    Data;       /* File contents */
+    unsigned long           Size;       /* Size of the file */
+    unsigned long           Pos;        /* Current read position */
+};
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+FileBuf* FB_Open (const char* Name);
+/* Read the file with the given name into memory and return a FileBuf for it.
+** If the file cannot be opened or read, NULL is returned and errno is set.
+*/
+
+void FB_Close (FileBuf* F);
+/* Free a FileBuf and the file data */
+
+void FileSetPos (FileBuf* F, unsigned long Pos);
+/* Seek to the given absolute position, fail on errors */
+
+unsigned long FileGetPos (const FileBuf* F);
+/* Return the current file position */
+
+unsigned Read8 (FileBuf* F);
+/* Read an 8 bit value from the file */
+
+unsigned Read16 (FileBuf* F);
+/* Read a 16 bit value from the file */
+
+unsigned long Read24 (FileBuf* F);
+/* Read a 24 bit value from the file */
+
+unsigned long Read32 (FileBuf* F);
+/* Read a 32 bit value from the file */
+
+long Read32Signed (FileBuf* F);
+/* Read a 32 bit value from the file. Sign extend the value. */
+
+unsigned long ReadVar (FileBuf* F);
+/* Read a variable size value from the file */
+
+void* ReadData (FileBuf* F, void* Data, unsigned long Size);
+/* Read data from the file */
+
+const void* ReadDataPtr (FileBuf* F, unsigned long Size);
+/* Skip Size bytes of data in the file and return a pointer to them. The
+** data is not copied, the pointer is valid until the FileBuf is closed.
+*/
+
+StrBuf* ReadStrBuf (FileBuf* F, StrBuf* S);
+/* Read a string from the file. S is initialized so that it references the
+** string data in the file buffer, so no memory is allocated, and S may be
+** "forgotten" without calling SB_Done. The string is not terminated.
+*/
+
+
+
+/* End of filebuf.h */
+
+#endif
@@ -50,14 +50,21 @@
 int ValidSegName (const char* Name)
 /* Return true if the given segment name is valid, return false otherwise */
 {
+    int Dot = 0;
+
     /* Must start with '_' or a letter */
     if ((*Name != '_' && !IsAlpha(*Name)) || strlen(Name) > 80) {
         return 0;
     }
 
-    /* Can have letters, digits or the underline */
+    /* Can have letters, digits or the underline. A single dot separates the
+    ** name of a section that may be removed by the linker from the name of
+    ** the segment it belongs to.
+    */
     while (*++Name) {
-        if (*Name != '_' && !IsAlNum(*Name)) {
+        if (*Name == '.' && !Dot && Name[1] != '\0') {
+            Dot = 1;
+        } else if (*Name != '_' && !IsAlNum(*Name)) {
             return 0;
         }
     }
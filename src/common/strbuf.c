@@ -87,6 +87,21 @@ StrBuf* SB_InitFromString (StrBuf* B, const char* S)
 
 
 
+StrBuf* SB_InitFromBuf (StrBuf* B, const char* S, unsigned Len)
+/* Initialize a string buffer from a character buffer with the given length.
+** Like with SB_InitFromString, the buffer won't store a copy but a pointer
+** to the actual data, so it may be "forgotten" without calling SB_Done.
+*/
+{
+    B->Allocated = 0;
+    B->Len       = Len;
+    B->Index     = 0;
+    B->Buf       = (char*) S;
+    return B;
+}
+
+
+
 void SB_Done (StrBuf* B)
 /* Free the data of a string buffer (but not the struct itself) */
 {
@@ -370,10 +385,17 @@ void SB_Move (StrBuf* Target, StrBuf* Source)
 
 
 void SB_ToLower (StrBuf* S)
-/* Convert all characters in S to lower case */
+/* Convert all characters in S to lower case. If the data of S is not owned
+** by the buffer, a private copy is made first.
+*/
 {
     unsigned I;
-    char* B = S->Buf;
+    char* B;
+
+    if (S->Allocated == 0 && S->Len > 0) {
+        SB_Realloc (S, S->Len);
+    }
+    B = S->Buf;
     for (I = 0; I < S->Len; ++I, ++B) {
         if (IsUpper (*B)) {
             *B = tolower (*B);
@@ -384,10 +406,17 @@ void SB_ToLower (StrBuf* S)
 
 
 void SB_ToUpper (StrBuf* S)
-/* Convert all characters in S to upper case */
+/* Convert all characters in S to upper case. If the data of S is not owned
+** by the buffer, a private copy is made first.
+*/
 {
     unsigned I;
-    char* B = S->Buf;
+    char* B;
+
+    if (S->Allocated == 0 && S->Len > 0) {
+        SB_Realloc (S, S->Len);
+    }
+    B = S->Buf;
     for (I = 0; I < S->Len; ++I, ++B) {
         if (IsLower (*B)) {
             *B = toupper (*B);
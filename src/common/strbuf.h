@@ -100,6 +100,12 @@ StrBuf* SB_InitFromString (StrBuf* B, const char* S);
 ** has been allocated.
 */
 
+StrBuf* SB_InitFromBuf (StrBuf* B, const char* S, unsigned Len);
+/* Initialize a string buffer from a character buffer with the given length.
+** Like with SB_InitFromString, the buffer won't store a copy but a pointer
+** to the actual data, so it may be "forgotten" without calling SB_Done.
+*/
+
 void SB_Done (StrBuf* B);
 /* Free the data of a string buffer (but not the struct itself) */
 
@@ -391,10 +397,14 @@ void SB_Move (StrBuf* Target, StrBuf* Source);
 */
 
 void SB_ToLower (StrBuf* S);
-/* Convert all characters in S to lower case */
+/* Convert all characters in S to lower case. If the data of S is not owned
+** by the buffer, a private copy is made first.
+*/
 
 void SB_ToUpper (StrBuf* S);
-/* Convert all characters in S to upper case */
+/* Convert all characters in S to upper case. If the data of S is not owned
+** by the buffer, a private copy is made first.
+*/
 
 int SB_Compare (const StrBuf* S1, const StrBuf* S2);
 /* Do a lexical compare of S1 and S2. See strcmp for result codes. */
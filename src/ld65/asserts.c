@@ -75,7 +75,7 @@ static Collection Assertions = STATIC_COLLECTION_INITIALIZER;
 
 
 
-Assertion* ReadAssertion (FILE* F, struct ObjData* O)
+Assertion* ReadAssertion (FileBuf* F, struct ObjData* O)
 /* Read an assertion from the given file */
 {
     /* Allocate memory */
@@ -157,3 +157,15 @@ void CheckAssertions (void)
         }
     }
 }
+
+
+
+void ForEachAssertion (void (*F) (struct ExprNode* Expr))
+/* Call F for the expressions of all assertions */
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&Assertions); ++I) {
+        const Assertion* A = CollConstAt (&Assertions, I);
+        F (A->Expr);
+    }
+}
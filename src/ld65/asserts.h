@@ -41,6 +41,7 @@
 #include <stdio.h>
 
 /* common */
+#include "filebuf.h"
 #include "filepos.h"
 
 
@@ -57,6 +58,9 @@ typedef struct Assertion Assertion;
 /* ObjData forward decl */
 struct ObjData;
 
+/* ExprNode forward decl */
+struct ExprNode;
+
 
 
 /*****************************************************************************/
@@ -65,12 +69,15 @@ struct ObjData;
 
 
 
-Assertion* ReadAssertion (FILE* F, struct ObjData* O);
+Assertion* ReadAssertion (FileBuf* F, struct ObjData* O);
 /* Read an assertion from the given file */
 
 void CheckAssertions (void);
 /* Check all assertions */
 
+void ForEachAssertion (void (*F) (struct ExprNode* Expr));
+/* Call F for the expressions of all assertions */
+
 
 
 /* End of asserts.h */
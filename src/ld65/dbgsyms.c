@@ -185,7 +185,7 @@ static void InsertDbgSym (DbgSym* D, long Val)
 
 
 
-DbgSym* ReadDbgSym (FILE* F, ObjData* O, unsigned Id)
+DbgSym* ReadDbgSym (FileBuf* F, ObjData* O, unsigned Id)
 /* Read a debug symbol from a file, insert and return it */
 {
     /* Read the type and address size */
@@ -236,7 +236,7 @@ DbgSym* ReadDbgSym (FILE* F, ObjData* O, unsigned Id)
 
 
 
-HLLDbgSym* ReadHLLDbgSym (FILE* F, ObjData* O, unsigned Id attribute ((unused)))
+HLLDbgSym* ReadHLLDbgSym (FileBuf* F, ObjData* O, unsigned Id attribute ((unused)))
 /* Read a hll debug symbol from a file, insert and return it */
 {
     unsigned SC;
@@ -517,8 +517,11 @@ void PrintDbgSymLabels (FILE* F)
             /* Get the next debug symbol */
             DbgSym* D = CollAt (&O->DbgSyms, J);
 
-            /* Emit this symbol only if it is a label (ignore equates and imports) */
-            if (SYM_IS_EQUATE (D->Type) || SYM_IS_IMPORT (D->Type)) {
+            /* Emit this symbol only if it is a label (ignore equates and
+            ** imports), and if it wasn't removed together with its section.
+            */
+            if (SYM_IS_EQUATE (D->Type) || SYM_IS_IMPORT (D->Type) ||
+                IsRemovedExpr (D->Expr)) {
                 continue;
             }
 
@@ -43,6 +43,7 @@
 /* common */
 #include "coll.h"
 #include "exprdefs.h"
+#include "filebuf.h"
 
 /* ld65 */
 #include "objdata.h"
@@ -70,10 +71,10 @@ typedef struct DbgSym DbgSym;
 
 
 
-DbgSym* ReadDbgSym (FILE* F, ObjData* Obj, unsigned Id);
+DbgSym* ReadDbgSym (FileBuf* F, ObjData* Obj, unsigned Id);
 /* Read a debug symbol from a file, insert and return it */
 
-struct HLLDbgSym* ReadHLLDbgSym (FILE* F, ObjData* Obj, unsigned Id);
+struct HLLDbgSym* ReadHLLDbgSym (FileBuf* F, ObjData* Obj, unsigned Id);
 /* Read a hll debug symbol from a file, insert and return it */
 
 void PrintDbgSyms (FILE* F);
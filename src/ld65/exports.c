@@ -140,7 +140,7 @@ void FreeImport (Import* I)
 
 
 
-Import* ReadImport (FILE* F, ObjData* Obj)
+Import* ReadImport (FileBuf* F, ObjData* Obj)
 /* Read an import from a file and return it */
 {
     Import* I;
@@ -341,7 +341,7 @@ void FreeExport (Export* E)
 
 
 
-Export* ReadExport (FILE* F, ObjData* O)
+Export* ReadExport (FileBuf* F, ObjData* O)
 /* Read an export from a file */
 {
     unsigned    ConDesCount;
@@ -858,6 +858,30 @@ void CheckUnresolvedImports (ExpCheckFunc F, void* Data)
 
 
 
+void ForEachLinkerImport (void (*F) (Export* E))
+/* Call F for the exports of all imports that were generated by the linker,
+** for example from the config file or the command line.
+*/
+{
+    unsigned I;
+    for (I = 0; I < sizeof (HashTab) / sizeof (HashTab [0]); ++I) {
+        Export* E = HashTab[I];
+        while (E) {
+            const Import* Imp = E->ImpList;
+            while (Imp) {
+                if (Imp->Obj == 0) {
+                    F (E);
+                    break;
+                }
+                Imp = Imp->Next;
+            }
+            E = E->Next;
+        }
+    }
+}
+
+
+
 static char GetAddrSizeCode (unsigned char AddrSize)
 /* Get a one char code for the address size */
 {
@@ -886,8 +910,11 @@ void PrintExportMapByName (FILE* F)
     for (I = 0; I < ExpCount; ++I) {
         const Export* E = ExpPool [I];
 
-        /* Print unreferenced symbols only if explictly requested */
-        if (VerboseMap || E->ImpCount > 0 || SYM_IS_CONDES (E->Type)) {
+        /* Print unreferenced symbols only if explictly requested. Symbols
+        ** in removed sections don't have a valid value.
+        */
+        if ((VerboseMap || E->ImpCount > 0 || SYM_IS_CONDES (E->Type)) &&
+            !IsRemovedExpr (E->Expr)) {
             fprintf (F,
                      "%-25s %06lX %c%c%c%c   ",
                      GetString (E->Name),
@@ -940,8 +967,11 @@ void PrintExportMapByValue (FILE* F)
     for (I = 0; I < ExpCount; ++I) {
         const Export* E = ExpPool [ExpValXlat [I]];
 
-        /* Print unreferenced symbols only if explictly requested */
-        if (VerboseMap || E->ImpCount > 0 || SYM_IS_CONDES (E->Type)) {
+        /* Print unreferenced symbols only if explictly requested. Symbols
+        ** in removed sections don't have a valid value.
+        */
+        if ((VerboseMap || E->ImpCount > 0 || SYM_IS_CONDES (E->Type)) &&
+            !IsRemovedExpr (E->Expr)) {
             fprintf (F,
                      "%-25s %06lX %c%c%c%c   ",
                      GetString (E->Name),
@@ -1024,7 +1054,9 @@ void PrintExportLabels (FILE* F)
     /* Print all exports */
     for (I = 0; I < ExpCount; ++I) {
         const Export* E = ExpPool [I];
-        fprintf (F, "al %06lX .%s\n", GetExportVal (E), GetString (E->Name));
+        if (!IsRemovedExpr (E->Expr)) {
+            fprintf (F, "al %06lX .%s\n", GetExportVal (E), GetString (E->Name));
+        }
     }
 }
 
@@ -44,6 +44,7 @@
 #include "cddefs.h"
 #include "coll.h"
 #include "exprdefs.h"
+#include "filebuf.h"
 
 /* ld65 */
 #include "config.h"
@@ -117,7 +118,7 @@ void FreeImport (Import* I);
 ** aren't referenced).
 */
 
-Import* ReadImport (FILE* F, ObjData* Obj);
+Import* ReadImport (FileBuf* F, ObjData* Obj);
 /* Read an import from a file and insert it into the table */
 
 Import* GenImport (unsigned Name, unsigned char AddrSize);
@@ -135,7 +136,7 @@ void FreeExport (Export* E);
 ** aren't referenced).
 */
 
-Export* ReadExport (FILE* F, ObjData* Obj);
+Export* ReadExport (FileBuf* F, ObjData* Obj);
 /* Read an export from a file */
 
 void InsertExport (Export* E);
@@ -186,6 +187,11 @@ void CheckUnresolvedImports (ExpCheckFunc F, void* Data);
 ** called (see the comments on ExpCheckFunc in the data section).
 */
 
+void ForEachLinkerImport (void (*F) (Export* E));
+/* Call F for the exports of all imports that were generated by the linker,
+** for example from the config file or the command line.
+*/
+
 void PrintExportMapByName (FILE* F);
 /* Print an export map to the given file (sorted by symbol name) */
 
@@ -532,6 +532,26 @@ static void GetSegExprValInternal (ExprNode* Expr, SegExprDesc* D, int Sign)
 
 
 
+int IsRemovedExpr (ExprNode* Expr)
+/* Return true if the expression references a section that was removed
+** because it is unused. The value of such an expression is meaningless.
+*/
+{
+    while (Expr) {
+        if (Expr->Op == EXPR_SECTION) {
+            return SectionIsRemoved (GetExprSection (Expr));
+        } else if (EXPR_IS_LEAF (Expr->Op)) {
+            return 0;
+        } else if (IsRemovedExpr (Expr->Left)) {
+            return 1;
+        }
+        Expr = Expr->Right;
+    }
+    return 0;
+}
+
+
+
 void GetSegExprVal (ExprNode* Expr, SegExprDesc* D)
 /* Check if the given expression consists of a segment reference and only
 ** constant values, additions and subtractions. If anything else is found,
@@ -622,7 +642,7 @@ ExprNode* SectionExpr (Section* Sec, long Offs, ObjData* O)
 
 
 
-ExprNode* ReadExpr (FILE* F, ObjData* O)
+ExprNode* ReadExpr (FileBuf* F, ObjData* O)
 /* Read an expression from the given file */
 {
     ExprNode* Expr;
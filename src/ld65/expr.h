@@ -40,6 +40,7 @@
 
 /* common */
 #include "exprdefs.h"
+#include "filebuf.h"
 
 /* ld65 */
 #include "objdata.h"
@@ -93,6 +94,11 @@ Section* GetExprSection (ExprNode* Expr);
 long GetExprVal (ExprNode* Expr);
 /* Get the value of a constant expression */
 
+int IsRemovedExpr (ExprNode* Expr);
+/* Return true if the expression references a section that was removed
+** because it is unused. The value of such an expression is meaningless.
+*/
+
 void GetSegExprVal (ExprNode* Expr, SegExprDesc* D);
 /* Check if the given expression consists of a segment reference and only
 ** constant values, additions and subtractions. If anything else is found,
@@ -111,7 +117,7 @@ ExprNode* SegmentExpr (Segment* Seg, long Offs, ObjData* O);
 ExprNode* SectionExpr (Section* Sec, long Offs, ObjData* O);
 /* Return an expression tree that encodes an offset into a section */
 
-ExprNode* ReadExpr (FILE* F, ObjData* O);
+ExprNode* ReadExpr (FileBuf* F, ObjData* O);
 /* Read an expression from the given file */
 
 int EqualExpr (ExprNode* E1, ExprNode* E2);
@@ -42,6 +42,7 @@
 
 /* common */
 #include "coll.h"
+#include "filebuf.h"
 #include "filepos.h"
 
 /* ld65 */
@@ -72,7 +73,7 @@ struct FileInfo {
 
 
 
-FileInfo* ReadFileInfo (FILE* F, ObjData* O);
+FileInfo* ReadFileInfo (FileBuf* F, ObjData* O);
 /* Read a file info from a file and return it */
 
 unsigned FileInfoCount (void);
@@ -34,10 +34,6 @@
 
 
 #include <string.h>
-#include <errno.h>
-
-/* common */
-#include "xmalloc.h"
 
 /* ld65 */
 #include "error.h"
@@ -52,28 +48,6 @@
 
 
 
-void FileSetPos (FILE* F, unsigned long Pos)
-/* Seek to the given absolute position, fail on errors */
-{
-    if (fseek (F, Pos, SEEK_SET) != 0) {
-        Error ("Cannot seek: %s", strerror (errno));
-    }
-}
-
-
-
-unsigned long FileGetPos (FILE* F)
-/* Return the current file position, fail on errors */
-{
-    long Pos = ftell (F);
-    if (Pos < 0) {
-        Error ("Error in ftell: %s", strerror (errno));
-    }
-    return Pos;
-}
-
-
-
 void Write8 (FILE* F, unsigned Val)
 /* Write an 8 bit value to the file */
 {
@@ -193,122 +167,20 @@ void WriteMult (FILE* F, unsigned char Val, unsigned long Count)
 
 
 
-unsigned Read8 (FILE* F)
-/* Read an 8 bit value from the file */
-{
-    int C = getc (F);
-    if (C == EOF) {
-        long Pos = ftell (F);
-        Error ("Read error at position %ld (file corrupt?)", Pos);
-    }
-    return C;
-}
-
-
-
-unsigned Read16 (FILE* F)
-/* Read a 16 bit value from the file */
-{
-    unsigned Lo = Read8 (F);
-    unsigned Hi = Read8 (F);
-    return (Hi << 8) | Lo;
-}
-
-
-
-unsigned long Read24 (FILE* F)
-/* Read a 24 bit value from the file */
-{
-    unsigned long Lo = Read16 (F);
-    unsigned long Hi = Read8 (F);
-    return (Hi << 16) | Lo;
-}
-
-
-
-unsigned long Read32 (FILE* F)
-/* Read a 32 bit value from the file */
-{
-    unsigned long Lo = Read16 (F);
-    unsigned long Hi = Read16 (F);
-    return (Hi << 16) | Lo;
-}
-
-
-
-long Read32Signed (FILE* F)
-/* Read a 32 bit value from the file. Sign extend the value. */
-{
-    /* Read a 32 bit value */
-    unsigned long V = Read32 (F);
-
-    /* Sign extend the value */
-    if (V & 0x80000000UL) {
-        /* Signed value */
-        V |= ~0xFFFFFFFFUL;
-    }
-
-    /* Return it as a long */
-    return (long) V;
-}
-
-
-
-unsigned long ReadVar (FILE* F)
-/* Read a variable size value from the file */
-{
-    /* The value was written to the file in 7 bit chunks LSB first. If there
-    ** are more bytes, bit 8 is set, otherwise it is clear.
-    */
-    unsigned char C;
-    unsigned long V = 0;
-    unsigned Shift = 0;
-    do {
-        /* Read one byte */
-        C = Read8 (F);
-        /* Encode it into the target value */
-        V |= ((unsigned long)(C & 0x7F)) << Shift;
-        /* Next value */
-        Shift += 7;
-    } while (C & 0x80);
-
-    /* Return the value read */
-    return V;
-}
-
-
-
-unsigned ReadStr (FILE* F)
+unsigned ReadStr (FileBuf* F)
 /* Read a string from the file, place it into the global string pool, and
 ** return its string id.
 */
 {
-    unsigned    Id;
-    StrBuf      Buf = STATIC_STRBUF_INITIALIZER;
-
-    /* Read the length */
-    unsigned Len = ReadVar (F);
-
-    /* Expand the string buffer memory */
-    SB_Realloc (&Buf, Len);
-
-    /* Read the string */
-    ReadData (F, SB_GetBuf (&Buf), Len);
-    Buf.Len = Len;
-
-    /* Insert it into the string pool and remember the id */
-    Id = GetStrBufId (&Buf);
-
-    /* Free the memory buffer */
-    SB_Done (&Buf);
+    StrBuf Buf;
 
-    /* Return the string id */
-    return Id;
+    /* Get a view of the string data and insert it into the string pool */
+    return GetStrBufId (ReadStrBuf (F, &Buf));
 }
 
 
 
-FilePos* ReadFilePos (FILE* F, FilePos* Pos)
+FilePos* ReadFilePos (FileBuf* F, FilePos* Pos)
 /* Read a file position from the file */
 {
     /* Read the data fields */
@@ -317,18 +189,3 @@ FilePos* ReadFilePos (FILE* F, FilePos* Pos)
     Pos->Name = ReadVar (F);
     return Pos;
 }
-
-
-
-void* ReadData (FILE* F, void* Data, unsigned Size)
-/* Read data from the file */
-{
-    /* Explicitly allow reading zero bytes */
-    if (Size > 0) {
-        if (fread (Data, 1, Size, F) != Size) {
-            long Pos = ftell (F);
-            Error ("Read error at position %ld (file corrupt?)", Pos);
-        }
-    }
-    return Data;
-}
@@ -41,6 +41,7 @@
 #include <stdio.h>
 
 /* common */
+#include "filebuf.h"
 #include "filepos.h"
 
 
@@ -51,12 +52,6 @@
 
 
 
-void FileSetPos (FILE* F, unsigned long Pos);
-/* Seek to the given absolute position, fail on errors */
-
-unsigned long FileGetPos (FILE* F);
-/* Return the current file position, fail on errors */
-
 void Write8 (FILE* F, unsigned Val);
 /* Write an 8 bit value to the file */
 
@@ -84,35 +79,14 @@ void WriteData (FILE* F, const void* Data, unsigned Size);
 void WriteMult (FILE* F, unsigned char Val, unsigned long Count);
 /* Write one byte several times to the file */
 
-unsigned Read8 (FILE* F);
-/* Read an 8 bit value from the file */
-
-unsigned Read16 (FILE* F);
-/* Read a 16 bit value from the file */
-
-unsigned long Read24 (FILE* F);
-/* Read a 24 bit value from the file */
-
-unsigned long Read32 (FILE* F);
-/* Read a 32 bit value from the file */
-
-long Read32Signed (FILE* F);
-/* Read a 32 bit value from the file. Sign extend the value. */
-
-unsigned long ReadVar (FILE* F);
-/* Read a variable size value from the file */
-
-unsigned ReadStr (FILE* F);
+unsigned ReadStr (FileBuf* F);
 /* Read a string from the file, place it into the global string pool, and
 ** return its string id.
 */
 
-FilePos* ReadFilePos (FILE* F, FilePos* Pos);
+FilePos* ReadFilePos (FileBuf* F, FilePos* Pos);
 /* Read a file position from the file */
 
-void* ReadData (FILE* F, void* Data, unsigned Size);
-/* Read data from the file */
-
 
 
 /* End of fileio.h */
@@ -35,7 +35,6 @@
 
 #include <stdio.h>
 #include <string.h>
-#include <errno.h>
 
 /* common */
 #include "coll.h"
@@ -67,7 +66,7 @@ typedef struct Library Library;
 struct Library {
     unsigned    Id;             /* Id of library */
     unsigned    Name;           /* String id of the name */
-    FILE*       F;              /* Open file stream */
+    FileBuf*    F;              /* File contents */
     LibHeader   Header;         /* Library header */
     Collection  Modules;        /* Modules */
 };
@@ -89,7 +88,7 @@ static int Grouping = 0;
 
 
 
-static Library* NewLibrary (FILE* F, const char* Name)
+static Library* NewLibrary (FileBuf* F, const char* Name)
 /* Create a new Library structure and return it */
 {
     /* Allocate memory */
@@ -111,9 +110,7 @@ static void CloseLibrary (Library* L)
 /* Close a library file and remove the list of modules */
 {
     /* Close the library file */
-    if (fclose (L->F) != 0) {
-        Error ("Error closing '%s': %s", GetString (L->Name), strerror (errno));
-    }
+    FB_Close (L->F);
     L->F = 0;
 }
 
@@ -143,10 +140,7 @@ static void FreeLibrary (Library* L)
 static void LibSeek (Library* L, unsigned long Offs)
 /* Do a seek in the library checking for errors */
 {
-    if (fseek (L->F, Offs, SEEK_SET) != 0) {
-        Error ("Seek error in '%s' (%lu): %s",
-               GetString (L->Name), Offs, strerror (errno));
-    }
+    FileSetPos (L->F, Offs);
 }
 
 
@@ -311,7 +305,7 @@ static void LibCheckExports (ObjData* O)
 
 
 
-static void LibOpen (FILE* F, const char* Name)
+static void LibOpen (FileBuf* F, const char* Name)
 /* Open the library for use */
 {
     /* Create a new library structure */
@@ -451,7 +445,7 @@ static void LibResolve (void)
 
 
 
-void LibAdd (FILE* F, const char* Name)
+void LibAdd (FileBuf* F, const char* Name)
 /* Add files from the library to the list if there are references that could
 ** be satisfied.
 */
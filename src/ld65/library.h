@@ -38,6 +38,13 @@
 
 
 
+#include <stdio.h>
+
+/* common */
+#include "filebuf.h"
+
+
+
 /*****************************************************************************/
 /*                                   Data                                    */
 /*****************************************************************************/
@@ -55,7 +62,7 @@ struct Library;
 
 
 
-void LibAdd (FILE* F, const char* Name);
+void LibAdd (FileBuf* F, const char* Name);
 /* Add files from the library to the list if there are references that could
 ** be satisfied.
 */
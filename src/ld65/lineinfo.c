@@ -121,7 +121,7 @@ LineInfo* GenLineInfo (const FilePos* Pos)
 
 
 
-LineInfo* ReadLineInfo (FILE* F, ObjData* O)
+LineInfo* ReadLineInfo (FileBuf* F, ObjData* O)
 /* Read a line info from a file and return it */
 {
     /* Create a new LineInfo struct */
@@ -141,7 +141,7 @@ LineInfo* ReadLineInfo (FILE* F, ObjData* O)
 
 
 
-void ReadLineInfoList (FILE* F, ObjData* O, Collection* LineInfos)
+void ReadLineInfoList (FileBuf* F, ObjData* O, Collection* LineInfos)
 /* Read a list of line infos stored as a list of indices in the object file,
 ** make real line infos from them and place them into the passed collection.
 */
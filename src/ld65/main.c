@@ -182,7 +182,7 @@ static void LinkFile (const char* Name, FILETYPE Type)
 /* Handle one file */
 {
     char*         PathName;
-    FILE*         F;
+    FileBuf*      F;
     unsigned long Magic;
 
 
@@ -219,7 +219,7 @@ static void LinkFile (const char* Name, FILETYPE Type)
     }
 
     /* Try to open the file */
-    F = fopen (PathName, "rb");
+    F = FB_Open (PathName);
     if (F == 0) {
         Error ("Cannot open '%s': %s", PathName, strerror (errno));
     }
@@ -246,7 +246,7 @@ static void LinkFile (const char* Name, FILETYPE Type)
             break;
 
         default:
-            fclose (F);
+            FB_Close (F);
             Error ("File '%s' has unknown type", PathName);
 
     }
@@ -811,6 +811,9 @@ int main (int argc, char* argv [])
     /* Create the condes tables if requested */
     ConDesCreate ();
 
+    /* Remove the sections that are not referenced */
+    RemoveUnusedSections ();
+
     /* Process data from the config file. Assign start addresses for the
     ** segments, define linker symbols. The function will return the number
     ** of memory area overflows (zero on success).
@@ -90,9 +90,9 @@ void CreateMapFile (int ShortMap)
         for (J = 0; J < CollCount (&O->Sections); ++J) {
             const Section* S = CollConstAt (&O->Sections, J);
             /* Don't include zero sized sections if not explicitly
-            ** requested
+            ** requested, and skip removed sections.
             */
-            if (VerboseMap || S->Size > 0) {
+            if ((VerboseMap || S->Size > 0) && !SectionIsRemoved (S)) {
                 fprintf (F, 
                          "    %-17s Offs=%06lX  Size=%06lX  "
                          "Align=%05lX  Fill=%04lX\n",
@@ -41,6 +41,7 @@
 #include <stdio.h>
 
 /* common */
+#include "filebuf.h"
 #include "objdefs.h"
 
 /* ld65 */
@@ -54,37 +55,37 @@
 
 
 
-void ObjReadFiles (FILE* F, unsigned long Pos, ObjData* O);
+void ObjReadFiles (FileBuf* F, unsigned long Pos, ObjData* O);
 /* Read the files list from a file at the given position */
 
-void ObjReadSections (FILE* F, unsigned long Pos, ObjData* O);
+void ObjReadSections (FileBuf* F, unsigned long Pos, ObjData* O);
 /* Read the section data from a file at the given position */
 
-void ObjReadImports (FILE* F, unsigned long Pos, ObjData* O);
+void ObjReadImports (FileBuf* F, unsigned long Pos, ObjData* O);
 /* Read the imports from a file at the given position */
 
-void ObjReadExports (FILE* F, unsigned long Pos, ObjData* O);
+void ObjReadExports (FileBuf* F, unsigned long Pos, ObjData* O);
 /* Read the exports from a file at the given position */
 
-void ObjReadDbgSyms (FILE* F, unsigned long Pos, ObjData* O);
+void ObjReadDbgSyms (FileBuf* F, unsigned long Pos, ObjData* O);
 /* Read the debug symbols from a file at the given position */
 
-void ObjReadLineInfos (FILE* F, unsigned long Pos, ObjData* O);
+void ObjReadLineInfos (FileBuf* F, unsigned long Pos, ObjData* O);
 /* Read the line infos from a file at the given position */
 
-void ObjReadStrPool (FILE* F, unsigned long Pos, ObjData* O);
+void ObjReadStrPool (FileBuf* F, unsigned long Pos, ObjData* O);
 /* Read the string pool from a file at the given position */
 
-void ObjReadAssertions (FILE* F, unsigned long Pos, ObjData* O);
+void ObjReadAssertions (FileBuf* F, unsigned long Pos, ObjData* O);
 /* Read the assertions from a file at the given offset */
 
-void ObjReadScopes (FILE* F, unsigned long Pos, ObjData* O);
+void ObjReadScopes (FileBuf* F, unsigned long Pos, ObjData* O);
 /* Read the scope table from a file at the given offset */
 
-void ObjReadSpans (FILE* F, unsigned long Pos, ObjData* O);
+void ObjReadSpans (FileBuf* F, unsigned long Pos, ObjData* O);
 /* Read the span table from a file at the given offset */
 
-void ObjAdd (FILE* F, const char* Name);
+void ObjAdd (FileBuf* F, const char* Name);
 /* Add an object file to the module list */
 
 
@@ -70,7 +70,7 @@ static Scope* NewScope (ObjData* Obj, unsigned Id)
 
 
 
-Scope* ReadScope (FILE* F, ObjData* Obj, unsigned Id)
+Scope* ReadScope (FileBuf* F, ObjData* Obj, unsigned Id)
 /* Read a scope from a file and return it */
 {
     /* Create a new scope */
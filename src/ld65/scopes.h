@@ -42,6 +42,7 @@
 
 /* common */
 #include "coll.h"
+#include "filebuf.h"
 #include "scopedefs.h"
 
 /* ld65 */
@@ -78,7 +79,7 @@ struct Scope {
 
 
 
-Scope* ReadScope (FILE* F, ObjData* Obj, unsigned Id);
+Scope* ReadScope (FileBuf* F, ObjData* Obj, unsigned Id);
 /* Read a scope from a file, insert and return it */
 
 unsigned ScopeCount (void);
@@ -50,12 +50,15 @@
 #include "xmalloc.h"
 
 /* ld65 */
+#include "asserts.h"
 #include "error.h"
+#include "exports.h"
 #include "expr.h"
 #include "fileio.h"
 #include "fragment.h"
 #include "global.h"
 #include "lineinfo.h"
+#include "objdata.h"
 #include "segments.h"
 #include "spool.h"
 
@@ -75,6 +78,10 @@ static Segment*         HashTab[HASHTAB_SIZE];
 /* List of all segments */
 static Collection       SegmentList = STATIC_COLLECTION_INITIALIZER;
 
+/* Sections and exports found by RemoveUnusedSections */
+static Collection       UsedSections = STATIC_COLLECTION_INITIALIZER;
+static Collection       UsedExports  = STATIC_COLLECTION_INITIALIZER;
+
 
 
 /*****************************************************************************/
@@ -170,6 +177,8 @@ Section* NewSection (Segment* Seg, unsigned long Alignment, unsigned char AddrSi
     S->Size     = 0;
     S->Alignment= Alignment;
     S->AddrSize = AddrSize;
+    S->Removable= 0;
+    S->Used     = 0;
 
     /* Calculate the alignment bytes needed for the section */
     S->Fill = AlignCount (Seg->Size, S->Alignment);
@@ -187,7 +196,7 @@ Section* NewSection (Segment* Seg, unsigned long Alignment, unsigned char AddrSi
 
 
 
-Section* ReadSection (FILE* F, ObjData* O)
+Section* ReadSection (FileBuf* F, ObjData* O)
 /* Read a section from a file */
 {
     unsigned      Name;
@@ -195,6 +204,8 @@ Section* ReadSection (FILE* F, ObjData* O)
     unsigned long Alignment;
     unsigned char Type;
     unsigned      FragCount;
+    const char*   Dot;
+    int           Removable;
     Segment*      S;
     Section*      Sec;
 
@@ -213,6 +224,20 @@ Section* ReadSection (FILE* F, ObjData* O)
            "Module '%s': Found segment '%s', size = %u, alignment = %lu, type = %u\n",
            GetObjFileName (O), GetString (Name), Size, Alignment, Type);
 
+    /* A segment name of the form "NAME.suffix" denotes a section of the
+    ** segment NAME that may be removed if nothing references it. Since the
+    ** config file cannot place segments with a dot in their name, there is
+    ** no ambiguity.
+    */
+    Dot = strchr (GetString (Name), '.');
+    Removable = (Dot != 0 && Dot != GetString (Name));
+    if (Removable) {
+        StrBuf Base = STATIC_STRBUF_INITIALIZER;
+        SB_CopyBuf (&Base, GetString (Name), Dot - GetString (Name));
+        Name = GetStrBufId (&Base);
+        SB_Done (&Base);
+    }
+
     /* Get the segment for this section */
     S = GetSegment (Name, Type, GetObjFileName (O));
 
@@ -221,6 +246,7 @@ Section* ReadSection (FILE* F, ObjData* O)
 
     /* Remember the object file this section was from */
     Sec->Obj = O;
+    Sec->Removable = Removable;
 
     /* Set up the combined segment alignment */
     if (Sec->Alignment > 1) {
@@ -306,6 +332,137 @@ Segment* SegFind (unsigned Name)
 
 
 
+static void UseSection (Section* S)
+/* Mark a section as used and remember it for the scan of its fragments */
+{
+    if (!S->Used) {
+        S->Used = 1;
+        CollAppend (&UsedSections, S);
+    }
+}
+
+
+
+static void UseExpr (ExprNode* Expr);
+
+
+
+static void UseExport (Export* E)
+/* Mark an export and everything referenced by its value as used */
+{
+    if (!ExportHasMark (E)) {
+        MarkExport (E);
+        CollAppend (&UsedExports, E);
+        UseExpr (E->Expr);
+    }
+}
+
+
+
+static void UseExpr (ExprNode* Expr)
+/* Mark all sections and exports referenced by the expression as used */
+{
+    while (Expr) {
+        switch (Expr->Op) {
+
+            case EXPR_SECTION:
+                UseSection (GetExprSection (Expr));
+                return;
+
+            case EXPR_SYMBOL:
+                UseExport (GetExprExport (Expr));
+                return;
+
+            default:
+                if (EXPR_IS_LEAF (Expr->Op)) {
+                    return;
+                }
+                UseExpr (Expr->Left);
+                Expr = Expr->Right;
+                break;
+        }
+    }
+}
+
+
+
+void RemoveUnusedSections (void)
+/* Remove all removable sections that cannot be reached from the sections
+** that must be kept, the symbols imported by the linker or the config file,
+** or the assertions. The offsets of the remaining sections are adjusted.
+*/
+{
+    unsigned Removable = 0;
+    unsigned I, J;
+
+    /* All sections that cannot be removed are the roots */
+    for (I = 0; I < CollCount (&SegmentList); ++I) {
+        Segment* Seg = CollAtUnchecked (&SegmentList, I);
+        for (J = 0; J < CollCount (&Seg->Sections); ++J) {
+            Section* S = CollAtUnchecked (&Seg->Sections, J);
+            if (S->Removable) {
+                ++Removable;
+            } else {
+                UseSection (S);
+            }
+        }
+    }
+
+    /* Nothing to do if we don't have removable sections */
+    if (Removable == 0) {
+        CollDeleteAll (&UsedSections);
+        return;
+    }
+
+    /* Add the symbols needed by the linker and the assertions */
+    ForEachLinkerImport (UseExport);
+    ForEachAssertion (UseExpr);
+
+    /* Follow the references from all used sections */
+    while (CollCount (&UsedSections) > 0) {
+        Section* S = CollPop (&UsedSections);
+        Fragment* F = S->FragRoot;
+        while (F) {
+            if (F->Type == FRAG_EXPR || F->Type == FRAG_SEXPR) {
+                UseExpr (F->Expr);
+            }
+            F = F->Next;
+        }
+    }
+
+    /* Remove the marks from the exports */
+    for (I = 0; I < CollCount (&UsedExports); ++I) {
+        UnmarkExport (CollAtUnchecked (&UsedExports, I));
+    }
+    CollDeleteAll (&UsedExports);
+
+    /* Remove the unused sections from the segments and recalculate the
+    ** offsets of the remaining ones.
+    */
+    for (I = 0; I < CollCount (&SegmentList); ++I) {
+        Segment* Seg = CollAtUnchecked (&SegmentList, I);
+        unsigned long Size = 0;
+        J = 0;
+        while (J < CollCount (&Seg->Sections)) {
+            Section* S = CollAtUnchecked (&Seg->Sections, J);
+            if (SectionIsRemoved (S)) {
+                Print (stdout, 1, "Removing unused section of segment '%s' "
+                       "in module '%s' (%lu bytes)\n",
+                       GetString (Seg->Name), GetObjFileName (S->Obj), S->Size);
+                CollDelete (&Seg->Sections, J);
+            } else {
+                S->Fill = AlignCount (Size, S->Alignment);
+                S->Offs = Size + S->Fill;
+                Size = S->Offs + S->Size;
+                ++J;
+            }
+        }
+        Seg->Size = Size;
+    }
+}
+
+
+
 int IsBSSType (Segment* S)
 /* Check if the given segment is a BSS style segment, that is, it does not
 ** contain non-zero data.
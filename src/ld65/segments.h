@@ -43,6 +43,7 @@
 /* common */
 #include "coll.h"
 #include "exprdefs.h"
+#include "filebuf.h"
 
 
 
@@ -90,6 +91,8 @@ struct Section {
     unsigned long       Fill;           /* Fill bytes for alignment */
     unsigned long       Alignment;      /* Alignment */
     unsigned char       AddrSize;       /* Address size of segment */
+    unsigned char       Removable;      /* Section may be removed if unused */
+    unsigned char       Used;           /* Section is referenced */
 };
 
 
@@ -125,12 +128,28 @@ Segment* GetSegment (unsigned Name, unsigned char AddrSize, const char* ObjName)
 Section* NewSection (Segment* Seg, unsigned long Alignment, unsigned char AddrSize);
 /* Create a new section for the given segment */
 
-Section* ReadSection (FILE* F, struct ObjData* O);
+Section* ReadSection (FileBuf* F, struct ObjData* O);
 /* Read a section from a file */
 
 Segment* SegFind (unsigned Name);
 /* Return the given segment or NULL if not found. */
 
+void RemoveUnusedSections (void);
+/* Remove all removable sections that cannot be reached from the sections
+** that must be kept, the symbols imported by the linker or the config file,
+** or the assertions. The offsets of the remaining sections are adjusted.
+*/
+
+#if defined(HAVE_INLINE)
+INLINE int SectionIsRemoved (const Section* S)
+/* Return true if the section was removed because it is unused */
+{
+    return S->Removable && !S->Used;
+}
+#else
+#  define SectionIsRemoved(S)   ((S)->Removable && !(S)->Used)
+#endif
+
 int IsBSSType (Segment* S);
 /* Check if the given segment is a BSS style segment, that is, it does not
 ** contain non-zero data.
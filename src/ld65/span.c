@@ -84,7 +84,7 @@ static Span* NewSpan (unsigned Id)
 
 
 
-Span* ReadSpan (FILE* F, ObjData* O, unsigned Id)
+Span* ReadSpan (FileBuf* F, ObjData* O, unsigned Id)
 /* Read a Span from a file and return it */
 {
     unsigned Type;
@@ -109,7 +109,7 @@ Span* ReadSpan (FILE* F, ObjData* O, unsigned Id)
 
 
 
-unsigned* ReadSpanList (FILE* F)
+unsigned* ReadSpanList (FileBuf* F)
 /* Read a list of span ids from a file. The list is returned as an array of
 ** unsigneds, the first being the number of spans (never zero) followed by
 ** the span ids. If the number of spans is zero, NULL is returned.
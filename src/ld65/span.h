@@ -42,6 +42,7 @@
 
 /* common */
 #include "coll.h"
+#include "filebuf.h"
 
 
 
@@ -73,10 +74,10 @@ typedef struct Span Span;
 
 
 
-Span* ReadSpan (FILE* F, struct ObjData* O, unsigned Id);
+Span* ReadSpan (FileBuf* F, struct ObjData* O, unsigned Id);
 /* Read a Span from a file and return it */
 
-unsigned* ReadSpanList (FILE* F);
+unsigned* ReadSpanList (FileBuf* F);
 /* Read a list of span ids from a file. The list is returned as an array of
 ** unsigneds, the first being the number of spans (never zero) followed by
 ** the span ids. If the number of spans is zero, NULL is returned.
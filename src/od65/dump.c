@@ -121,7 +121,7 @@ static char* TimeToStr (unsigned long Time)
 
 
 
-static void SkipLineInfoList (FILE* F)
+static void SkipLineInfoList (FileBuf* F)
 /* Skip a line info list from the given file */
 {
     /* Count preceeds the list */
@@ -135,7 +135,7 @@ static void SkipLineInfoList (FILE* F)
 
 
 
-static void SkipSpanList (FILE* F)
+static void SkipSpanList (FileBuf* F)
 /* Skip a span list from the given file */
 {
     /* Count preceeds the list */
@@ -149,7 +149,7 @@ static void SkipSpanList (FILE* F)
 
 
 
-static void SkipExpr (FILE* F)
+static void SkipExpr (FileBuf* F)
 /* Skip an expression from the given file */
 {
     /* Read the node tag and handle NULL nodes */
@@ -264,7 +264,7 @@ static const char* GetScopeType (unsigned Type)
 
 
 
-void DumpObjHeader (FILE* F, unsigned long Offset)
+void DumpObjHeader (FileBuf* F, unsigned long Offset)
 /* Dump the header of the given object file */
 {
     ObjHeader H;
@@ -326,7 +326,7 @@ void DumpObjHeader (FILE* F, unsigned long Offset)
 
 
 
-void DumpObjOptions (FILE* F, unsigned long Offset)
+void DumpObjOptions (FileBuf* F, unsigned long Offset)
 /* Dump the file options */
 {
     ObjHeader  H;
@@ -414,7 +414,7 @@ void DumpObjOptions (FILE* F, unsigned long Offset)
 
 
 
-void DumpObjFiles (FILE* F, unsigned long Offset)
+void DumpObjFiles (FileBuf* F, unsigned long Offset)
 /* Dump the source files */
 {
     ObjHeader  H;
@@ -464,7 +464,7 @@ void DumpObjFiles (FILE* F, unsigned long Offset)
 
 
 
-void DumpObjSegments (FILE* F, unsigned long Offset)
+void DumpObjSegments (FileBuf* F, unsigned long Offset)
 /* Dump the segments in the object file */
 {
     ObjHeader  H;
@@ -495,7 +495,7 @@ void DumpObjSegments (FILE* F, unsigned long Offset)
 
         /* Read the data for one segments */
         unsigned long DataSize  = Read32 (F);
-        unsigned long NextSeg   = ftell (F) + DataSize;
+        unsigned long NextSeg   = FileGetPos (F) + DataSize;
         const char*   Name      = GetString (&StrPool, ReadVar (F));
         unsigned      Len       = strlen (Name);
         unsigned      Flags     = ReadVar (F);
@@ -526,7 +526,7 @@ void DumpObjSegments (FILE* F, unsigned long Offset)
 
 
 
-void DumpObjImports (FILE* F, unsigned long Offset)
+void DumpObjImports (FileBuf* F, unsigned long Offset)
 /* Dump the imports in the object file */
 {
     ObjHeader  H;
@@ -579,7 +579,7 @@ void DumpObjImports (FILE* F, unsigned long Offset)
 
 
 
-void DumpObjExports (FILE* F, unsigned long Offset)
+void DumpObjExports (FileBuf* F, unsigned long Offset)
 /* Dump the exports in the object file */
 {
     ObjHeader   H;
@@ -656,7 +656,7 @@ void DumpObjExports (FILE* F, unsigned long Offset)
 
 
 
-void DumpObjDbgSyms (FILE* F, unsigned long Offset)
+void DumpObjDbgSyms (FileBuf* F, unsigned long Offset)
 /* Dump the debug symbols from an object file */
 {
     ObjHeader   H;
@@ -751,7 +751,7 @@ void DumpObjDbgSyms (FILE* F, unsigned long Offset)
 
 
 
-void DumpObjLineInfo (FILE* F, unsigned long Offset)
+void DumpObjLineInfo (FileBuf* F, unsigned long Offset)
 /* Dump the line info from an object file */
 {
     ObjHeader   H;
@@ -816,7 +816,7 @@ void DumpObjLineInfo (FILE* F, unsigned long Offset)
 
 
 
-void DumpObjScopes (FILE* F, unsigned long Offset)
+void DumpObjScopes (FileBuf* F, unsigned long Offset)
 /* Dump the scopes from an object file */
 {
     ObjHeader   H;
@@ -897,7 +897,7 @@ void DumpObjScopes (FILE* F, unsigned long Offset)
 
 
 
-void DumpObjSegSize (FILE* F, unsigned long Offset)
+void DumpObjSegSize (FileBuf* F, unsigned long Offset)
 /* Dump the sizes of the segment in the object file */
 {
     ObjHeader   H;
@@ -928,7 +928,7 @@ void DumpObjSegSize (FILE* F, unsigned long Offset)
 
         /* Read the data for one segment */
         unsigned long DataSize = Read32 (F);
-        unsigned long NextSeg  = ftell (F) + DataSize;
+        unsigned long NextSeg  = FileGetPos (F) + DataSize;
         const char*   Name     = GetString (&StrPool, ReadVar (F));
         unsigned      Len      = strlen (Name);
 
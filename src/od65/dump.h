@@ -33,12 +33,13 @@
 
 
 
-#include <stdio.h>
+#ifndef DUMP_H
+#define DUMP_H
 
 
 
-#ifndef DUMP_H
-#define DUMP_H
+/* common */
+#include "filebuf.h"
 
 
 
@@ -48,34 +49,34 @@
 
 
 
-void DumpObjHeader (FILE* F, unsigned long Offset);
+void DumpObjHeader (FileBuf* F, unsigned long Offset);
 /* Dump the header of the given object file */
 
-void DumpObjOptions (FILE* F, unsigned long Offset);
+void DumpObjOptions (FileBuf* F, unsigned long Offset);
 /* Dump the file options */
 
-void DumpObjFiles (FILE* F, unsigned long Offset);
+void DumpObjFiles (FileBuf* F, unsigned long Offset);
 /* Dump the source files */
 
-void DumpObjSegments (FILE* F, unsigned long Offset);
+void DumpObjSegments (FileBuf* F, unsigned long Offset);
 /* Dump the segments in the object file */
 
-void DumpObjImports (FILE* F, unsigned long Offset);
+void DumpObjImports (FileBuf* F, unsigned long Offset);
 /* Dump the imports in the object file */
 
-void DumpObjExports (FILE* F, unsigned long Offset);
+void DumpObjExports (FileBuf* F, unsigned long Offset);
 /* Dump the exports in the object file */
 
-void DumpObjDbgSyms (FILE* F, unsigned long Offset);
+void DumpObjDbgSyms (FileBuf* F, unsigned long Offset);
 /* Dump the debug symbols from an object file */
 
-void DumpObjLineInfo (FILE* F, unsigned long Offset);
+void DumpObjLineInfo (FileBuf* F, unsigned long Offset);
 /* Dump the line infos from an object file */
 
-void DumpObjScopes (FILE* F, unsigned long Offset);
+void DumpObjScopes (FileBuf* F, unsigned long Offset);
 /* Dump the scopes from an object file */
 
-void DumpObjSegSize (FILE* F, unsigned long Offset);
+void DumpObjSegSize (FileBuf* F, unsigned long Offset);
 /* Dump the sizes of the segment in the object file */
 
 
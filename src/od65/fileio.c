@@ -34,13 +34,11 @@
 
 
 #include <string.h>
-#include <errno.h>
 
 /* common */
 #include "xmalloc.h"
 
 /* od65 */
-#include "error.h"
 #include "fileio.h"
 
 
@@ -51,123 +49,16 @@
 
 
 
-void FileSetPos (FILE* F, unsigned long Pos)
-/* Seek to the given absolute position, fail on errors */
-{                 
-    if (fseek (F, Pos, SEEK_SET) != 0) {
-        Error ("Cannot seek: %s", strerror (errno));
-    }
-}
-
-
-
-unsigned long FileGetPos (FILE* F)
-/* Return the current file position, fail on errors */
-{
-    long Pos = ftell (F);
-    if (Pos < 0) {
-        Error ("Error in ftell: %s", strerror (errno));
-    }
-    return Pos;
-}
-
-
-
-unsigned Read8 (FILE* F)
-/* Read an 8 bit value from the file */
-{
-    int C = getc (F);
-    if (C == EOF) {
-        Error ("Read error (file corrupt?)");
-    }
-    return C;
-}
-
-
-
-unsigned Read16 (FILE* F)
-/* Read a 16 bit value from the file */
-{
-    unsigned Lo = Read8 (F);
-    unsigned Hi = Read8 (F);
-    return (Hi << 8) | Lo;
-}
-
-
-
-unsigned long Read24 (FILE* F)
-/* Read a 24 bit value from the file */
-{
-    unsigned long Lo = Read16 (F);
-    unsigned long Hi = Read8 (F);
-    return (Hi << 16) | Lo;
-}
-
-
-
-unsigned long Read32 (FILE* F)
-/* Read a 32 bit value from the file */
-{
-    unsigned long Lo = Read16 (F);
-    unsigned long Hi = Read16 (F);
-    return (Hi << 16) | Lo;
-}
-
-
-
-long Read32Signed (FILE* F)
-/* Read a 32 bit value from the file. Sign extend the value. */
-{
-    /* Read a 32 bit value */
-    unsigned long V = Read32 (F);
-
-    /* Sign extend the value */
-    if (V & 0x80000000UL) {
-        /* Signed value */
-        V |= ~0xFFFFFFFFUL;
-    }
-
-    /* Return it as a long */
-    return (long) V;
-}
-
-
-
-unsigned long ReadVar (FILE* F)
-/* Read a variable size value from the file */
-{
-    /* The value was written to the file in 7 bit chunks LSB first. If there
-    ** are more bytes, bit 8 is set, otherwise it is clear.
-    */
-    unsigned char C;
-    unsigned long V = 0;
-    unsigned Shift = 0;
-    do {
-        /* Read one byte */
-        C = Read8 (F);
-        /* Encode it into the target value */
-        V |= ((unsigned long)(C & 0x7F)) << Shift;
-        /* Next value */
-        Shift += 7;
-    } while (C & 0x80);
-
-    /* Return the value read */
-    return V;
-}
-
-
-
-char* ReadStr (FILE* F)
+char* ReadStr (FileBuf* F)
 /* Read a string from the file into a malloced area */
 {
-    /* Read the length */
-    unsigned Len = ReadVar (F);
+    /* Read the string */
+    StrBuf S;
+    unsigned Len = SB_GetLen (ReadStrBuf (F, &S));
 
-    /* Allocate memory */
+    /* Allocate memory and copy the string */
     char* Str = xmalloc (Len + 1);
-
-    /* Read the string itself */
-    ReadData (F, Str, Len);
+    memcpy (Str, SB_GetConstBuf (&S), Len);
 
     /* Terminate the string and return it */
     Str [Len] = '\0';
@@ -176,7 +67,7 @@ char* ReadStr (FILE* F)
 
 
 
-FilePos* ReadFilePos (FILE* F, FilePos* Pos)
+FilePos* ReadFilePos (FileBuf* F, FilePos* Pos)
 /* Read a file position from the file */
 {
     /* Read the data fields */
@@ -188,21 +79,7 @@ FilePos* ReadFilePos (FILE* F, FilePos* Pos)
 
 
 
-void* ReadData (FILE* F, void* Data, unsigned Size)
-/* Read data from the file */
-{
-    /* Accept zero sized reads */
-    if (Size > 0) {
-        if (fread (Data, 1, Size, F) != Size) {
-            Error ("Read error (file corrupt?)");
-        }
-    }
-    return Data;
-}
-
-
-
-void ReadObjHeader (FILE* F, ObjHeader* H)
+void ReadObjHeader (FileBuf* F, ObjHeader* H)
 /* Read an object file header from the file */
 {
     /* Read all fields */
@@ -235,7 +112,7 @@ void ReadObjHeader (FILE* F, ObjHeader* H)
 
 
 
-void ReadStrPool (FILE* F, Collection* C)
+void ReadStrPool (FileBuf* F, Collection* C)
 /* Read a string pool from the current position into C. */
 {
     /* The number of strings is the first item */
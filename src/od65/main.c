@@ -220,7 +220,7 @@ static void DumpFile (const char* Name)
     unsigned long Magic;
 
     /* Try to open the file */
-    FILE* F = fopen (Name, "rb");
+    FileBuf* F = FB_Open (Name);
     if (F == 0) {
         Error ("Cannot open '%s': %s", Name, strerror (errno));
     }
@@ -278,7 +278,7 @@ static void DumpFile (const char* Name)
     }
 
     /* Close the file */
-    fclose (F);
+    FB_Close (F);
 }
 
 
@@ -65,7 +65,7 @@ static CPURegs Regs;
 static unsigned Cycles;
 
 /* Total number of CPU cycles exec'd */
-static unsigned long TotalCycles;
+static uint64_t TotalCycles;
 
 /* NMI request active */
 static unsigned HaveNMIRequest;
@@ -3286,7 +3286,7 @@ unsigned ExecuteInsn (void)
 
 
 
-unsigned long GetCycles (void)
+uint64_t GetCycles (void)
 /* Return the total number of cycles executed */
 {
     /* Return the total number of cycles */
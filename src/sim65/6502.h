@@ -38,6 +38,11 @@
 
 
 
+/* common */
+#include "inttypes.h"
+
+
+
 /*****************************************************************************/
 /*                                   Data                                    */
 /*****************************************************************************/
@@ -96,7 +101,7 @@ unsigned ExecuteInsn (void);
 ** executed instruction.
 */
 
-unsigned long GetCycles (void);
+uint64_t GetCycles (void);
 /* Return the total number of clock cycles executed */
 
 extern int PrintCycles;
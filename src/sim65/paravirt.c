@@ -58,11 +58,13 @@
 
 /* common */
 #include "cmdline.h"
+#include "coll.h"
 #include "print.h"
 #include "xmalloc.h"
 
 /* sim65 */
 #include "6502.h"
+#include "error.h"
 #include "memory.h"
 #include "paravirt.h"
 
@@ -79,6 +81,19 @@ typedef void (*PVFunc) (CPURegs* Regs);
 static unsigned ArgStart;
 static unsigned char SPAddr;
 
+/* A timing region */
+typedef struct Region Region;
+struct Region {
+    uint64_t            Count;          /* Number of times the region ran */
+    uint64_t            Total;          /* Total cycles spent in the region */
+    uint64_t            Start;          /* Cycle count when last started */
+    int                 Running;        /* True if the region is running */
+    char                Name[1];        /* Name, dynamically allocated */
+};
+
+/* All timing regions in the order they were first started */
+static Collection Regions = STATIC_COLLECTION_INITIALIZER;
+
 
 
 /*****************************************************************************/
@@ -120,11 +135,88 @@ static unsigned PopParam (unsigned char Incr)
 
 
 
+static void ReadName (char* Name, unsigned Size, unsigned Addr)
+/* Read a zero terminated string from simulated memory, truncate it to Size */
+{
+    unsigned I = 0;
+    while ((Name[I] = MemReadByte (Addr++)) != '\0') {
+        if (++I == Size - 1) {
+            Name[I] = '\0';
+            break;
+        }
+    }
+}
+
+
+
+static Region* FindRegion (const char* Name)
+/* Find a region by name, return NULL if there is none */
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&Regions); ++I) {
+        Region* R = CollAtUnchecked (&Regions, I);
+        if (strcmp (R->Name, Name) == 0) {
+            return R;
+        }
+    }
+    return 0;
+}
+
+
+
+static const char* Dec64 (char* Buf, uint64_t Val)
+/* Format Val as a decimal number at the end of Buf, which must hold 21 chars.
+** Return a pointer to the number. Not every host library has a printf format
+** for 64 bit numbers.
+*/
+{
+    char* P = Buf + 20;
+    *P = '\0';
+    do {
+        *--P = (char) ('0' + (unsigned) (Val % 10));
+        Val /= 10;
+    } while (Val);
+    return P;
+}
+
+
+
+static void PrintRegions (void)
+/* Print the statistics for all timing regions. Regions that are still
+** running are stopped.
+*/
+{
+    char Count[21], Total[21], Avg[21];
+    unsigned I;
+
+    if (CollCount (&Regions) == 0) {
+        return;
+    }
+
+    Print (stdout, 0, "%-32s %10s %14s %12s\n",
+           "Region", "Count", "Cycles", "Cycles/Run");
+    for (I = 0; I < CollCount (&Regions); ++I) {
+        Region* R = CollAtUnchecked (&Regions, I);
+        if (R->Running) {
+            R->Total += GetCycles () - R->Start;
+            ++R->Count;
+        }
+        Print (stdout, 0, "%-32s %10s %14s %12s\n",
+               R->Name, Dec64 (Count, R->Count), Dec64 (Total, R->Total),
+               Dec64 (Avg, R->Total / R->Count));
+    }
+}
+
+
+
 static void PVExit (CPURegs* Regs)
 {
+    char Cycles[21];
+
     Print (stderr, 1, "PVExit ($%02X)\n", Regs->AC);
+    PrintRegions ();
     if (PrintCycles) {
-        Print (stdout, 0, "%lu cycles\n", GetCycles ());
+        Print (stdout, 0, "%s cycles\n", Dec64 (Cycles, GetCycles ()));
     }
 
     exit (Regs->AC);
@@ -294,7 +386,73 @@ static void PVWrite (CPURegs* Regs)
 
 
 
+static void PVCycles (CPURegs* Regs)
+{
+    uint64_t Cycles = GetCycles ();
+    unsigned Addr = GetAX (Regs);
+    unsigned I;
+
+    Print (stderr, 2, "PVCycles ($%04X)\n", Addr);
+
+    /* Store the cycle count as a little endian 64 bit number */
+    for (I = 0; I < 8; ++I) {
+        MemWriteByte (Addr++, (unsigned char) Cycles);
+        Cycles >>= 8;
+    }
+}
+
+
+
+static void PVRegionStart (CPURegs* Regs)
+{
+    char Name[256];
+    Region* R;
+
+    ReadName (Name, sizeof (Name), GetAX (Regs));
+
+    Print (stderr, 2, "PVRegionStart (\"%s\")\n", Name);
+
+    R = FindRegion (Name);
+    if (R == 0) {
+        R = xmalloc (sizeof (Region) + strlen (Name));
+        R->Count   = 0;
+        R->Total   = 0;
+        R->Running = 0;
+        strcpy (R->Name, Name);
+        CollAppend (&Regions, R);
+    } else if (R->Running) {
+        Error ("Region '%s' started while running", Name);
+    }
+    R->Running = 1;
+    R->Start   = GetCycles ();
+}
+
+
+
+static void PVRegionStop (CPURegs* Regs)
+{
+    char Name[256];
+    Region* R;
+
+    ReadName (Name, sizeof (Name), GetAX (Regs));
+
+    Print (stderr, 2, "PVRegionStop (\"%s\")\n", Name);
+
+    R = FindRegion (Name);
+    if (R == 0 || !R->Running) {
+        Error ("Region '%s' stopped without being started", Name);
+    }
+    R->Total  += GetCycles () - R->Start;
+    R->Running = 0;
+    ++R->Count;
+}
+
+
+
 static const PVFunc Hooks[] = {
+    PVCycles,
+    PVRegionStart,
+    PVRegionStop,
     PVOpen,
     PVClose,
     PVRead,
@@ -0,0 +1,6 @@
+; .incbin test: the whole file, from an offset, and a slice of the file
+
+        .incbin "6502-opcodes.ref"
+        .incbin "6502-opcodes.ref", 16
+        .byte   $EA
+        .incbin "6502-opcodes.ref", 4, 8
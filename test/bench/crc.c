@@ -0,0 +1,72 @@
+/*
+  !!DESCRIPTION!! benchmark: CRC-16 and CRC-32 checksums
+  !!ORIGIN!!      cc65 benchmarks
+  !!LICENCE!!     Public Domain
+*/
+
+/*
+  Bitwise CRC calculation: shifts, xor and 32 bit arithmetic.
+*/
+
+#define LEN     512
+
+/* Expected results */
+#define CRC16   0x7D1BU
+#define CRC32   0x0F498B0EUL
+
+static unsigned char data[LEN];
+
+static unsigned crc16 (const unsigned char* p, unsigned len)
+{
+    unsigned crc = 0xFFFF;
+    unsigned char bit;
+
+    while (len--) {
+        crc ^= (unsigned) *p++ << 8;
+        for (bit = 0; bit < 8; ++bit) {
+            if (crc & 0x8000) {
+                crc = (crc << 1) ^ 0x1021;
+            } else {
+                crc <<= 1;
+            }
+        }
+    }
+    return crc;
+}
+
+static unsigned long crc32 (const unsigned char* p, unsigned len)
+{
+    unsigned long crc = 0xFFFFFFFFUL;
+    unsigned char bit;
+
+    while (len--) {
+        crc ^= *p++;
+        for (bit = 0; bit < 8; ++bit) {
+            if (crc & 1) {
+                crc = (crc >> 1) ^ 0xEDB88320UL;
+            } else {
+                crc >>= 1;
+            }
+        }
+    }
+    return ~crc;
+}
+
+int main (void)
+{
+    unsigned i;
+    unsigned char failures = 0;
+
+    for (i = 0; i < LEN; ++i) {
+        data[i] = (unsigned char) (i * 7 + 3);
+    }
+
+    if (crc16 (data, LEN) != CRC16) {
+        ++failures;
+    }
+    if (crc32 (data, LEN) != CRC32) {
+        ++failures;
+    }
+
+    return failures;
+}
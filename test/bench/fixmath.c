@@ -0,0 +1,78 @@
+/*
+  !!DESCRIPTION!! benchmark: fixed point arithmetic
+  !!ORIGIN!!      cc65 benchmarks
+  !!LICENCE!!     Public Domain
+*/
+
+/*
+  A small Mandelbrot set in 5.11 fixed point with 32 bit products, and a
+  16.16 fixed point dot product.
+*/
+
+#define WIDTH   24
+#define HEIGHT  16
+#define MAXITER 16
+#define FRAC    11
+
+/* Expected results */
+#define TOTAL   3096U
+#define DOT     31719424L
+
+static unsigned char image[HEIGHT][WIDTH];
+static long vec[16];
+
+static unsigned char mandel (int cr, int ci)
+{
+    int zr = 0;
+    int zi = 0;
+    long zr2, zi2;
+    unsigned char i;
+
+    for (i = 0; i < MAXITER; ++i) {
+        zr2 = ((long) zr * zr) >> FRAC;
+        zi2 = ((long) zi * zi) >> FRAC;
+        if (zr2 + zi2 > (4L << FRAC)) {
+            break;
+        }
+        zi = (int) ((((long) zr * zi) >> (FRAC - 1)) + ci);
+        zr = (int) (zr2 - zi2 + cr);
+    }
+    return i;
+}
+
+static long dot (const long* a, const long* b, unsigned char n)
+{
+    long sum = 0;
+
+    while (n--) {
+        sum += ((*a++ >> 8) * (*b++ >> 8));
+    }
+    return sum;
+}
+
+int main (void)
+{
+    unsigned char x, y;
+    unsigned total = 0;
+    unsigned char failures = 0;
+
+    for (y = 0; y < HEIGHT; ++y) {
+        for (x = 0; x < WIDTH; ++x) {
+            /* Real part -2.0 to 1.0, imaginary part -1.0 to 1.0 */
+            image[y][x] = mandel ((int) x * 256 - 4096, (int) y * 256 - 2048);
+            total += image[y][x];
+        }
+    }
+    if (total != TOTAL) {
+        ++failures;
+    }
+
+    for (x = 0; x < 16; ++x) {
+        vec[x] = ((long) x << 16) - 0x48000L;
+    }
+    if (dot (vec, vec, 16) != DOT) {
+        ++failures;
+    }
+
+    return failures;
+}
@@ -0,0 +1,68 @@
+/*
+  !!DESCRIPTION!! benchmark: block copies and compares
+  !!ORIGIN!!      cc65 benchmarks
+  !!LICENCE!!     Public Domain
+*/
+
+/*
+  memcpy, memmove, memset and memcmp with different lengths, and struct
+  assignments.
+*/
+
+#include <string.h>
+
+#define LEN     1024
+#define ITER    4
+
+/* Expected result */
+#define SUM     2511547UL
+
+struct rec {
+    unsigned        id;
+    unsigned char   tag[6];
+    long            value;
+};
+
+static unsigned char src[LEN];
+static unsigned char dst[LEN + ITER];
+static struct rec recs[32];
+
+int main (void)
+{
+    unsigned i, n, iter;
+    unsigned long sum = 0;
+    struct rec r;
+
+    for (i = 0; i < LEN; ++i) {
+        src[i] = (unsigned char) (i ^ (i >> 3));
+    }
+
+    for (iter = 0; iter < ITER; ++iter) {
+        memset (dst, iter, LEN);
+        for (n = 1; n < LEN; n += n + 1) {
+            memcpy (dst + iter, src, n);
+            memmove (dst + 1, dst, n / 2);
+            memmove (dst, dst + 3, n / 2);
+            sum += memcmp (dst, src, n) < 0;
+        }
+        for (i = 0; i < 32; ++i) {
+            r.id = i + iter;
+            memcpy (r.tag, src + i, sizeof (r.tag));
+            r.value = (long) i * 1000 + iter;
+            recs[i] = r;
+        }
+        for (i = 1; i < 32; ++i) {
+            r = recs[i];
+            recs[i] = recs[i - 1];
+            recs[i - 1] = r;
+        }
+        for (i = 0; i < LEN; ++i) {
+            sum += dst[i];
+        }
+        for (i = 0; i < 32; ++i) {
+            sum += recs[i].id + recs[i].tag[5] + (unsigned) recs[i].value;
+        }
+    }
+
+    return sum != SUM;
+}
@@ -0,0 +1,38 @@
+/*
+  !!DESCRIPTION!! benchmark: sieve of Eratosthenes
+  !!ORIGIN!!      cc65 benchmarks
+  !!LICENCE!!     Public Domain
+*/
+
+/*
+  The classic byte sieve. Array indexing in loops and byte stores.
+*/
+
+#define SIZE    8190
+#define ITER    2
+
+static unsigned char flags[SIZE + 1];
+
+int main (void)
+{
+    unsigned i, k, prime, count, iter;
+
+    count = 0;
+    for (iter = 0; iter < ITER; ++iter) {
+        count = 0;
+        for (i = 0; i <= SIZE; ++i) {
+            flags[i] = 1;
+        }
+        for (i = 0; i <= SIZE; ++i) {
+            if (flags[i]) {
+                prime = i + i + 3;
+                for (k = i + prime; k <= SIZE; k += prime) {
+                    flags[k] = 0;
+                }
+                ++count;
+            }
+        }
+    }
+
+    return count != 1899;
+}
@@ -0,0 +1,90 @@
+/*
+  !!DESCRIPTION!! benchmark: sorting
+  !!ORIGIN!!      cc65 benchmarks
+  !!LICENCE!!     Public Domain
+*/
+
+/*
+  qsort with a compare callback, and an insertion sort with pointer
+  arithmetic.
+*/
+
+#include <stdlib.h>
+
+#define COUNT   300
+
+/* Expected results */
+#define FIRST   254U
+#define LAST    65464U
+
+static unsigned values[COUNT];
+static unsigned seed;
+
+static unsigned rnd (void)
+{
+    seed = seed * 25173U + 13849U;
+    return seed;
+}
+
+static void fill (void)
+{
+    unsigned i;
+
+    seed = 1;
+    for (i = 0; i < COUNT; ++i) {
+        values[i] = rnd ();
+    }
+}
+
+static int compare (const void* a, const void* b)
+{
+    unsigned x = *(const unsigned*) a;
+    unsigned y = *(const unsigned*) b;
+    return x < y ? -1 : x > y;
+}
+
+static void isort (unsigned* v, unsigned n)
+{
+    unsigned* p;
+    unsigned* q;
+    unsigned t;
+
+    for (p = v + 1; p < v + n; ++p) {
+        t = *p;
+        for (q = p; q > v && q[-1] > t; --q) {
+            *q = q[-1];
+        }
+        *q = t;
+    }
+}
+
+static unsigned char sorted (void)
+{
+    unsigned i;
+
+    for (i = 1; i < COUNT; ++i) {
+        if (values[i - 1] > values[i]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int main (void)
+{
+    unsigned char failures = 0;
+
+    fill ();
+    qsort (values, COUNT, sizeof (values[0]), compare);
+    if (!sorted () || values[0] != FIRST || values[COUNT - 1] != LAST) {
+        ++failures;
+    }
+
+    fill ();
+    isort (values, COUNT);
+    if (!sorted () || values[0] != FIRST || values[COUNT - 1] != LAST) {
+        ++failures;
+    }
+
+    return failures;
+}
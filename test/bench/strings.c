@@ -0,0 +1,92 @@
+/*
+  !!DESCRIPTION!! benchmark: string handling
+  !!ORIGIN!!      cc65 benchmarks
+  !!LICENCE!!     Public Domain
+*/
+
+/*
+  Splitting a text into words, character classification, and the string
+  functions of the library.
+*/
+
+#include <string.h>
+#include <ctype.h>
+
+#define ITER    3
+
+/* Expected results */
+#define WORDS   36
+#define DUPS    7
+#define LEN     124
+#define HASH    6235U
+
+static const char text[] =
+    "The quick brown fox jumps over the lazy dog. Pack my box with five "
+    "dozen liquor jugs! How vexingly quick daft zebras jump; the five "
+    "boxing wizards jump quickly. Sphinx of black quartz, judge my vow.";
+
+static char buf[sizeof (text)];
+static char words[40][16];
+static char line[128];
+
+static unsigned char split (void)
+{
+    char* p = buf;
+    char* w;
+    unsigned char n = 0;
+
+    strcpy (buf, text);
+    while (*p) {
+        while (*p && !isalpha (*p)) {
+            ++p;
+        }
+        w = p;
+        while (isalpha (*p)) {
+            if (isupper (*p)) {
+                *p += 'a' - 'A';
+            }
+            ++p;
+        }
+        if (p != w) {
+            if (*p) {
+                *p++ = '\0';
+            }
+            strncpy (words[n], w, sizeof (words[0]) - 1);
+            ++n;
+        }
+    }
+    return n;
+}
+
+int main (void)
+{
+    unsigned char i, j, n, iter;
+    unsigned dups = 0;
+    unsigned len = 0;
+    unsigned hash = 0;
+    const char* p;
+
+    for (iter = 0; iter < ITER; ++iter) {
+        n = split ();
+        dups = 0;
+        for (i = 0; i < n; ++i) {
+            for (j = i + 1; j < n; ++j) {
+                if (strcmp (words[i], words[j]) == 0) {
+                    ++dups;
+                }
+            }
+        }
+        line[0] = '\0';
+        for (i = 0; i < n && strlen (line) + strlen (words[i]) < sizeof (line) - 1; ++i) {
+            strcat (line, words[i]);
+            strcat (line, " ");
+        }
+        len = strlen (line);
+        hash = 0;
+        for (p = strchr (line, 'q'); p; p = strchr (p + 1, 'q')) {
+            hash = hash * 31 + (unsigned) (p - line);
+        }
+    }
+
+    return n != WORDS || dups != DUPS || len != LEN || hash != HASH;
+}
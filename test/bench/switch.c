@@ -0,0 +1,119 @@
+/*
+  !!DESCRIPTION!! benchmark: switch dispatch
+  !!ORIGIN!!      cc65 benchmarks
+  !!LICENCE!!     Public Domain
+*/
+
+/*
+  A small stack based bytecode interpreter with a dense switch statement.
+*/
+
+/* Expected result */
+#define TOTAL   6016U
+
+enum {
+    OP_PUSH,    /* Push the next byte */
+    OP_LOAD,    /* Push variable n */
+    OP_STORE,   /* Pop into variable n */
+    OP_ADD,
+    OP_SUB,
+    OP_AND,
+    OP_SHL,
+    OP_DUP,
+    OP_DROP,
+    OP_JNZ,     /* Pop, jump to address n if not zero */
+    OP_JMP,
+    OP_HALT
+};
+
+/* Sums of the first fibonacci numbers, repeated for each value of the outer
+** counter. Variables: 0 = outer counter, 1 = a, 2 = b, 3 = sum, 4 = total,
+** 5 = inner counter.
+*/
+static const unsigned char prog[] = {
+    OP_PUSH, 40, OP_STORE, 0,               /*  0: counter = 40 */
+    OP_PUSH, 0, OP_STORE, 4,                /*  4: total = 0 */
+    OP_PUSH, 0, OP_STORE, 1,                /*  8: a = 0 */
+    OP_PUSH, 1, OP_STORE, 2,                /* 12: b = 1 */
+    OP_PUSH, 0, OP_STORE, 3,                /* 16: sum = 0 */
+    OP_PUSH, 24, OP_STORE, 5,               /* 20: n = 24 */
+    OP_LOAD, 3, OP_LOAD, 2, OP_ADD,         /* 24: sum += b */
+    OP_STORE, 3,
+    OP_LOAD, 1, OP_LOAD, 2, OP_DUP,         /* 31: a, b = b, a + b */
+    OP_STORE, 1, OP_ADD, OP_STORE, 2,
+    OP_LOAD, 5, OP_PUSH, 1, OP_SUB, OP_DUP, /* 41: while (--n) */
+    OP_STORE, 5, OP_JNZ, 24,
+    OP_LOAD, 4, OP_LOAD, 3,                 /* 51: total += sum & 0x7FFF */
+    OP_PUSH, 0xFF, OP_PUSH, 7, OP_SHL,
+    OP_PUSH, 0x7F, OP_ADD, OP_AND, OP_ADD,
+    OP_STORE, 4,
+    OP_LOAD, 0, OP_PUSH, 1, OP_SUB, OP_DUP, /* 67: while (--counter) */
+    OP_STORE, 0, OP_JNZ, 8,
+    OP_HALT
+};
+
+static unsigned vars[8];
+static unsigned stack[16];
+
+static unsigned run (const unsigned char* code)
+{
+    const unsigned char* pc = code;
+    unsigned* sp = stack;
+    unsigned v;
+
+    while (1) {
+        switch (*pc++) {
+            case OP_PUSH:
+                *sp++ = *pc++;
+                break;
+            case OP_LOAD:
+                *sp++ = vars[*pc++];
+                break;
+            case OP_STORE:
+                vars[*pc++] = *--sp;
+                break;
+            case OP_ADD:
+                v = *--sp;
+                sp[-1] += v;
+                break;
+            case OP_SUB:
+                v = *--sp;
+                sp[-1] -= v;
+                break;
+            case OP_AND:
+                v = *--sp;
+                sp[-1] &= v;
+                break;
+            case OP_SHL:
+                v = *--sp;
+                sp[-1] <<= v;
+                break;
+            case OP_DUP:
+                *sp = sp[-1];
+                ++sp;
+                break;
+            case OP_DROP:
+                --sp;
+                break;
+            case OP_JNZ:
+                if (*--sp) {
+                    pc = code + *pc;
+                } else {
+                    ++pc;
+                }
+                break;
+            case OP_JMP:
+                pc = code + *pc;
+                break;
+            case OP_HALT:
+                return vars[4];
+            default:
+                return 0;
+        }
+    }
+}
+
+int main (void)
+{
+    return run (prog) != TOTAL;
+}
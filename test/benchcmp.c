@@ -0,0 +1,209 @@
+/* Collects the results of the benchmarks and compares them with a baseline.
+**
+** Usage: benchcmp [-t percent] [-r reffile] [-o outfile] name...
+**
+** For each name, the code size is read from the CODE segment in name.map,
+** and the number of cycles from the "cycles" line that sim65 --cycles
+** writes to name.out. The results are written to the output file as a
+** table with one line per benchmark. If a reference file is given, each
+** result is compared with the line of the same name. The program fails if
+** the code size or the number of cycles of a benchmark grew by more than
+** the given percentage (default 2).
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#define MAX_NAME        64
+#define MAX_LINE        256
+
+typedef struct {
+    char            Name[MAX_NAME];
+    unsigned long   Code;
+    unsigned long   Cycles;
+} Result;
+
+static const char* BaseName (const char* Path)
+/* Return the name part of a path */
+{
+    const char* P = strrchr (Path, '/');
+    const char* Q = strrchr (Path, '\\');
+    if (Q > P) {
+        P = Q;
+    }
+    return P ? P + 1 : Path;
+}
+
+static FILE* OpenFile (const char* Name, const char* Ext, const char* Mode)
+/* Open the file Name + Ext, exit on errors */
+{
+    char  Path[MAX_LINE];
+    FILE* F;
+
+    sprintf (Path, "%.*s%s", MAX_LINE - 8, Name, Ext);
+    F = fopen (Path, Mode);
+    if (F == 0) {
+        fprintf (stderr, "benchcmp: Cannot open '%s'\n", Path);
+        exit (EXIT_FAILURE);
+    }
+    return F;
+}
+
+static int ReadResult (const char* Name, Result* R)
+/* Read the results of one benchmark. Returns false on errors. */
+{
+    char          Line[MAX_LINE];
+    char          Seg[MAX_LINE];
+    unsigned long Start, End, Size;
+    FILE*         F;
+    int           Found;
+
+    sprintf (R->Name, "%.*s", MAX_NAME - 1, BaseName (Name));
+
+    /* Get the size of the CODE segment from the map file */
+    F = OpenFile (Name, ".map", "r");
+    Found = 0;
+    while (fgets (Line, sizeof (Line), F)) {
+        if (sscanf (Line, "%s %lx %lx %lx", Seg, &Start, &End, &Size) == 4 &&
+            strcmp (Seg, "CODE") == 0) {
+            R->Code = Size;
+            Found = 1;
+            break;
+        }
+    }
+    fclose (F);
+    if (!Found) {
+        fprintf (stderr, "benchcmp: No CODE segment in '%s.map'\n", Name);
+        return 0;
+    }
+
+    /* Get the cycles from the output of the simulator */
+    F = OpenFile (Name, ".out", "r");
+    Found = 0;
+    while (fgets (Line, sizeof (Line), F)) {
+        if (sscanf (Line, "%lu %s", &R->Cycles, Seg) == 2 &&
+            strcmp (Seg, "cycles") == 0) {
+            Found = 1;
+        }
+    }
+    fclose (F);
+    if (!Found) {
+        fprintf (stderr, "benchcmp: No cycle count in '%s.out'\n", Name);
+        return 0;
+    }
+    return 1;
+}
+
+static int FindRef (FILE* F, const char* Name, Result* R)
+/* Search the reference file for the results of a benchmark */
+{
+    char Line[MAX_LINE];
+
+    rewind (F);
+    while (fgets (Line, sizeof (Line), F)) {
+        if (Line[0] != '#' &&
+            sscanf (Line, "%63s %lu %lu", R->Name, &R->Code, &R->Cycles) == 3 &&
+            strcmp (R->Name, Name) == 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static double Change (unsigned long Old, unsigned long New)
+/* Return the change from Old to New in percent */
+{
+    return Old ? ((double) New - (double) Old) * 100.0 / (double) Old : 0.0;
+}
+
+int main (int argc, char* argv[])
+{
+    const char*   RefName = 0;
+    const char*   OutName = 0;
+    double        Threshold = 2.0;
+    FILE*         Ref = 0;
+    FILE*         Out = stdout;
+    unsigned      Regressions = 0;
+    unsigned      Missing = 0;
+    unsigned long OldCycles = 0, NewCycles = 0;
+    unsigned long OldCode = 0, NewCode = 0;
+    int           I;
+
+    for (I = 1; I < argc && argv[I][0] == '-'; I += 2) {
+        if (I + 1 >= argc) {
+            fprintf (stderr, "benchcmp: Option '%s' needs an argument\n", argv[I]);
+            return EXIT_FAILURE;
+        }
+        switch (argv[I][1]) {
+            case 't':   Threshold = atof (argv[I+1]);   break;
+            case 'r':   RefName = argv[I+1];            break;
+            case 'o':   OutName = argv[I+1];            break;
+            default:
+                fprintf (stderr, "benchcmp: Invalid option '%s'\n", argv[I]);
+                return EXIT_FAILURE;
+        }
+    }
+
+    if (RefName) {
+        Ref = fopen (RefName, "r");
+        if (Ref == 0) {
+            fprintf (stderr, "benchcmp: Cannot open '%s'\n", RefName);
+            return EXIT_FAILURE;
+        }
+    }
+    if (OutName) {
+        Out = fopen (OutName, "w");
+        if (Out == 0) {
+            fprintf (stderr, "benchcmp: Cannot open '%s'\n", OutName);
+            return EXIT_FAILURE;
+        }
+    }
+
+    fprintf (Out, "# %-30s %8s %12s\n", "name", "code", "cycles");
+    for (; I < argc; ++I) {
+
+        Result New, Old;
+        if (!ReadResult (argv[I], &New)) {
+            return EXIT_FAILURE;
+        }
+        fprintf (Out, "%-32s %8lu %12lu\n", New.Name, New.Code, New.Cycles);
+
+        if (Ref == 0) {
+            continue;
+        }
+        if (!FindRef (Ref, New.Name, &Old)) {
+            ++Missing;
+            continue;
+        }
+        OldCode   += Old.Code;
+        NewCode   += New.Code;
+        OldCycles += Old.Cycles;
+        NewCycles += New.Cycles;
+
+        if (Change (Old.Code, New.Code) > Threshold ||
+            Change (Old.Cycles, New.Cycles) > Threshold) {
+            printf ("REGRESSION: %s: code %lu -> %lu (%+.1f%%), "
+                    "cycles %lu -> %lu (%+.1f%%)\n",
+                    New.Name,
+                    Old.Code, New.Code, Change (Old.Code, New.Code),
+                    Old.Cycles, New.Cycles, Change (Old.Cycles, New.Cycles));
+            ++Regressions;
+        }
+    }
+
+    if (Ref) {
+        printf ("bench: code %lu -> %lu (%+.2f%%), cycles %lu -> %lu (%+.2f%%)\n",
+                OldCode, NewCode, Change (OldCode, NewCode),
+                OldCycles, NewCycles, Change (OldCycles, NewCycles));
+        if (Missing) {
+            printf ("bench: %u results not in the baseline\n", Missing);
+        }
+        fclose (Ref);
+    }
+    if (Out != stdout) {
+        fclose (Out);
+    }
+
+    return Regressions ? EXIT_FAILURE : EXIT_SUCCESS;
+}
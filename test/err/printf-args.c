@@ -0,0 +1,15 @@
+/*
+  !!DESCRIPTION!! printf with too few arguments
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+/* The printf call must be diagnosed as usual when it may be replaced */
+#pragma inline-stdfuncs (on)
+
+#include <stdio.h>
+
+void f (void)
+{
+    printf ();
+}
@@ -0,0 +1,17 @@
+/*
+  !!DESCRIPTION!! printf with a stray comma
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+/* The printf call must be diagnosed as usual when it may be replaced */
+#pragma inline-stdfuncs (on)
+
+#include <stdio.h>
+
+int x;
+
+void f (void)
+{
+    printf ("%d\n", x,);
+}
@@ -0,0 +1,69 @@
+/*
+  !!DESCRIPTION!! removal of unused functions and data objects
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+/*
+  Compiled with --function-sections. The linker must keep everything that is
+  referenced, directly or through a table of function pointers, and remove
+  the unused objects. The size of the BSS segment tells if the large unused
+  arrays were removed.
+*/
+
+#include <stdio.h>
+
+/* Defined by the linker */
+extern char _BSS_SIZE__[];
+
+static unsigned char failures;
+
+/* Unused */
+char unused_bss[1000];
+int unused_data[50] = { 1, 2, 3 };
+static char unused_static[500];
+
+int unused_func (int x)
+{
+    static int sum;
+    unused_static[x] = (char) x;
+    sum += unused_data[x];
+    return sum + unused_bss[x];
+}
+
+/* Used */
+int used_data = 5;
+char used_bss[10];
+static const char used_rodata[] = { 1, 2, 4, 8 };
+
+static int twice (int x)
+{
+    return 2 * x;
+}
+
+static int thrice (int x)
+{
+    return 3 * x;
+}
+
+static int (* const ops[]) (int) = { twice, thrice };
+
+static int helper (int x)
+{
+    return ops[x & 1] (x) + used_data + used_rodata[x & 3];
+}
+
+int main (void)
+{
+    used_bss[2] = 7;
+    if (helper (4) != 8 + 5 + 1 || helper (3) != 9 + 5 + 8 || used_bss[2] != 7) {
+        printf ("wrong results\n");
+        ++failures;
+    }
+    if ((unsigned) _BSS_SIZE__ >= 500) {
+        printf ("unused objects not removed, BSS size is %u\n",
+                (unsigned) _BSS_SIZE__);
+        ++failures;
+    }
+    return failures;
+}
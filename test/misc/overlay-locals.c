@@ -0,0 +1,88 @@
+/*
+  !!DESCRIPTION!! static locals overlaid by --overlay-locals
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static unsigned char failures = 0;
+
+static void check (int got, int expected, const char* what)
+{
+    if (got != expected) {
+        printf ("%s: got %d, expected %d\n", what, got, expected);
+        ++failures;
+    }
+}
+
+/* Two leaf functions that may share their frames */
+static int leaf1 (int x)
+{
+    int a = x * 2;
+    int b = a + 1;
+    return a + b;
+}
+
+static int leaf2 (int x)
+{
+    int c = x - 1;
+    int d = c * c;
+    return d;
+}
+
+/* The locals of a caller must survive calls */
+static int caller (int x)
+{
+    int m = x + 100;
+    int n = leaf1 (x);
+    int o = leaf2 (x);
+    return m + n + o;
+}
+
+/* A static function reached through a pointer, from code outside of this
+** translation unit.
+*/
+static int compare (const void* l, const void* r)
+{
+    int a = *(const int*) l;
+    int b = *(const int*) r;
+    int res = (a > b) - (a < b);
+    return res;
+}
+
+static int sorted (void)
+{
+    int v[5] = { 5, 3, 4, 1, 2 };
+    int i;
+    int ok = 1;
+    qsort (v, 5, sizeof (v[0]), compare);
+    for (i = 0; i < 5; ++i) {
+        if (v[i] != i + 1) {
+            ok = 0;
+        }
+    }
+    return ok;
+}
+
+/* A function calling through a pointer keeps its locals */
+static int (*fp) (int) = leaf2;
+
+static int indirect (int x)
+{
+    int keep = x * 3;
+    int r = fp (x);
+    return keep + r;
+}
+
+int main (void)
+{
+    check (leaf1 (3), 13, "leaf1");
+    check (leaf2 (3), 4, "leaf2");
+    check (caller (3), 103 + 13 + 4, "caller");
+    check (sorted (), 1, "sorted");
+    check (indirect (5), 15 + 16, "indirect");
+    printf ("failures: %u\n", failures);
+    return failures;
+}
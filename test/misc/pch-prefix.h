@@ -0,0 +1,26 @@
+/*
+  !!DESCRIPTION!! prefix header for the precompiled header test
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TRIPLE(x)       ((x) * 3)
+#define SUM(...)        sum (__VA_ARGS__, -1)
+#define GREETING        "hello"
+
+typedef struct {
+    int           x;
+    unsigned char tag;
+} point_t;
+
+enum { RED = 5, GREEN, BLUE };
+
+static int sum (int first, ...);
+
+/* A function with the name of a macro that is defined later */
+int twice (int v);
+#define twice(v)        ((v) + (v))
@@ -0,0 +1,62 @@
+/*
+  !!DESCRIPTION!! precompiled header snapshots
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+/*
+  Compiled with --pch-use and a snapshot of pch-prefix.h, so the macros and
+  declarations from the prefix are available without including it.
+*/
+
+#include <stdio.h>      /* Already included by the prefix */
+#include <stdarg.h>
+
+static unsigned char failures;
+
+static int sum (int first, ...)
+{
+    va_list ap;
+    int s = 0;
+    int v = first;
+
+    va_start (ap, first);
+    while (v >= 0) {
+        s += v;
+        v = va_arg (ap, int);
+    }
+    va_end (ap);
+    return s;
+}
+
+int (twice) (int v)
+{
+    return v * 2;
+}
+
+static void check (const char* what, long val, long expected)
+{
+    if (val != expected) {
+        printf ("%s: %ld != %ld\n", what, val, expected);
+        ++failures;
+    }
+}
+
+int main (void)
+{
+    point_t p;
+    char buf[8];
+
+    p.x = TRIPLE (7);
+    p.tag = BLUE;
+    strcpy (buf, GREETING);
+
+    check ("macro", p.x, 21);
+    check ("enum", p.tag, 7);
+    check ("string", strlen (buf), 5);
+    check ("variadic", SUM (1, 2, 3), 6);
+    check ("function", (twice) (4), 8);
+    check ("masked", twice (5), 10);
+
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
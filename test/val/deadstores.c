@@ -0,0 +1,183 @@
+/*
+  !!DESCRIPTION!! removal of dead stores to locals on the C stack
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+/*
+  The optimizer removes stores to locals and parameters that are overwritten
+  or go out of scope before they are read. Stores must stay if the value is
+  read on some path, by a called function, through a pointer, or if the local
+  is volatile.
+*/
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+
+static unsigned char failures;
+
+static int g;
+
+static void expect (const char* what, long got, long expected)
+{
+    if (got != expected) {
+        printf ("%s: got %ld, expected %ld\n", what, got, expected);
+        ++failures;
+    }
+}
+
+static int overwritten (int a)
+{
+    int x, y;
+    unsigned char c;
+
+    x = a + 1;
+    y = 5;
+    c = 3;
+    g = x;
+    y = 7;
+    c = (unsigned char) a;
+    return g + c;
+}
+
+static int one_path (int a)
+{
+    int x = 1;
+
+    if (a > 10) {
+        x = 2;
+    }
+    return x;
+}
+
+static int in_loop (unsigned char n)
+{
+    int sum = 0;
+    int last = -1;
+    unsigned char i;
+
+    for (i = 0; i < n; ++i) {
+        last = sum;
+        sum += i;
+    }
+    return last;
+}
+
+static void set (int* p)
+{
+    *p += 10;
+}
+
+static int address_taken (void)
+{
+    int x;
+
+    x = 5;
+    set (&x);
+    return x;
+}
+
+static int array (unsigned char i)
+{
+    unsigned char buf[4];
+
+    buf[0] = 1;
+    buf[1] = 2;
+    buf[2] = 3;
+    buf[3] = 4;
+    return buf[i];
+}
+
+static long sum_args (unsigned char count, ...)
+{
+    va_list ap;
+    long sum = 0;
+
+    va_start (ap, count);
+    while (count--) {
+        sum += va_arg (ap, int);
+    }
+    va_end (ap);
+    return sum;
+}
+
+static long variadic (int a)
+{
+    long l;
+    int b = a * 2;
+
+    l = 100000;
+    l = sum_args (3, a, b, 7);
+    return l;
+}
+
+static long longs (long a)
+{
+    long l;
+
+    l = a;
+    l += 1;
+    a = 0;
+    return l;
+}
+
+static int param_overwritten (int a, int b)
+{
+    a = b;
+    b = 1;
+    return a;
+}
+
+static int vol (void)
+{
+    volatile int v;
+
+    v = 1;
+    v = 2;
+    return v;
+}
+
+static int nested (int a)
+{
+    int x;
+    int y;
+
+    x = a;
+    {
+        int z = x + 1;
+        y = z * 2;
+    }
+    x = 0;
+    return y;
+}
+
+static int strings (void)
+{
+    char s[8];
+
+    strcpy (s, "abc");
+    s[1] = 'x';
+    return strcmp (s, "axc");
+}
+
+int main (void)
+{
+    expect ("overwritten", overwritten (4), 9);
+    expect ("one_path 1", one_path (5), 1);
+    expect ("one_path 2", one_path (50), 2);
+    expect ("in_loop", in_loop (5), 6);
+    expect ("address_taken", address_taken (), 15);
+    expect ("array", array (2), 3);
+    expect ("variadic", variadic (5), 22);
+    expect ("longs", longs (70000), 70001);
+    expect ("param_overwritten", param_overwritten (1, 2), 2);
+    expect ("vol", vol (), 2);
+    expect ("nested", nested (3), 8);
+    expect ("strings", strings (), 0);
+
+    if (failures) {
+        printf ("failures: %u\n", failures);
+    }
+    return failures;
+}
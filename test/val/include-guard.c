@@ -0,0 +1,45 @@
+/*
+  !!DESCRIPTION!! include guards and #pragma once
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+/*
+  Included files may be skipped without reading them if they are completely
+  enclosed in an include guard that is still defined. The results must be
+  the same as if the files were read again.
+*/
+
+#include <stdio.h>
+#include <stdio.h>
+#include "include-guard.h"
+#include "include-guard.h"
+
+static unsigned char failures;
+
+static void check (const char* what, int val, int expected)
+{
+    if (val != expected) {
+        printf ("%s: %d != %d\n", what, val, expected);
+        ++failures;
+    }
+}
+
+int main (void)
+{
+    int once = 0;
+
+    check ("guarded", GUARD_PASSES, 1);
+
+    /* Removing the guard makes the header visible again */
+#undef INCLUDE_GUARD_H
+#include "include-guard.h"
+    check ("unguarded", GUARD_PASSES, 2);
+
+    /* A header with #pragma once is read only once */
+#include "include-once.h"
+#include "include-once.h"
+    check ("once", once, 1);
+
+    return failures;
+}
@@ -0,0 +1,18 @@
+/*
+  !!DESCRIPTION!! header for the include guard test
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+#ifndef INCLUDE_GUARD_H
+#define INCLUDE_GUARD_H
+
+/* Counts how often the header contents were seen */
+#ifndef GUARD_PASSES
+#define GUARD_PASSES 1
+#else
+#undef GUARD_PASSES
+#define GUARD_PASSES 2
+#endif
+
+#endif
@@ -0,0 +1,9 @@
+/*
+  !!DESCRIPTION!! header for the #pragma once test
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+#pragma once
+
+++once;
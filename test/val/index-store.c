@@ -0,0 +1,108 @@
+/*
+  !!DESCRIPTION!! stores into static arrays with a byte sized index
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+/*
+  The optimizer replaces the address calculation for these stores by indexed
+  addressing. The index may be a local, a parameter or a static variable, and
+  the value may be computed in various ways.
+*/
+
+#include <stdio.h>
+
+static unsigned char failures;
+
+static unsigned char src[64];
+static unsigned char dst[64];
+static unsigned char idx;
+
+static void copy (void)
+{
+    unsigned char i;
+    for (i = 0; i < 64; ++i) {
+        dst[i] = src[i];
+    }
+}
+
+static void add (unsigned char n, unsigned char k)
+{
+    unsigned char i;
+    for (i = 0; i < n; ++i) {
+        dst[i] = src[i] + k;
+    }
+}
+
+static void reverse (void)
+{
+    unsigned char i;
+    for (i = 0; i < 64; ++i) {
+        dst[i] = src[63 - i];
+    }
+}
+
+static void mix (void)
+{
+    unsigned char i;
+    unsigned char j = 5;
+    for (i = 0; i < 64; ++i) {
+        dst[i] = (src[i] ^ j) | 1;
+        j = dst[i];
+    }
+}
+
+static void global (void)
+{
+    for (idx = 0; idx < 64; ++idx) {
+        dst[idx] = src[idx] >> 1;
+    }
+}
+
+static void check (const char* what, unsigned char i, unsigned char expected)
+{
+    if (dst[i] != expected) {
+        printf ("%s: dst[%u] = %u, expected %u\n", what, i, dst[i], expected);
+        ++failures;
+    }
+}
+
+int main (void)
+{
+    unsigned char i;
+    unsigned char j;
+
+    for (i = 0; i < 64; ++i) {
+        src[i] = i * 3 + 1;
+    }
+
+    copy ();
+    for (i = 0; i < 64; ++i) {
+        check ("copy", i, i * 3 + 1);
+    }
+
+    add (32, 200);
+    for (i = 0; i < 32; ++i) {
+        check ("add", i, (unsigned char) (i * 3 + 201));
+    }
+    check ("add", 32, 32 * 3 + 1);
+
+    reverse ();
+    for (i = 0; i < 64; ++i) {
+        check ("reverse", i, (63 - i) * 3 + 1);
+    }
+
+    mix ();
+    j = 5;
+    for (i = 0; i < 64; ++i) {
+        j = ((i * 3 + 1) ^ j) | 1;
+        check ("mix", i, j);
+    }
+
+    global ();
+    for (i = 0; i < 64; ++i) {
+        check ("global", i, (i * 3 + 1) >> 1);
+    }
+
+    return failures;
+}
@@ -0,0 +1,84 @@
+/*
+  !!DESCRIPTION!! inlining of small static functions
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+/*
+  The functions below are small enough to be inlined with -Oi, the inline
+  ones also without it. The results must not depend on inlining.
+*/
+
+#include <stdio.h>
+
+static unsigned char failures;
+
+static int counter;
+
+static inline int inc (int a)
+{
+    return a + 1;
+}
+
+static int max (int a, int b)
+{
+    if (a > b) {
+        return a;
+    }
+    return b;
+}
+
+static unsigned char low (unsigned v)
+{
+    return v & 0xFF;
+}
+
+static void bump (void)
+{
+    ++counter;
+}
+
+static int fact (int n)
+{
+    return n <= 1 ? 1 : n * fact (n - 1);
+}
+
+static inline unsigned char sum (unsigned char a, unsigned char b, unsigned char c)
+{
+    return a + b + c;
+}
+
+static int apply (int (*f) (int), int v)
+{
+    return f (v);
+}
+
+static void check (const char* what, long val, long expected)
+{
+    if (val != expected) {
+        printf ("%s: %ld != %ld\n", what, val, expected);
+        ++failures;
+    }
+}
+
+int main (void)
+{
+    int i;
+    int m = 0;
+
+    for (i = -3; i < 3; ++i) {
+        m += max (i, 0);
+        bump ();
+    }
+    check ("max", m, 3);
+    check ("counter", counter, 6);
+
+    check ("inc", inc (inc (40)), 42);
+    check ("low", low (0x1234), 0x34);
+    check ("fact", fact (7), 5040);
+    check ("sum", sum (low (0x101), 2, inc (2)), 6);
+    check ("apply", apply (inc, 9), 10);
+    check ("nested", max (inc (1), max (low (0x205), -1)), 5);
+
+    return failures;
+}
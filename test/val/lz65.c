@@ -0,0 +1,126 @@
+/*
+  !!DESCRIPTION!! decompress_lz65 and decompress_lz65_fast
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+/*
+  The data below was compressed with util/lz65. It has repeated text, a run
+  and a block of random bytes that are both longer than 256 bytes, and
+  copies with offsets above 256. Both decompressors must restore it, also
+  in place with the compressed data at the end of the buffer.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <lz65.h>
+
+#define SIZE    2000
+#define MARGIN  2
+
+static const unsigned char Packed[] = {
+    0x0A, 0x71, 0x6C, 0x7A, 0x36, 0x35, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x73,
+    0x20, 0x36, 0x35, 0x30, 0x32, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x20,
+    0x15, 0x54, 0x1B, 0x00, 0x82, 0x00, 0x22, 0x4A, 0xA2, 0x32, 0x98, 0xEE,
+    0x4E, 0xAF, 0x0F, 0x53, 0xFE, 0x4B, 0x77, 0x51, 0x65, 0x40, 0xAC, 0xF6,
+    0x80, 0x38, 0xCA, 0x8D, 0x89, 0x21, 0x2E, 0xA3, 0xFE, 0x26, 0x73, 0x02,
+    0x9A, 0xB3, 0x75, 0xB8, 0x5A, 0x75, 0x51, 0x10, 0x78, 0x57, 0x62, 0x97,
+    0x72, 0x85, 0x44, 0x18, 0x03, 0x6B, 0xD3, 0x9F, 0x28, 0xB6, 0x2B, 0x78,
+    0x1B, 0x50, 0xA9, 0x2F, 0x5A, 0x67, 0xE8, 0x91, 0xA0, 0x67, 0xC4, 0xA9,
+    0xEA, 0xFA, 0x5A, 0xC3, 0x72, 0x0E, 0x04, 0x6B, 0xB6, 0xCE, 0x60, 0x6E,
+    0x71, 0xA6, 0x4A, 0xD7, 0x9F, 0x43, 0xDC, 0xF2, 0x7D, 0x90, 0x74, 0x4B,
+    0x86, 0xB9, 0xAD, 0xAF, 0x76, 0x2A, 0x63, 0x29, 0x49, 0x90, 0xB3, 0x05,
+    0x3C, 0xD5, 0xF7, 0xD0, 0xCA, 0x27, 0xCD, 0x54, 0xAF, 0xF2, 0x11, 0x9F,
+    0xE7, 0xE0, 0xDD, 0xFC, 0xAF, 0xDF, 0x8F, 0xF8, 0x82, 0x1A, 0xC2, 0x5E,
+    0x1C, 0xFD, 0x52, 0x39, 0x79, 0x35, 0x5B, 0xD8, 0xD6, 0xAD, 0x3A, 0xC4,
+    0xAE, 0x91, 0x8A, 0xCB, 0xBD, 0x4D, 0x27, 0xF8, 0xFF, 0x8E, 0x2E, 0x97,
+    0xB1, 0x3E, 0xFA, 0x34, 0x4E, 0x8C, 0x27, 0x9C, 0x92, 0xE1, 0x91, 0xDA,
+    0x79, 0xEA, 0x54, 0x3A, 0x40, 0x94, 0xCD, 0x48, 0x62, 0x0A, 0x97, 0xD1,
+    0x9B, 0xB9, 0x8E, 0xE0, 0xE7, 0x4B, 0xCF, 0xC1, 0x83, 0xAE, 0xB4, 0x01,
+    0xEA, 0x0D, 0xDB, 0x6A, 0xD8, 0xD4, 0x20, 0x0A, 0x49, 0xB0, 0x9D, 0x2C,
+    0x7A, 0x8C, 0xB0, 0x5D, 0xE6, 0x94, 0xF4, 0x67, 0x49, 0x34, 0x45, 0x58,
+    0x9F, 0x18, 0xC0, 0x7C, 0x25, 0x2D, 0xBF, 0x5D, 0x55, 0x9E, 0xE0, 0xC9,
+    0xEE, 0xD8, 0xFF, 0xCB, 0xE9, 0x85, 0x36, 0xAF, 0x84, 0x93, 0xE3, 0x01,
+    0x39, 0x2D, 0xA1, 0x8E, 0xC6, 0xBF, 0x4C, 0x61, 0x27, 0xF6, 0x00, 0xC6,
+    0x96, 0xBD, 0x1A, 0x49, 0x91, 0x40, 0x35, 0xB7, 0xD3, 0xEB, 0x2D, 0x1B,
+    0x59, 0x6B, 0x1F, 0xC1, 0x5D, 0xAA, 0x66, 0x36, 0x5D, 0xD6, 0x9E, 0x44,
+    0x14, 0x5B, 0xA3, 0xF9, 0x7F, 0xE3, 0x91, 0xA0, 0xD8, 0x5C, 0xC5, 0xC6,
+    0x9D, 0xF1, 0xDA, 0x35, 0x89, 0x0E, 0xAC, 0xFB, 0x99, 0x60, 0x58, 0x63,
+    0x07, 0xD2, 0x39, 0xFA, 0x51, 0x90, 0xEB, 0x8B, 0x32, 0x06, 0x4A, 0x22,
+    0xA7, 0xE1, 0x72, 0x0B, 0xEA, 0x0B, 0xC0, 0xD2, 0x79, 0xB2, 0xCF, 0x44,
+    0x0F, 0x42, 0x7B, 0x6C, 0xA9, 0x65, 0xE1, 0x96, 0x81, 0x09, 0x5B, 0x4E,
+    0x15, 0x59, 0x87, 0x61, 0x20, 0xC1, 0x41, 0xDA, 0x9E, 0xEE, 0xA3, 0x05,
+    0xCC, 0xCB, 0x0B, 0x6E, 0x25, 0x84, 0x14, 0xE2, 0x65, 0x85, 0x9A, 0x6C,
+    0x88, 0x7B, 0xBA, 0x58, 0xCB, 0x50, 0xCE, 0x33, 0xA9, 0x32, 0x74, 0xC7,
+    0xDE, 0x8D, 0x88, 0x22, 0x66, 0x0B, 0x24, 0x8F, 0x7E, 0x9A, 0xA6, 0x9B,
+    0xA1, 0x65, 0xA9, 0x11, 0x8B, 0xD8, 0x09, 0xFC, 0x38, 0xA0, 0xE2, 0xAB,
+    0xE5, 0xA8, 0x91, 0xA7, 0x0D, 0x1C, 0xB1, 0xBE, 0x6C, 0x68, 0x1E, 0xFB,
+    0xFE, 0x39, 0xF5, 0xAA, 0x00, 0x79, 0x91, 0x57, 0xED, 0x57, 0x8E, 0xCF,
+    0x81, 0x3C, 0xC8, 0x1D, 0xB8, 0xD5, 0x5B, 0x8D, 0xCF, 0x0F, 0xA4, 0xAB,
+    0x41, 0x15, 0x3E, 0x44, 0xCA, 0x54, 0x05, 0x63, 0x66, 0x76, 0x16, 0x54,
+    0x52, 0x69, 0xCB, 0xA4, 0x09, 0x58, 0xC2, 0x1D, 0x47, 0xAF, 0xD7, 0xCD,
+    0x08, 0x1B, 0x24, 0xFF, 0x89, 0x87, 0x07, 0x40, 0x45, 0x1F, 0x1B, 0x5A,
+    0xF8, 0x4F, 0x3C, 0x5B, 0x9E, 0xC3, 0x87, 0x8F, 0x74, 0x68, 0x56, 0x80,
+    0xF4, 0x69, 0x47, 0xFC, 0xDD, 0x33, 0x36, 0x0E, 0x28, 0x70, 0x3D, 0x02,
+    0x13, 0x0E, 0xBA, 0x64, 0x18, 0x38, 0x48, 0x01, 0xF5, 0x5A, 0xC3, 0xE4,
+    0xA6, 0x21, 0x47, 0x59, 0x65, 0x78, 0x00, 0x02, 0xBB, 0xBA, 0x40, 0x76,
+    0xB9, 0x80, 0xED, 0xBB, 0x01, 0xDA, 0xBA, 0x03, 0xB4, 0xB9, 0x07, 0x68,
+    0xBB, 0x0E, 0xD0, 0xBA, 0x1D, 0xA0, 0xB9, 0x3B, 0xBB, 0x40, 0x76, 0xBA,
+    0x08, 0x8E, 0x00, 0x01,
+};
+
+static const char Phrase[] = "lz65 packs 6502 data. ";
+
+static unsigned char Expected[SIZE];
+static unsigned char Buf[SIZE + MARGIN];
+
+static unsigned char failures;
+
+static void Generate (void)
+{
+    unsigned I;
+    unsigned Seed = 1;
+
+    for (I = 0; I < SIZE; ++I) {
+        if (I < 400) {
+            Expected[I] = Phrase[I % (sizeof (Phrase) - 1)];
+        } else if (I < 700) {
+            Expected[I] = 0;
+        } else if (I < 1200) {
+            Seed = Seed * 25173U + 13849U;
+            Expected[I] = Seed >> 8;
+        } else {
+            Expected[I] = Expected[I - 700 + (I / 50) % 3];
+        }
+    }
+}
+
+static void Check (const char* What, unsigned Size)
+{
+    if (Size != SIZE) {
+        printf ("%s: size is %u instead of %u\n", What, Size, SIZE);
+        ++failures;
+    } else if (memcmp (Buf, Expected, SIZE) != 0) {
+        printf ("%s: wrong data\n", What);
+        ++failures;
+    }
+}
+
+int main (void)
+{
+    unsigned char* InPlace = Buf + sizeof (Buf) - sizeof (Packed);
+
+    Generate ();
+
+    memset (Buf, 0, sizeof (Buf));
+    Check ("lz65", decompress_lz65 (Packed, Buf));
+    memset (Buf, 0, sizeof (Buf));
+    Check ("lz65_fast", decompress_lz65_fast (Packed, Buf));
+
+    memcpy (InPlace, Packed, sizeof (Packed));
+    Check ("lz65 in place", decompress_lz65 (InPlace, Buf));
+    memcpy (InPlace, Packed, sizeof (Packed));
+    Check ("lz65_fast in place", decompress_lz65_fast (InPlace, Buf));
+
+    return failures;
+}
@@ -0,0 +1,115 @@
+/*
+  !!DESCRIPTION!! reloads of variables that are still held in a register
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+/*
+  The optimizer removes loads of variables whose value is still in a register,
+  and stores of a value that was just loaded from the same variable. It must
+  not do so if the variable may have been changed in between, be it through a
+  pointer, by a called function, by a change of the stack pointer or because
+  the variable is volatile.
+*/
+
+#include <stdio.h>
+
+static unsigned char failures;
+
+static unsigned char a;
+static unsigned char b;
+static unsigned int w;
+static volatile unsigned char v;
+
+static void expect (const char* what, unsigned got, unsigned expected)
+{
+    if (got != expected) {
+        printf ("%s: got %u, expected %u\n", what, got, expected);
+        ++failures;
+    }
+}
+
+static void change_a (void)
+{
+    ++a;
+}
+
+static unsigned char copy (void)
+{
+    b = a;
+    a = b;
+    return a + b;
+}
+
+static unsigned char through_pointer (unsigned char* p)
+{
+    unsigned char x;
+    x = a;
+    *p = x + 1;
+    return a + x;
+}
+
+static unsigned char through_call (void)
+{
+    unsigned char x;
+    x = a;
+    change_a ();
+    return a + x;
+}
+
+static unsigned char locals (unsigned char x, unsigned char y)
+{
+    unsigned char z;
+    z = x;
+    x = y;
+    y = z;
+    return x * 16 + y;
+}
+
+static unsigned int nested (unsigned int x)
+{
+    unsigned int y = x;
+    {
+        unsigned int z = x + 1;
+        w = z;
+    }
+    return y + x;
+}
+
+static unsigned char wait (void)
+{
+    unsigned char n = 0;
+    while (v == 0) {
+        if (++n == 3) {
+            v = 1;
+        }
+    }
+    return n;
+}
+
+int main (void)
+{
+    a = 5;
+    expect ("copy", copy (), 10);
+
+    a = 5;
+    expect ("pointer", through_pointer (&a), 11);
+    expect ("pointer", a, 6);
+    b = 5;
+    a = 5;
+    expect ("pointer", through_pointer (&b), 10);
+    expect ("pointer", b, 6);
+
+    a = 7;
+    expect ("call", through_call (), 15);
+
+    expect ("locals", locals (1, 2), 0x21);
+
+    expect ("nested", nested (1000), 2000);
+    expect ("nested", w, 1001);
+
+    v = 0;
+    expect ("volatile", wait (), 3);
+
+    return failures;
+}
@@ -0,0 +1,76 @@
+/*
+  !!DESCRIPTION!! printf calls with a constant format
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+/*
+  With -Os, the compiler replaces printf, fprintf and sprintf calls with a
+  constant format by calls to output primitives. The results must be the same
+  as those of the library formatter, including the return value. Formats the
+  compiler doesn't handle must still be passed to the library.
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+static unsigned char failures;
+
+static char buf[64];
+
+static void expect (const char* what, int len, const char* expected)
+{
+    if (strcmp (buf, expected) != 0 || len != (int) strlen (expected)) {
+        printf ("%s: got \"%s\" (%d), expected \"%s\"\n", what, buf, len, expected);
+        ++failures;
+    }
+}
+
+static int calls;
+
+static int next (void)
+{
+    return ++calls;
+}
+
+int main (void)
+{
+    int i = -42;
+    unsigned u = 65535U;
+    char c = 'Z';
+    const char* s = "str";
+    long l = 123456L;
+    int n;
+
+    n = sprintf (buf, "x=%d u=%u h=%x H=%X c=%c s=%s %%", i, u, 0xBEEF, 0xBEEF, c, s);
+    expect ("conversions", n, "x=-42 u=65535 h=beef H=BEEF c=Z s=str %");
+
+    n = sprintf (buf, "[%5d][%-5u][%5s][%-4s|][%04x]", i, 12, "ab", "cd", 31);
+    expect ("width", n, "[  -42][12   ][   ab][cd  |][001f]");
+
+    n = sprintf (buf, "%i%c", 7, '-');
+    expect ("short", n, "7-");
+
+    n = sprintf (buf, "%d %d", next (), next ());
+    expect ("calls", n, "1 2");
+
+    n = sprintf (buf, "");
+    expect ("empty", n, "");
+
+    n = sprintf (buf, "%s", "");
+    expect ("empty string", n, "");
+
+    n = sprintf (buf, "%ld %5.2s", l, "abc");
+    expect ("fallback", n, "123456    ab");
+
+    n = sprintf (buf, "%u", (unsigned char) 200);
+    expect ("char arg", n, "200");
+
+    n = printf ("");
+    if (n != 0) {
+        printf ("printf: got %d, expected 0\n", n);
+        ++failures;
+    }
+
+    return failures;
+}
@@ -0,0 +1,38 @@
+/*
+  !!DESCRIPTION!! printf defined by the program
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+/*
+  A program may have its own printf, for example to output to a custom
+  device. Calls to it must not be replaced by the output primitives of the
+  library, even with -Os.
+*/
+
+static int calls;
+
+int printf (const char* fmt, ...)
+{
+    ++calls;
+    return fmt[0];
+}
+
+int sprintf (char* buf, const char* fmt, ...)
+{
+    ++calls;
+    return buf[0] = fmt[0];
+}
+
+static char buf[4];
+
+int main (void)
+{
+    if (printf ("%d\n", 1) != '%') {
+        return 1;
+    }
+    if (sprintf (buf, "x%u", 2u) != 'x' || buf[0] != 'x') {
+        return 1;
+    }
+    return calls != 2;
+}
@@ -0,0 +1,124 @@
+/*
+  !!DESCRIPTION!! repeated dereferences of pointers on the C stack
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+/*
+  The optimizer keeps a pointer parameter or local in ptr1 across several
+  dereferences instead of loading it again from the stack. It must reload the
+  pointer if it was changed in between, if ptr1 was used for something else,
+  or if the paths leading to a dereference disagree about its contents.
+*/
+
+#include <stdio.h>
+
+static unsigned char failures;
+
+struct node {
+    int                 value;
+    unsigned char       flags;
+    struct node*        next;
+    unsigned char       data[4];
+};
+
+static struct node nodes[3];
+
+static void expect (const char* what, int got, int expected)
+{
+    if (got != expected) {
+        printf ("%s: got %d, expected %d\n", what, got, expected);
+        ++failures;
+    }
+}
+
+static void init (struct node* n, int value)
+{
+    n->value = value;
+    n->flags = 1;
+    n->next = 0;
+    n->data[0] = 1;
+    n->data[1] = 2;
+    n->data[2] = 3;
+    n->data[3] = 4;
+}
+
+static int sum_list (struct node* n)
+{
+    int sum = 0;
+
+    while (n) {
+        sum += n->value;
+        sum += n->flags;
+        n = n->next;
+    }
+    return sum;
+}
+
+static unsigned char changed (struct node* a, struct node* b)
+{
+    unsigned char r;
+    struct node* p = a;
+
+    p->flags = 7;
+    r = p->flags;
+    p = b;
+    p->flags = 9;
+    return r + p->flags;
+}
+
+static unsigned char branches (struct node* a, struct node* b, unsigned char c)
+{
+    struct node* p = a;
+
+    p->data[0] = 5;
+    if (c) {
+        p = b;
+    }
+    return p->data[0];
+}
+
+static unsigned char loop (struct node* p, struct node* q)
+{
+    unsigned char i, s = 0;
+
+    for (i = 0; i < 4; ++i) {
+        p->data[i] = q->data[i];
+        s += p->flags;
+    }
+    return s;
+}
+
+static void touch (struct node* p)
+{
+    p->flags = 42;
+}
+
+static unsigned char call (struct node* p)
+{
+    p->flags = 1;
+    touch (p);
+    return p->flags;
+}
+
+int main (void)
+{
+    init (&nodes[0], 100);
+    init (&nodes[1], 200);
+    init (&nodes[2], 300);
+    nodes[0].next = &nodes[1];
+    nodes[1].next = &nodes[2];
+
+    expect ("sum_list", sum_list (nodes), 603);
+    expect ("changed", changed (&nodes[0], &nodes[1]), 16);
+    expect ("branches 1", branches (&nodes[0], &nodes[1], 0), 5);
+    expect ("branches 2", branches (&nodes[0], &nodes[1], 1), 1);
+    expect ("loop", loop (&nodes[2], &nodes[0]), 4);
+    expect ("loop data", nodes[2].data[0], 5);
+    expect ("call", call (&nodes[0]), 42);
+
+    if (failures) {
+        printf ("failures: %u\n", failures);
+    }
+    return failures;
+}
@@ -0,0 +1,225 @@
+/*
+  !!DESCRIPTION!! qsort, qsort_u8 and qsort_u16
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+/*
+  qsort has separate code paths for small partitions, for elements of 1, 2
+  and 4 bytes, for other elements of less than 256 bytes and for larger ones.
+  qsort_u8 and qsort_u16 compare keys without a function. A compare function
+  may call qsort itself.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static unsigned char failures;
+
+static unsigned seed;
+
+static unsigned rnd (void)
+{
+    seed = seed * 25173U + 13849U;
+    return seed >> 4;
+}
+
+static void fail (const char* what, unsigned n)
+{
+    printf ("%s: failed for %u elements\n", what, n);
+    ++failures;
+}
+
+/* Bytes */
+static unsigned char b[300];
+
+static int cmpb (const void* x, const void* y)
+{
+    return (int) *(const unsigned char*) x - (int) *(const unsigned char*) y;
+}
+
+/* Ints */
+static int w[300];
+
+static int cmpw (const void* x, const void* y)
+{
+    int a = *(const int*) x;
+    int b = *(const int*) y;
+    return a < b ? -1 : a > b;
+}
+
+/* Longs */
+static long l[200];
+
+static int cmpl (const void* x, const void* y)
+{
+    long a = *(const long*) x;
+    long b = *(const long*) y;
+    return a < b ? -1 : a > b;
+}
+
+/* Records of 3 bytes, with the key in front */
+struct rec3 {
+    unsigned int key;
+    unsigned char tag;
+};
+static struct rec3 r3[150];
+
+/* Large records */
+struct big {
+    unsigned char key;
+    unsigned char data[299];
+};
+static struct big big[4];
+
+static int cmpbig (const void* x, const void* y)
+{
+    return cmpb (&((const struct big*) x)->key, &((const struct big*) y)->key);
+}
+
+/* A compare function that sorts the bytes of both elements first */
+static unsigned char nested[6][4];
+
+static int cmpnested (const void* x, const void* y)
+{
+    qsort ((void*) x, 4, 1, cmpb);
+    qsort ((void*) y, 4, 1, cmpb);
+    return memcmp (x, y, 4);
+}
+
+static void test_bytes (unsigned n, unsigned char mode)
+{
+    unsigned i;
+    unsigned sum = 0;
+
+    for (i = 0; i < n; ++i) {
+        b[i] = mode == 0 ? rnd () : mode == 1 ? i : mode == 2 ? n - i : 7;
+        sum += b[i];
+    }
+    if (mode & 1) {
+        qsort_u8 (b, n, 1);
+    } else {
+        qsort (b, n, 1, cmpb);
+    }
+    for (i = 1; i < n; ++i) {
+        if (b[i - 1] > b[i]) {
+            fail ("bytes", n);
+            return;
+        }
+    }
+    for (i = 0; i < n; ++i) {
+        sum -= b[i];
+    }
+    if (sum != 0) {
+        fail ("bytes checksum", n);
+    }
+}
+
+static void test_ints (unsigned n)
+{
+    unsigned i;
+
+    for (i = 0; i < n; ++i) {
+        w[i] = rnd () - 0x0800;
+    }
+    qsort (w, n, sizeof (w[0]), cmpw);
+    for (i = 1; i < n; ++i) {
+        if (w[i - 1] > w[i]) {
+            fail ("ints", n);
+            return;
+        }
+    }
+    for (i = 0; i < n; ++i) {
+        w[i] = rnd ();
+    }
+    qsort_u16 (w, n, sizeof (w[0]));
+    for (i = 1; i < n; ++i) {
+        if ((unsigned) w[i - 1] > (unsigned) w[i]) {
+            fail ("qsort_u16", n);
+            return;
+        }
+    }
+}
+
+static void test_longs (unsigned n)
+{
+    unsigned i;
+
+    for (i = 0; i < n; ++i) {
+        l[i] = ((long) rnd () << 12) - rnd ();
+    }
+    qsort (l, n, sizeof (l[0]), cmpl);
+    for (i = 1; i < n; ++i) {
+        if (l[i - 1] > l[i]) {
+            fail ("longs", n);
+            return;
+        }
+    }
+}
+
+static void test_records (unsigned n)
+{
+    unsigned i;
+
+    for (i = 0; i < n; ++i) {
+        r3[i].key = rnd () & 0x3F;
+        r3[i].tag = (unsigned char) (r3[i].key + 0x55);
+    }
+    qsort_u16 (r3, n, sizeof (r3[0]));
+    for (i = 0; i < n; ++i) {
+        if ((i > 0 && r3[i - 1].key > r3[i].key) ||
+            r3[i].tag != (unsigned char) (r3[i].key + 0x55)) {
+            fail ("records", n);
+            return;
+        }
+    }
+}
+
+int main (void)
+{
+    static const unsigned counts[] = { 0, 1, 2, 3, 7, 8, 9, 20, 100, 300 };
+    unsigned char i, j;
+
+    seed = 1;
+    for (i = 0; i < sizeof (counts) / sizeof (counts[0]); ++i) {
+        for (j = 0; j < 4; ++j) {
+            test_bytes (counts[i], j);
+        }
+        test_ints (counts[i]);
+        test_longs (counts[i] < 200 ? counts[i] : 200);
+        test_records (counts[i] < 150 ? counts[i] : 150);
+    }
+
+    for (i = 0; i < 4; ++i) {
+        big[i].key = 4 - i;
+        memset (big[i].data, 4 - i, sizeof (big[i].data));
+    }
+    qsort (big, 4, sizeof (big[0]), cmpbig);
+    for (i = 0; i < 4; ++i) {
+        if (big[i].key != i + 1 || big[i].data[0] != i + 1 ||
+            big[i].data[298] != i + 1) {
+            fail ("large elements", 4);
+            break;
+        }
+    }
+
+    for (i = 0; i < 6; ++i) {
+        for (j = 0; j < 4; ++j) {
+            nested[i][j] = (unsigned char) (20 - i * 3 - j * 5);
+        }
+    }
+    qsort (nested, 6, 4, cmpnested);
+    for (i = 0; i < 6; ++i) {
+        for (j = 1; j < 4; ++j) {
+            if (nested[i][j - 1] > nested[i][j]) {
+                fail ("nested", 6);
+            }
+        }
+        if (i > 0 && memcmp (nested[i - 1], nested[i], 4) > 0) {
+            fail ("nested order", 6);
+        }
+    }
+
+    return failures;
+}
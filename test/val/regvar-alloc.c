@@ -0,0 +1,100 @@
+/*
+  !!DESCRIPTION!! usage based allocation of register variables
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+/*
+  More register variables than register space. The compiler must pick the
+  ones used in loops and may share space between variables with disjoint
+  lifetimes. The results must not depend on the allocation. The function
+  body is read ahead for this, so a #pragma charmap inside of it must still
+  apply to the character constants that follow.
+*/
+
+#include <stdio.h>
+
+static unsigned char failures;
+
+static unsigned buf[40];
+
+static unsigned twice (register unsigned x)
+{
+    register unsigned unused = 0;
+    return x * 2 + unused;
+}
+
+static unsigned loops (void)
+{
+    register unsigned a, b, c, d;
+    register unsigned char e;
+    unsigned s = 0;
+
+    for (a = 0; a < 10; ++a) {
+        buf[a] = twice (a);
+    }
+    for (b = 10; b < 20; ++b) {
+        buf[b] = b;
+    }
+    c = 20;
+    do {
+        buf[c] = 1;
+    } while (++c < 30);
+    d = 30;
+    while (d < 40) {
+        buf[d++] = 2;
+    }
+    for (e = 0; e < 40; ++e) {
+        if (e & 1)
+            s += buf[e];
+        else
+            s -= 1;
+    }
+    return s + a + b + c + d;
+}
+
+static unsigned nested (void)
+{
+    register unsigned char i, j;
+    register unsigned t = 0;
+    register unsigned char* p = (unsigned char*) buf;
+
+    for (i = 0; i < 8; ++i) {
+        for (j = 0; j < 8; ++j) {
+            t += i * j;
+        }
+    }
+    p[0] = 1;
+    return t + p[0];
+}
+
+static unsigned charmap (void)
+{
+    register unsigned char i;
+    unsigned before = 0;
+    unsigned after;
+
+    for (i = 0; i < 2; ++i) {
+        before += 'A';
+    }
+#pragma charmap (0x41, 0x42)
+    after = 'A';
+#pragma charmap (0x41, 0x41)
+    return before + after + 'A';
+}
+
+static void check (const char* what, unsigned val, unsigned expected)
+{
+    if (val != expected) {
+        printf ("%s: %u != %u\n", what, val, expected);
+        ++failures;
+    }
+}
+
+int main (void)
+{
+    check ("loops", loops (), 120 + 10 + 20 + 30 + 40);
+    check ("nested", nested (), 785);
+    check ("charmap", charmap (), 0x41 + 0x41 + 0x42 + 0x41);
+    return failures;
+}
@@ -0,0 +1,64 @@
+/*
+  !!DESCRIPTION!! sim65 cycle counter and timing regions
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+/*
+  The cycle counter must increase, and ten NOPs between two reads must add
+  exactly 20 cycles. Timing regions may overlap and may be run repeatedly.
+*/
+
+#include <stdio.h>
+#include <sim65.h>
+
+static struct sim65_cycles A, B, C, D;
+
+static unsigned long Diff (const struct sim65_cycles* X,
+                           const struct sim65_cycles* Y)
+{
+    return Y->lo - X->lo;
+}
+
+int main (void)
+{
+    unsigned char I;
+    unsigned long Empty, Nops;
+
+    sim65_get_cycles (&A);
+    sim65_get_cycles (&B);
+    sim65_get_cycles (&C);
+    asm ("nop");
+    asm ("nop");
+    asm ("nop");
+    asm ("nop");
+    asm ("nop");
+    asm ("nop");
+    asm ("nop");
+    asm ("nop");
+    asm ("nop");
+    asm ("nop");
+    sim65_get_cycles (&D);
+
+    if (A.lo == 0 || A.hi != 0 || B.hi != 0) {
+        printf ("Bad cycle count %lu %lu\n", A.hi, A.lo);
+        return 1;
+    }
+    Empty = Diff (&A, &B);
+    Nops = Diff (&C, &D);
+    if (Empty == 0 || Nops != Empty + 20) {
+        printf ("Bad cycle differences %lu and %lu\n", Empty, Nops);
+        return 1;
+    }
+
+    sim65_region_start ("all");
+    for (I = 0; I < 10; ++I) {
+        sim65_region_start ("loop");
+        sim65_region_stop ("loop");
+    }
+    sim65_region_start ("open");
+    sim65_region_stop ("all");
+
+    printf ("Empty: %lu cycles\n", Empty);
+    return 0;
+}
@@ -0,0 +1,186 @@
+/* heap-bench.c -- Stress test and benchmark for malloc and free.
+**
+** Build and run the program twice under sim65, once with malloc and free from
+** the library and once with the size class allocator, and compare the cycle
+** counts and the memory statistics:
+**
+**   cl65 -t sim6502 -O -o heap-bench.prg heap-bench.c
+**   sim65 -c heap-bench.prg
+**   cl65 -t sim6502 -O -o heap-bench-sc.prg heap-bench.c sim6502-smalloc.o
+**   sim65 -c heap-bench-sc.prg
+**
+** The program keeps a set of blocks, most of them small, and randomly frees
+** and replaces them. The contents of every block are checked before it is
+** freed, so the program exits with a non zero code if the allocator is
+** broken. "Waste" is the part of the used heap that doesn't hold live data,
+** be it administration space, holes in the heap or unused blocks of a size
+** class.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <_heap.h>
+
+
+
+/* Number of blocks held at the same time, and number of replacements */
+#define BLOCKS  96
+#define ROUNDS  4000
+
+static unsigned char* Blocks[BLOCKS];
+static unsigned Sizes[BLOCKS];
+
+static unsigned long Seed = 1;
+static unsigned Live;
+static unsigned PeakUsed;
+static unsigned PeakWaste;
+static unsigned char Errors;
+
+
+
+static unsigned Random (void)
+/* Return a pseudo random number */
+{
+    Seed = Seed * 1103515245UL + 12345UL;
+    return (unsigned) (Seed >> 16);
+}
+
+
+
+static unsigned RandomSize (void)
+/* Return the size of a new block. Most blocks are small. */
+{
+    unsigned R = Random ();
+
+    if ((R & 0x0F) == 0) {
+        return 65 + (R >> 4) % 200;
+    } else if ((R & 0x03) == 0) {
+        return 17 + (R >> 4) % 48;
+    } else {
+        return 2 + (R >> 4) % 15;
+    }
+}
+
+
+
+static void Stats (void)
+/* Update the peak memory statistics */
+{
+    unsigned Used = (unsigned) _heapptr - (unsigned) _heaporg;
+
+    if (Used > PeakUsed) {
+        PeakUsed = Used;
+    }
+    if (Used - Live > PeakWaste) {
+        PeakWaste = Used - Live;
+    }
+}
+
+
+
+static void Alloc (unsigned char I)
+/* Allocate block I and fill it with a pattern */
+{
+    unsigned Size = RandomSize ();
+
+    Blocks[I] = malloc (Size);
+    if (Blocks[I] == 0) {
+        printf ("Out of memory\n");
+        exit (EXIT_FAILURE);
+    }
+    memset (Blocks[I], I, Size);
+    Sizes[I] = Size;
+    Live += Size;
+}
+
+
+
+static void Free (unsigned char I)
+/* Check the pattern of block I and free it */
+{
+    unsigned char* B = Blocks[I];
+    unsigned Size = Sizes[I];
+    unsigned J;
+
+    for (J = 0; J < Size; ++J) {
+        if (B[J] != I) {
+            printf ("Block %u corrupted at offset %u\n", I, J);
+            ++Errors;
+            break;
+        }
+    }
+    free (B);
+    Live -= Size;
+}
+
+
+
+static void Bench (void)
+/* Randomly replace blocks */
+{
+    unsigned char I;
+    unsigned Round;
+
+    for (I = 0; I < BLOCKS; ++I) {
+        Alloc (I);
+    }
+    for (Round = 0; Round < ROUNDS; ++Round) {
+        I = (unsigned char) (Random () % BLOCKS);
+        Free (I);
+        Stats ();
+        Alloc (I);
+        Stats ();
+    }
+    for (I = 0; I < BLOCKS; ++I) {
+        Free (I);
+    }
+}
+
+
+
+static void Check (void)
+/* Check the functions that look into allocated blocks */
+{
+    unsigned char* B;
+    void* P;
+
+    B = malloc (10);
+    strcpy ((char*) B, "abcdefghi");
+    if (_heapblocksize (B) < 10) {
+        printf ("_heapblocksize too small\n");
+        ++Errors;
+    }
+    B = realloc (B, 200);
+    if (B == 0 || strcmp ((char*) B, "abcdefghi") != 0) {
+        printf ("realloc failed\n");
+        ++Errors;
+    }
+    if (_heapblocksize (B) < 200) {
+        printf ("_heapblocksize too small after realloc\n");
+        ++Errors;
+    }
+    free (B);
+
+    if (posix_memalign (&P, 64, 20) != 0 || ((unsigned) P & 63) != 0) {
+        printf ("posix_memalign failed\n");
+        ++Errors;
+    }
+    free (P);
+}
+
+
+
+int main (void)
+{
+    Check ();
+    Bench ();
+    if (Errors) {
+        return EXIT_FAILURE;
+    }
+    printf ("%u blocks replaced\n", ROUNDS);
+    printf ("Peak heap used: %u, peak waste: %u\n", PeakUsed, PeakWaste);
+    printf ("Free memory: %u, largest block: %u\n",
+            _heapmemavail (), _heapmaxavail ());
+    return EXIT_SUCCESS;
+}
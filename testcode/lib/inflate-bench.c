@@ -0,0 +1,298 @@
+/* inflate-bench.c -- Check and benchmark inflatemem and crc32.
+**
+** Build and run the program under sim65 with the functions from the library,
+** with the table driven inflatemem and with the precomputed crc32 table, and
+** compare the cycle counts:
+**
+**   cl65 -t sim6502 -O -o inflate-bench.prg inflate-bench.c
+**   sim65 -c inflate-bench.prg 10
+**   cl65 -t sim6502 -O -o inflate-bench-fast.prg inflate-bench.c \
+**        sim6502-inflatefast.o sim6502-crc32rom.o
+**   sim65 -c inflate-bench-fast.prg 10
+**
+** The argument is the number of rounds. The difference of the cycle counts
+** for two numbers of rounds divided by the difference of the numbers gives the
+** cycles for one round, without the setup of the program. One round inflates
+** a dynamic, a fixed and a stored deflate stream of together 5632 bytes and
+** checks the CRC32 of the results, so the program exits with a non zero code
+** if inflatemem or crc32 is broken. The data is the start of
+** libsrc/zlib/inflatemem.s, compressed with zlib at level 9 and 0.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <zlib.h>
+
+
+
+/* Compressed data */
+static const unsigned char Dynamic[1383] = {
+    0xB5, 0x57, 0x6D, 0x6F, 0xDB, 0x38, 0x0C, 0xFE, 0xEE, 0x5F, 0x41, 0x6C,
+    0x07, 0x74, 0xBB, 0xA4, 0x41, 0xE2, 0x76, 0x6F, 0x09, 0xF2, 0x61, 0xED,
+    0xB2, 0xAD, 0x40, 0xD7, 0x16, 0x4D, 0x80, 0xC3, 0xF6, 0xC5, 0x90, 0x6D,
+    0x25, 0xD1, 0x66, 0x4B, 0x82, 0x24, 0xAF, 0x71, 0x7F, 0xFD, 0x51, 0xB2,
+    0xE3, 0x97, 0xD8, 0xE9, 0xED, 0x0E, 0xB7, 0x7C, 0x48, 0x53, 0x51, 0x24,
+    0x45, 0x8A, 0xCF, 0x43, 0x6A, 0xE6, 0xCD, 0xC0, 0x1F, 0x4F, 0xDE, 0x9C,
+    0x4E, 0x26, 0xA7, 0xE3, 0x37, 0x43, 0xB8, 0x63, 0xC2, 0x28, 0xF8, 0x98,
+    0x69, 0xF6, 0xC3, 0x9B, 0xA1, 0x2C, 0xE3, 0x9A, 0x6D, 0x38, 0x8D, 0x21,
+    0x08, 0xD6, 0x44, 0x9B, 0x88, 0x24, 0x49, 0x10, 0x00, 0xE3, 0xEB, 0x84,
+    0x18, 0x9A, 0xD2, 0x14, 0x5E, 0x54, 0x3B, 0xA2, 0x2D, 0x51, 0x7F, 0x42,
+    0x4C, 0xB5, 0x19, 0xA2, 0xE2, 0x3F, 0x7F, 0x22, 0xC1, 0xB5, 0x81, 0x03,
+    0x75, 0x2D, 0x32, 0x15, 0xD1, 0x97, 0x33, 0xE7, 0xFC, 0xE6, 0x76, 0xB5,
+    0x98, 0xC2, 0x05, 0x05, 0xBA, 0x33, 0x0A, 0xBD, 0x25, 0x39, 0x44, 0x44,
+    0xD1, 0x75, 0x96, 0xC0, 0x03, 0x33, 0x5B, 0x48, 0x45, 0xCC, 0xD6, 0x2C,
+    0x22, 0x86, 0xA1, 0xA9, 0x21, 0x84, 0x34, 0x22, 0x99, 0xA6, 0x60, 0xB6,
+    0x4C, 0xA3, 0xF5, 0x98, 0x02, 0xFE, 0xDD, 0x52, 0xF2, 0x93, 0x25, 0x39,
+    0x5A, 0x13, 0xD2, 0xB0, 0x94, 0x3D, 0xA2, 0xAB, 0xB5, 0x50, 0xA0, 0xF1,
+    0x17, 0xBC, 0xB0, 0xBF, 0xE8, 0x8E, 0xA4, 0x32, 0xA1, 0x40, 0xB4, 0xCE,
+    0x52, 0x8A, 0x9A, 0x54, 0x19, 0xC2, 0x38, 0x28, 0xBA, 0x61, 0xDA, 0x50,
+    0x05, 0x84, 0xA3, 0x4A, 0x42, 0x36, 0xF0, 0x93, 0x24, 0x19, 0xD5, 0x68,
+    0xEA, 0x61, 0x4B, 0x39, 0x30, 0xA3, 0x31, 0x11, 0xB8, 0x81, 0x93, 0x04,
+    0x94, 0xC8, 0x0C, 0xE3, 0xA8, 0xAD, 0xA8, 0xC9, 0x14, 0x7F, 0x39, 0x82,
+    0x15, 0x26, 0xA2, 0x38, 0xA6, 0xD9, 0x52, 0xD8, 0x64, 0xFC, 0x91, 0xC9,
+    0xD7, 0xAF, 0x40, 0x3B, 0x67, 0x23, 0x8C, 0xCF, 0xDB, 0x27, 0x62, 0x44,
+    0x77, 0x52, 0x28, 0x53, 0x25, 0x26, 0xA8, 0xD3, 0xDB, 0xD8, 0xC4, 0xD2,
+    0xD6, 0x26, 0xC6, 0x23, 0x2D, 0xFD, 0x43, 0xF1, 0xA3, 0x2C, 0xFF, 0xD7,
+    0x72, 0x08, 0x1A, 0x23, 0x18, 0x82, 0x34, 0x6A, 0xE2, 0xBE, 0x7D, 0xF7,
+    0x7D, 0xE6, 0xBE, 0xCF, 0x3D, 0x8C, 0xE2, 0xF4, 0x7F, 0xFB, 0xB8, 0xDB,
+    0xBA, 0xB4, 0xF7, 0x49, 0xB8, 0xD1, 0x36, 0xB6, 0x19, 0xBC, 0x57, 0x1B,
+    0x4C, 0x27, 0x37, 0x65, 0xD6, 0x5C, 0xD2, 0x37, 0xD4, 0x5C, 0x60, 0xDA,
+    0x46, 0xDE, 0xA7, 0xC5, 0x2A, 0x98, 0x04, 0x17, 0x57, 0xAB, 0x46, 0x3D,
+    0xCC, 0xE1, 0x8F, 0xB7, 0x13, 0x27, 0xF1, 0xAD, 0x64, 0xD9, 0x96, 0xF8,
+    0x4E, 0x72, 0xD6, 0x23, 0x39, 0x77, 0x92, 0xF3, 0x1E, 0xC9, 0x5B, 0x27,
+    0x79, 0xD5, 0x95, 0xBC, 0x1B, 0x3B, 0xC9, 0xEB, 0xAE, 0x84, 0x14, 0x92,
+    0x37, 0x5D, 0x49, 0x34, 0xB6, 0x51, 0x7D, 0xCE, 0xD6, 0xEB, 0x94, 0x70,
+    0xC0, 0x7A, 0xA4, 0x18, 0xC7, 0xEA, 0x7E, 0xB1, 0x08, 0x96, 0x57, 0xDF,
+    0x16, 0xAD, 0x38, 0x26, 0xAF, 0xBD, 0xBB, 0xFB, 0xAB, 0x2F, 0xEF, 0xEF,
+    0xBF, 0x06, 0x76, 0x43, 0x2D, 0x18, 0x7B, 0x1F, 0xAE, 0x96, 0xAB, 0xF7,
+    0x37, 0x97, 0x8B, 0xA6, 0x60, 0x0E, 0x95, 0x19, 0x97, 0xB8, 0x44, 0x6E,
+    0x49, 0x48, 0xCD, 0xC8, 0xBB, 0x5E, 0xDC, 0x7C, 0x5A, 0x7D, 0x0E, 0x96,
+    0x5F, 0xBF, 0x5C, 0xDC, 0x5E, 0x2F, 0x2B, 0xEB, 0x03, 0xFF, 0xDD, 0xC0,
+    0xB7, 0xBF, 0x67, 0xB0, 0xB8, 0xFD, 0x38, 0x04, 0xFF, 0x1D, 0x24, 0x94,
+    0x6F, 0xB0, 0xD2, 0x74, 0x9E, 0x86, 0x22, 0x41, 0x28, 0x98, 0x07, 0x81,
+    0xC8, 0x42, 0x30, 0xC4, 0xFB, 0xB5, 0xDA, 0x73, 0xC3, 0xDC, 0x1C, 0xCE,
+    0xC6, 0xDE, 0xE5, 0xED, 0xCD, 0xEA, 0xFE, 0xF6, 0xBA, 0xE5, 0x66, 0x0E,
+    0x6D, 0xDF, 0x83, 0x43, 0x6D, 0xEF, 0x37, 0x14, 0xD0, 0x1D, 0xD9, 0x50,
+    0x78, 0xA4, 0x4A, 0x14, 0x05, 0x74, 0x27, 0x1C, 0xBA, 0xC0, 0x08, 0x87,
+    0xA0, 0x48, 0xA4, 0x52, 0x51, 0x6D, 0x43, 0x8A, 0x89, 0x21, 0x23, 0x8F,
+    0x71, 0x99, 0x99, 0xFD, 0xA6, 0x83, 0xCF, 0x74, 0x0E, 0xAE, 0xF0, 0x8B,
+    0x2C, 0xF9, 0x10, 0xE6, 0x06, 0x81, 0xDB, 0x35, 0x9A, 0xF1, 0x8E, 0x59,
+    0x04, 0xF2, 0x51, 0xBB, 0xA5, 0x59, 0xBF, 0x63, 0xF6, 0x5A, 0x20, 0x33,
+    0x62, 0xA5, 0x2B, 0x46, 0xC2, 0xC4, 0x16, 0x06, 0x5E, 0x23, 0x96, 0x3C,
+    0x41, 0xF2, 0xD0, 0xD6, 0x91, 0x72, 0x5C, 0xC4, 0x85, 0x25, 0xBD, 0x75,
+    0xC2, 0x22, 0x33, 0xB4, 0x44, 0x40, 0x01, 0x21, 0x2E, 0x54, 0x0E, 0x89,
+    0x28, 0x49, 0x0C, 0x90, 0xDE, 0xC0, 0x5E, 0x1B, 0x1A, 0xB0, 0x80, 0x41,
+    0x7E, 0x5B, 0xA3, 0xB2, 0x43, 0x51, 0x65, 0xDB, 0x2B, 0xF9, 0x61, 0x69,
+    0x84, 0xA2, 0x71, 0x20, 0x31, 0x6D, 0x97, 0x22, 0x2B, 0x8F, 0x5B, 0x1E,
+    0xF1, 0xAC, 0x38, 0xE2, 0xC4, 0x1D, 0x71, 0xAF, 0xF0, 0x21, 0xE7, 0x24,
+    0x65, 0x51, 0x50, 0x94, 0x44, 0x3B, 0xA6, 0x27, 0x15, 0x12, 0xA4, 0xFE,
+    0xEB, 0xA2, 0xC4, 0x6A, 0x85, 0xC1, 0xA4, 0xA1, 0x50, 0xF1, 0x10, 0xB2,
+    0x28, 0xF2, 0xA7, 0xE3, 0x18, 0xAC, 0x22, 0x67, 0x78, 0x00, 0x48, 0x3D,
+    0x54, 0x29, 0xA1, 0x86, 0xF0, 0xEC, 0x86, 0x62, 0xA6, 0xCD, 0x16, 0xE1,
+    0x53, 0x64, 0xCF, 0x85, 0x79, 0xE0, 0x0E, 0xA9, 0x4F, 0x5E, 0x22, 0x7F,
+    0xEB, 0x67, 0xDE, 0x31, 0x09, 0x74, 0x0E, 0x72, 0x56, 0xDE, 0xC6, 0x81,
+    0x06, 0x36, 0xAC, 0x4A, 0xC1, 0x69, 0x1C, 0xB3, 0x88, 0x56, 0x8E, 0x85,
+    0x2F, 0x15, 0x4B, 0x89, 0xCA, 0x0B, 0x3B, 0x4F, 0xDA, 0xF0, 0x3B, 0x36,
+    0xDC, 0x7A, 0x50, 0xB4, 0xB5, 0xAA, 0xA8, 0xDA, 0x39, 0xF7, 0xDB, 0x27,
+    0x2F, 0x34, 0x0A, 0x44, 0x7F, 0x61, 0x08, 0x62, 0xBF, 0x8E, 0xF5, 0xBC,
+    0x75, 0x4B, 0x25, 0x9D, 0x06, 0x21, 0xC1, 0xAE, 0xD7, 0x53, 0xAA, 0xB6,
+    0x01, 0xF4, 0x28, 0x04, 0x61, 0x66, 0xAB, 0xEA, 0x88, 0x42, 0xEB, 0x5A,
+    0x7F, 0x4B, 0x9B, 0x88, 0xA9, 0x05, 0x78, 0xA3, 0xCB, 0x4D, 0xAD, 0x9B,
+    0x16, 0x9C, 0xE7, 0xE5, 0x20, 0x50, 0xD5, 0x15, 0x76, 0x96, 0xB2, 0xED,
+    0xD5, 0xBB, 0x1A, 0xC2, 0x5D, 0x47, 0x38, 0x98, 0xD8, 0x96, 0xDF, 0xC2,
+    0xF2, 0xDC, 0x0D, 0x27, 0x95, 0x56, 0x12, 0xE7, 0xEE, 0xEF, 0xF3, 0x49,
+    0x63, 0xA9, 0xF0, 0xF2, 0x42, 0xCB, 0x97, 0xC3, 0xBC, 0xE3, 0xBC, 0x65,
+    0x6E, 0x50, 0xAB, 0xC5, 0x34, 0xFF, 0x4F, 0x26, 0xBC, 0x6A, 0x4E, 0xAA,
+    0xCE, 0x32, 0x6E, 0x68, 0x14, 0x4B, 0xAD, 0x3B, 0xAB, 0xB0, 0x1F, 0x84,
+    0xC8, 0x19, 0x3F, 0xAE, 0x85, 0x90, 0x53, 0x34, 0xF2, 0x89, 0x1A, 0x20,
+    0x10, 0x32, 0x03, 0x62, 0x6D, 0x7B, 0x82, 0x1B, 0x59, 0x6C, 0x0F, 0x08,
+    0xED, 0x90, 0x82, 0x6B, 0x6E, 0x37, 0x98, 0x5C, 0xD2, 0x5F, 0x77, 0x59,
+    0xD4, 0x55, 0x27, 0xB0, 0xE7, 0x75, 0x1F, 0xAE, 0x64, 0xDF, 0xB5, 0x6A,
+    0x2A, 0xD6, 0x3A, 0xE5, 0x3A, 0xB1, 0x7C, 0xE8, 0x0E, 0xF5, 0xCD, 0x32,
+    0xA0, 0x1B, 0xAF, 0xEA, 0x23, 0x0D, 0xE1, 0x72, 0xBF, 0xAA, 0xDD, 0xE9,
+    0xED, 0xB0, 0x85, 0x1A, 0x4B, 0xF2, 0x93, 0xD6, 0xFF, 0xEF, 0x6D, 0xCA,
+    0xAD, 0xAC, 0x7E, 0x87, 0x9C, 0x96, 0x17, 0x5F, 0x22, 0x67, 0xCF, 0xE5,
+    0x36, 0xB3, 0x1F, 0xE8, 0x9E, 0xDB, 0x31, 0x37, 0x27, 0xDA, 0x91, 0xE5,
+    0x89, 0x23, 0xF9, 0xC2, 0xF7, 0xE8, 0x5F, 0x67, 0xDF, 0x41, 0x09, 0xA7,
+    0x55, 0xB4, 0x54, 0x64, 0x16, 0x49, 0x97, 0x25, 0x0E, 0x29, 0x10, 0x22,
+    0x03, 0xC7, 0x48, 0x12, 0x7D, 0x39, 0xF9, 0x4B, 0xA8, 0xB8, 0xC2, 0xD9,
+    0x0C, 0xF4, 0x0F, 0x26, 0x5D, 0xF7, 0x29, 0xBB, 0xF6, 0x03, 0x85, 0x58,
+    0xF0, 0x13, 0x03, 0x1C, 0xB9, 0xF1, 0x17, 0xF4, 0x71, 0xC5, 0xA9, 0x0B,
+    0x4E, 0x4F, 0xB4, 0xEB, 0x8B, 0x09, 0x75, 0x93, 0x56, 0x61, 0xAF, 0x07,
+    0x33, 0x47, 0xDA, 0x45, 0x9D, 0xC7, 0x48, 0xF7, 0xEC, 0x5C, 0x33, 0xA5,
+    0xCD, 0x85, 0x0D, 0x6E, 0x06, 0xDF, 0x53, 0x79, 0xD0, 0x76, 0x22, 0x21,
+    0x73, 0x2B, 0x9C, 0xF6, 0x56, 0x81, 0x25, 0x8F, 0x7D, 0x7A, 0x35, 0x8D,
+    0x5A, 0xBA, 0xFD, 0x5A, 0x7A, 0x2F, 0x6A, 0x9C, 0x2A, 0x6A, 0xDF, 0xAE,
+    0xE3, 0x45, 0x2C, 0x79, 0xEF, 0xC8, 0x39, 0x6B, 0xA3, 0x8C, 0xEF, 0x8E,
+    0x15, 0xC9, 0xC1, 0xF1, 0x1B, 0x2A, 0xD1, 0xAF, 0x66, 0xEB, 0x69, 0x83,
+    0x18, 0xF7, 0x85, 0xAB, 0xED, 0x98, 0xD6, 0xC3, 0xC5, 0xA8, 0x02, 0x2E,
+    0xC7, 0xC7, 0x8C, 0x93, 0xD7, 0xA7, 0x95, 0x89, 0x3C, 0x16, 0x74, 0x8D,
+    0xF3, 0x76, 0x49, 0xE3, 0xB0, 0x50, 0xDE, 0xBC, 0xB1, 0x8F, 0x89, 0xF2,
+    0xD9, 0x71, 0x40, 0x78, 0xA7, 0x87, 0x84, 0xD7, 0xC7, 0x41, 0x3D, 0x20,
+    0x68, 0x5E, 0x5C, 0x55, 0x4C, 0x61, 0xD4, 0xC7, 0x6B, 0x8C, 0xE7, 0x0D,
+    0x64, 0x92, 0xA7, 0x7D, 0x35, 0x28, 0xF3, 0x88, 0x39, 0x43, 0x76, 0x8D,
+    0xAC, 0x58, 0xDA, 0x90, 0x42, 0xB6, 0xA3, 0xC0, 0x4A, 0x6C, 0x3E, 0x80,
+    0xBC, 0x0E, 0xF6, 0xA7, 0x87, 0xD8, 0x2F, 0x67, 0xF6, 0x53, 0xFB, 0x24,
+    0x8C, 0x1B, 0x04, 0x60, 0x49, 0x69, 0x3E, 0x99, 0xC2, 0x9A, 0xED, 0x70,
+    0xDD, 0x2D, 0x0D, 0xD1, 0x2C, 0x33, 0x8C, 0x24, 0xF6, 0x75, 0xE8, 0x1E,
+    0x6F, 0x85, 0xD0, 0xAA, 0x6A, 0xB7, 0xDF, 0x9F, 0x42, 0x5C, 0xB4, 0xFD,
+    0xBD, 0x06, 0xC2, 0x0C, 0x07, 0x9E, 0x10, 0xDF, 0xA6, 0x09, 0xC5, 0x21,
+    0x8D, 0x6F, 0x00, 0x67, 0x8E, 0xE2, 0xFD, 0x59, 0x00, 0xB2, 0x50, 0x3C,
+    0x9B, 0xA2, 0x6D, 0x7C, 0x0B, 0xB1, 0xF8, 0x70, 0x94, 0x1D, 0xE2, 0x60,
+    0x68, 0x60, 0x8B, 0xF4, 0x98, 0xE0, 0x0A, 0x52, 0xA3, 0x7B, 0xC0, 0x96,
+    0x2F, 0xCA, 0x2A, 0x6E, 0x2A, 0x0A, 0x9C, 0x3C, 0xF7, 0x7B, 0xDB, 0x46,
+    0x27, 0x0D, 0x81, 0xA6, 0xC6, 0x42, 0xA6, 0x98, 0xDB, 0xF4, 0xB4, 0x37,
+    0xC7, 0xE1, 0xDF,
+};
+static const unsigned char Fixed[589] = {
+    0xB3, 0xE6, 0xB2, 0x56, 0x30, 0x32, 0x30, 0x34, 0xD7, 0x35, 0x34, 0xD4,
+    0x35, 0x30, 0xD7, 0x51, 0x08, 0xC8, 0xCC, 0x2F, 0x29, 0x52, 0x70, 0x2B,
+    0x2D, 0xCE, 0xCC, 0xE6, 0xB2, 0x06, 0xCA, 0x95, 0xE6, 0x15, 0x67, 0xA6,
+    0xE7, 0xA5, 0xA6, 0x28, 0xC4, 0xC7, 0xA7, 0x25, 0x16, 0x97, 0x24, 0x27,
+    0xE6, 0xE4, 0xC4, 0xC7, 0x2B, 0x64, 0xE6, 0xA5, 0xE5, 0x24, 0x96, 0xA4,
+    0xE6, 0xA6, 0xE6, 0x2A, 0x68, 0xC0, 0x55, 0x24, 0x67, 0x24, 0x16, 0x69,
+    0x29, 0xA4, 0xA4, 0x16, 0x97, 0xE8, 0x00, 0x35, 0x12, 0x06, 0xC9, 0xF9,
+    0x79, 0xC5, 0x25, 0x0A, 0x68, 0xDA, 0x8B, 0xF3, 0x4B, 0x8B, 0x92, 0x53,
+    0x35, 0xAD, 0xC1, 0x96, 0xFB, 0xF9, 0x87, 0xB8, 0x5A, 0x29, 0x38, 0xA5,
+    0x2A, 0xA4, 0x56, 0x94, 0x14, 0x01, 0x6D, 0xCB, 0xA9, 0x54, 0x48, 0x4E,
+    0x2C, 0x4A, 0x4D, 0x2B, 0xCD, 0x51, 0x28, 0xCF, 0x2C, 0xC9, 0x50, 0xC8,
+    0xCD, 0x4F, 0xC9, 0x4C, 0xCB, 0x4C, 0x4E, 0x2C, 0xC9, 0x04, 0x1A, 0xA5,
+    0xA3, 0x90, 0x94, 0x9A, 0x9C, 0x58, 0x5A, 0x9C, 0xAA, 0x50, 0x92, 0x91,
+    0x59, 0x0C, 0x34, 0x3D, 0x25, 0x55, 0x01, 0x48, 0x67, 0xA4, 0x26, 0x96,
+    0x65, 0xE6, 0x54, 0x02, 0x4D, 0xCB, 0x2F, 0x28, 0xC9, 0xCC, 0xCD, 0xAC,
+    0x02, 0x5A, 0x95, 0x96, 0x5F, 0xA4, 0x50, 0x0C, 0x64, 0x29, 0x68, 0x80,
+    0x58, 0xA9, 0x15, 0x89, 0xB9, 0x05, 0x39, 0xA9, 0x0A, 0x89, 0xC5, 0xC5,
+    0xA5, 0xB9, 0xA9, 0x40, 0x9D, 0xA9, 0x45, 0x25, 0x89, 0x99, 0x79, 0x0A,
+    0x45, 0xA9, 0xE9, 0x99, 0xC5, 0x25, 0xA9, 0x45, 0x0A, 0x89, 0x79, 0x40,
+    0x2D, 0x39, 0x89, 0xE9, 0x0A, 0x65, 0x89, 0x39, 0xA5, 0xA9, 0xC5, 0x40,
+    0xA3, 0xCA, 0x33, 0x52, 0xF3, 0x14, 0x32, 0x4B, 0x8A, 0x81, 0x01, 0x01,
+    0x54, 0x90, 0x97, 0x98, 0xA3, 0x50, 0x94, 0x5F, 0x5A, 0x92, 0x99, 0x07,
+    0xD4, 0x5D, 0x94, 0x5A, 0x52, 0x5A, 0x94, 0xA7, 0xA9, 0xA7, 0x10, 0x02,
+    0x0C, 0x08, 0x88, 0x33, 0x4B, 0x32, 0x52, 0x15, 0xD2, 0x4B, 0xF3, 0xAA,
+    0x32, 0x0B, 0xCC, 0x4C, 0x15, 0x8A, 0xC1, 0x96, 0xE9, 0x01, 0xFD, 0xC7,
+    0x05, 0x0B, 0x08, 0xBD, 0xD4, 0x8A, 0x82, 0xFC, 0xA2, 0x12, 0x78, 0xC0,
+    0xC4, 0x23, 0x82, 0x17, 0x49, 0x51, 0x66, 0x2E, 0x8A, 0xA2, 0xCC, 0xBC,
+    0xE4, 0xE2, 0x02, 0x23, 0x74, 0xE9, 0xAA, 0x02, 0x28, 0xBF, 0xB8, 0x40,
+    0x47, 0xA1, 0x18, 0xE8, 0x03, 0x1D, 0x85, 0x82, 0x92, 0x22, 0x43, 0x30,
+    0x69, 0x04, 0x26, 0x8D, 0xC1, 0xA4, 0x09, 0x17, 0xD0, 0x17, 0xBA, 0x54,
+    0x03, 0xE0, 0xD8, 0x72, 0x06, 0xC5, 0x67, 0x62, 0x5E, 0x49, 0x31, 0xC8,
+    0x6F, 0xD6, 0x0A, 0x8E, 0x45, 0xE9, 0xC0, 0xE0, 0xCC, 0x2B, 0x81, 0x86,
+    0x1A, 0x38, 0xD0, 0xD3, 0x53, 0x4B, 0x9C, 0x80, 0xC1, 0xA6, 0xC7, 0xE5,
+    0xEE, 0x1A, 0x12, 0x6F, 0x18, 0xEF, 0xE4, 0x19, 0x82, 0x94, 0x1E, 0x6C,
+    0x15, 0x54, 0x2C, 0x0C, 0xC1, 0x32, 0x46, 0x20, 0x99, 0x60, 0x54, 0x19,
+    0x23, 0xB0, 0x8C, 0x31, 0x16, 0x19, 0x13, 0xB0, 0x8C, 0x09, 0x16, 0x19,
+    0x0B, 0xB0, 0x8C, 0x29, 0xA6, 0x8C, 0xA5, 0x01, 0x58, 0xC6, 0x0C, 0x53,
+    0x26, 0x11, 0x22, 0x63, 0x8E, 0x29, 0x93, 0x6C, 0x00, 0xF2, 0x95, 0x47,
+    0x69, 0x5A, 0x5A, 0x6E, 0x62, 0x9E, 0x02, 0x30, 0x3D, 0xA6, 0x02, 0xFD,
+    0x11, 0x12, 0xE4, 0xEA, 0x1A, 0x1F, 0xEC, 0x19, 0xE5, 0x8A, 0xE2, 0x0F,
+    0x43, 0x33, 0xAE, 0x80, 0x20, 0x4F, 0x5F, 0xC7, 0xA0, 0xC8, 0x78, 0x90,
+    0x02, 0x84, 0x84, 0x01, 0x97, 0x8B, 0x67, 0x70, 0x88, 0xA3, 0x9F, 0xB3,
+    0x2B, 0xB2, 0x84, 0xAD, 0x02, 0xDC, 0x18, 0x70, 0xC0, 0xE5, 0x14, 0x64,
+    0x24, 0x26, 0xA5, 0x96, 0xE8, 0x71, 0xF9, 0xB8, 0xFA, 0xB9, 0x87, 0x78,
+    0xC4, 0x07, 0x47, 0xFA, 0x3A, 0xF9, 0xFB, 0x04, 0xC3, 0x4D, 0xD7, 0x36,
+    0xB2, 0xD4, 0x36, 0x02, 0xB1, 0xAD, 0x15, 0x5C, 0xFD, 0xDD, 0x74, 0x14,
+    0x8C, 0x2C, 0x15, 0x72, 0x52, 0xF3, 0xD2, 0x81, 0x29, 0xAD, 0xB8, 0x32,
+    0x37, 0x29, 0x3F, 0x07, 0x98, 0x15, 0x4A, 0xCA, 0xF3, 0x81, 0x39, 0x0B,
+    0x98, 0x19, 0x52, 0x60, 0x62, 0x08, 0x9B, 0x91, 0x8C, 0xB3, 0x55, 0x00,
+    0x00,
+};
+static const unsigned char Stored[517] = {
+    0x01, 0x00, 0x02, 0xFF, 0xFD, 0x3B, 0x0A, 0x3B, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2D, 0x31, 0x31, 0x2D, 0x30, 0x37, 0x2C, 0x20, 0x50, 0x69, 0x6F,
+    0x74, 0x72, 0x20, 0x46, 0x75, 0x73, 0x69, 0x6B, 0x0A, 0x3B, 0x0A, 0x3B,
+    0x20, 0x75, 0x6E, 0x73, 0x69, 0x67, 0x6E, 0x65, 0x64, 0x20, 0x5F, 0x5F,
+    0x66, 0x61, 0x73, 0x74, 0x63, 0x61, 0x6C, 0x6C, 0x5F, 0x5F, 0x20, 0x69,
+    0x6E, 0x66, 0x6C, 0x61, 0x74, 0x65, 0x6D, 0x65, 0x6D, 0x20, 0x28, 0x75,
+    0x6E, 0x73, 0x69, 0x67, 0x6E, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+    0x2A, 0x20, 0x64, 0x65, 0x73, 0x74, 0x2C, 0x0A, 0x3B, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73,
+    0x74, 0x20, 0x75, 0x6E, 0x73, 0x69, 0x67, 0x6E, 0x65, 0x64, 0x20, 0x63,
+    0x68, 0x61, 0x72, 0x2A, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x29,
+    0x3B, 0x0A, 0x3B, 0x0A, 0x3B, 0x20, 0x4E, 0x4F, 0x54, 0x45, 0x3A, 0x20,
+    0x42, 0x65, 0x20, 0x65, 0x78, 0x74, 0x72, 0x65, 0x6D, 0x65, 0x6C, 0x79,
+    0x20, 0x63, 0x61, 0x72, 0x65, 0x66, 0x75, 0x6C, 0x20, 0x77, 0x69, 0x74,
+    0x68, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69,
+    0x6F, 0x6E, 0x73, 0x2C, 0x20, 0x62, 0x65, 0x63, 0x61, 0x75, 0x73, 0x65,
+    0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x69,
+    0x73, 0x20, 0x68, 0x65, 0x61, 0x76, 0x69, 0x6C, 0x79, 0x0A, 0x3B, 0x20,
+    0x6F, 0x70, 0x74, 0x69, 0x6D, 0x69, 0x7A, 0x65, 0x64, 0x20, 0x66, 0x6F,
+    0x72, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x28, 0x66, 0x6F, 0x72, 0x20,
+    0x65, 0x78, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x20, 0x61, 0x73, 0x73, 0x75,
+    0x6D, 0x65, 0x73, 0x20, 0x63, 0x65, 0x72, 0x74, 0x61, 0x69, 0x6E, 0x20,
+    0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x66, 0x6C, 0x61, 0x67, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73,
+    0x0A, 0x3B, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x69, 0x74, 0x73, 0x20,
+    0x69, 0x6E, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x20, 0x72, 0x6F, 0x75,
+    0x74, 0x69, 0x6E, 0x65, 0x73, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x29, 0x2E, 0x20, 0x54, 0x65, 0x73, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x75, 0x6E, 0x7A, 0x69, 0x70, 0x36,
+    0x35, 0x20, 0x73, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x2E, 0x0A, 0x3B, 0x0A,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x65, 0x78,
+    0x70, 0x6F, 0x72, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x5F, 0x69, 0x6E, 0x66, 0x6C, 0x61, 0x74, 0x65, 0x6D, 0x65, 0x6D,
+    0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x69,
+    0x6D, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x69, 0x6E, 0x63, 0x73, 0x70, 0x32, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74,
+    0x7A, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x70, 0x2C,
+    0x20, 0x73, 0x72, 0x65, 0x67, 0x2C, 0x20, 0x70, 0x74, 0x72, 0x31, 0x2C,
+    0x20, 0x70, 0x74, 0x72, 0x32, 0x2C, 0x20, 0x70, 0x74, 0x72, 0x33, 0x2C,
+    0x20, 0x70, 0x74, 0x72, 0x34, 0x0A, 0x0A, 0x3B, 0x20, 0x2D, 0x2D, 0x2D,
+    0x2D,
+};
+
+
+
+struct Stream {
+    const char*          Name;
+    const unsigned char* Data;
+    unsigned             Size;
+    unsigned long        CRC;
+};
+
+static const struct Stream Streams[] = {
+    { "dynamic",  Dynamic,  4096, 0xABD726ECUL },
+    { "fixed",    Fixed,    1024, 0x17478E0EUL },
+    { "stored",   Stored,   512,  0x5486A451UL },
+};
+
+static unsigned char Buf[4096];
+
+
+
+static unsigned char Check (const struct Stream* S)
+/* Inflate one stream and check the result. Return non zero on errors. */
+{
+    unsigned Size = inflatemem (Buf, S->Data);
+
+    if (Size != S->Size) {
+        printf ("%s: got %u bytes instead of %u\n", S->Name, Size, S->Size);
+        return 1;
+    }
+    if (crc32 (crc32 (0, 0, 0), Buf, Size) != S->CRC) {
+        printf ("%s: wrong CRC\n", S->Name);
+        return 1;
+    }
+    return 0;
+}
+
+
+
+int main (int argc, char* argv[])
+{
+    unsigned Rounds = argc > 1 ? atoi (argv[1]) : 1;
+    unsigned Round;
+    unsigned char I;
+
+    for (Round = 0; Round < Rounds; ++Round) {
+        for (I = 0; I < sizeof (Streams) / sizeof (Streams[0]); ++I) {
+            if (Check (&Streams[I])) {
+                return EXIT_FAILURE;
+            }
+        }
+    }
+    printf ("%u rounds inflated\n", Rounds);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,152 @@
+/* lz65-bench.c -- Check and benchmark the lz65 and lz4 decompressors.
+**
+** Compress a file with util/lz65 in both formats, then run the program under
+** sim65 with the file names and the number of rounds:
+**
+**   lz65 asset.bin asset.lz65
+**   lz65 -4 asset.bin asset.lz4
+**   cl65 -t sim6502 -O -o lz65-bench.prg lz65-bench.c
+**   sim65 lz65-bench.prg asset.bin asset.lz65 asset.lz4 10
+**
+** The program checks that all decompressors restore the original file and
+** prints the compression ratios. Then it decompresses the file the given
+** number of times with each decompressor, and prints the cycles per
+** decompressed byte. sim65 adds a summary of the timing regions at exit.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lz4.h>
+#include <lz65.h>
+#include <sim65.h>
+
+
+
+/* Maximum size of a file */
+#define MAX_SIZE        12000U
+
+static unsigned char Orig[MAX_SIZE];
+static unsigned char LZ65[MAX_SIZE + 64];
+static unsigned char LZ4[MAX_SIZE + 64];
+static unsigned char Buf[MAX_SIZE];
+
+static unsigned OrigSize;
+static unsigned LZ65Size;
+static unsigned LZ4Size;
+
+/* Names of the decompressors */
+static const char* const Names[3] = {
+    "decompress_lz65",
+    "decompress_lz65_fast",
+    "decompress_lz4"
+};
+
+
+
+static unsigned Load (const char* Name, unsigned char* Data, unsigned Max)
+/* Load a file and return its size */
+{
+    FILE* F = fopen (Name, "rb");
+    unsigned Size;
+
+    if (F == 0) {
+        printf ("Cannot open %s\n", Name);
+        exit (EXIT_FAILURE);
+    }
+    Size = fread (Data, 1, Max, F);
+    if (fgetc (F) != EOF) {
+        printf ("%s is too large\n", Name);
+        exit (EXIT_FAILURE);
+    }
+    fclose (F);
+    return Size;
+}
+
+
+
+static unsigned Decompress (unsigned char Which)
+/* Decompress the file with one of the decompressors, return the size */
+{
+    switch (Which) {
+        case 0:
+            return decompress_lz65 (LZ65, Buf);
+        case 1:
+            return decompress_lz65_fast (LZ65, Buf);
+        default:
+            decompress_lz4 (LZ4, Buf, OrigSize);
+            return OrigSize;
+    }
+}
+
+
+
+static void Check (unsigned char Which)
+/* Decompress the file with one of the decompressors and check the result */
+{
+    memset (Buf, 0, OrigSize);
+    if (Decompress (Which) != OrigSize || memcmp (Buf, Orig, OrigSize) != 0) {
+        printf ("%s failed\n", Names[Which]);
+        exit (EXIT_FAILURE);
+    }
+}
+
+
+
+static void Bench (unsigned char Which, unsigned Rounds)
+/* Decompress the file Rounds times and print the cycles per byte */
+{
+    struct sim65_cycles Start, End;
+    unsigned I;
+
+    sim65_get_cycles (&Start);
+    sim65_region_start (Names[Which]);
+    for (I = 0; I < Rounds; ++I) {
+        Decompress (Which);
+    }
+    sim65_region_stop (Names[Which]);
+    sim65_get_cycles (&End);
+
+    printf ("%-20s %lu cycles/byte\n", Names[Which],
+            (End.lo - Start.lo) / ((unsigned long) Rounds * OrigSize));
+}
+
+
+
+static unsigned Percent (unsigned Size)
+/* Return Size in percent of the original size */
+{
+    return (unsigned) ((Size * 100UL + OrigSize / 2) / OrigSize);
+}
+
+
+
+int main (int argc, char* argv[])
+{
+    unsigned char Which;
+    unsigned Rounds;
+
+    if (argc != 5) {
+        printf ("Usage: lz65-bench file lz65-file lz4-file rounds\n");
+        return EXIT_FAILURE;
+    }
+    OrigSize = Load (argv[1], Orig, sizeof (Orig));
+    LZ65Size = Load (argv[2], LZ65, sizeof (LZ65));
+    LZ4Size = Load (argv[3], LZ4, sizeof (LZ4));
+
+    for (Which = 0; Which < 3; ++Which) {
+        Check (Which);
+    }
+    if (OrigSize) {
+        printf ("%u bytes, lz65: %u bytes (%u%%), lz4: %u bytes (%u%%)\n",
+                OrigSize, LZ65Size, Percent (LZ65Size), LZ4Size, Percent (LZ4Size));
+    }
+
+    Rounds = atoi (argv[4]);
+    if (OrigSize && Rounds) {
+        for (Which = 0; Which < 3; ++Which) {
+            Bench (Which, Rounds);
+        }
+    }
+    return EXIT_SUCCESS;
+}
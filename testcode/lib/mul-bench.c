@@ -0,0 +1,140 @@
+/* mul-bench.c -- Benchmark the integer multiplication runtime routines.
+**
+** Build and run the program twice under sim65, once with the shift-and-add
+** routines from the library and once with the table driven replacements,
+** and compare the cycle counts:
+**
+**   cl65 -t sim6502 -O -o mul-bench.prg mul-bench.c
+**   sim65 -c mul-bench.prg
+**   cl65 -t sim6502 -O -o mul-bench-fast.prg mul-bench.c sim6502-fastmul.o
+**   sim65 -c mul-bench-fast.prg
+**
+** The results are checked against a shift-and-add reference, so the program
+** also exits with a non zero code if the multiplication routines are broken.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <cc65.h>
+
+
+
+/* Number of passes over the operand table */
+#define PASSES  20
+
+static const unsigned Operands[] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0007, 0x000A, 0x0010, 0x0033,
+    0x007F, 0x0080, 0x00AA, 0x00FF, 0x0100, 0x0123, 0x01FF, 0x0555,
+    0x0FFF, 0x1234, 0x4000, 0x5A5A, 0x7FFF, 0x8000, 0x8001, 0xA5A5,
+    0xC000, 0xDEAD, 0xF00F, 0xFF00, 0xFFFE, 0xFFFF
+};
+#define OPCOUNT (sizeof (Operands) / sizeof (Operands[0]))
+
+static unsigned long Sum16;
+static unsigned long Sum8;
+static unsigned long Sum32;
+
+
+
+static unsigned long RefMul (unsigned lhs, unsigned rhs)
+/* Multiply two unsigneds without using the multiplication routines */
+{
+    unsigned long Res = 0;
+    unsigned long Add = lhs;
+
+    while (rhs) {
+        if (rhs & 1) {
+            Res += Add;
+        }
+        Add <<= 1;
+        rhs >>= 1;
+    }
+    return Res;
+}
+
+
+
+static unsigned long Passes (unsigned long Val)
+/* Return Val * PASSES without using the multiplication routines */
+{
+    return RefMul ((unsigned) Val, PASSES) +
+           (RefMul ((unsigned) (Val >> 16), PASSES) << 16);
+}
+
+
+
+static void Bench (void)
+/* Run the multiplication routines over all operand combinations */
+{
+    register unsigned char I, J;
+    unsigned char Pass;
+    unsigned L, R;
+
+    for (Pass = 0; Pass < PASSES; ++Pass) {
+        for (I = 0; I < OPCOUNT; ++I) {
+            L = Operands[I];
+            for (J = 0; J < OPCOUNT; ++J) {
+                R = Operands[J];
+                Sum16 += L * R;
+                Sum8  += L * (unsigned char) R;
+                Sum8  += umul8x8r16 ((unsigned char) L, (unsigned char) R);
+                Sum32 += umul16x16r32 (L, R);
+            }
+        }
+    }
+}
+
+
+
+static unsigned char Check (void)
+/* Compute the expected sums and compare them. Return the number of errors. */
+{
+    unsigned char I, J;
+    unsigned char Errors = 0;
+    unsigned long Exp16 = 0;
+    unsigned long Exp8 = 0;
+    unsigned long Exp32 = 0;
+    unsigned long P;
+    unsigned L, R;
+
+    for (I = 0; I < OPCOUNT; ++I) {
+        L = Operands[I];
+        for (J = 0; J < OPCOUNT; ++J) {
+            R = Operands[J];
+            P = RefMul (L, R);
+            Exp16 += (unsigned) P;
+            Exp32 += P;
+            Exp8  += (unsigned) RefMul (L, R & 0xFF);
+            Exp8  += RefMul (L & 0xFF, R & 0xFF);
+        }
+    }
+    Exp16 = Passes (Exp16);
+    Exp8  = Passes (Exp8);
+    Exp32 = Passes (Exp32);
+
+    if (Sum16 != Exp16) {
+        printf ("16x16 mismatch: %08lX != %08lX\n", Sum16, Exp16);
+        ++Errors;
+    }
+    if (Sum8 != Exp8) {
+        printf ("16x8 mismatch: %08lX != %08lX\n", Sum8, Exp8);
+        ++Errors;
+    }
+    if (Sum32 != Exp32) {
+        printf ("16x16r32 mismatch: %08lX != %08lX\n", Sum32, Exp32);
+        ++Errors;
+    }
+    return Errors;
+}
+
+
+
+int main (void)
+{
+    Bench ();
+    if (Check ()) {
+        return EXIT_FAILURE;
+    }
+    printf ("%lu multiplications ok\n", 4UL * PASSES * OPCOUNT * OPCOUNT);
+    return EXIT_SUCCESS;
+}
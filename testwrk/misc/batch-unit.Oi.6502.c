@@ -0,0 +1,25 @@
+/*
+  !!DESCRIPTION!! second translation unit for batch.c
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+#ifdef BATCH_MAIN
+#error Macro of the first translation unit is still defined
+#endif
+
+static int helper (void)
+{
+    return 2;
+}
+
+int unit_chars (void)
+{
+    char c = 200;
+    return c > 100 && 'A' == 0x41;
+}
+
+int unit_helper (void)
+{
+    return helper ();
+}
@@ -0,0 +1,42 @@
+/*
+  !!DESCRIPTION!! several translation units compiled by one compiler run
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+/*
+  Compiled together with batch-unit.c by one run of the compiler. Nothing
+  defined or changed here must be visible when the second file is compiled.
+*/
+
+#include <stdio.h>
+
+#define BATCH_MAIN      1
+
+static unsigned char failures = 0;
+
+static int helper (void)
+{
+    return 1;
+}
+
+int unit_chars (void);
+int unit_helper (void);
+
+int main (void)
+{
+    if (!unit_chars ()) {
+        printf ("settings of the first unit leaked into the second\n");
+        ++failures;
+    }
+    if (unit_helper () != 2 || helper () != 1) {
+        printf ("wrong helper called\n");
+        ++failures;
+    }
+    return failures;
+}
+
+/* Unbalanced settings at the end of the file */
+#pragma signed-chars (on)
+#pragma charmap (0x41, 0x42)
+#pragma code-name (push, "CODE")
@@ -0,0 +1,117 @@
+/*
+  !!DESCRIPTION!! integer multiplication, also with the table driven routines
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+/*
+  Linked once with the multiplication routines from the library and once with
+  <target>-fastmul.o. All combinations of a set of operands are multiplied
+  with the * operator (tosmulax, tosumulax, tosmula0, tosumula0) and with the
+  functions from <cc65.h>, and compared against a shift-and-add reference.
+  A few products are also checked against fixed values, so the reference
+  itself is checked.
+*/
+
+#include <stdio.h>
+#include <cc65.h>
+
+static unsigned char failures;
+
+static const unsigned Operands[] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0007, 0x000A, 0x0010, 0x0033,
+    0x007F, 0x0080, 0x00AA, 0x00FF, 0x0100, 0x0123, 0x01FF, 0x0555,
+    0x0FFF, 0x1234, 0x4000, 0x5A5A, 0x7FFF, 0x8000, 0x8001, 0xA5A5,
+    0xC000, 0xDEAD, 0xF00F, 0xFF00, 0xFFFE, 0xFFFF
+};
+#define OPCOUNT (sizeof (Operands) / sizeof (Operands[0]))
+
+/* Multiply two unsigneds without using the multiplication routines */
+static unsigned long refmul (unsigned lhs, unsigned rhs)
+{
+    unsigned long res = 0;
+    unsigned long add = lhs;
+
+    while (rhs) {
+        if (rhs & 1) {
+            res += add;
+        }
+        add <<= 1;
+        rhs >>= 1;
+    }
+    return res;
+}
+
+/* Multiply two ints without using the multiplication routines */
+static long refimul (int lhs, int rhs)
+{
+    unsigned long res = refmul (lhs < 0? -lhs : lhs, rhs < 0? -rhs : rhs);
+
+    return ((lhs < 0) != (rhs < 0))? -(long) res : (long) res;
+}
+
+static void fail (const char* what, unsigned lhs, unsigned rhs)
+{
+    printf ("%s: %04X * %04X\n", what, lhs, rhs);
+    ++failures;
+}
+
+static void check_pair (unsigned l, unsigned r)
+{
+    unsigned char lc = (unsigned char) l;
+    unsigned char rc = (unsigned char) r;
+    int           li = (int) l;
+    int           ri = (int) r;
+    signed char   ls = (signed char) lc;
+    signed char   rs = (signed char) rc;
+
+    if (l * r != (unsigned) refmul (l, r)) {
+        fail ("tosumulax", l, r);
+    }
+    if (li * ri != (int) refimul (li, ri)) {
+        fail ("tosmulax", l, r);
+    }
+    if (l * rc != (unsigned) refmul (l, rc)) {
+        fail ("tosumula0", l, r);
+    }
+    if (li * (int) rc != (int) refimul (li, rc)) {
+        fail ("tosmula0", l, r);
+    }
+    if (umul16x16r32 (l, r) != refmul (l, r)) {
+        fail ("umul16x16r32", l, r);
+    }
+    if (imul16x16r32 (li, ri) != refimul (li, ri)) {
+        fail ("imul16x16r32", l, r);
+    }
+    if (umul16x8r32 (l, rc) != refmul (l, rc)) {
+        fail ("umul16x8r32", l, r);
+    }
+    if (umul8x8r16 (lc, rc) != (unsigned) refmul (lc, rc)) {
+        fail ("umul8x8r16", l, r);
+    }
+    if (imul8x8r16 (ls, rs) != (int) refimul (ls, rs)) {
+        fail ("imul8x8r16", l, r);
+    }
+}
+
+int main (void)
+{
+    unsigned char i, j;
+
+    /* Check the reference */
+    if (refmul (0xFFFF, 0xFFFF) != 0xFFFE0001UL                 ||
+        refmul (1234, 5678) != 0x006AE9BCUL                     ||
+        refimul (-300, 1000) != -300000L                        ||
+        refimul (-32767 - 1, 32767) != (long) 0xC0008000UL      ||
+        refimul (-128, 127) != -16256) {
+        printf ("reference is broken\n");
+        return 1;
+    }
+
+    for (i = 0; i < OPCOUNT; ++i) {
+        for (j = 0; j < OPCOUNT; ++j) {
+            check_pair (Operands[i], Operands[j]);
+        }
+    }
+    return failures;
+}
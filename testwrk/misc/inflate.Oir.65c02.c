@@ -0,0 +1,267 @@
+/*
+  !!DESCRIPTION!! inflatemem and crc32, also with the alternative modules
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+/*
+  Linked once with the library versions and once with <target>-inflatefast.o
+  and <target>-crc32rom.o. The streams are raw deflate data made with zlib
+  from parts of libsrc/zlib/inflatemem.s: a dynamic, a fixed and a stored
+  block, and a stream of several blocks with long runs and overlapping copies.
+  The last one has a fixed block, an empty stored block from a full flush and
+  a dynamic block.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <zlib.h>
+
+static unsigned char failures;
+
+static const unsigned char Dynamic[678] = {
+    0xAD, 0x55, 0x4D, 0x6F, 0xDB, 0x30, 0x0C, 0xBD, 0xFB, 0x57, 0x10, 0xE8,
+    0x21, 0x1B, 0x9A, 0x16, 0x4B, 0x7B, 0x73, 0xD0, 0xC3, 0xD2, 0x75, 0xDD,
+    0x80, 0x02, 0x1B, 0xD0, 0x02, 0x03, 0x76, 0x31, 0x64, 0x8B, 0x49, 0xD4,
+    0x3A, 0x92, 0x60, 0xD1, 0x6D, 0xBC, 0x5F, 0x3F, 0x4A, 0xF1, 0x67, 0xE2,
+    0x74, 0xDD, 0x30, 0x5F, 0x1C, 0x93, 0x7A, 0xFC, 0x78, 0xE2, 0x63, 0x00,
+    0x9A, 0x27, 0xBE, 0x02, 0x70, 0x05, 0xAE, 0x4E, 0x67, 0x00, 0x73, 0x98,
+    0x41, 0x5A, 0x11, 0x46, 0x51, 0x34, 0x87, 0xB3, 0xFF, 0xF6, 0x44, 0x73,
+    0x0E, 0x77, 0x6D, 0x24, 0xF2, 0x8F, 0x28, 0x51, 0x7A, 0x99, 0x0B, 0xC2,
+    0x0D, 0x6E, 0x62, 0x9F, 0x46, 0x69, 0x5B, 0xD2, 0x77, 0xA3, 0x34, 0x61,
+    0x01, 0x57, 0xE0, 0x4C, 0x59, 0x64, 0x18, 0x35, 0xD5, 0x39, 0x12, 0xE1,
+    0xDD, 0x3F, 0xD5, 0x73, 0x6E, 0x0F, 0x9C, 0xA7, 0x33, 0x8E, 0x69, 0x4A,
+    0x1A, 0x04, 0x95, 0xE8, 0xA8, 0x45, 0xE5, 0xB2, 0x0A, 0xEF, 0x93, 0x59,
+    0xCF, 0xB4, 0xCB, 0xF2, 0xCE, 0xD9, 0xF7, 0xD3, 0xEA, 0x20, 0xF9, 0x20,
+    0xDC, 0x69, 0x07, 0x93, 0x58, 0xFD, 0x53, 0x08, 0xDF, 0xF6, 0x5E, 0x2D,
+    0x1F, 0x7A, 0x88, 0x9D, 0x69, 0x85, 0xB4, 0x50, 0x94, 0xA4, 0xE5, 0x72,
+    0xE9, 0x11, 0x35, 0x6B, 0x49, 0x9A, 0x9B, 0xEC, 0xE9, 0xCE, 0x18, 0x1B,
+    0x73, 0x90, 0x5B, 0x24, 0x10, 0x90, 0x2A, 0x02, 0xB3, 0x84, 0x9B, 0x6F,
+    0x9F, 0x41, 0x68, 0x09, 0xF4, 0x62, 0xBC, 0xC9, 0x79, 0x5B, 0x38, 0x0D,
+    0x54, 0x59, 0x7C, 0x7B, 0x4A, 0x97, 0xA4, 0xC2, 0xE1, 0x41, 0x63, 0x27,
+    0xB7, 0x37, 0x0F, 0xC9, 0x65, 0xB2, 0xF8, 0xFA, 0x70, 0xDF, 0xFA, 0x1E,
+    0x5D, 0xD1, 0x07, 0x76, 0x98, 0xDA, 0x2E, 0x38, 0xEB, 0xC7, 0x50, 0xD4,
+    0x4F, 0xC8, 0x8C, 0x26, 0xA1, 0x74, 0xAF, 0xA4, 0x29, 0x5C, 0x37, 0x56,
+    0x17, 0xAA, 0xE7, 0x0E, 0x57, 0x8C, 0xB8, 0x17, 0xCF, 0xD8, 0x7D, 0x37,
+    0x31, 0xED, 0xDA, 0xB6, 0xBF, 0x53, 0x8D, 0xF5, 0xC5, 0x07, 0x52, 0xAE,
+    0xCD, 0xC6, 0x16, 0xE8, 0x1C, 0x4A, 0xCF, 0xEC, 0x27, 0xCC, 0xEA, 0x6F,
+    0xE6, 0x66, 0xE2, 0xC8, 0x14, 0x28, 0x27, 0x20, 0x05, 0xDF, 0x44, 0xC8,
+    0x7D, 0xFE, 0xD7, 0xEC, 0x83, 0x57, 0x86, 0x5A, 0x69, 0x8E, 0xB4, 0x63,
+    0xB6, 0xD4, 0xA4, 0xF2, 0xA0, 0x14, 0x48, 0x4D, 0xA9, 0xA5, 0x28, 0xAA,
+    0x31, 0x4E, 0x7E, 0x98, 0x42, 0xB6, 0x3A, 0x9B, 0x83, 0x7B, 0x52, 0x16,
+    0x68, 0x8D, 0x90, 0xA3, 0x5E, 0xD1, 0x1A, 0x5E, 0x10, 0xA4, 0xD1, 0x13,
+    0x02, 0x8D, 0x5C, 0xF9, 0x9F, 0xF1, 0x6C, 0x09, 0x70, 0xA3, 0x71, 0xE2,
+    0xC0, 0x37, 0x99, 0xB3, 0x8A, 0x34, 0xD5, 0xF1, 0x46, 0x34, 0x13, 0xD8,
+    0xB9, 0x0F, 0x0C, 0x24, 0x56, 0xAC, 0x98, 0xA8, 0x72, 0x20, 0xA0, 0x34,
+    0x73, 0x23, 0x27, 0x97, 0xAA, 0x70, 0xB4, 0xF0, 0xCD, 0xCD, 0xE1, 0x71,
+    0x63, 0xA3, 0xA1, 0x37, 0x33, 0xB6, 0xF2, 0xCE, 0x78, 0x74, 0x0A, 0xFC,
+    0xF2, 0x68, 0xE8, 0x75, 0x98, 0x0D, 0xB0, 0xE3, 0x28, 0xD7, 0xB8, 0x7A,
+    0x55, 0x65, 0xC3, 0xDB, 0x65, 0xF9, 0x26, 0x39, 0x8F, 0x7C, 0x74, 0xA4,
+    0xCE, 0x2E, 0xA8, 0xD2, 0xDB, 0x63, 0x43, 0xB2, 0x57, 0x7E, 0x0F, 0x92,
+    0xBD, 0x95, 0xAD, 0xD7, 0x03, 0x72, 0xDF, 0x8B, 0x30, 0xDB, 0xB2, 0x1D,
+    0x40, 0x94, 0xE7, 0xAD, 0x70, 0x35, 0x6E, 0x29, 0xF8, 0xBB, 0x6A, 0x6D,
+    0x6E, 0x8F, 0x35, 0xDD, 0xE9, 0x7C, 0x38, 0xD2, 0xCA, 0xE8, 0xFA, 0xE6,
+    0x09, 0xFD, 0x20, 0x17, 0x48, 0x65, 0xA1, 0xF7, 0x16, 0xDE, 0xD9, 0xFE,
+    0xC2, 0x1B, 0xDB, 0x41, 0x23, 0x22, 0xE8, 0x5F, 0x5C, 0x3B, 0x4C, 0x69,
+    0x36, 0xB6, 0xD7, 0x94, 0xAE, 0x7A, 0xCA, 0x14, 0xAF, 0xE7, 0xEA, 0xAD,
+    0xCC, 0x23, 0xE1, 0x48, 0x6C, 0x7B, 0xAC, 0xF8, 0xB5, 0x61, 0x8D, 0x1D,
+    0x76, 0xC1, 0x93, 0xD8, 0xDC, 0x97, 0xB3, 0x17, 0xED, 0x42, 0xEC, 0xB4,
+    0x1F, 0xEF, 0x6B, 0xFF, 0x0B, 0x8B, 0x77, 0x23, 0xF4, 0x59, 0xC6, 0x03,
+    0x24, 0x7B, 0x0B, 0xC0, 0x2F, 0xA5, 0xAB, 0x59, 0x0C, 0x4B, 0xB5, 0x65,
+    0x7B, 0x30, 0x4D, 0x39, 0xAC, 0x22, 0x25, 0x72, 0xF5, 0x0B, 0xE1, 0x45,
+    0xB1, 0x38, 0x77, 0x4E, 0x0F, 0x75, 0xE1, 0xFC, 0x45, 0x0C, 0xB2, 0xD2,
+    0x62, 0xA3, 0xB2, 0x06, 0xC1, 0x32, 0x2B, 0x88, 0x97, 0x00, 0x64, 0x39,
+    0x8A, 0x42, 0xE9, 0x15, 0x88, 0x3C, 0x0F, 0x88, 0x5A, 0x90, 0x3B, 0xE0,
+    0x65, 0xCC, 0xB1, 0x9F, 0x39, 0xB2, 0x84, 0x6E, 0x2C, 0x42, 0x35, 0x53,
+    0xD0, 0x86, 0x60, 0xCD, 0xEB, 0x31, 0x67, 0x0B, 0xAF, 0x46, 0x5A, 0x2B,
+    0x07, 0x05, 0x53, 0xA7, 0x74, 0x37, 0x9F, 0x68, 0x76, 0x3A, 0x39, 0xB9,
+    0x18, 0xFD, 0xDB, 0x38, 0xA0, 0x21, 0x71, 0x48, 0x5E, 0x32, 0x77, 0xBB,
+    0x1A, 0xE2, 0x51, 0x8E, 0xD3, 0xDF,
+};
+static const unsigned char Fixed[239] = {
+    0x4B, 0x2D, 0x54, 0x00, 0x81, 0xCC, 0xBC, 0xB4, 0x9C, 0xC4, 0x92, 0x54,
+    0xE7, 0xFC, 0xDC, 0x82, 0xA2, 0xD4, 0xE2, 0xE2, 0xD4, 0x94, 0xF8, 0xE2,
+    0xD4, 0x12, 0x9F, 0xCC, 0x92, 0xD4, 0xA2, 0xC4, 0x1C, 0xE7, 0xFC, 0x94,
+    0x54, 0x9F, 0xD4, 0xBC, 0xF4, 0x92, 0x0C, 0x2E, 0x6B, 0x85, 0xB4, 0xCC,
+    0x8A, 0xD4, 0x14, 0x05, 0x8F, 0xD2, 0xB4, 0xB4, 0xDC, 0xC4, 0x3C, 0x85,
+    0x1C, 0x88, 0x0A, 0x85, 0x64, 0xA0, 0x92, 0x62, 0x2B, 0xA0, 0xB4, 0xA1,
+    0x89, 0x89, 0x82, 0x85, 0x6E, 0x52, 0x66, 0x09, 0x44, 0x08, 0x24, 0x62,
+    0x68, 0xA4, 0x60, 0x89, 0x24, 0xA2, 0x00, 0x05, 0x39, 0x29, 0x89, 0x60,
+    0x5A, 0xD9, 0x04, 0x2E, 0x94, 0x5C, 0x50, 0x09, 0x11, 0x02, 0x9A, 0x02,
+    0x17, 0x2C, 0xCA, 0xCF, 0x01, 0xD3, 0x89, 0x5C, 0xC4, 0xB9, 0xD1, 0x0A,
+    0xAE, 0xB3, 0xB8, 0x04, 0x62, 0x03, 0xD4, 0x91, 0xC1, 0x95, 0xB9, 0x49,
+    0xF9, 0x48, 0x0A, 0x75, 0x2A, 0xE1, 0x2A, 0x93, 0x52, 0xF1, 0x84, 0x82,
+    0x73, 0x7E, 0x5E, 0x49, 0x51, 0x3E, 0xBE, 0x50, 0x48, 0x86, 0xA8, 0x40,
+    0x84, 0x82, 0x91, 0x89, 0x82, 0x39, 0x4A, 0x20, 0x28, 0x98, 0xA1, 0x85,
+    0x8A, 0x82, 0x91, 0x42, 0x6E, 0x6A, 0x62, 0x5E, 0x66, 0x5E, 0x7A, 0x0E,
+    0xD0, 0x22, 0x34, 0x49, 0x63, 0x03, 0x05, 0x53, 0xB0, 0x40, 0x4A, 0x26,
+    0xD0, 0x0F, 0x79, 0xC9, 0xA9, 0xB8, 0x82, 0xCE, 0x54, 0xDB, 0xC5, 0x33,
+    0x38, 0xC4, 0xD1, 0xCF, 0xD9, 0x35, 0x3E, 0x24, 0xC8, 0xD5, 0x15, 0x33,
+    0x20, 0x7D, 0x5C, 0xFD, 0xDC, 0x43, 0x3C, 0xE2, 0x83, 0x23, 0x7D, 0x9D,
+    0xFC, 0x7D, 0x82, 0x11, 0xFE, 0x4D, 0x2E, 0x86, 0xF9, 0x17, 0x00,
+};
+static const unsigned char Stored[305] = {
+    0x01, 0x2C, 0x01, 0xD3, 0xFE, 0x6C, 0x61, 0x74, 0x65, 0x43, 0x6F, 0x6D,
+    0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x5F, 0x73, 0x65, 0x74, 0x43,
+    0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x43, 0x6F, 0x64, 0x65, 0x4C, 0x65,
+    0x6E, 0x67, 0x74, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x63, 0x70, 0x79, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x32, 0x34,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x64, 0x63,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x24, 0x31, 0x30, 0x30, 0x2B, 0x32,
+    0x2D, 0x44, 0x49, 0x53, 0x54, 0x41, 0x4E, 0x43, 0x45, 0x5F, 0x54, 0x52,
+    0x45, 0x45, 0x0A, 0x69, 0x6E, 0x66, 0x6C, 0x61, 0x74, 0x65, 0x43, 0x6F,
+    0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x5F, 0x73, 0x65, 0x74,
+    0x43, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x43, 0x6F, 0x64, 0x65, 0x4C,
+    0x65, 0x6E, 0x67, 0x74, 0x68, 0x3A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x63, 0x70, 0x79, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23,
+    0x43, 0x4F, 0x4E, 0x54, 0x52, 0x4F, 0x4C, 0x5F, 0x53, 0x59, 0x4D, 0x42,
+    0x4F, 0x4C, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x62, 0x63, 0x73, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x66, 0x6C,
+    0x61, 0x74, 0x65, 0x43, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65,
+    0x64, 0x5F, 0x6E, 0x6F, 0x43, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x53,
+    0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x73, 0x74, 0x61, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F,
+    0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x43,
+    0x6F, 0x64, 0x65, 0x4C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x2C, 0x79, 0x0A,
+    0x69, 0x6E, 0x66, 0x6C, 0x61, 0x74, 0x65, 0x43, 0x6F, 0x6D, 0x70, 0x72,
+    0x65, 0x73, 0x73, 0x65, 0x64, 0x5F, 0x6E, 0x6F, 0x43, 0x6F, 0x6E, 0x74,
+    0x72, 0x6F, 0x6C, 0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x3A, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20,
+};
+static const unsigned char Blocks[798] = {
+    0x62, 0x60, 0x18, 0x05, 0xA3, 0x60, 0x68, 0x82, 0xC4, 0xA4, 0x51, 0x38,
+    0x98, 0x20, 0x03, 0x23, 0x13, 0x33, 0x0B, 0x2B, 0x1B, 0x3B, 0x07, 0x27,
+    0x17, 0x37, 0x0F, 0x2F, 0x1F, 0xBF, 0x80, 0xA0, 0x90, 0xB0, 0x88, 0xA8,
+    0x98, 0xB8, 0x84, 0xA4, 0x94, 0xB4, 0x8C, 0xAC, 0x9C, 0xBC, 0x82, 0xA2,
+    0x92, 0xB2, 0x8A, 0xAA, 0x9A, 0xBA, 0x86, 0xA6, 0x96, 0xB6, 0x8E, 0xAE,
+    0x9E, 0xBE, 0x81, 0xA1, 0x91, 0xB1, 0x89, 0xA9, 0x99, 0xB9, 0x85, 0xA5,
+    0x95, 0xB5, 0x8D, 0xAD, 0x9D, 0xBD, 0x83, 0xA3, 0x93, 0xB3, 0x8B, 0xAB,
+    0x9B, 0xBB, 0x87, 0xA7, 0x97, 0xB7, 0x8F, 0xAF, 0x9F, 0x7F, 0x40, 0x60,
+    0x50, 0x70, 0x48, 0x68, 0x58, 0x78, 0x44, 0x64, 0x54, 0x74, 0x4C, 0x6C,
+    0x5C, 0x7C, 0x42, 0x62, 0x52, 0x72, 0x4A, 0x6A, 0x5A, 0x7A, 0x46, 0x66,
+    0x56, 0x76, 0x4E, 0x6E, 0x5E, 0x7E, 0x41, 0x61, 0x51, 0x71, 0x49, 0x69,
+    0x59, 0x79, 0x45, 0x65, 0x55, 0x75, 0x4D, 0x6D, 0x5D, 0x7D, 0x43, 0x63,
+    0x53, 0x73, 0x4B, 0x6B, 0x5B, 0x7B, 0x47, 0x67, 0x57, 0x77, 0x4F, 0x6F,
+    0x5F, 0xFF, 0x84, 0x89, 0x93, 0x26, 0x4F, 0x99, 0x3A, 0x6D, 0xFA, 0x8C,
+    0x99, 0xB3, 0x66, 0xCF, 0x99, 0x3B, 0x6F, 0xFE, 0x82, 0x85, 0x8B, 0x16,
+    0x2F, 0x59, 0xBA, 0x6C, 0xF9, 0x8A, 0x95, 0xAB, 0x56, 0xAF, 0x59, 0xBB,
+    0x6E, 0xFD, 0x86, 0x8D, 0x9B, 0x36, 0x6F, 0xD9, 0xBA, 0x6D, 0xFB, 0x8E,
+    0x9D, 0xBB, 0x76, 0xEF, 0xD9, 0xBB, 0x6F, 0xFF, 0x81, 0x83, 0x87, 0x0E,
+    0x1F, 0x39, 0x7A, 0xEC, 0xF8, 0x89, 0x93, 0xA7, 0x4E, 0x9F, 0x39, 0x7B,
+    0xEE, 0xFC, 0x85, 0x8B, 0x97, 0x2E, 0x5F, 0xB9, 0x7A, 0xED, 0xFA, 0x8D,
+    0x9B, 0xB7, 0x6E, 0xDF, 0xB9, 0x7B, 0xEF, 0xFE, 0x83, 0x87, 0x8F, 0x1E,
+    0x3F, 0x79, 0xFA, 0xEC, 0xF9, 0x8B, 0x97, 0xAF, 0x5E, 0xBF, 0x79, 0xFB,
+    0xEE, 0xFD, 0x87, 0x8F, 0x9F, 0x3E, 0x7F, 0xF9, 0xFA, 0xED, 0xFB, 0x8F,
+    0x9F, 0xBF, 0x7E, 0xFF, 0xF9, 0xFB, 0xEF, 0x3F, 0xD0, 0x1D, 0xA3, 0x88,
+    0x48, 0x04, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAD, 0x93, 0xCB, 0x4E, 0xE3,
+    0x30, 0x14, 0x86, 0xF7, 0x79, 0x8A, 0xB3, 0x98, 0x05, 0x0C, 0x69, 0xD5,
+    0x84, 0xD2, 0xC2, 0x44, 0x5D, 0xB4, 0x4C, 0x80, 0x4A, 0xD0, 0xA2, 0x36,
+    0x1B, 0x66, 0x13, 0xB9, 0xE9, 0x49, 0x62, 0x8D, 0xE3, 0x44, 0xB6, 0x43,
+    0x2F, 0x4F, 0xCF, 0x89, 0x81, 0x5E, 0x28, 0xD2, 0x6C, 0xC6, 0x0B, 0xC7,
+    0xC9, 0x77, 0x2E, 0xF9, 0x7F, 0xDB, 0x81, 0x13, 0x80, 0xDF, 0xF1, 0xFA,
+    0x2D, 0xCF, 0x6B, 0x75, 0xFA, 0x2E, 0x3C, 0xF3, 0xD2, 0x28, 0xB8, 0xAB,
+    0x35, 0xFF, 0xEB, 0x04, 0xC4, 0x6A, 0xA9, 0x79, 0x26, 0x71, 0x09, 0x71,
+    0x9C, 0x32, 0x6D, 0x12, 0x26, 0x44, 0x1C, 0x03, 0x97, 0xA9, 0x60, 0x06,
+    0x0B, 0x2C, 0xE0, 0x6C, 0x17, 0x91, 0xE4, 0x4C, 0xFD, 0x84, 0x25, 0x6A,
+    0xE3, 0x52, 0xE2, 0xBF, 0x47, 0x52, 0x4A, 0x6D, 0xE0, 0x4B, 0xBA, 0x2E,
+    0x6B, 0x95, 0xE0, 0x79, 0x60, 0x9B, 0x4F, 0xA6, 0x51, 0xF8, 0x0B, 0x46,
+    0x08, 0xB8, 0x36, 0x8A, 0xBA, 0x89, 0x0D, 0x24, 0x4C, 0x61, 0x5A, 0x0B,
+    0x58, 0x71, 0x93, 0x43, 0x51, 0x2E, 0x79, 0xCA, 0x13, 0x66, 0x38, 0x95,
+    0x72, 0x61, 0x81, 0x09, 0xAB, 0x35, 0x82, 0xC9, 0xB9, 0xA6, 0xEA, 0x4B,
+    0x04, 0x7A, 0xE6, 0xC8, 0x5E, 0xB9, 0xD8, 0x50, 0xB5, 0xB2, 0x32, 0xBC,
+    0xE0, 0x5B, 0x6A, 0x95, 0x96, 0x0A, 0x34, 0xAD, 0xE0, 0xAC, 0x59, 0xE1,
+    0x9A, 0x15, 0x95, 0x40, 0x60, 0x5A, 0xD7, 0x05, 0x52, 0x26, 0x2A, 0xC3,
+    0xB8, 0x04, 0x85, 0x19, 0xD7, 0x06, 0x15, 0x30, 0x49, 0x29, 0x82, 0x65,
+    0xF0, 0xCA, 0x44, 0x8D, 0x9A, 0x4A, 0xAD, 0x72, 0x94, 0xC0, 0x8D, 0x26,
+    0x23, 0x28, 0x40, 0x32, 0x01, 0xAA, 0xAC, 0x0D, 0x97, 0x94, 0xAD, 0xD0,
+    0xD4, 0x4A, 0x9E, 0xB7, 0x21, 0x22, 0x23, 0xDE, 0x7F, 0xD3, 0xE4, 0x08,
+    0x59, 0x2D, 0xB7, 0xBC, 0xEA, 0x5D, 0x81, 0xB6, 0xCD, 0xDA, 0xA4, 0xCF,
+    0xF9, 0x34, 0xA2, 0x8D, 0xEB, 0xAA, 0x54, 0x66, 0x67, 0x4C, 0xBC, 0xB7,
+    0xF7, 0x20, 0x88, 0x17, 0x47, 0x41, 0x5C, 0x26, 0xBA, 0xF2, 0xBF, 0xE2,
+    0x6D, 0xF5, 0xF1, 0xAE, 0x2B, 0x17, 0x34, 0x29, 0x70, 0xA1, 0x32, 0xCA,
+    0xB3, 0xB3, 0x6F, 0xE7, 0x4B, 0x3B, 0x77, 0x1D, 0x52, 0xD1, 0xFA, 0x6F,
+    0xC3, 0xEE, 0xD6, 0x6D, 0xB3, 0x9F, 0x4C, 0x1A, 0xDD, 0x68, 0x0B, 0x60,
+    0xA8, 0x32, 0xB2, 0x53, 0x9A, 0x0F, 0xD7, 0xAC, 0xE9, 0x19, 0x9A, 0x11,
+    0xD9, 0xD6, 0x76, 0xEE, 0xC3, 0x28, 0xF6, 0xE2, 0xD1, 0x38, 0x3A, 0x38,
+    0x0F, 0x03, 0xF8, 0x71, 0xED, 0x59, 0xE2, 0x37, 0x64, 0x7E, 0x4C, 0x7C,
+    0x4B, 0x2E, 0xBF, 0x21, 0x5D, 0x4B, 0xBA, 0xDF, 0x90, 0x6B, 0x4B, 0xAE,
+    0x4E, 0xC9, 0x4D, 0xC7, 0x92, 0xDE, 0x29, 0x61, 0xEF, 0xA4, 0x7F, 0x4A,
+    0x92, 0x4E, 0xA3, 0xEA, 0xA1, 0x4E, 0xD3, 0x82, 0x49, 0xA0, 0xF3, 0x88,
+    0xA4, 0x23, 0x9A, 0x85, 0x61, 0x3C, 0x1F, 0xFF, 0x09, 0x8F, 0x74, 0x78,
+    0x3D, 0xE7, 0x79, 0x36, 0x7E, 0x1A, 0xCE, 0x5E, 0xE2, 0x26, 0x60, 0x0F,
+    0x3A, 0xCE, 0xEF, 0xF1, 0x3C, 0x1A, 0x4E, 0x6E, 0xC3, 0x43, 0x30, 0x80,
+    0x5D, 0x19, 0x6B, 0x9C, 0xA8, 0x72, 0xB6, 0x40, 0xD3, 0x76, 0x1E, 0xC3,
+    0xC9, 0x7D, 0xF4, 0x10, 0xCF, 0x5F, 0x9E, 0x46, 0xD3, 0xC7, 0xF9, 0xAE,
+    0xFA, 0x85, 0x7F, 0x73, 0xE1, 0x37, 0xEB, 0x00, 0xC2, 0xE9, 0x9D, 0x0B,
+    0xFE, 0x0D, 0x08, 0x94, 0x19, 0x9D, 0x34, 0xBD, 0x29, 0x16, 0xA5, 0xA0,
+    0xAB, 0x60, 0x56, 0x25, 0xDD, 0x2C, 0xBA, 0x0C, 0xCB, 0xCF, 0x6F, 0xFB,
+    0xCE, 0x07, 0xE5, 0x06, 0xF0, 0x06,
+};
+
+struct Stream {
+    const char*          Name;
+    const unsigned char* Data;
+    unsigned             Size;
+    unsigned long        CRC;
+};
+
+static const struct Stream Streams[] = {
+    { "dynamic",  Dynamic,  2048, 0x95861F9BUL },
+    { "fixed",    Fixed,    512,  0x7E9F0C19UL },
+    { "stored",   Stored,   300,  0x26FD86ECUL },
+    { "blocks",   Blocks,   2680, 0xD895E27CUL },
+};
+
+/* One more byte to check that nothing is written behind the output */
+static unsigned char Buf[2680 + 1];
+
+static void check_stream (const struct Stream* S)
+{
+    unsigned Size;
+
+    Buf[S->Size] = 0xAA;
+    Size = inflatemem (Buf, S->Data);
+    if (Size != S->Size) {
+        printf ("%s: got %u bytes instead of %u\n", S->Name, Size, S->Size);
+        ++failures;
+    } else if (crc32 (crc32 (0, 0, 0), Buf, Size) != S->CRC) {
+        printf ("%s: wrong data\n", S->Name);
+        ++failures;
+    } else if (Buf[S->Size] != 0xAA) {
+        printf ("%s: output overrun\n", S->Name);
+        ++failures;
+    }
+}
+
+static void check_crc (void)
+{
+    static const char Digits[] = "123456789";
+    unsigned long crc;
+
+    if (crc32 (0, 0, 0) != 0) {
+        printf ("crc32: wrong initial value\n");
+        ++failures;
+    }
+    if (crc32 (0, Digits, 9) != 0xCBF43926UL) {
+        printf ("crc32: wrong check value\n");
+        ++failures;
+    }
+    crc = crc32 (0, Digits, 4);
+    if (crc32 (crc, Digits + 4, 5) != 0xCBF43926UL) {
+        printf ("crc32: wrong value when continued\n");
+        ++failures;
+    }
+}
+
+int main (void)
+{
+    unsigned char I;
+
+    check_crc ();
+    for (I = 0; I < sizeof (Streams) / sizeof (Streams[0]); ++I) {
+        check_stream (&Streams[I]);
+    }
+    /* A dynamic block after the others must not see their tables */
+    check_stream (&Streams[0]);
+    return failures;
+}
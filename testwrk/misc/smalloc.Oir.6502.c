@@ -0,0 +1,237 @@
+/*
+  !!DESCRIPTION!! malloc and friends with the size class allocator
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+/*
+  Linked once with the library versions and once with <target>-smalloc.o.
+  Blocks of the 8, 16, 32 and 64 byte classes and larger heap blocks are
+  allocated, resized and freed in mixed order. Every block is filled with its
+  own pattern, and all live blocks are checked after each step, so overlapping
+  blocks or a damaged free list are detected.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <_heap.h>
+
+#define BLOCKS  80
+
+static unsigned char* Blocks[BLOCKS];
+static unsigned Sizes[BLOCKS];
+
+static unsigned char failures;
+
+static void fail (const char* msg, unsigned n)
+{
+    printf ("%s (%u)\n", msg, n);
+    ++failures;
+}
+
+static void fill (unsigned i)
+{
+    memset (Blocks[i], (unsigned char) (i + 1), Sizes[i]);
+}
+
+static unsigned char check_block (unsigned i)
+{
+    unsigned j;
+
+    for (j = 0; j < Sizes[i]; ++j) {
+        if (Blocks[i][j] != (unsigned char) (i + 1)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void check_all (const char* step)
+{
+    unsigned i;
+
+    for (i = 0; i < BLOCKS; ++i) {
+        if (!check_block (i)) {
+            fail (step, i);
+        }
+    }
+}
+
+static void alloc (unsigned i, unsigned size)
+{
+    Blocks[i] = malloc (size);
+    Sizes[i] = size;
+    if (Blocks[i] == 0) {
+        fail ("out of memory", size);
+        Sizes[i] = 0;
+    } else {
+        fill (i);
+    }
+}
+
+/* Block sizes around the limits of the size classes */
+static const unsigned Limits[] = {
+    1, 7, 8, 9, 16, 17, 31, 32, 33, 63, 64, 65, 100, 255, 256, 300
+};
+
+static void check_blocksize (void)
+{
+    unsigned i, size, have;
+    void* p;
+
+    for (i = 0; i < sizeof (Limits) / sizeof (Limits[0]); ++i) {
+        size = Limits[i];
+        p = malloc (size);
+        have = _heapblocksize (p);
+        if (have < size || (size <= 64 && have > 64)) {
+            fail ("wrong block size", size);
+        }
+        free (p);
+    }
+}
+
+static void check_reuse (void)
+{
+    void* p;
+    void* q;
+    void* r;
+
+    /* A freed block must not be handed out twice */
+    p = malloc (12);
+    free (p);
+    q = malloc (12);
+    r = malloc (12);
+    if (r == q) {
+        fail ("block used twice", 12);
+    }
+    free (r);
+    free (q);
+}
+
+static void check_realloc (void)
+{
+    static const char Text[] = "0123456789";
+    char* p;
+
+    p = realloc (0, 6);
+    memcpy (p, Text, 6);
+    p = realloc (p, 20);
+    if (p == 0 || memcmp (p, Text, 6) != 0) {
+        fail ("realloc 6 -> 20", 20);
+        return;
+    }
+    memcpy (p, Text, 10);
+    p = realloc (p, 120);
+    if (p == 0 || memcmp (p, Text, 10) != 0) {
+        fail ("realloc 20 -> 120", 120);
+        return;
+    }
+    p = realloc (p, 4);
+    if (p == 0 || memcmp (p, Text, 4) != 0) {
+        fail ("realloc 120 -> 4", 4);
+        return;
+    }
+    if (realloc (p, 0) != 0) {
+        fail ("realloc to zero", 0);
+    }
+}
+
+static void check_calloc (void)
+{
+    unsigned char* p;
+    unsigned size, i;
+
+    for (size = 10; size <= 160; size *= 2) {
+        /* Leave a dirty block behind that calloc may get again */
+        p = malloc (size);
+        memset (p, 0xFF, size);
+        free (p);
+        p = calloc (size / 10, 10);
+        for (i = 0; i < size; ++i) {
+            if (p[i] != 0) {
+                fail ("calloc", size);
+                break;
+            }
+        }
+        free (p);
+    }
+}
+
+static void check_memalign (void)
+{
+    static const unsigned Align[] = { 8, 16, 64, 256, 256 };
+    static const unsigned Size[]  = { 5, 40, 10, 64, 300 };
+    void* p[5];
+    unsigned i;
+
+    for (i = 0; i < 5; ++i) {
+        if (posix_memalign (&p[i], Align[i], Size[i]) != 0) {
+            fail ("posix_memalign", Size[i]);
+            p[i] = 0;
+        } else if (((unsigned) p[i] & (Align[i] - 1)) != 0) {
+            fail ("posix_memalign alignment", Align[i]);
+        } else {
+            memset (p[i], 0x55, Size[i]);
+        }
+    }
+    check_all ("posix_memalign overwrote a block");
+    for (i = 0; i < 5; ++i) {
+        free (p[i]);
+    }
+}
+
+int main (void)
+{
+    unsigned i;
+
+    check_blocksize ();
+
+    /* Several pages of every class, and some heap blocks in between */
+    for (i = 0; i < BLOCKS; ++i) {
+        alloc (i, (i % 5 == 4) ? 70 + i : 1 + (i * 7) % 64);
+    }
+    check_all ("after malloc");
+
+    /* Free every other block and allocate other sizes in the holes */
+    for (i = 0; i < BLOCKS; i += 2) {
+        free (Blocks[i]);
+    }
+    for (i = 0; i < BLOCKS; i += 2) {
+        alloc (i, 1 + (i * 3) % 100);
+    }
+    check_all ("after replacing blocks");
+
+    /* Grow blocks into the next classes and to the heap */
+    for (i = 1; i < BLOCKS; i += 3) {
+        Blocks[i] = realloc (Blocks[i], Sizes[i] + 30);
+        if (Blocks[i] == 0) {
+            fail ("realloc", i);
+            Sizes[i] = 0;
+        } else if (!check_block (i)) {
+            fail ("realloc lost the contents", i);
+        } else {
+            Sizes[i] += 30;
+            fill (i);
+        }
+    }
+    check_all ("after realloc");
+
+    check_reuse ();
+    check_realloc ();
+    check_calloc ();
+    check_memalign ();
+    check_all ("at the end");
+
+    for (i = 0; i < BLOCKS; ++i) {
+        free (Blocks[i]);
+    }
+
+    /* The heap must still serve large blocks */
+    Blocks[0] = malloc (2000);
+    if (Blocks[0] == 0) {
+        fail ("no large block after freeing", 2000);
+    }
+    free (Blocks[0]);
+    return failures;
+}
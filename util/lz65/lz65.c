@@ -0,0 +1,509 @@
+/*
+** Compresses data to the lz65 format, or to raw LZ4 blocks.
+** The compressed data is ready to use with decompress_lz65(),
+** decompress_lz65_fast() or decompress_lz4().
+** Compile using e.g.
+** gcc -O2 -o lz65 lz65.c
+**
+** The lz65 format
+** ---------------
+** The stream is a sequence of commands. Bits are read MSB first from a bit
+** byte, and a new bit byte is taken from the stream whenever the previous
+** one is used up, so bit bytes are interleaved with the byte-aligned
+** literals and offsets. Numbers >= 1 are stored as interlaced Elias gamma
+** codes: For each bit below the highest one bit of the number, from high to
+** low, a 0 and the bit itself, then a 1.
+**
+**   literals:      gamma(count), then count bytes
+**   new offset:    gamma(((offset - 1) >> 8) + 1), a byte with the low 8 bits
+**                  of offset - 1, then gamma(length - 1)
+**   repeat offset: gamma(length)
+**
+** The stream starts as if a match had just been copied, and the last offset
+** is initially 1. After a match, a 0 bit selects literals and a 1 bit a new
+** offset. After literals, a 0 bit selects a match with the last offset, and
+** a 1 bit a new offset. A new offset with a high part of 256 ends the stream.
+**
+** The data may be decompressed in place, if the compressed data is placed at
+** the end of the buffer for the decompressed data, and the buffer is longer
+** than the decompressed data by the margin printed by this program.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define IN_SIZE_MAX     65535U
+#define OUT_SIZE_MAX    (2 * IN_SIZE_MAX + 16)
+#define MAX_OFFSET      0xFF00U
+#define MAX_CHAIN       4096
+#define MAX_LEN_STEPS   64
+#define MAX_LIT_EXACT   128
+#define INFINITE        0x7FFFFFFFL
+
+/* Input and output */
+static unsigned char In[IN_SIZE_MAX];
+static unsigned char Out[OUT_SIZE_MAX];
+static unsigned InLen;
+static unsigned OutLen;
+
+/* Hash chains with the previous position of the same two bytes */
+static long Head[65536];
+static long Prev[IN_SIZE_MAX];
+
+/* Parser state for every position. Cost is the number of bits needed to
+** encode the data up to this position, ending with literals (L) or with a
+** match (M).
+*/
+typedef struct {
+    long        Cost;
+    unsigned    From;           /* Position where the last command started */
+    unsigned    Offset;         /* Last offset */
+    unsigned char Rep;          /* For M: Match with the last offset */
+} Node;
+
+static Node L[IN_SIZE_MAX + 1];
+static Node M[IN_SIZE_MAX + 1];
+
+/* Commands as found by the parser, in reverse order */
+typedef struct {
+    unsigned    Len;
+    unsigned    Offset;         /* 0 for literals */
+    unsigned char Rep;
+} Command;
+
+static Command Cmds[IN_SIZE_MAX + 1];
+static unsigned CmdCount;
+
+
+
+static unsigned GammaBits (unsigned V)
+/* Return the number of bits of the gamma code for V */
+{
+    unsigned Bits = 1;
+    while (V > 1) {
+        Bits += 2;
+        V >>= 1;
+    }
+    return Bits;
+}
+
+
+
+static unsigned MatchLen (unsigned Pos, unsigned Offset)
+/* Return the length of the match at Pos with the given offset */
+{
+    unsigned Len = 0;
+    while (Pos + Len < InLen && In[Pos + Len] == In[Pos + Len - Offset]) {
+        ++Len;
+    }
+    return Len;
+}
+
+
+
+static void InitChains (void)
+/* Build the hash chains */
+{
+    unsigned I;
+
+    for (I = 0; I < 65536; ++I) {
+        Head[I] = -1;
+    }
+    for (I = 0; I + 1 < InLen; ++I) {
+        unsigned H = In[I] | (In[I + 1] << 8);
+        Prev[I] = Head[H];
+        Head[H] = I;
+    }
+}
+
+
+
+static unsigned FindMatches (unsigned Pos, unsigned* Offsets, unsigned* Lens)
+/* Find the matches at Pos. Each match is longer than the one before, and has
+** a larger offset. Return the number of matches.
+*/
+{
+    unsigned Count = 0;
+    unsigned Best = 1;
+    unsigned Chain = 0;
+    long P = Prev[Pos];
+
+    if (Pos + 1 >= InLen) {
+        return 0;
+    }
+    while (P >= 0 && Pos - P <= MAX_OFFSET && Chain++ < MAX_CHAIN) {
+        unsigned Offset = Pos - (unsigned) P;
+        if (Pos + Best >= InLen) {
+            break;
+        }
+        if (In[Pos + Best] == In[P + Best]) {
+            unsigned Len = MatchLen (Pos, Offset);
+            if (Len > Best) {
+                Offsets[Count] = Offset;
+                Lens[Count] = Len;
+                ++Count;
+                Best = Len;
+                if (Pos + Len == InLen) {
+                    break;
+                }
+            }
+        }
+        P = Prev[P];
+    }
+    return Count;
+}
+
+
+
+static void Relax (Node* N, long Cost, unsigned From, unsigned Offset,
+                   unsigned char Rep)
+/* Replace the node if the new cost is lower */
+{
+    if (Cost < N->Cost) {
+        N->Cost = Cost;
+        N->From = From;
+        N->Offset = Offset;
+        N->Rep = Rep;
+    }
+}
+
+
+
+static unsigned NextLen (unsigned Len, unsigned Max)
+/* Return the next match length to try. All short lengths are tried, longer
+** matches are only tried with their full length.
+*/
+{
+    if (Len < MAX_LEN_STEPS && Len < Max) {
+        return Len + 1;
+    }
+    return Len < Max ? Max : Max + 1;
+}
+
+
+
+static void Parse (void)
+/* Find the cheapest sequence of commands */
+{
+    static unsigned Offsets[MAX_CHAIN];
+    static unsigned Lens[MAX_CHAIN];
+    unsigned I, J, K;
+    unsigned FarPos = 0;
+    long FarCost = INFINITE;
+
+    for (I = 0; I <= InLen; ++I) {
+        L[I].Cost = M[I].Cost = INFINITE;
+    }
+    M[0].Cost = 0;
+    M[0].Offset = 1;
+
+    for (I = 0; I <= InLen; ++I) {
+
+        /* Literals ending here. Short runs are checked exactly, for longer
+        ** ones only the cheapest start is used.
+        */
+        if (I > MAX_LIT_EXACT) {
+            unsigned P = I - MAX_LIT_EXACT - 1;
+            if (M[P].Cost < INFINITE && M[P].Cost - 8L * P < FarCost) {
+                FarCost = M[P].Cost - 8L * P;
+                FarPos = P;
+            }
+            if (FarCost < INFINITE) {
+                Relax (&L[I], M[FarPos].Cost + 1 + GammaBits (I - FarPos) +
+                       8L * (I - FarPos), FarPos, M[FarPos].Offset, 0);
+            }
+        }
+        for (J = I > MAX_LIT_EXACT ? I - MAX_LIT_EXACT : 0; J < I; ++J) {
+            if (M[J].Cost < INFINITE) {
+                Relax (&L[I], M[J].Cost + 1 + GammaBits (I - J) + 8L * (I - J),
+                       J, M[J].Offset, 0);
+            }
+        }
+
+        if (I == InLen) {
+            break;
+        }
+
+        /* Matches with the last offset after literals */
+        if (L[I].Cost < INFINITE && L[I].Offset <= I) {
+            unsigned Max = MatchLen (I, L[I].Offset);
+            for (K = 1; K <= Max; K = NextLen (K, Max)) {
+                Relax (&M[I + K], L[I].Cost + 1 + GammaBits (K), I,
+                       L[I].Offset, 1);
+            }
+        }
+
+        /* Matches with a new offset */
+        if (L[I].Cost < INFINITE || M[I].Cost < INFINITE) {
+            long Base = (L[I].Cost < M[I].Cost ? L[I].Cost : M[I].Cost) + 1;
+            unsigned Count = FindMatches (I, Offsets, Lens);
+            unsigned Min = 2;
+            for (J = 0; J < Count; ++J) {
+                long OffsetCost = Base + 8 +
+                                  GammaBits (((Offsets[J] - 1) >> 8) + 1);
+                for (K = Min; K <= Lens[J]; K = NextLen (K, Lens[J])) {
+                    Relax (&M[I + K], OffsetCost + GammaBits (K - 1), I,
+                           Offsets[J], 0);
+                }
+                Min = Lens[J] + 1;
+            }
+        }
+    }
+
+    /* Collect the commands from the end */
+    CmdCount = 0;
+    I = InLen;
+    K = L[I].Cost < M[I].Cost;          /* 1 if ending with literals */
+    while (I > 0) {
+        Command* C = &Cmds[CmdCount++];
+        if (K) {
+            C->Len = I - L[I].From;
+            C->Offset = 0;
+            C->Rep = 0;
+            I = L[I].From;
+            K = 0;
+        } else {
+            C->Len = I - M[I].From;
+            C->Offset = M[I].Offset;
+            C->Rep = M[I].Rep;
+            J = M[I].From;
+            /* A match with the last offset follows literals, one with a new
+            ** offset follows the cheaper state as in Parse.
+            */
+            K = M[I].Rep || L[J].Cost < M[J].Cost;
+            I = J;
+        }
+    }
+}
+
+
+
+/* Bit writer */
+static unsigned BitPos;
+static unsigned char BitMask;
+
+
+
+static void PutByte (unsigned char B)
+{
+    Out[OutLen++] = B;
+}
+
+
+
+static void PutBit (unsigned Bit)
+{
+    if (BitMask == 0) {
+        BitPos = OutLen;
+        PutByte (0);
+        BitMask = 0x80;
+    }
+    if (Bit) {
+        Out[BitPos] |= BitMask;
+    }
+    BitMask >>= 1;
+}
+
+
+
+static void PutGamma (unsigned V)
+{
+    int Bit = 15;
+    while ((V >> Bit) == 0) {
+        --Bit;
+    }
+    while (--Bit >= 0) {
+        PutBit (0);
+        PutBit ((V >> Bit) & 1);
+    }
+    PutBit (1);
+}
+
+
+
+static unsigned Emit (void)
+/* Write the commands in lz65 format. Return the margin needed for in place
+** decompression.
+*/
+{
+    unsigned Pos = 0;
+    long MaxDiff = 0;
+    unsigned I, J;
+
+    OutLen = 0;
+    BitMask = 0;
+    for (I = CmdCount; I-- > 0; ) {
+        const Command* C = &Cmds[I];
+        if (C->Offset == 0) {
+            PutBit (0);
+            PutGamma (C->Len);
+            for (J = 0; J < C->Len; ++J) {
+                PutByte (In[Pos + J]);
+            }
+        } else if (C->Rep) {
+            PutBit (0);
+            PutGamma (C->Len);
+        } else {
+            PutBit (1);
+            PutGamma (((C->Offset - 1) >> 8) + 1);
+            PutByte ((C->Offset - 1) & 0xFF);
+            PutGamma (C->Len - 1);
+        }
+        Pos += C->Len;
+        /* The last byte written must be before the next byte read */
+        if ((long) Pos - (long) OutLen > MaxDiff) {
+            MaxDiff = (long) Pos - (long) OutLen;
+        }
+    }
+    PutBit (1);
+    PutGamma (256);
+
+    /* The compressed data starts at InLen + Margin - OutLen */
+    return (unsigned) (MaxDiff > (long) InLen - (long) OutLen ?
+                       MaxDiff - ((long) InLen - (long) OutLen) : 0);
+}
+
+
+
+static void PutLZ4Len (unsigned Len)
+/* Write the extra bytes of an LZ4 length */
+{
+    while (Len >= 255) {
+        PutByte (255);
+        Len -= 255;
+    }
+    PutByte (Len);
+}
+
+
+
+static void EmitLZ4 (void)
+/* Write a raw LZ4 block. The parse is greedy with one step lookahead. */
+{
+    static unsigned Offsets[MAX_CHAIN];
+    static unsigned Lens[MAX_CHAIN];
+    unsigned Pos = 0;
+    unsigned Anchor = 0;
+    unsigned Count;
+
+    OutLen = 0;
+    while (1) {
+        unsigned Len = 0;
+        unsigned Offset = 0;
+
+        /* The last match starts at least 12 bytes before the end, and the
+        ** last five bytes are always literals.
+        */
+        if (Pos + 12 <= InLen) {
+            Count = FindMatches (Pos, Offsets, Lens);
+            if (Count > 0 && Lens[Count - 1] >= 4) {
+                Len = Lens[Count - 1];
+                Offset = Offsets[Count - 1];
+                Count = FindMatches (Pos + 1, Offsets, Lens);
+                if (Count > 0 && Lens[Count - 1] > Len + 1) {
+                    ++Pos;
+                    continue;
+                }
+                if (Pos + Len > InLen - 5) {
+                    Len = InLen - 5 - Pos;
+                }
+            }
+        }
+        if (Len < 4 && Pos + 5 < InLen) {
+            ++Pos;
+            continue;
+        }
+        if (Len < 4) {
+            Pos = InLen;
+        }
+
+        /* Write the sequence */
+        {
+            unsigned Lits = Pos - Anchor;
+            unsigned Token = (Lits < 15 ? Lits : 15) << 4;
+            if (Len >= 4) {
+                Token |= Len - 4 < 15 ? Len - 4 : 15;
+            }
+            PutByte (Token);
+            if (Lits >= 15) {
+                PutLZ4Len (Lits - 15);
+            }
+            memcpy (Out + OutLen, In + Anchor, Lits);
+            OutLen += Lits;
+            if (Len < 4) {
+                break;
+            }
+            PutByte (Offset & 0xFF);
+            PutByte (Offset >> 8);
+            if (Len - 4 >= 15) {
+                PutLZ4Len (Len - 4 - 15);
+            }
+        }
+        Pos += Len;
+        Anchor = Pos;
+    }
+}
+
+
+
+int main (int argc, char* argv[])
+{
+    FILE* F;
+    int LZ4 = 0;
+    unsigned Margin = 0;
+
+    if (argc == 4 && strcmp (argv[1], "-4") == 0) {
+        LZ4 = 1;
+        ++argv;
+        --argc;
+    }
+    if (argc != 3) {
+        fprintf (stderr,
+                 "Compresses a file to the lz65 format.\n"
+                 "Usage: lz65 [-4] input_file compressed_file\n"
+                 "  -4  Write a raw LZ4 block instead\n");
+        return 3;
+    }
+
+    /* Read the input file */
+    F = fopen (argv[1], "rb");
+    if (F == NULL) {
+        perror (argv[1]);
+        return 1;
+    }
+    InLen = fread (In, 1, IN_SIZE_MAX, F);
+    if (fgetc (F) != EOF) {
+        fprintf (stderr, "lz65: %s is larger than %u bytes\n",
+                 argv[1], IN_SIZE_MAX);
+        return 1;
+    }
+    fclose (F);
+
+    /* Compress */
+    InitChains ();
+    if (LZ4) {
+        EmitLZ4 ();
+    } else {
+        Parse ();
+        Margin = Emit ();
+    }
+
+    /* Write the output */
+    F = fopen (argv[2], "wb");
+    if (F == NULL) {
+        perror (argv[2]);
+        return 1;
+    }
+    if (fwrite (Out, 1, OutLen, F) != OutLen || fclose (F) != 0) {
+        perror (argv[2]);
+        return 1;
+    }
+
+    /* Display a summary */
+    printf ("Compressed %s (%u bytes) to %s (%u bytes)\n",
+            argv[1], InLen, argv[2], OutLen);
+    if (!LZ4) {
+        printf ("In place decompression needs a margin of %u bytes\n", Margin);
+    }
+    return 0;
+}